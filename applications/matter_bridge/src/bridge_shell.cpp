@@ -7,6 +7,10 @@
 #include "bridge_manager.h"
 #include "platform/ConfigurationManager.h"
 
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+#include "report_coalescer.h"
+#endif
+
 #ifdef CONFIG_BRIDGED_DEVICE_BT
 #include "ble_bridged_device_factory.h"
 #include "ble_connectivity_manager.h"
@@ -125,6 +129,57 @@ static int RemoveBridgedDeviceHandler(const struct shell *shell, size_t argc, ch
 	return 0;
 }
 
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+static int ReportsStatsHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	chip::DeviceLayer::PlatformMgr().LockChipStack();
+	Nrf::ReportCoalescer::Stats stats = Nrf::ReportCoalescer::Instance().GetStats();
+	uint16_t pending = Nrf::ReportCoalescer::Instance().PendingCount();
+
+	if (argc > 1) {
+		if (strcmp(argv[1], "reset") != 0) {
+			chip::DeviceLayer::PlatformMgr().UnlockChipStack();
+			shell_fprintf(shell, SHELL_ERROR, "Error: Unknown argument\n");
+			return -EINVAL;
+		}
+		Nrf::ReportCoalescer::Instance().ResetStats();
+	}
+	chip::DeviceLayer::PlatformMgr().UnlockChipStack();
+
+	shell_fprintf(shell, SHELL_INFO, "Attribute changes: %u\n", stats.mUpdates);
+	shell_fprintf(shell, SHELL_INFO, "Reports sent: %u\n", stats.mSent);
+	shell_fprintf(shell, SHELL_INFO, "Reports suppressed: %u\n", stats.mSuppressed);
+	shell_fprintf(shell, SHELL_INFO, "Reports sent without coalescing: %u\n", stats.mOverflows);
+	shell_fprintf(shell, SHELL_INFO, "Reports pending: %u\n", pending);
+	return 0;
+}
+
+static int ReportsRateLimitHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	int err = 0;
+	unsigned long clusterId = shell_strtoul(argv[1], 0, &err);
+	unsigned long minIntervalMs = shell_strtoul(argv[2], 0, &err);
+
+	if (err || clusterId > UINT32_MAX || minIntervalMs > UINT32_MAX) {
+		shell_fprintf(shell, SHELL_ERROR, "Error: Invalid argument\n");
+		return -EINVAL;
+	}
+
+	chip::DeviceLayer::PlatformMgr().LockChipStack();
+	CHIP_ERROR result = Nrf::ReportCoalescer::Instance().SetRateLimit(static_cast<chip::ClusterId>(clusterId),
+									  static_cast<uint32_t>(minIntervalMs));
+	chip::DeviceLayer::PlatformMgr().UnlockChipStack();
+
+	if (result != CHIP_NO_ERROR) {
+		shell_fprintf(shell, SHELL_ERROR, "Error: Cannot set the rate limit\n");
+		return -ENOMEM;
+	}
+
+	shell_fprintf(shell, SHELL_INFO, "Done\n");
+	return 0;
+}
+#endif /* CONFIG_BRIDGE_REPORT_COALESCING */
+
 #ifdef CONFIG_BRIDGED_DEVICE_SIMULATED_ONOFF_SHELL
 static int SimulatedBridgedDeviceOnOffWriteHandler(const struct shell *shell, size_t argc, char **argv)
 {
@@ -265,6 +320,19 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		"Usage: remove <bridged_device_endpoint_id>\n"
 		"* bridged_device_endpoint_id - the bridged device's endpoint on which it was previously created\n",
 		RemoveBridgedDeviceHandler, 2, 0),
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+	SHELL_CMD_ARG(reports, NULL,
+		      "Prints the attribute report coalescing counters. \n"
+		      "Usage: reports [reset]\n"
+		      "* reset - the optional argument to reset the counters after printing them\n",
+		      ReportsStatsHandler, 1, 1),
+	SHELL_CMD_ARG(rate_limit, NULL,
+		      "Sets the minimum interval between reports of the cluster. \n"
+		      "Usage: rate_limit <cluster_id> <interval_ms>\n"
+		      "* cluster_id - the cluster ID, e.g. 0x0402 - Temperature Measurement\n"
+		      "* interval_ms - the minimum interval in milliseconds, 0 removes the limit\n",
+		      ReportsRateLimitHandler, 3, 0),
+#endif /* CONFIG_BRIDGE_REPORT_COALESCING */
 #ifdef CONFIG_BRIDGED_DEVICE_SIMULATED_ONOFF_SHELL
 	SHELL_CMD_ARG(
 		onoff, NULL,
@@ -9,6 +9,10 @@
 
 #include "binding/binding_handler.h"
 
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+#include "report_coalescer.h"
+#endif
+
 #include <app-common/zap-generated/ids/Clusters.h>
 #include <app/reporting/reporting.h>
 #include <app/util/endpoint-config-api.h>
@@ -126,6 +130,9 @@ CHIP_ERROR BridgeManager::RemoveBridgedDevice(uint16_t endpoint, uint8_t &device
 			auto &devicePair = mDevicesMap[index];
 			if (devicePair.mDevice->GetEndpointId() == endpoint) {
 				LOG_INF("Removed dynamic endpoint %d (index=%d)", endpoint, index);
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+				ReportCoalescer::Instance().Cancel(endpoint);
+#endif
 				/* Free dynamically allocated memory */
 				emberAfClearDynamicEndpoint(index);
 				devicesPairIndex = index;
@@ -142,6 +149,7 @@ CHIP_ERROR BridgeManager::SafelyRemoveDevice(uint8_t index)
 	uint16_t duplicatedItemKeys[kMaxBridgedDevices];
 	bool removeProvider = true;
 	auto &devicePair = mDevicesMap[index];
+	BridgedDeviceDataProvider *dataProvider = devicePair.mProvider;
 
 	uint8_t duplicatesNumber = mDevicesMap.GetDuplicatesCount(devicePair, duplicatedItemKeys);
 	/* There must be at least 2 duplicates in the map to determine the real duplicate,
@@ -166,7 +174,7 @@ CHIP_ERROR BridgeManager::SafelyRemoveDevice(uint8_t index)
 			}
 		}
 	}
-	if (mDevicesMap.Erase(index)) {
+	if (mDevicesMap.ErasePair(index, dataProvider)) {
 		if (removeProvider) {
 			mNumberOfProviders--;
 		}
@@ -202,11 +210,10 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 {
 	uint8_t index{ 0 };
 	CHIP_ERROR err;
-	uint16_t duplicatedItemKeys[kMaxBridgedDevices];
 	BridgedDevicePair pair(device, dataProvider);
 
-	/* Check if the current provider is already contained in the map - if so, there is at least one duplicate */
-	bool isNewProvider = (Instance().mDevicesMap.GetDuplicatesCount(pair, duplicatedItemKeys) == 0);
+	/* Check if the current provider is already bridged with other devices */
+	bool isNewProvider = !mDevicesMap.ContainsProvider(dataProvider);
 
 	if (isNewProvider) {
 		VerifyOrReturnError(mNumberOfProviders + 1 <= kMaxDataProviders, CHIP_ERROR_NO_MEMORY,
@@ -227,7 +234,7 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 			return CHIP_ERROR_INTERNAL;
 		}
 
-		if (!mDevicesMap.Insert(index, std::move(pair))) {
+		if (!mDevicesMap.InsertPair(index, std::move(pair))) {
 			return CHIP_ERROR_INTERNAL;
 		}
 
@@ -247,7 +254,7 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 			if (err == CHIP_ERROR_NO_MEMORY) {
 				LOG_ERR("The device object was not constructed properly due to the lack of memory");
 			}
-			mDevicesMap.Erase(index);
+			mDevicesMap.ErasePair(index, dataProvider);
 		}
 
 		return err;
@@ -255,7 +262,7 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 		while (index < kMaxBridgedDevices) {
 			/* Find the first empty index in the bridged devices list */
 			if (!mDevicesMap.Contains(index)) {
-				if (mDevicesMap.Insert(index, std::move(pair))) {
+				if (mDevicesMap.InsertPair(index, std::move(pair))) {
 					/* Assign the free endpoint ID. */
 					do {
 						err = CreateEndpoint(index, mCurrentDynamicEndpointId);
@@ -266,7 +273,7 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 							}
 							/* The pair was added to a map, so we have to take care about
 							 * removing it in case of failure. */
-							mDevicesMap.Erase(index);
+							mDevicesMap.ErasePair(index, dataProvider);
 						}
 
 						/* Handle wrap condition */
@@ -457,16 +464,23 @@ void BridgeManager::HandleUpdate(BridgedDeviceDataProvider &dataProvider, Cluste
 {
 	VerifyOrReturn(data);
 
+	auto &instance = Instance();
+	const auto *providerDevices = instance.mDevicesMap.GetProviderDevices(&dataProvider);
+
+	VerifyOrReturn(providerDevices);
+
 	/* The state update was triggered by non-Matter device, find bridged Matter device to update it as well.
 	 */
-	for (auto &item : Instance().mDevicesMap.mMap) {
-		if (item.value.mProvider == &dataProvider) {
-			/* If the Bridged Device state was updated successfully, schedule sending Matter data
-			 * report. */
-			auto *device = item.value.mDevice;
-			if (CHIP_NO_ERROR == device->HandleAttributeChange(clusterId, attributeId, data, dataSize)) {
-				MatterReportingAttributeChangeCallback(device->GetEndpointId(), clusterId, attributeId);
-			}
+	for (uint8_t i = 0; i < providerDevices->mCount; i++) {
+		/* If the Bridged Device state was updated successfully, schedule sending Matter data
+		 * report. */
+		auto *device = instance.mDevicesMap[providerDevices->mIndexes[i]].mDevice;
+		if (CHIP_NO_ERROR == device->HandleAttributeChange(clusterId, attributeId, data, dataSize)) {
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+			ReportCoalescer::Instance().Report(device->GetEndpointId(), clusterId, attributeId);
+#else
+			MatterReportingAttributeChangeCallback(device->GetEndpointId(), clusterId, attributeId);
+#endif
 		}
 	}
 }
@@ -485,9 +499,12 @@ void BridgeManager::HandleCommand(BridgedDeviceDataProvider &dataProvider, Clust
 	bindingData->ClusterId = clusterId;
 	bindingData->InvokeCommandFunc = invokeCommand;
 
-	for (auto &item : Instance().mDevicesMap.mMap) {
-		if (item.value.mProvider == &dataProvider) {
-			auto *device = item.value.mDevice;
+	auto &instance = Instance();
+	const auto *providerDevices = instance.mDevicesMap.GetProviderDevices(&dataProvider);
+
+	if (providerDevices) {
+		for (uint8_t i = 0; i < providerDevices->mCount; i++) {
+			auto *device = instance.mDevicesMap[providerDevices->mIndexes[i]].mDevice;
 
 			if (emberAfContainsClient(device->GetEndpointId(), clusterId)) {
 				bindingData->EndpointId = device->GetEndpointId();
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "report_coalescer.h"
+
+#include <app/reporting/reporting.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+
+namespace Nrf
+{
+
+void ReportCoalescer::Report(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId)
+{
+	mStats.mUpdates++;
+
+	for (uint16_t i = 0; i < mPendingCount; i++) {
+		if (mPending[i].mEndpointId == endpointId && mPending[i].mClusterId == clusterId &&
+		    mPending[i].mAttributeId == attributeId) {
+			/* The report will read the latest attribute value anyway. */
+			mStats.mSuppressed++;
+			return;
+		}
+	}
+
+	if (mPendingCount == kMaxPendingReports) {
+		/* Do not lose the change, report it right away as if coalescing was disabled. */
+		mStats.mOverflows++;
+		mStats.mSent++;
+		MatterReportingAttributeChangeCallback(endpointId, clusterId, attributeId);
+		return;
+	}
+
+	mPending[mPendingCount++] = { endpointId, clusterId, attributeId };
+	ScheduleFlush(kWindowMs);
+}
+
+void ReportCoalescer::Cancel(EndpointId endpointId)
+{
+	uint16_t kept = 0;
+
+	for (uint16_t i = 0; i < mPendingCount; i++) {
+		if (mPending[i].mEndpointId != endpointId) {
+			mPending[kept++] = mPending[i];
+		}
+	}
+
+	mPendingCount = kept;
+}
+
+CHIP_ERROR ReportCoalescer::SetRateLimit(ClusterId clusterId, uint32_t minIntervalMs)
+{
+	RateLimit *limit = FindRateLimit(clusterId);
+
+	if (minIntervalMs == 0) {
+		if (limit) {
+			*limit = mRateLimits[--mRateLimitsCount];
+		}
+
+		/* Do not keep the reports held back by the removed limit waiting for the rescheduled flush. */
+		if (mPendingCount > 0) {
+			ScheduleFlush(kWindowMs);
+		}
+		return CHIP_NO_ERROR;
+	}
+
+	if (!limit) {
+		VerifyOrReturnError(mRateLimitsCount < kMaxRateLimits, CHIP_ERROR_NO_MEMORY);
+
+		limit = &mRateLimits[mRateLimitsCount++];
+		*limit = {};
+		limit->mClusterId = clusterId;
+	}
+
+	limit->mMinIntervalMs = minIntervalMs;
+	return CHIP_NO_ERROR;
+}
+
+ReportCoalescer::RateLimit *ReportCoalescer::FindRateLimit(ClusterId clusterId)
+{
+	for (uint8_t i = 0; i < mRateLimitsCount; i++) {
+		if (mRateLimits[i].mClusterId == clusterId) {
+			return &mRateLimits[i];
+		}
+	}
+
+	return nullptr;
+}
+
+void ReportCoalescer::ScheduleFlush(uint32_t delayMs)
+{
+	const System::Clock::Timestamp deadline =
+		System::SystemClock().GetMonotonicTimestamp() + System::Clock::Milliseconds32(delayMs);
+
+	/* An earlier flush reschedules itself for the reports it has to leave pending. */
+	if (mFlushScheduled && mFlushDeadline <= deadline) {
+		return;
+	}
+
+	DeviceLayer::SystemLayer().CancelTimer(FlushTimerHandler, this);
+
+	CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(System::Clock::Milliseconds32(delayMs),
+							       FlushTimerHandler, this);
+	if (err != CHIP_NO_ERROR) {
+		LOG_ERR("Cannot start the report flush timer: %" CHIP_ERROR_FORMAT, err.Format());
+		mFlushScheduled = false;
+		Flush(true);
+		return;
+	}
+
+	mFlushScheduled = true;
+	mFlushDeadline = deadline;
+}
+
+void ReportCoalescer::Flush(bool force)
+{
+	const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+	System::Clock::Timestamp nextFlush = System::Clock::Timestamp::max();
+	uint16_t kept = 0;
+
+	/* Evaluate the rate limits once, so that all pending reports of a cluster are sent in the same pass. */
+	for (uint8_t i = 0; i < mRateLimitsCount; i++) {
+		RateLimit &limit = mRateLimits[i];
+		const System::Clock::Timestamp allowedAt =
+			limit.mLastFlush + System::Clock::Milliseconds32(limit.mMinIntervalMs);
+
+		limit.mAllowed = force || limit.mLastFlush == System::Clock::kZero || now >= allowedAt;
+		limit.mSent = false;
+
+		if (!limit.mAllowed && allowedAt < nextFlush) {
+			nextFlush = allowedAt;
+		}
+	}
+
+	for (uint16_t i = 0; i < mPendingCount; i++) {
+		PendingReport &report = mPending[i];
+		RateLimit *limit = FindRateLimit(report.mClusterId);
+
+		if (limit && !limit->mAllowed) {
+			mPending[kept++] = report;
+			continue;
+		}
+
+		MatterReportingAttributeChangeCallback(report.mEndpointId, report.mClusterId, report.mAttributeId);
+		mStats.mSent++;
+
+		if (limit) {
+			limit->mSent = true;
+		}
+	}
+
+	mPendingCount = kept;
+
+	for (uint8_t i = 0; i < mRateLimitsCount; i++) {
+		if (mRateLimits[i].mSent) {
+			mRateLimits[i].mLastFlush = now;
+		}
+	}
+
+	if (mPendingCount > 0) {
+		ScheduleFlush(std::chrono::duration_cast<System::Clock::Milliseconds32>(nextFlush - now).count());
+	}
+}
+
+void ReportCoalescer::FlushTimerHandler(System::Layer *systemLayer, void *appState)
+{
+	ReportCoalescer *coalescer = reinterpret_cast<ReportCoalescer *>(appState);
+	VerifyOrReturn(coalescer != nullptr);
+
+	coalescer->mFlushScheduled = false;
+	coalescer->Flush(false);
+}
+
+} /* namespace Nrf */
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+namespace Nrf
+{
+
+/*
+   ReportCoalescer collects the attribute changes reported by the bridged devices data providers and marks
+   them dirty for the Matter reporting engine in batches, instead of one by one.
+   All the changes reported within the coalescing window are deduplicated, so an attribute that changed
+   several times is reported only once with its latest value, and flushed in one pass on the Matter thread.
+   Reports of a cluster can additionally be rate limited, so that they are flushed no more often than
+   the configured minimum interval.
+   All methods must be called from the Matter thread or with the Matter stack lock held.
+*/
+class ReportCoalescer {
+public:
+	static constexpr uint16_t kMaxPendingReports = CONFIG_BRIDGE_REPORT_COALESCING_MAX_PENDING;
+	static constexpr uint8_t kMaxRateLimits = CONFIG_BRIDGE_REPORT_COALESCING_RATE_LIMITS_NUMBER;
+	static constexpr uint32_t kWindowMs = CONFIG_BRIDGE_REPORT_COALESCING_WINDOW_MS;
+
+	struct Stats {
+		/* Number of attribute changes reported by the data providers. */
+		uint32_t mUpdates;
+		/* Number of attribute changes passed to the Matter reporting engine. */
+		uint32_t mSent;
+		/* Number of attribute changes merged with the already pending change of the same attribute. */
+		uint32_t mSuppressed;
+		/* Number of attribute changes sent immediately because there was no space to queue them. */
+		uint32_t mOverflows;
+	};
+
+	/**
+	 * @brief Schedule sending Matter data report for the attribute.
+	 *
+	 * The report is sent when the coalescing window expires, or later if the cluster is rate limited.
+	 *
+	 * @param endpointId endpoint of the changed attribute
+	 * @param clusterId cluster of the changed attribute
+	 * @param attributeId changed attribute
+	 */
+	void Report(chip::EndpointId endpointId, chip::ClusterId clusterId, chip::AttributeId attributeId);
+
+	/**
+	 * @brief Drop all pending reports of the endpoint.
+	 *
+	 * @param endpointId endpoint which is being removed
+	 */
+	void Cancel(chip::EndpointId endpointId);
+
+	/**
+	 * @brief Set the minimum interval between consecutive reports of the cluster.
+	 *
+	 * The limit applies to all endpoints implementing the cluster.
+	 *
+	 * @param clusterId cluster to rate limit
+	 * @param minIntervalMs minimum interval in milliseconds, 0 removes the limit
+	 * @return CHIP_NO_ERROR on success
+	 * @return CHIP_ERROR_NO_MEMORY if the maximum number of rate limits has been reached
+	 */
+	CHIP_ERROR SetRateLimit(chip::ClusterId clusterId, uint32_t minIntervalMs);
+
+	const Stats &GetStats() const { return mStats; }
+	void ResetStats() { mStats = {}; }
+	uint16_t PendingCount() const { return mPendingCount; }
+
+	static ReportCoalescer &Instance()
+	{
+		static ReportCoalescer sInstance;
+		return sInstance;
+	}
+
+private:
+	struct PendingReport {
+		chip::EndpointId mEndpointId;
+		chip::ClusterId mClusterId;
+		chip::AttributeId mAttributeId;
+	};
+
+	struct RateLimit {
+		chip::ClusterId mClusterId;
+		uint32_t mMinIntervalMs;
+		chip::System::Clock::Timestamp mLastFlush;
+		/* Flush pass state, whether the cluster reports can be sent and whether any of them was sent. */
+		bool mAllowed;
+		bool mSent;
+	};
+
+	RateLimit *FindRateLimit(chip::ClusterId clusterId);
+	void ScheduleFlush(uint32_t delayMs);
+	void Flush(bool force);
+
+	static void FlushTimerHandler(chip::System::Layer *systemLayer, void *appState);
+
+	PendingReport mPending[kMaxPendingReports];
+	uint16_t mPendingCount{ 0 };
+	RateLimit mRateLimits[kMaxRateLimits];
+	uint8_t mRateLimitsCount{ 0 };
+	bool mFlushScheduled{ false };
+	chip::System::Clock::Timestamp mFlushDeadline;
+	Stats mStats{};
+};
+
+} /* namespace Nrf */
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include "util/hashed_finite_map.h"
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace Nrf
+{
+/*
+   BridgedDevicesMap template container keeps the pairs of bridged devices and their data providers under the
+   indexes assigned by the bridge, together with a reverse index from the data provider address to the indexes
+   of its bridged devices. It allows to find all bridged devices of a data provider in constant time, without
+   scanning the map.
+   The pairs are stored in the HashedFiniteMap base, which is available for lookups. The pairs must be added and
+   removed only with InsertPair() and ErasePair(), which keep the reverse index up to date.
+	Prerequisites:
+     * T must fulfill the HashedFiniteMap value requirements and have the mProvider member pointing to the data
+   provider.
+     * N must not exceed 256, as the indexes are stored in the reverse index on a single byte.
+*/
+template <typename T, uint16_t N, uint16_t NProviders, uint8_t NDevicesPerProvider>
+class BridgedDevicesMap : public HashedFiniteMap<uint16_t, T, N> {
+	using DevicesMap = HashedFiniteMap<uint16_t, T, N>;
+
+public:
+	static_assert(N <= UINT8_MAX + 1);
+
+	/* Indexes of the bridged devices that share the same data provider. */
+	struct ProviderDevices {
+		operator bool() const { return mCount > 0; }
+		bool operator==(const ProviderDevices &other)
+		{
+			return (mCount == other.mCount) && !memcmp(mIndexes, other.mIndexes, mCount);
+		}
+
+		uint8_t mIndexes[NDevicesPerProvider] = { 0 };
+		uint8_t mCount{ 0 };
+	};
+
+	/* Insert the pair under the given index, the pair is left untouched on failure. */
+	bool InsertPair(uint16_t index, T &&pair)
+	{
+		const uintptr_t providerKey = ProviderKey(pair.mProvider);
+		bool isNewProvider = !mProvidersMap.Contains(providerKey);
+
+		if (isNewProvider && !mProvidersMap.Insert(providerKey, ProviderDevices{})) {
+			return false;
+		}
+
+		auto &providerDevices = mProvidersMap[providerKey];
+
+		if (providerDevices.mCount >= NDevicesPerProvider || !DevicesMap::Insert(index, std::move(pair))) {
+			if (isNewProvider) {
+				mProvidersMap.Erase(providerKey);
+			}
+			return false;
+		}
+
+		providerDevices.mIndexes[providerDevices.mCount++] = index;
+		return true;
+	}
+
+	/* Erase the pair under the given index. The provider must be the one the pair was inserted with, it can differ
+	 * from the provider stored in the pair if the pair no longer owns the provider. */
+	bool ErasePair(uint16_t index, const void *provider)
+	{
+		const uintptr_t providerKey = ProviderKey(provider);
+
+		if (mProvidersMap.Contains(providerKey)) {
+			auto &providerDevices = mProvidersMap[providerKey];
+
+			for (uint8_t i = 0; i < providerDevices.mCount; i++) {
+				if (providerDevices.mIndexes[i] == index) {
+					/* The order of devices is not relevant, fill the gap with the last one. */
+					providerDevices.mIndexes[i] = providerDevices.mIndexes[--providerDevices.mCount];
+					break;
+				}
+			}
+
+			if (providerDevices.mCount == 0) {
+				mProvidersMap.Erase(providerKey);
+			}
+		}
+
+		return DevicesMap::Erase(index);
+	}
+
+	bool ContainsProvider(const void *provider) { return mProvidersMap.Contains(ProviderKey(provider)); }
+
+	/* Return the indexes of the bridged devices of the provider, or nullptr if the provider is not bridged. */
+	const ProviderDevices *GetProviderDevices(const void *provider)
+	{
+		const uintptr_t providerKey = ProviderKey(provider);
+
+		return mProvidersMap.Contains(providerKey) ? &mProvidersMap[providerKey] : nullptr;
+	}
+
+private:
+	/* Hide the base methods that would bypass the reverse index. */
+	using DevicesMap::Erase;
+	using DevicesMap::Insert;
+
+	static uintptr_t ProviderKey(const void *provider) { return reinterpret_cast<uintptr_t>(provider); }
+
+	HashedFiniteMap<uintptr_t, ProviderDevices, NProviders> mProvidersMap;
+};
+
+} /* namespace Nrf */
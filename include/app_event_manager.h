@@ -55,6 +55,11 @@ enum app_event_type_flags {
 	 */
 	APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE =
 		APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START,
+	/** dispatches events of this type through the high priority lane.
+	 *  Used only if @kconfig{CONFIG_APP_EVENT_MANAGER_PRIORITY_LANES} is enabled.
+	 *  Flag set by user.
+	 */
+	APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY,
 	/** shows number of predefined flags.*/
 	APP_EVENT_TYPE_FLAGS_COUNT,
 	/** marks beginning of user-specific flags.*/
@@ -90,6 +95,18 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
  */
 #define APP_EVENT_LISTENER(lname, cb_fn) _APP_EVENT_LISTENER(lname, cb_fn)
 
+/** @brief Create an event listener object that never consumes events.
+ *
+ * The value returned by the event handler function of such listener is ignored.
+ * Listeners that never consume events allow the Application Event Manager to notify
+ * subscribers without checking if the event was consumed
+ * (see @kconfig{CONFIG_APP_EVENT_MANAGER_DISPATCH_TABLE}).
+ *
+ * @param lname   Module name.
+ * @param cb_fn  Pointer to the event handler function.
+ */
+#define APP_EVENT_LISTENER_NO_CONSUME(lname, cb_fn) _APP_EVENT_LISTENER_NO_CONSUME(lname, cb_fn)
+
 
 /** @brief Subscribe a listener to an event type as first module that is
  *  being notified.
@@ -178,6 +195,27 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
 	_APP_EVENT_TYPE_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags)
 
 
+/** @brief Define an event type with a memory pool of the given size.
+ *
+ * This macro works like @ref APP_EVENT_TYPE_DEFINE, but it also sets the number of
+ * events of this type that can be allocated from the dedicated memory pool.
+ * The pool is used only if @kconfig{CONFIG_APP_EVENT_MANAGER_EVENT_POOLS} is enabled.
+ * Otherwise, the @p pool_size argument is ignored.
+ *
+ * @param ename     	   Name of the event.
+ * @param log_fn  	   Function to stringify an event of this type.
+ * @param ev_info_struct   Data structure describing the event type.
+ * @param app_event_type_flags Event type flags.
+ *                         You should use APP_EVENT_FLAGS_CREATE to define them.
+ * @param pool_size        Number of events in the memory pool. It must be an integer literal.
+ *                         Set to 0 to always allocate events of this type from heap.
+ */
+#define APP_EVENT_TYPE_DEFINE_WITH_POOL(ename, log_fn, ev_info_struct, app_event_type_flags,	\
+					pool_size)						\
+	_APP_EVENT_TYPE_DEFINE_WITH_POOL(ename, log_fn, ev_info_struct, app_event_type_flags,	\
+					 pool_size)
+
+
 /** @brief Verify if an event ID is valid.
  *
  * The pointer to an event type structure is used as its ID. This macro
@@ -197,6 +235,23 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
  */
 #define APP_EVENT_SUBMIT(event) _event_submit(&event->header)
 
+/** @brief Append an event to the list of events prepared for batched submission.
+ *
+ * @param list   Pointer to the list of events (sys_slist_t).
+ * @param event  Pointer to the event object.
+ */
+#define APP_EVENT_LIST_APPEND(list, event) sys_slist_append((list), &(event)->header.node)
+
+/** @brief Submit events in a batch.
+ *
+ * This helper macro submits the given events with a single call to
+ * @ref app_event_manager_submit_list. The events are processed in the order
+ * in which they are passed to the macro.
+ *
+ * @param ...  Comma-separated list of pointers to event objects.
+ */
+#define APP_EVENT_SUBMIT_BATCH(...) _APP_EVENT_SUBMIT_BATCH(__VA_ARGS__)
+
 /**
  * @brief Register event hook after the Application Event Manager is initialized.
  *
@@ -318,6 +373,19 @@ static inline size_t app_event_manager_event_size(const struct app_event_header
 #define APP_EVENT_HOOK_PREPROCESS_REGISTER(hook_fn) \
 	_APP_EVENT_HOOK_PREPROCESS_REGISTER(hook_fn, _APP_EM_SUBS_PRIO_ID(_APP_EM_SUBS_PRIO_NORMAL))
 
+/**
+ * @brief Register event hook on the start of processing of the given event type.
+ *
+ * The event hook called when an event of the given type is being processed.
+ * The hook function should have a form `void hook(const struct app_event_header *aeh)`.
+ *
+ * @param hook_fn Hook function.
+ * @param ename   Name of the event.
+ */
+#define APP_EVENT_HOOK_PREPROCESS_REGISTER_FOR_EVENT(hook_fn, ename)			\
+	_APP_EVENT_HOOK_PREPROCESS_REGISTER_FOR_EVENT(hook_fn, ename,			\
+		_APP_EM_SUBS_PRIO_ID(_APP_EM_SUBS_PRIO_NORMAL))
+
 /**
  * @brief Register event hook on the start of event processing. The hook would be called last.
  *
@@ -358,6 +426,19 @@ static inline size_t app_event_manager_event_size(const struct app_event_header
 	_APP_EVENT_HOOK_POSTPROCESS_REGISTER(hook_fn,	\
 	_APP_EM_SUBS_PRIO_ID(_APP_EM_SUBS_PRIO_NORMAL))
 
+/**
+ * @brief Register event hook on the end of processing of the given event type.
+ *
+ * The event hook called after an event of the given type is processed.
+ * The hook function should have a form `void hook(const struct app_event_header *aeh)`.
+ *
+ * @param hook_fn Hook function.
+ * @param ename   Name of the event.
+ */
+#define APP_EVENT_HOOK_POSTPROCESS_REGISTER_FOR_EVENT(hook_fn, ename)			\
+	_APP_EVENT_HOOK_POSTPROCESS_REGISTER_FOR_EVENT(hook_fn, ename,			\
+		_APP_EM_SUBS_PRIO_ID(_APP_EM_SUBS_PRIO_NORMAL))
+
 /**
  * @brief Register event hook on the end of event processing. The hook would be called last.
  *
@@ -380,6 +461,20 @@ static inline size_t app_event_manager_event_size(const struct app_event_header
  */
 int app_event_manager_init(void);
 
+/** @brief Submit a list of events.
+ *
+ * The events are queued with a single lock acquisition and the event processing
+ * is triggered once for the whole list. The order of processing and the calls of
+ * the submit hooks are the same as if the events were submitted one by one in the
+ * order of the list.
+ *
+ * Use @ref APP_EVENT_LIST_APPEND to prepare the list. After the call, the list is empty
+ * and the events must not be accessed by the caller.
+ *
+ * @param events  Pointer to the list of events.
+ */
+void app_event_manager_submit_list(sys_slist_t *events);
+
 /** @brief Allocate event.
  *
  * The behavior of this function depends on the actual implementation.
@@ -398,6 +493,10 @@ void *app_event_manager_alloc(size_t size);
  * The default implementation of this function is same as k_free.
  * It is annotated as weak and can be overridden by user.
  *
+ * Events allocated from the event type memory pools are returned to the pools
+ * by the Application Event Manager and are never passed to this function.
+ * Do not use it to free such events.
+ *
  * @param addr  Pointer to previously allocated memory.
  **/
 void app_event_manager_free(void *addr);
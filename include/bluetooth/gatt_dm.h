@@ -317,6 +317,33 @@ int bt_gatt_dm_continue(struct bt_gatt_dm *dm, void *context);
  */
 int bt_gatt_dm_data_release(struct bt_gatt_dm *dm);
 
+/** @brief Remove the discovery cache of a peer.
+ *
+ * The cache of a peer is validated against its Database Hash before every
+ * discovery and is removed when the bond with the peer is deleted. Call this
+ * function if the database of the peer is known to have changed in a different
+ * way, for example, when the Service Changed indication is received.
+ *
+ * The cache is removed in the discovery workqueue, so this function can be
+ * called from the Bluetooth callbacks.
+ *
+ * @param[in] addr Identity address of the peer.
+ *
+ * @retval 0 If the removal of the cache was queued.
+ * @retval -EINVAL If the address is NULL.
+ * @retval -ENOMEM If the removal queue is full.
+ */
+#ifdef CONFIG_BT_GATT_DM_CACHE
+int bt_gatt_dm_cache_invalidate(const bt_addr_le_t *addr);
+#else
+static inline int bt_gatt_dm_cache_invalidate(const bt_addr_le_t *addr)
+{
+	ARG_UNUSED(addr);
+
+	return 0;
+}
+#endif
+
 /** @brief Print service discovery data.
  *
  * This function prints GATT attributes that belong to the discovered service.
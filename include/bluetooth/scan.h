@@ -516,6 +516,36 @@ int bt_scan_filter_add(enum bt_scan_filter_type type,
  */
 void bt_scan_filter_remove_all(void);
 
+#if CONFIG_BT_SCAN_FILTER_STATS
+
+/**@brief Function for getting the hit counter of a filter.
+ *
+ * @details The hit counter of a filter is incremented each time the filter
+ *          matches an advertising report, also when the other filters
+ *          prevent the filter match event in the multifilter mode.
+ *          In the multifilter mode, the advertising data of a device
+ *          that does not match the address filter is not checked,
+ *          so it does not increment the counters of the other filters.
+ *
+ * @param[in] type Filter type.
+ * @param[in] idx Filter index. The filters of each type are indexed
+ *                in the order in which they were added.
+ * @param[out] hits Number of the advertising reports that matched the filter.
+ *
+ * @return 0 If the operation was successful. Otherwise, a (negative) error
+ *	     code is returned.
+ */
+int bt_scan_filter_hits_get(enum bt_scan_filter_type type, uint8_t idx,
+			    uint32_t *hits);
+
+/**@brief Function for resetting the hit counters of all filters.
+ *
+ * @note The counters are also reset when the filters are removed.
+ */
+void bt_scan_filter_hits_reset(void);
+
+#endif /* CONFIG_BT_SCAN_FILTER_STATS */
+
 #endif /* CONFIG_BT_SCAN_FILTER_ENABLE */
 
 /**@brief Function for changing the scanning parameters.
@@ -571,6 +601,68 @@ void bt_scan_blocklist_clear(void);
  */
 void bt_scan_update_connect_if_match(bool connect_if_match);
 
+#if CONFIG_BT_SCAN_DEDUP
+
+/**@brief Clear the advertising report deduplication table.
+ *
+ * @details Use this function to deliver the next advertising report
+ *          of each device, also if it repeats the previous one.
+ *          The table is also cleared when the filters are changed.
+ */
+void bt_scan_dedup_clear(void);
+
+#if CONFIG_BT_SCAN_CHANGED_DEVICES
+
+/**@brief Changed device information. */
+struct bt_scan_changed_device {
+	/** Device address. */
+	bt_addr_le_t addr;
+
+	/** Strength of the last advertising report in dBm. */
+	int8_t rssi;
+
+	/** Properties of the last advertising report.
+	 *  See @ref bt_gap_adv_prop.
+	 */
+	uint16_t adv_props;
+
+	/** Set to true if the last advertising report matched the filters. */
+	bool filter_match;
+};
+
+/**@brief Changed devices callback structure. */
+struct bt_scan_changed_devices_cb {
+	/**@brief Devices that advertised new data.
+	 *
+	 * @details The devices are collected from the advertising reports
+	 *          that are not dropped as duplicates and whose data is not
+	 *          in the deduplication table. Each device is reported once
+	 *          in a batch, with its last advertising report.
+	 *          The callback is called from the system workqueue.
+	 *
+	 * @param[in] devices Array of the changed devices.
+	 * @param[in] count Number of the changed devices.
+	 */
+	void (*changed)(const struct bt_scan_changed_device *devices,
+			size_t count);
+
+	sys_snode_t node;
+};
+
+/**@brief Register a changed devices callback.
+ *
+ * @details The batch of the changed devices is delivered
+ *          CONFIG_BT_SCAN_CHANGED_DEVICES_INTERVAL_MS milliseconds after
+ *          the first device in the batch changes.
+ *
+ * @param[in] cb Callback structure.
+ */
+void bt_scan_changed_devices_cb_register(struct bt_scan_changed_devices_cb *cb);
+
+#endif /* CONFIG_BT_SCAN_CHANGED_DEVICES */
+
+#endif /* CONFIG_BT_SCAN_DEDUP */
+
 #ifdef __cplusplus
 }
 #endif
@@ -31,6 +31,36 @@ struct data_fifo_msgq {
 	size_t size;
 };
 
+#if CONFIG_DATA_FIFO_SPSC
+
+#if defined(CONFIG_DCACHE_LINE_SIZE) && (CONFIG_DCACHE_LINE_SIZE > 0)
+#define DATA_FIFO_SPSC_ALIGN CONFIG_DCACHE_LINE_SIZE
+#else
+#define DATA_FIFO_SPSC_ALIGN 32
+#endif
+
+/* Indices used in the single-producer, single-consumer mode. The indices run
+ * from 0 to 2 * elements_max - 1, so that a full ring can be told apart from
+ * an empty one. The producer and consumer indices are kept in separate cache
+ * lines to avoid false sharing.
+ */
+struct data_fifo_spsc {
+	struct {
+		atomic_t alloc_idx;
+		atomic_t lock_idx;
+		atomic_t waiting;
+		struct k_sem space_sem;
+	} __aligned(DATA_FIFO_SPSC_ALIGN) producer;
+	struct {
+		atomic_t read_idx;
+		atomic_t free_idx;
+		atomic_t waiting;
+		struct k_sem data_sem;
+	} __aligned(DATA_FIFO_SPSC_ALIGN) consumer;
+};
+
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 struct data_fifo {
 	char *msgq_buffer;
 	char *slab_buffer;
@@ -39,6 +69,10 @@ struct data_fifo {
 	uint32_t elements_max;
 	size_t block_size_max;
 	bool initialized;
+#if CONFIG_DATA_FIFO_SPSC
+	bool spsc;
+	struct data_fifo_spsc ring;
+#endif
 };
 
 #define DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in)                                 \
@@ -52,6 +86,31 @@ struct data_fifo {
 				 .elements_max = elements_max_in,                                  \
 				 .initialized = false}
 
+#if CONFIG_DATA_FIFO_SPSC
+/**
+ * @brief Define a data_fifo working in the single-producer, single-consumer mode.
+ *
+ * The data_fifo uses a ring of blocks with atomic indices instead of a memory
+ * slab and a message queue. The API is the same as for the data_fifo defined with
+ * DATA_FIFO_DEFINE, with the following restrictions:
+ * - data_fifo_pointer_first_vacant_get and data_fifo_block_lock must be called
+ *   from a single context, and blocks must be locked in the order they were got.
+ * - data_fifo_pointer_last_filled_get and data_fifo_block_free must be called
+ *   from a single context, and blocks must be freed in the order they were got.
+ */
+#define DATA_FIFO_SPSC_DEFINE(name, elements_max_in, block_size_max_in)                            \
+	char __aligned(WB_UP(                                                                      \
+		1)) _msgq_buffer_##name[(elements_max_in) * sizeof(struct data_fifo_msgq)] = {0};  \
+	char __aligned(WB_UP(1)) _slab_buffer_##name[(elements_max_in) * (block_size_max_in)] = {  \
+		0};                                                                                \
+	struct data_fifo name = {.msgq_buffer = _msgq_buffer_##name,                               \
+				 .slab_buffer = _slab_buffer_##name,                               \
+				 .block_size_max = block_size_max_in,                              \
+				 .elements_max = elements_max_in,                                  \
+				 .initialized = false,                                             \
+				 .spsc = true}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 /**
  * @brief Get pointer to the first vacant block in slab.
  *
@@ -68,7 +127,9 @@ struct data_fifo {
  *	or K_FOREVER to wait as long as necessary.
  *
  * @retval 0		Memory allocated.
- * @retval value	Return values from k_mem_slab_alloc.
+ * @retval value	Return values from k_mem_slab_alloc. In the single-producer,
+ *			single-consumer mode, -ENOMEM if no block is vacant and
+ *			-EAGAIN if waiting period timed out.
  */
 int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 				       k_timeout_t timeout);
@@ -88,7 +149,9 @@ int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
  *
  * @retval 0		Block has been submitted to the message queue.
  * @retval -ENOMEM	The size parameter is larger than the block size max.
- * @retval -EINVAL	The supplied size is zero.
+ * @retval -EINVAL	The supplied size is zero. In the single-producer,
+ *			single-consumer mode, also if the block is not the oldest
+ *			block that is got and not locked.
  * @retval -ESPIPE	A generic return value if an error occurs in k_msg_put.
  *			Since data has already been added to the slab, there
  *			must be space in the message queue.
@@ -111,7 +174,9 @@ int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size);
  *	or K_FOREVER to wait as long as necessary.
  *
  * @retval 0		Memory pointer retrieved.
- * @retval value	Return values from k_msgq_get.
+ * @retval value	Return values from k_msgq_get. In the single-producer,
+ *			single-consumer mode, -ENOMSG if no block is filled and
+ *			-EAGAIN if waiting period timed out.
  */
 int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
 				      k_timeout_t timeout);
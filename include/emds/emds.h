@@ -23,6 +23,28 @@
 extern "C" {
 #endif
 
+/** Maximum length of the data of an entry. */
+#define EMDS_ENTRY_LEN_MAX 0x7fff
+
+/**
+ * @struct emds_entry_state
+ *
+ * Location of the entry data in the last loaded snapshot, used by the
+ * incremental snapshots. For internal use only.
+ */
+struct emds_entry_state {
+	/** Offset of the stored data in the partition. */
+	uint32_t data_off;
+	/** CRC of the stored data. */
+	uint32_t data_crc;
+	/** Length of the stored data. */
+	uint16_t len;
+	/** Whether the stored data matches the entry data. */
+	bool valid;
+	/** Whether the entry data has been modified since it was loaded. */
+	bool dirty;
+};
+
 /**
  * @struct emds_entry
  *
@@ -35,6 +57,8 @@ struct emds_entry {
 	uint8_t *data;
 	/** Length of data that will be stored. */
 	size_t len;
+	/** Entry state, set by the emergency data storage. */
+	struct emds_entry_state *state;
 };
 
 /**
@@ -46,6 +70,7 @@ struct emds_entry {
 struct emds_dynamic_entry {
 	struct emds_entry entry;
 	sys_snode_t node;
+	struct emds_entry_state state;
 };
 
 /**
@@ -60,10 +85,13 @@ struct emds_dynamic_entry {
  * This creates a variable _name prepended by emds_.
  */
 #define EMDS_STATIC_ENTRY_DEFINE(_name, _id, _data, _len)                      \
+	BUILD_ASSERT((_len) <= EMDS_ENTRY_LEN_MAX, "EMDS entry is too long");  \
+	static struct emds_entry_state emds_state_##_name;                     \
 	static const STRUCT_SECTION_ITERABLE(emds_entry, emds_##_name) = {     \
 		.id = _id,                                                     \
 		.data = (uint8_t *)_data,                                      \
 		.len = _len,                                                   \
+		.state = &emds_state_##_name,                                  \
 	}
 
 /**
@@ -110,6 +138,24 @@ int emds_init(emds_store_cb_t cb);
  */
 int emds_entry_add(struct emds_dynamic_entry *entry);
 
+/**
+ * @brief Mark the entry data as modified.
+ *
+ * With @kconfig{CONFIG_EMDS_INCREMENTAL}, only the entries that are marked
+ * as modified since the last call to @ref emds_load are stored in full by
+ * @ref emds_store. The other entries are stored as references to their data
+ * in the previous snapshots. The application must call this function every
+ * time the data of an entry changes. Without
+ * @kconfig{CONFIG_EMDS_INCREMENTAL}, all entries are stored in full and this
+ * function has no effect.
+ *
+ * This function can be called from an interrupt context.
+ *
+ * @param entry Static entry, or the entry of a dynamic entry added with
+ *              @ref emds_entry_add.
+ */
+void emds_entry_dirty_set(const struct emds_entry *entry);
+
 /**
  * @brief Start the emergency data storage process.
  *
@@ -143,6 +189,9 @@ int emds_store(void);
  * called before the @ref emds_prepare function which will delete all the
  * previously stored data.
  *
+ * With @kconfig{CONFIG_EMDS_INCREMENTAL} enabled, an entry whose data referenced
+ * by the snapshot is corrupted is not loaded, and its data is left unchanged.
+ *
  * @retval 0 Success
  * @retval -ECANCELED errno code if it was called before @ref emds_init
  * @retval -ENOENT errno code if no valid snapshot was found in any partition
@@ -186,6 +235,11 @@ int emds_prepare(void);
  * registered in the entries. This value is dependent on the chip used, and
  * should be checked against the chip datasheet.
  *
+ * With @kconfig{CONFIG_EMDS_INCREMENTAL}, after @ref emds_prepare has been
+ * called, the estimate only covers the entries that are currently marked as
+ * modified, and the references to the other entries. Marking more entries as
+ * modified increases the estimate, up to the time it takes to store all data.
+ *
  * @param store_time_us Pointer to a variable where the estimated time (in microseconds)
  *                      will be stored.
  *
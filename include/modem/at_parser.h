@@ -36,6 +36,23 @@ enum at_parser_cmd_type {
 	AT_PARSER_CMD_TYPE_TEST
 };
 
+/**
+ * @brief AT parser token
+ *
+ * Entry of the token table filled by @ref at_parser_index.
+ * The content is internal to the AT parser.
+ */
+struct at_parser_token {
+	/* Offset of the token from the beginning of the indexed AT command string. */
+	uint16_t offset;
+	/* Length of the token, or number of tokens in the line for a line entry. */
+	uint16_t len;
+	/* Type of the token. */
+	uint8_t type;
+	/* Variant of the token, or the error terminating the line for a line entry. */
+	uint8_t var;
+};
+
 /**
  * @brief AT parser
  *
@@ -53,6 +70,12 @@ struct at_parser {
 	bool is_next_empty;
 	/* Sentinel value for determining initialization state. */
 	uint32_t init_sentinel;
+	/* Token table of the indexed AT command string, NULL if not indexed. */
+	const struct at_parser_token *tokens;
+	/* Pointer to the indexed AT command string. */
+	const char *str;
+	/* Position of the current AT command line in the token table. */
+	size_t line;
 };
 
 /**
@@ -99,6 +122,32 @@ struct at_parser {
  */
 int at_parser_init(struct at_parser *parser, const char *at);
 
+/**
+ * @brief Tokenize the AT command string of an AT parser into a token table.
+ *
+ * The AT command string is tokenized once, from the current AT command line to the end.
+ * Afterwards, the values of any index and the subsequent AT command lines are accessed in
+ * constant time, instead of parsing the AT command line up to the requested index.
+ * This is useful for long, multiline AT command strings, or when the values are not retrieved in
+ * order of their indices.
+ *
+ * The token table needs one entry per value and one entry per AT command line.
+ * It must stay valid as long as @p parser is used.
+ * If the function fails, @p parser stays usable without the token table.
+ *
+ * @param[in] parser A pointer to the AT parser.
+ * @param[in] tokens A pointer to the token table.
+ * @param[in] count  Number of entries in the token table.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ * @retval -EINVAL One or more of the supplied parameters are invalid.
+ * @retval -EPERM  @p parser has not been initialized.
+ * @retval -ENOMEM The token table is too small.
+ * @retval -E2BIG  The AT command string is longer than 65535 characters.
+ */
+int at_parser_index(struct at_parser *parser, struct at_parser_token *tokens, size_t count);
+
 /**
  * @brief Move the cursor of an AT parser to the next command line of its configured AT command
  *        string.
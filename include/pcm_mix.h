@@ -29,13 +29,26 @@ enum pcm_mix_mode {
 	B_MONO_INTO_A_STEREO_R,
 };
 
+/** Gain of a stream that is mixed without attenuation or amplification. */
+#define PCM_MIX_GAIN_UNITY 0x8000
+
+/**
+ * @brief Stream mixed by pcm_mix_gain.
+ */
+struct pcm_mix_stream {
+	/** Pointer to the PCM data buffer. The stream is skipped if NULL. */
+	void const *pcm;
+	/** Gain in the Q1.15 format, see @ref PCM_MIX_GAIN_UNITY. */
+	uint16_t gain;
+};
+
 /**
  * @brief Mixes two buffers of PCM data.
  *
  * @note Uses simple addition with hard clip protection.
  * Input can be mono or stereo as long as the inputs match.
  * By selecting the mix mode, mono can also be mixed into a stereo buffer.
- * Hard coded for the signed 16-bit PCM.
+ * Hard coded for the signed 16-bit PCM, see pcm_mix_bit_depth for other bit depths.
  *
  * @param pcm_a         [in/out] Pointer to the PCM data buffer A.
  * @param size_a        [in]     Size of the PCM data buffer A (in bytes).
@@ -52,6 +65,47 @@ enum pcm_mix_mode {
 int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
 	    enum pcm_mix_mode mix_mode);
 
+/**
+ * @brief Mixes two buffers of PCM data with the given bit depth.
+ *
+ * @note Same as pcm_mix, but supports signed 16-bit, 24-bit and 32-bit PCM.
+ * 24-bit samples are carried in 32-bit words and must be sign extended.
+ *
+ * @param pcm_a         [in/out] Pointer to the PCM data buffer A.
+ * @param size_a        [in]     Size of the PCM data buffer A (in bytes).
+ * @param pcm_b         [in]     Pointer to the PCM data buffer B.
+ * @param size_b        [in]     Size of the PCM data buffer B (in bytes).
+ * @param mix_mode      [in]     Mixing mode according to pcm_mix_mode.
+ * @param pcm_bit_depth [in]     Bit depth of PCM samples (16, 24, or 32).
+ *
+ * @retval 0            Success. Result stored in pcm_a.
+ * @retval -EINVAL      pcm_a is NULL, size_a = 0 or the bit depth is not supported.
+ * @retval -EPERM       Either size_b < size_a (for stereo to stereo, mono to mono)
+ *			or size_a/2 < size_b (for mono to stereo mix).
+ * @retval -ESRCH       Invalid mixing mode.
+ */
+int pcm_mix_bit_depth(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+		      enum pcm_mix_mode mix_mode, uint8_t pcm_bit_depth);
+
+/**
+ * @brief Mixes multiple buffers of PCM data with gain applied to each of them.
+ *
+ * @note All buffers are mixed in a single pass and the result is clipped once.
+ * All streams must have the same layout and be at least of the output buffer size.
+ * The output buffer can be one of the streams.
+ *
+ * @param pcm_out       [out]    Pointer to the output PCM data buffer.
+ * @param size          [in]     Size of the output PCM data buffer (in bytes).
+ * @param streams       [in]     Streams to mix.
+ * @param stream_cnt    [in]     Number of streams. If zero, the output is silence.
+ * @param pcm_bit_depth [in]     Bit depth of PCM samples (16, 24, or 32).
+ *
+ * @retval 0            Success. Result stored in pcm_out.
+ * @retval -EINVAL      pcm_out or streams is NULL, size = 0 or the bit depth is not supported.
+ */
+int pcm_mix_gain(void *const pcm_out, size_t size, struct pcm_mix_stream const *const streams,
+		 size_t stream_cnt, uint8_t pcm_bit_depth);
+
 /**
  * @}
  */
@@ -42,7 +42,11 @@
 /** Filter types supported by the sample rate converter */
 enum sample_rate_converter_filter {
 	SAMPLE_RATE_FILTER_TEST = 1,
-	SAMPLE_RATE_FILTER_SIMPLE
+	SAMPLE_RATE_FILTER_SIMPLE,
+	/* Polyphase resampler for arbitrary sample rates, see
+	 * CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE.
+	 */
+	SAMPLE_RATE_FILTER_POLYPHASE
 };
 
 /**
@@ -77,6 +81,49 @@ enum sample_rate_converter_filter {
 #define SAMPLE_RATE_CONVERTER_RINGBUF_SIZE   0
 #endif
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+/**
+ * Size of the polyphase resampler history buffer in samples. Between process calls the buffer
+ * holds less than CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_MAX_TAPS samples, and a full block is
+ * appended to them.
+ */
+#define SAMPLE_RATE_CONVERTER_POLYPHASE_BUF_SIZE                                                   \
+	(CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_MAX_TAPS + CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX)
+
+/** State of the polyphase resampler */
+struct sample_rate_converter_polyphase {
+	/* Position of the next output sample in the history buffer, in input samples (Q32.32). */
+	uint64_t time;
+
+	/* Distance between two output samples in input samples (Q32.32), without and with the
+	 * drift compensation applied.
+	 */
+	uint64_t step_nominal;
+	uint64_t step;
+
+	/* Drift compensation in parts per billion, see sample_rate_converter_ratio_adjust(). */
+	int32_t adjust_ppb;
+
+	/* Distance between two input samples in filter table entries (Q16.16). */
+	uint32_t table_step;
+
+	/* Gain applied to the filter output (Q16.16), scales the filter for downsampling. */
+	uint32_t gain;
+
+	/* Number of input samples on each side of an output sample used by the filter. */
+	uint16_t wing;
+
+	/* Number of samples in the history buffer. */
+	uint16_t buf_samples;
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	int16_t buf[SAMPLE_RATE_CONVERTER_POLYPHASE_BUF_SIZE];
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	int32_t buf[SAMPLE_RATE_CONVERTER_POLYPHASE_BUF_SIZE];
+#endif
+};
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 /** Buffer used for storing input bytes to the sample rate converter */
 struct buf_ctx {
 	uint8_t buf[SAMPLE_RATE_CONVERTER_INPUT_BUF_SIZE];
@@ -123,6 +170,11 @@ struct sample_rate_converter_ctx {
 #elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
 	q31_t state_buf_31[SAMPLE_RATE_CONVERTER_STATE_BUFFER_SIZE];
 #endif
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+	/* State of the polyphase resampler, used with SAMPLE_RATE_FILTER_POLYPHASE. */
+	struct sample_rate_converter_polyphase polyphase;
+#endif
 };
 
 /**
@@ -161,6 +213,11 @@ int sample_rate_converter_open(struct sample_rate_converter_ctx *ctx);
  * @param[out]		output_written		Number of bytes written to output.
  * @param[in]		output_sample_rate	Sample rate of output.
  *
+ * @note	With SAMPLE_RATE_FILTER_POLYPHASE any pair of sample rates can be used, and the
+ *		number of output samples can differ by one between calls, depending on the
+ *		fractional position of the resampler. The output buffer must be able to hold the
+ *		rounded up number of output samples.
+ *
  * @retval	0	On success.
  * @retval	-EINVAL	Invalid parameters for sample rate conversion.
  * @retval	-EFAULT	Output ring buffer has either not enough bytes to output, or not enough
@@ -172,6 +229,25 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 				  size_t output_size, size_t *output_written,
 				  uint32_t output_sample_rate);
 
+/**
+ * @brief	Adjust the conversion ratio of the polyphase resampler.
+ *
+ * @details	Compensates for drift between the input and the output clock, for example between
+ *		the I2S and the Bluetooth LE ISO clock. A positive adjustment makes the resampler
+ *		consume input samples faster, so fewer output samples are produced from the same
+ *		input. The adjustment is kept when the sample rates change, and can be changed
+ *		between any two process calls without discontinuities in the output.
+ *
+ * @param[in,out]	ctx		Pointer to the sample rate conversion context.
+ * @param[in]		adjust_ppb	Adjustment of the conversion ratio in parts per billion.
+ *
+ * @retval	0		On success.
+ * @retval	-EINVAL		NULL pointer given for context, or adjustment larger than
+ *				CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_MAX_ADJUST_PPM.
+ * @retval	-ENOTSUP	Polyphase resampler is not enabled.
+ */
+int sample_rate_converter_ratio_adjust(struct sample_rate_converter_ctx *ctx, int32_t adjust_ppb);
+
 /**
  * @}
  */
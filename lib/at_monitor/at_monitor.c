@@ -11,12 +11,22 @@
 #include <nrf_modem_at.h>
 #include <modem/at_monitor.h>
 #include <zephyr/toolchain.h>
+#include <zephyr/sys/iterable_sections.h>
 #include <zephyr/logging/log.h>
 
 LOG_MODULE_REGISTER(at_monitor, CONFIG_AT_MONITOR_LOG_LEVEL);
 
+#if defined(CONFIG_AT_MONITOR_MATCHER)
+#define MATCH_WORDS DIV_ROUND_UP(CONFIG_AT_MONITOR_MATCHER_MONITORS_MAX, 32)
+#define MATCH_NONE UINT16_MAX
+#endif
+
 struct at_notif_fifo {
 	void *fifo_reserved;
+#if defined(CONFIG_AT_MONITOR_MATCHER)
+	bool indexed; /* Whether the monitors matched in ISR are set */
+	uint32_t matched[MATCH_WORDS]; /* Monitors matched in ISR, by section index */
+#endif
 	char data[]; /* Null-terminated AT notification string */
 };
 
@@ -41,6 +51,208 @@ static bool has_match(const struct at_monitor_entry *mon, const char *notif)
 	return (mon->filter == ANY || strstr(notif, mon->filter));
 }
 
+#if defined(CONFIG_AT_MONITOR_MATCHER)
+/* Aho-Corasick automaton over the monitor filters, to match a notification
+ * against all filters in a single pass.
+ * Node 0 is the root. The root is never a child and never ends a filter,
+ * so 0 also means "none" in the child, sibling and out fields.
+ */
+struct matcher_node {
+	uint16_t child;   /* First child */
+	uint16_t sibling; /* Next sibling */
+	uint16_t fail;    /* Longest proper suffix that is also a node */
+	uint16_t out;     /* Closest node ending a filter on the fail chain, self included */
+	uint16_t mon;     /* First monitor whose filter ends here, or MATCH_NONE */
+	uint8_t depth;
+	char c;
+};
+
+static struct {
+	bool ready;
+	uint8_t depth_max;
+	uint16_t node_cnt;
+	/* Next monitor with the same filter, chained from matcher_node.mon */
+	uint16_t mon_next[CONFIG_AT_MONITOR_MATCHER_MONITORS_MAX];
+	/* Monitors matching any notification */
+	uint32_t any[MATCH_WORDS];
+	/* Characters the filters start with, to skip the others quickly */
+	uint32_t first[256 / 32];
+	struct matcher_node nodes[CONFIG_AT_MONITOR_MATCHER_NODES];
+} matcher;
+
+static uint16_t matcher_child(uint16_t node, char c)
+{
+	uint16_t n;
+
+	for (n = matcher.nodes[node].child; n; n = matcher.nodes[n].sibling) {
+		if (matcher.nodes[n].c == c) {
+			break;
+		}
+	}
+
+	return n;
+}
+
+static int matcher_insert(const char *filter, uint16_t mon)
+{
+	uint16_t node = 0;
+	uint16_t next;
+
+	for (const char *c = filter; *c; c++) {
+		next = matcher_child(node, *c);
+		if (!next) {
+			if (matcher.node_cnt == ARRAY_SIZE(matcher.nodes) ||
+			    matcher.nodes[node].depth == UINT8_MAX) {
+				return -ENOMEM;
+			}
+
+			next = matcher.node_cnt++;
+			matcher.nodes[next] = (struct matcher_node){
+				.sibling = matcher.nodes[node].child,
+				.mon = MATCH_NONE,
+				.depth = matcher.nodes[node].depth + 1,
+				.c = *c,
+			};
+			matcher.nodes[node].child = next;
+			matcher.depth_max = MAX(matcher.depth_max, matcher.nodes[next].depth);
+		}
+		node = next;
+	}
+
+	matcher.mon_next[mon] = matcher.nodes[node].mon;
+	matcher.nodes[node].mon = mon;
+
+	return 0;
+}
+
+static void matcher_link(void)
+{
+	/* Link the nodes level by level, so that the fail node of a node,
+	 * which is shallower, is already linked. This runs once, on few nodes.
+	 */
+	for (uint8_t depth = 0; depth < matcher.depth_max; depth++) {
+		for (uint16_t u = 0; u < matcher.node_cnt; u++) {
+			if (matcher.nodes[u].depth != depth) {
+				continue;
+			}
+
+			for (uint16_t v = matcher.nodes[u].child; v; v = matcher.nodes[v].sibling) {
+				struct matcher_node *node = &matcher.nodes[v];
+				uint16_t f = matcher.nodes[u].fail;
+
+				if (u != 0) {
+					while (f && !matcher_child(f, node->c)) {
+						f = matcher.nodes[f].fail;
+					}
+					node->fail = matcher_child(f, node->c);
+				}
+
+				node->out = (node->mon != MATCH_NONE) ? v : matcher.nodes[node->fail].out;
+			}
+		}
+	}
+}
+
+/* Number of nodes needed if the filters share no prefixes, root included. */
+static size_t matcher_nodes_max(size_t count)
+{
+	struct at_monitor_entry *e;
+	size_t nodes = 1;
+
+	for (size_t i = 0; i < count; i++) {
+		STRUCT_SECTION_GET(at_monitor_entry, i, &e);
+		if (e->filter != ANY) {
+			nodes += strlen(e->filter);
+		}
+	}
+
+	return nodes;
+}
+
+static int matcher_build(void)
+{
+	struct at_monitor_entry *e;
+	size_t count;
+	int err;
+
+	STRUCT_SECTION_COUNT(at_monitor_entry, &count);
+	if (count > CONFIG_AT_MONITOR_MATCHER_MONITORS_MAX) {
+		LOG_WRN("%zu monitors do not fit the matcher, "
+			"increase CONFIG_AT_MONITOR_MATCHER_MONITORS_MAX", count);
+		return -ENOMEM;
+	}
+
+	matcher.node_cnt = 1;
+	matcher.nodes[0].mon = MATCH_NONE;
+
+	for (size_t i = 0; i < count; i++) {
+		STRUCT_SECTION_GET(at_monitor_entry, i, &e);
+
+		/* An empty filter is found in any notification, too */
+		if (e->filter == ANY || e->filter[0] == '\0') {
+			matcher.any[i / 32] |= BIT(i % 32);
+			continue;
+		}
+
+		err = matcher_insert(e->filter, i);
+		if (err) {
+			LOG_WRN("Filters need up to %zu nodes, "
+				"increase CONFIG_AT_MONITOR_MATCHER_NODES", matcher_nodes_max(count));
+			return err;
+		}
+
+		matcher.first[(uint8_t)e->filter[0] / 32] |= BIT((uint8_t)e->filter[0] % 32);
+	}
+
+	matcher_link();
+
+	LOG_DBG("Matcher built, %zu monitors, %u nodes", count, matcher.node_cnt);
+
+	return 0;
+}
+
+/* Find the monitors whose filter is contained in the notification. */
+static void matcher_match(const char *notif, uint32_t matched[MATCH_WORDS])
+{
+	uint16_t node = 0;
+	uint8_t c;
+
+	memcpy(matched, matcher.any, sizeof(matcher.any));
+
+	for (; (c = *notif) != '\0'; notif++) {
+		if (!node && !(matcher.first[c / 32] & BIT(c % 32))) {
+			continue;
+		}
+
+		while (node && !matcher_child(node, c)) {
+			node = matcher.nodes[node].fail;
+		}
+		node = matcher_child(node, c);
+
+		for (uint16_t o = matcher.nodes[node].out; o;
+		     o = matcher.nodes[matcher.nodes[o].fail].out) {
+			for (uint16_t m = matcher.nodes[o].mon; m != MATCH_NONE;
+			     m = matcher.mon_next[m]) {
+				matched[m / 32] |= BIT(m % 32);
+			}
+		}
+	}
+}
+#endif /* CONFIG_AT_MONITOR_MATCHER */
+
+/* Check whether the i-th monitor matches the notification.
+ * Use the monitors matched in advance, if given.
+ */
+static bool is_match(const struct at_monitor_entry *mon, size_t i, const char *notif,
+		     const uint32_t *matched)
+{
+	if (matched) {
+		return matched[i / 32] & BIT(i % 32);
+	}
+
+	return has_match(mon, notif);
+}
+
 /* Dispatch AT notifications immediately, or schedules a workqueue task to do that.
  * Keep this function public so that it can be called by tests.
  * This function is called from an ISR.
@@ -50,12 +262,25 @@ void at_monitor_dispatch(const char *notif)
 	bool monitored;
 	struct at_notif_fifo *at_notif;
 	size_t sz_needed;
+	size_t i;
+	const uint32_t *matched = NULL;
+#if defined(CONFIG_AT_MONITOR_MATCHER)
+	uint32_t matched_buf[MATCH_WORDS];
+#endif
 
 	__ASSERT_NO_MSG(notif != NULL);
 
+#if defined(CONFIG_AT_MONITOR_MATCHER)
+	if (matcher.ready) {
+		matcher_match(notif, matched_buf);
+		matched = matched_buf;
+	}
+#endif
+
 	monitored = false;
+	i = 0;
 	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-		if (!is_paused(e) && has_match(e, notif)) {
+		if (!is_paused(e) && is_match(e, i, notif, matched)) {
 			if (is_direct(e)) {
 				LOG_DBG("Dispatching to %p (ISR)", e->handler);
 				e->handler(notif);
@@ -64,6 +289,7 @@ void at_monitor_dispatch(const char *notif)
 				monitored = true;
 			}
 		}
+		i++;
 	}
 
 	if (!monitored) {
@@ -80,6 +306,13 @@ void at_monitor_dispatch(const char *notif)
 		return;
 	}
 
+#if defined(CONFIG_AT_MONITOR_MATCHER)
+	/* Pass the match result along so that the notification is not matched again */
+	at_notif->indexed = (matched != NULL);
+	if (matched) {
+		memcpy(at_notif->matched, matched, sizeof(at_notif->matched));
+	}
+#endif
 	strcpy(at_notif->data, notif);
 
 	k_fifo_put(&at_monitor_fifo, at_notif);
@@ -89,15 +322,25 @@ void at_monitor_dispatch(const char *notif)
 static void at_monitor_task(struct k_work *work)
 {
 	struct at_notif_fifo *at_notif;
+	const uint32_t *matched;
+	size_t i;
 
 	while ((at_notif = k_fifo_get(&at_monitor_fifo, K_NO_WAIT))) {
-		/* Match notification with all monitors */
+		/* Match notification with all monitors, unless it was matched in ISR already */
 		LOG_DBG("AT notif: %.*s", strlen(at_notif->data) - strlen("\r\n"), at_notif->data);
+#if defined(CONFIG_AT_MONITOR_MATCHER)
+		matched = at_notif->indexed ? at_notif->matched : NULL;
+#else
+		matched = NULL;
+#endif
+		i = 0;
 		STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-			if (!is_paused(e) && !is_direct(e) && has_match(e, at_notif->data)) {
+			if (!is_paused(e) && !is_direct(e) &&
+			    is_match(e, i, at_notif->data, matched)) {
 				LOG_DBG("Dispatching to %p", e->handler);
 				e->handler(at_notif->data);
 			}
+			i++;
 		}
 		k_heap_free(&at_monitor_heap, at_notif);
 	}
@@ -107,6 +350,13 @@ static int at_monitor_sys_init(void)
 {
 	int err;
 
+#if defined(CONFIG_AT_MONITOR_MATCHER)
+	/* The filters are constant, so build the matcher before receiving notifications.
+	 * If they do not fit, each filter is searched in the notifications instead.
+	 */
+	matcher.ready = (matcher_build() == 0);
+#endif
+
 	err = nrf_modem_at_notif_handler_set(at_monitor_dispatch);
 	if (err) {
 		LOG_ERR("Failed to hook the dispatch function, err %d", err);
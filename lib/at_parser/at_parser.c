@@ -24,6 +24,16 @@
 #define MINUS_SIGN '-'
 /* Init Sentinel. */
 #define INIT_SENTINEL 0xc0ffee
+/* Double Quote. */
+#define QUOTE '"'
+/* Space. */
+#define SPACE ' '
+
+/* Word-at-a-time helpers, to find a byte in a word without testing each byte. */
+#define WORD_ONES (~0UL / 0xff)
+#define WORD_HIGHS (WORD_ONES * 0x80)
+#define WORD_HAS_ZERO(word) (((word) - WORD_ONES) & ~(word) & WORD_HIGHS)
+#define WORD_HAS_BYTE(word, byte) WORD_HAS_ZERO((word) ^ (WORD_ONES * (uint8_t)(byte)))
 
 enum at_num_type {
 	AT_NUM_TYPE_INT16,
@@ -120,6 +130,67 @@ static bool lookahead_crlf_or_more(const char *str)
 	return lookahead_crlf(str) || lookahead_crlf_and_more(str);
 }
 
+/* Find the first double quote or null terminator in the string. */
+static const char *quote_or_null_find(const char *str)
+{
+	const unsigned long *word;
+
+	/* Words are read aligned only, so that they never cross into another page. */
+	while (((uintptr_t)str % sizeof(unsigned long)) != 0) {
+		if (*str == QUOTE || *str == NULL_TERMINATOR) {
+			return str;
+		}
+		str++;
+	}
+
+	word = (const unsigned long *)str;
+	while (!WORD_HAS_ZERO(*word) && !WORD_HAS_BYTE(*word, QUOTE)) {
+		word++;
+	}
+
+	str = (const char *)word;
+	while (*str != QUOTE && *str != NULL_TERMINATOR) {
+		str++;
+	}
+
+	return str;
+}
+
+/* Match a quoted string subparameter.
+ * This is equivalent to at_match_subparam() for strings starting with an optional space and a
+ * double quote, but the closing double quote is searched for a word at a time.
+ * Quoted strings are the longest subparameters, for example in %NCELLMEAS or +COPS responses.
+ */
+static struct at_token at_match_quoted_str(const char *at, const char **remainder)
+{
+	const char *start = at;
+	const char *end;
+
+	if (*start == SPACE) {
+		start++;
+	}
+
+	/* Skip the opening double quote. */
+	start++;
+
+	end = quote_or_null_find(start);
+	if (*end != QUOTE) {
+		return (struct at_token){ .type = AT_TOKEN_TYPE_INVALID };
+	}
+
+	/* Skip the closing double quote and the trailing comma, if any. */
+	*remainder = end + 1;
+	if (**remainder == ',') {
+		(*remainder)++;
+	}
+
+	return (struct at_token){
+		.start = start, .len = end - start,
+		.type = AT_TOKEN_TYPE_QUOTED_STRING,
+		.var = *(*remainder - 1) == ',' ? AT_TOKEN_VAR_COMMA : AT_TOKEN_VAR_NO_COMMA
+	};
+}
+
 static void at_token_set_empty(struct at_token *token, const char *start)
 {
 	token->start = start;
@@ -189,6 +260,9 @@ static int at_parser_tok(struct at_parser *parser, struct at_token *token)
 
 	if (parser->count == 0) {
 		*token = at_match_cmd(parser->cursor, &remainder);
+	} else if (parser->cursor[0] == QUOTE ||
+		   (parser->cursor[0] == SPACE && parser->cursor[1] == QUOTE)) {
+		*token = at_match_quoted_str(parser->cursor, &remainder);
 	} else {
 		*token = at_match_subparam(parser->cursor, &remainder);
 	}
@@ -231,15 +305,41 @@ finalize:
 	return 0;
 }
 
+/* Get the token at the given index of the current line from the token table. */
+static int at_parser_indexed_get(struct at_parser *parser, size_t index, struct at_token *token)
+{
+	const struct at_parser_token *line = &parser->tokens[parser->line];
+	const struct at_parser_token *entry;
+
+	if (index >= line->len) {
+		/* The index is past the end of the line, return what terminated it. */
+		return -line->var;
+	}
+
+	entry = &parser->tokens[parser->line + 1 + index];
+
+	token->start = parser->str + entry->offset;
+	token->len = entry->len;
+	token->type = entry->type;
+	token->var = entry->var;
+
+	return 0;
+}
+
 /* Seek the AT parser cursor to the given index. */
 static int at_parser_seek(struct at_parser *parser, size_t index, struct at_token *token)
 {
 	int err;
 
+	if (parser->tokens) {
+		return at_parser_indexed_get(parser, index, token);
+	}
+
 	if (!is_index_ahead(parser, index)) {
 		/* Rewind parser. */
 		parser->cursor = parser->at;
 		parser->count = 0;
+		parser->is_next_empty = false;
 	}
 
 	do {
@@ -264,6 +364,97 @@ int at_parser_init(struct at_parser *parser, const char *at)
 	return 0;
 }
 
+int at_parser_index(struct at_parser *parser, struct at_parser_token *tokens, size_t count)
+{
+	int err;
+	size_t line;
+	size_t n = 0;
+	struct at_parser scan;
+	struct at_token token = {0};
+
+	if (!tokens) {
+		return -EINVAL;
+	}
+
+	err = at_parser_check(parser);
+	if (err) {
+		return err;
+	}
+
+	/* Tokenize with a copy of the parser, so that it is left untouched on failure. */
+	scan = *parser;
+	scan.tokens = NULL;
+	scan.cursor = scan.at;
+	scan.count = 0;
+	scan.is_next_empty = false;
+
+	while (true) {
+		if (n == count) {
+			return -ENOMEM;
+		}
+
+		/* Each line starts with an entry for the line itself. */
+		line = n++;
+		tokens[line] = (struct at_parser_token){ .offset = scan.at - parser->at };
+
+		while ((err = at_parser_tok(&scan, &token)) == 0) {
+			if (n == count) {
+				return -ENOMEM;
+			}
+
+			if (token.start + token.len - parser->at > UINT16_MAX) {
+				return -E2BIG;
+			}
+
+			tokens[n++] = (struct at_parser_token){
+				.offset = token.start - parser->at,
+				.len = token.len,
+				.type = token.type,
+				.var = token.var,
+			};
+		}
+
+		tokens[line].len = n - line - 1;
+		tokens[line].var = -err;
+
+		if (err != -EAGAIN) {
+			break;
+		}
+
+		/* Move to the next line, as in at_parser_cmd_next(). */
+		trim_crlf(&scan.cursor);
+		scan.count = 0;
+		scan.at = scan.cursor;
+
+		if (scan.at - parser->at > UINT16_MAX) {
+			return -E2BIG;
+		}
+	}
+
+	parser->tokens = tokens;
+	parser->str = parser->at;
+	parser->line = 0;
+
+	return 0;
+}
+
+/* Move to the next line in the token table. */
+static int at_parser_indexed_cmd_next(struct at_parser *parser)
+{
+	const struct at_parser_token *line = &parser->tokens[parser->line];
+
+	if (line->var != EAGAIN) {
+		return -EOPNOTSUPP;
+	}
+
+	parser->line += line->len + 1;
+	parser->at = parser->str + parser->tokens[parser->line].offset;
+	parser->cursor = parser->at;
+	parser->count = 0;
+
+	return 0;
+}
+
 int at_parser_cmd_next(struct at_parser *parser)
 {
 	int err;
@@ -274,6 +465,10 @@ int at_parser_cmd_next(struct at_parser *parser)
 		return err;
 	}
 
+	if (parser->tokens) {
+		return at_parser_indexed_cmd_next(parser);
+	}
+
 	do {
 		err = at_parser_tok(parser, &token);
 	} while (!err);
@@ -341,6 +536,13 @@ int at_parser_cmd_count_get(struct at_parser *parser, size_t *count)
 		return err;
 	}
 
+	if (parser->tokens) {
+		*count = parser->tokens[parser->line].len;
+		err = -parser->tokens[parser->line].var;
+
+		return (err == -EIO || err == -EAGAIN) ? 0 : err;
+	}
+
 	do {
 		err = at_parser_tok(parser, &token);
 	} while (!err);
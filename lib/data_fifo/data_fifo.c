@@ -41,6 +41,199 @@ static int msgq_slab_legal_used_elements(struct data_fifo *data_fifo, uint32_t *
 	return 0;
 }
 
+#if CONFIG_DATA_FIFO_SPSC
+
+static uint32_t spsc_idx_next(struct data_fifo *data_fifo, uint32_t idx)
+{
+	idx++;
+
+	return (idx == 2 * data_fifo->elements_max) ? 0 : idx;
+}
+
+static uint32_t spsc_idx_diff(struct data_fifo *data_fifo, uint32_t newer, uint32_t older)
+{
+	return (newer >= older) ? (newer - older) : (newer + 2 * data_fifo->elements_max - older);
+}
+
+static uint32_t spsc_slot(struct data_fifo *data_fifo, uint32_t idx)
+{
+	return (idx < data_fifo->elements_max) ? idx : (idx - data_fifo->elements_max);
+}
+
+static void *spsc_block_ptr(struct data_fifo *data_fifo, uint32_t idx)
+{
+	return data_fifo->slab_buffer + spsc_slot(data_fifo, idx) * data_fifo->block_size_max;
+}
+
+static struct data_fifo_msgq *spsc_entry(struct data_fifo *data_fifo, uint32_t idx)
+{
+	return &((struct data_fifo_msgq *)data_fifo->msgq_buffer)[spsc_slot(data_fifo, idx)];
+}
+
+static bool spsc_vacant(struct data_fifo *data_fifo)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	return spsc_idx_diff(data_fifo, atomic_get(&ring->producer.alloc_idx),
+			     atomic_get(&ring->consumer.free_idx)) < data_fifo->elements_max;
+}
+
+static bool spsc_filled(struct data_fifo *data_fifo)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	return atomic_get(&ring->consumer.read_idx) != atomic_get(&ring->producer.lock_idx);
+}
+
+/** @brief Waits until the condition is met.
+ *
+ * The waiter announces itself in the waiting flag before checking the condition
+ * for the last time, so the other side gives the semaphore only if someone waits.
+ */
+static int spsc_wait(struct data_fifo *data_fifo, bool (*cond)(struct data_fifo *),
+		     atomic_t *waiting, struct k_sem *sem, k_timeout_t timeout, int no_wait_err)
+{
+	k_timepoint_t end;
+	int ret;
+
+	if (cond(data_fifo)) {
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return no_wait_err;
+	}
+
+	end = sys_timepoint_calc(timeout);
+
+	while (true) {
+		atomic_set(waiting, 1);
+
+		if (cond(data_fifo)) {
+			atomic_set(waiting, 0);
+			return 0;
+		}
+
+		ret = k_sem_take(sem, sys_timepoint_timeout(end));
+		atomic_set(waiting, 0);
+
+		if (ret) {
+			return cond(data_fifo) ? 0 : -EAGAIN;
+		}
+	}
+}
+
+static void spsc_wake(atomic_t *waiting, struct k_sem *sem)
+{
+	if (atomic_get(waiting)) {
+		k_sem_give(sem);
+	}
+}
+
+static int spsc_first_vacant_get(struct data_fifo *data_fifo, void **data, k_timeout_t timeout)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	uint32_t alloc_idx;
+	int ret;
+
+	ret = spsc_wait(data_fifo, spsc_vacant, &ring->producer.waiting, &ring->producer.space_sem,
+			timeout, -ENOMEM);
+	if (ret) {
+		return ret;
+	}
+
+	alloc_idx = atomic_get(&ring->producer.alloc_idx);
+	*data = spsc_block_ptr(data_fifo, alloc_idx);
+	atomic_set(&ring->producer.alloc_idx, spsc_idx_next(data_fifo, alloc_idx));
+
+	return 0;
+}
+
+static int spsc_block_lock(struct data_fifo *data_fifo, void *data, size_t size)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	uint32_t lock_idx = atomic_get(&ring->producer.lock_idx);
+
+	if (lock_idx == atomic_get(&ring->producer.alloc_idx) ||
+	    data != spsc_block_ptr(data_fifo, lock_idx)) {
+		LOG_ERR("Block %p is not the oldest vacant block got", data);
+		return -EINVAL;
+	}
+
+	spsc_entry(data_fifo, lock_idx)->size = size;
+	atomic_set(&ring->producer.lock_idx, spsc_idx_next(data_fifo, lock_idx));
+
+	spsc_wake(&ring->consumer.waiting, &ring->consumer.data_sem);
+
+	return 0;
+}
+
+static int spsc_last_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
+				k_timeout_t timeout)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	uint32_t read_idx;
+	int ret;
+
+	ret = spsc_wait(data_fifo, spsc_filled, &ring->consumer.waiting, &ring->consumer.data_sem,
+			timeout, -ENOMSG);
+	if (ret) {
+		return ret;
+	}
+
+	read_idx = atomic_get(&ring->consumer.read_idx);
+	*data = spsc_block_ptr(data_fifo, read_idx);
+	*size = spsc_entry(data_fifo, read_idx)->size;
+	atomic_set(&ring->consumer.read_idx, spsc_idx_next(data_fifo, read_idx));
+
+	return 0;
+}
+
+static void spsc_block_free(struct data_fifo *data_fifo, void *data)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	uint32_t free_idx = atomic_get(&ring->consumer.free_idx);
+
+	if (free_idx == atomic_get(&ring->consumer.read_idx) ||
+	    data != spsc_block_ptr(data_fifo, free_idx)) {
+		LOG_ERR("Block %p is not the oldest filled block got", data);
+		__ASSERT_NO_MSG(false);
+		return;
+	}
+
+	atomic_set(&ring->consumer.free_idx, spsc_idx_next(data_fifo, free_idx));
+
+	spsc_wake(&ring->producer.waiting, &ring->producer.space_sem);
+}
+
+static void spsc_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num,
+			      uint32_t *locked_num)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	uint32_t read_idx = atomic_get(&ring->consumer.read_idx);
+	uint32_t free_idx = atomic_get(&ring->consumer.free_idx);
+
+	/* Producer indices are read after consumer ones, so the numbers are never negative. */
+	*locked_num = spsc_idx_diff(data_fifo, atomic_get(&ring->producer.lock_idx), read_idx);
+	*alloced_num = spsc_idx_diff(data_fifo, atomic_get(&ring->producer.alloc_idx), free_idx);
+}
+
+static void spsc_init(struct data_fifo *data_fifo)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	atomic_set(&ring->producer.alloc_idx, 0);
+	atomic_set(&ring->producer.lock_idx, 0);
+	atomic_set(&ring->producer.waiting, 0);
+	atomic_set(&ring->consumer.read_idx, 0);
+	atomic_set(&ring->consumer.free_idx, 0);
+	atomic_set(&ring->consumer.waiting, 0);
+	k_sem_init(&ring->producer.space_sem, 0, 1);
+	k_sem_init(&ring->consumer.data_sem, 0, 1);
+}
+
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 				       k_timeout_t timeout)
 {
@@ -48,6 +241,12 @@ int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc) {
+		return spsc_first_vacant_get(data_fifo, data, timeout);
+	}
+#endif
+
 	ret = k_mem_slab_alloc(&data_fifo->mem_slab, data, timeout);
 	return ret;
 }
@@ -66,6 +265,12 @@ int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
 		return -EINVAL;
 	}
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc) {
+		return spsc_block_lock(data_fifo, *data, size);
+	}
+#endif
+
 	struct data_fifo_msgq msgq_tmp;
 
 	msgq_tmp.block_ptr = *data;
@@ -91,6 +296,12 @@ int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc) {
+		return spsc_last_filled_get(data_fifo, data, size, timeout);
+	}
+#endif
+
 	struct data_fifo_msgq msgq_tmp;
 
 	ret = k_msgq_get(&data_fifo->msgq, &msgq_tmp, timeout);
@@ -108,6 +319,13 @@ void data_fifo_block_free(struct data_fifo *data_fifo, void *data)
 	__ASSERT_NO_MSG(data_fifo != NULL);
 	__ASSERT_NO_MSG(data_fifo->initialized);
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc) {
+		spsc_block_free(data_fifo, data);
+		return;
+	}
+#endif
+
 	k_mem_slab_free(&data_fifo->mem_slab, data);
 }
 
@@ -120,6 +338,13 @@ int data_fifo_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num, u
 	uint32_t msgq_num_used = UINT32_MAX;
 	uint32_t slab_blocks_num_used = UINT32_MAX;
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc) {
+		spsc_num_used_get(data_fifo, alloced_num, locked_num);
+		return 0;
+	}
+#endif
+
 	ret = msgq_slab_legal_used_elements(data_fifo, &msgq_num_used, &slab_blocks_num_used);
 	if (ret) {
 		return ret;
@@ -156,6 +381,14 @@ int data_fifo_empty(struct data_fifo *data_fifo)
 		data_fifo_block_free(data_fifo, old_data);
 	}
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc) {
+		/* Reset the ring to release the blocks that are got and not locked */
+		spsc_init(data_fifo);
+		return 0;
+	}
+#endif
+
 	/* Re-init k_mem_slab to reset the number of alloced slabs */
 	ret = k_mem_slab_init(&data_fifo->mem_slab, data_fifo->slab_buffer,
 			      data_fifo->block_size_max, data_fifo->elements_max);
@@ -192,6 +425,14 @@ int data_fifo_init(struct data_fifo *data_fifo)
 	__ASSERT_NO_MSG((data_fifo->block_size_max % WB_UP(1)) == 0);
 	int ret;
 
+#if CONFIG_DATA_FIFO_SPSC
+	if (data_fifo->spsc) {
+		spsc_init(data_fifo);
+		data_fifo->initialized = true;
+		return 0;
+	}
+#endif
+
 	k_msgq_init(&data_fifo->msgq, data_fifo->msgq_buffer, sizeof(struct data_fifo_msgq),
 		    data_fifo->elements_max);
 
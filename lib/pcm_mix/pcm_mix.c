@@ -6,91 +6,198 @@
 
 #include <pcm_mix.h>
 
+#include <string.h>
 #include <zephyr/kernel.h>
 
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include <cmsis_core.h>
+#define PCM_MIX_DSP 1
+#else
+#define PCM_MIX_DSP 0
+#endif
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pcm_mix, CONFIG_PCM_MIX_LOG_LEVEL);
 
-/* Clip signal if amplitude is outside legal range */
-static void hard_limiter(int32_t *const pcm)
+/* Number of samples accumulated on the stack by pcm_mix_gain before they are stored */
+#define GAIN_BLOCK_SAMPLES 32
+
+/* Clip signal if amplitude is outside the range of a signed 16-bit sample */
+static ALWAYS_INLINE int32_t sat16(int32_t pcm)
 {
-	if (*pcm < INT16_MIN) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MIN;
-	} else if (*pcm > INT16_MAX) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MAX;
-	}
+#if PCM_MIX_DSP
+	return __SSAT(pcm, 16);
+#else
+	return CLAMP(pcm, INT16_MIN, INT16_MAX);
+#endif
 }
 
-/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
-static void pcm_mix_identical(void *const pcm_a, size_t size_a, void const *const pcm_b,
-			      size_t size_b)
+/* Clip signal if amplitude is outside the range of a signed 24-bit sample */
+static ALWAYS_INLINE int32_t sat24(int32_t pcm)
 {
-	int32_t res;
+#if PCM_MIX_DSP
+	return __SSAT(pcm, 24);
+#else
+	return CLAMP(pcm, -(1 << 23), (1 << 23) - 1);
+#endif
+}
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i];
+static ALWAYS_INLINE int32_t sat32(int64_t pcm)
+{
+	return CLAMP(pcm, INT32_MIN, INT32_MAX);
+}
 
-		hard_limiter(&res);
+/* Saturating addition of two pairs of signed 16-bit samples packed in words */
+static ALWAYS_INLINE uint32_t add_sat16x2(uint32_t a, uint32_t b)
+{
+#if PCM_MIX_DSP
+	return __QADD16(a, b);
+#else
+	int32_t lo = sat16((int16_t)a + (int16_t)b);
+	int32_t hi = sat16((int16_t)(a >> 16) + (int16_t)(b >> 16));
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
+	return ((uint32_t)hi << 16) | ((uint32_t)lo & 0xFFFF);
+#endif
+}
+
+/* Saturating addition of two 24-bit samples sign extended to 32 bits, or two 32-bit samples */
+static ALWAYS_INLINE int32_t add_sat_wide(int32_t a, int32_t b, uint8_t pcm_bit_depth)
+{
+	if (pcm_bit_depth == 24) {
+		/* Sum of two 24-bit samples always fits in 32 bits */
+		return sat24(a + b);
 	}
+
+#if PCM_MIX_DSP
+	return __QADD(a, b);
+#else
+	return sat32((int64_t)a + b);
+#endif
 }
 
-/* Mix mono into both channels of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_lr(void *const pcm_a, size_t size_a,
-					    void const *const pcm_b, size_t size_b)
+static ALWAYS_INLINE uint32_t load32(void const *const ptr)
 {
-	int32_t res;
+	uint32_t val;
 
-	/* Use size_b as this is the length of the mono sample.
-	 * This must be *2 to traverse the stereo sample and /2 since
-	 * the sample is two bytes in size.
-	 */
-	for (uint32_t i = 0; i < size_b; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i / 2];
+	/* Buffers of 16-bit samples do not have to be word aligned */
+	memcpy(&val, ptr, sizeof(val));
 
-		hard_limiter(&res);
+	return val;
+}
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
-	}
+static ALWAYS_INLINE void store32(void *const ptr, uint32_t val)
+{
+	memcpy(ptr, &val, sizeof(val));
 }
 
-/* Mix mono into left channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_l(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
+static void pcm_mix_identical_16(int16_t *pcm_a, int16_t const *pcm_b, size_t samples)
 {
-	int32_t res;
+	/* Two samples are mixed at once */
+	for (; samples >= 2; samples -= 2) {
+		store32(pcm_a, add_sat16x2(load32(pcm_a), load32(pcm_b)));
+		pcm_a += 2;
+		pcm_b += 2;
+	}
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2] + ((int16_t *)pcm_b)[i];
+	if (samples) {
+		*pcm_a = sat16(*pcm_a + *pcm_b);
+	}
+}
 
-		hard_limiter(&res);
+/* Mix mono into both channels of a stereo buffer */
+static void pcm_mix_b_mono_into_a_stereo_lr_16(int16_t *pcm_a, int16_t const *pcm_b,
+					       size_t samples)
+{
+	/* Left and right sample of a frame are mixed at once */
+	while (samples--) {
+		uint32_t b = (uint16_t)*pcm_b++;
 
-		((int16_t *)pcm_a)[i * 2] = (int16_t)res;
+		store32(pcm_a, add_sat16x2(load32(pcm_a), b | (b << 16)));
+		pcm_a += 2;
 	}
 }
 
-/* Mix mono into right channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_r(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+/* Mix mono into one channel of a stereo buffer. pcm_a points at the first sample of the channel */
+static void pcm_mix_b_mono_into_a_stereo_ch_16(int16_t *pcm_a, int16_t const *pcm_b,
+					       size_t samples)
 {
-	int32_t res;
+	while (samples--) {
+		*pcm_a = sat16(*pcm_a + *pcm_b++);
+		pcm_a += 2;
+	}
+}
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2 + 1] + ((int16_t *)pcm_b)[i];
+static ALWAYS_INLINE void pcm_mix_wide(int32_t *pcm_a, int32_t const *pcm_b, size_t samples,
+				       enum pcm_mix_mode mix_mode, uint8_t pcm_bit_depth)
+{
+	switch (mix_mode) {
+	case B_STEREO_INTO_A_STEREO:
+	case B_MONO_INTO_A_MONO:
+		while (samples--) {
+			*pcm_a = add_sat_wide(*pcm_a, *pcm_b++, pcm_bit_depth);
+			pcm_a++;
+		}
+		break;
+	case B_MONO_INTO_A_STEREO_LR:
+		while (samples--) {
+			pcm_a[0] = add_sat_wide(pcm_a[0], *pcm_b, pcm_bit_depth);
+			pcm_a[1] = add_sat_wide(pcm_a[1], *pcm_b++, pcm_bit_depth);
+			pcm_a += 2;
+		}
+		break;
+	case B_MONO_INTO_A_STEREO_R:
+		pcm_a++;
+		/* Fall through */
+	case B_MONO_INTO_A_STEREO_L:
+		while (samples--) {
+			*pcm_a = add_sat_wide(*pcm_a, *pcm_b++, pcm_bit_depth);
+			pcm_a += 2;
+		}
+		break;
+	}
+}
 
-		hard_limiter(&res);
+static void pcm_mix_16(int16_t *pcm_a, int16_t const *pcm_b, size_t samples,
+		       enum pcm_mix_mode mix_mode)
+{
+	switch (mix_mode) {
+	case B_STEREO_INTO_A_STEREO:
+	case B_MONO_INTO_A_MONO:
+		pcm_mix_identical_16(pcm_a, pcm_b, samples);
+		break;
+	case B_MONO_INTO_A_STEREO_LR:
+		pcm_mix_b_mono_into_a_stereo_lr_16(pcm_a, pcm_b, samples);
+		break;
+	case B_MONO_INTO_A_STEREO_L:
+		pcm_mix_b_mono_into_a_stereo_ch_16(pcm_a, pcm_b, samples);
+		break;
+	case B_MONO_INTO_A_STEREO_R:
+		pcm_mix_b_mono_into_a_stereo_ch_16(pcm_a + 1, pcm_b, samples);
+		break;
+	}
+}
 
-		((int16_t *)pcm_a)[i * 2 + 1] = (int16_t)res;
+static int sample_size_get(uint8_t pcm_bit_depth)
+{
+	switch (pcm_bit_depth) {
+	case 16:
+		return sizeof(int16_t);
+	case 24:
+		/* 24-bit samples are carried in 32-bit words */
+	case 32:
+		return sizeof(int32_t);
+	default:
+		return -EINVAL;
 	}
 }
 
-int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
-	    enum pcm_mix_mode mix_mode)
+int pcm_mix_bit_depth(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+		      enum pcm_mix_mode mix_mode, uint8_t pcm_bit_depth)
 {
-	if (pcm_a == NULL || size_a == 0) {
+	int sample_size = sample_size_get(pcm_bit_depth);
+
+	if (pcm_a == NULL || size_a == 0 || sample_size < 0) {
 		return -EINVAL;
 	}
 
@@ -106,24 +213,12 @@ int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t si
 		if (size_b > size_a) {
 			return -EPERM;
 		}
-		pcm_mix_identical(pcm_a, size_a, pcm_b, size_b);
 		break;
 	case B_MONO_INTO_A_STEREO_LR:
-		if (size_b > (size_a / 2)) {
-			return -EPERM;
-		}
-		pcm_mix_b_mono_into_a_stereo_lr(pcm_a, size_a, pcm_b, size_b);
-		break;
 	case B_MONO_INTO_A_STEREO_L:
-		pcm_mix_b_mono_into_a_stereo_l(pcm_a, size_a, pcm_b, size_b);
-		if (size_b > (size_a / 2)) {
-			LOG_ERR("size a %d size b %d", size_a, size_b);
-			return -EPERM;
-		}
-		break;
 	case B_MONO_INTO_A_STEREO_R:
-		pcm_mix_b_mono_into_a_stereo_r(pcm_a, size_a, pcm_b, size_b);
 		if (size_b > (size_a / 2)) {
+			LOG_ERR("size a %zu size b %zu", size_a, size_b);
 			return -EPERM;
 		}
 		break;
@@ -131,5 +226,113 @@ int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t si
 		return -ESRCH;
 	};
 
+	if (sample_size == sizeof(int16_t)) {
+		pcm_mix_16(pcm_a, pcm_b, size_b / sample_size, mix_mode);
+	} else if (pcm_bit_depth == 24) {
+		pcm_mix_wide(pcm_a, pcm_b, size_b / sample_size, mix_mode, 24);
+	} else {
+		pcm_mix_wide(pcm_a, pcm_b, size_b / sample_size, mix_mode, 32);
+	}
+
+	return 0;
+}
+
+int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+	    enum pcm_mix_mode mix_mode)
+{
+	return pcm_mix_bit_depth(pcm_a, size_a, pcm_b, size_b, mix_mode, 16);
+}
+
+/* Apply Q1.15 gain to a sample */
+static ALWAYS_INLINE int64_t gain_apply(int32_t pcm, uint16_t gain)
+{
+	return ((int64_t)pcm * gain) >> 15;
+}
+
+static void pcm_mix_gain_16(int16_t *pcm_out, size_t samples,
+			    struct pcm_mix_stream const *const streams, size_t stream_cnt)
+{
+	int32_t acc[GAIN_BLOCK_SAMPLES];
+
+	for (size_t offset = 0; offset < samples; offset += GAIN_BLOCK_SAMPLES) {
+		size_t block = MIN(samples - offset, GAIN_BLOCK_SAMPLES);
+
+		memset(acc, 0, block * sizeof(acc[0]));
+
+		for (size_t s = 0; s < stream_cnt; s++) {
+			int16_t const *pcm;
+			uint16_t gain = streams[s].gain;
+
+			if (streams[s].pcm == NULL || gain == 0) {
+				continue;
+			}
+
+			pcm = (int16_t const *)streams[s].pcm + offset;
+
+			/* Product of a 16-bit sample and the gain fits in 32 bits */
+			for (size_t i = 0; i < block; i++) {
+				acc[i] += ((int32_t)pcm[i] * gain) >> 15;
+			}
+		}
+
+		for (size_t i = 0; i < block; i++) {
+			pcm_out[offset + i] = sat16(acc[i]);
+		}
+	}
+}
+
+static void pcm_mix_gain_wide(int32_t *pcm_out, size_t samples,
+			      struct pcm_mix_stream const *const streams, size_t stream_cnt,
+			      uint8_t pcm_bit_depth)
+{
+	int64_t acc[GAIN_BLOCK_SAMPLES];
+
+	for (size_t offset = 0; offset < samples; offset += GAIN_BLOCK_SAMPLES) {
+		size_t block = MIN(samples - offset, GAIN_BLOCK_SAMPLES);
+
+		memset(acc, 0, block * sizeof(acc[0]));
+
+		for (size_t s = 0; s < stream_cnt; s++) {
+			int32_t const *pcm;
+			uint16_t gain = streams[s].gain;
+
+			if (streams[s].pcm == NULL || gain == 0) {
+				continue;
+			}
+
+			pcm = (int32_t const *)streams[s].pcm + offset;
+
+			for (size_t i = 0; i < block; i++) {
+				acc[i] += gain_apply(pcm[i], gain);
+			}
+		}
+
+		for (size_t i = 0; i < block; i++) {
+			if (pcm_bit_depth == 24) {
+				pcm_out[offset + i] = CLAMP(acc[i], -(1 << 23), (1 << 23) - 1);
+			} else {
+				pcm_out[offset + i] = sat32(acc[i]);
+			}
+		}
+	}
+}
+
+int pcm_mix_gain(void *const pcm_out, size_t size, struct pcm_mix_stream const *const streams,
+		 size_t stream_cnt, uint8_t pcm_bit_depth)
+{
+	int sample_size = sample_size_get(pcm_bit_depth);
+
+	if (pcm_out == NULL || size == 0 || sample_size < 0 ||
+	    (streams == NULL && stream_cnt != 0)) {
+		return -EINVAL;
+	}
+
+	if (sample_size == sizeof(int16_t)) {
+		pcm_mix_gain_16(pcm_out, size / sample_size, streams, stream_cnt);
+	} else {
+		pcm_mix_gain_wide(pcm_out, size / sample_size, streams, stream_cnt,
+				  pcm_bit_depth);
+	}
+
 	return 0;
 }
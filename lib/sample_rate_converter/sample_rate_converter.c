@@ -6,6 +6,7 @@
 
 #include "sample_rate_converter.h"
 #include "sample_rate_converter_filter.h"
+#include "sample_rate_converter_polyphase.h"
 
 #include <errno.h>
 #include <stdbool.h>
@@ -102,6 +103,21 @@ static int sample_rate_converter_reconfigure(struct sample_rate_converter_ctx *c
 
 	__ASSERT(ctx != NULL, "Context cannot be NULL");
 
+	if (IS_ENABLED(CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE) &&
+	    (filter == SAMPLE_RATE_FILTER_POLYPHASE)) {
+		ret = sample_rate_converter_polyphase_configure(ctx, sample_rate_input,
+								sample_rate_output);
+		if (ret) {
+			return ret;
+		}
+
+		ctx->sample_rate_input = sample_rate_input;
+		ctx->sample_rate_output = sample_rate_output;
+		ctx->conversion_ratio = 0;
+		ctx->filter_type = filter;
+		return 0;
+	}
+
 	ret = validate_sample_rates(sample_rate_input, sample_rate_output);
 	if (ret) {
 		LOG_ERR("Invalid sample rate given (%d)", ret);
@@ -247,6 +263,12 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 		}
 	}
 
+	if (IS_ENABLED(CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE) &&
+	    (ctx->filter_type == SAMPLE_RATE_FILTER_POLYPHASE)) {
+		return sample_rate_converter_polyphase_process(ctx, input, samples_in, output,
+							       output_size, output_written);
+	}
+
 	if ((ctx->conversion_ratio < 0) && (samples_in < abs(ctx->conversion_ratio))) {
 		LOG_ERR("Number of samples in can not be less than the conversion ratio (%d) when "
 			"downsampling",
@@ -393,3 +415,17 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 
 	return 0;
 }
+
+int sample_rate_converter_ratio_adjust(struct sample_rate_converter_ctx *ctx, int32_t adjust_ppb)
+{
+	if (ctx == NULL) {
+		LOG_ERR("Context cannot be NULL");
+		return -EINVAL;
+	}
+
+	if (!IS_ENABLED(CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE)) {
+		return -ENOTSUP;
+	}
+
+	return sample_rate_converter_polyphase_adjust(ctx, adjust_ppb);
+}
@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "sample_rate_converter.h"
+#include "sample_rate_converter_polyphase.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(sample_rate_converter_polyphase, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVEL);
+
+/* Number of zero crossings of the sinc function on each side of the filter */
+#define ZERO_CROSSINGS	 8
+/* Number of filter table entries between two zero crossings */
+#define TABLE_RESOLUTION 128
+/* End of the filter table in table entries (Q16.16) */
+#define TABLE_END	 ((uint32_t)(ZERO_CROSSINGS * TABLE_RESOLUTION) << 16)
+
+#define PPB_PER_PPM 1000
+#define PPB	    1000000000LL
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+typedef int16_t sample_t;
+#define SAMPLE_MIN INT16_MIN
+#define SAMPLE_MAX INT16_MAX
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+typedef int32_t sample_t;
+#define SAMPLE_MIN INT32_MIN
+#define SAMPLE_MAX INT32_MAX
+#endif
+
+/**
+ * Right half of a Kaiser windowed (beta 8) sinc filter in Q1.15, with the cut-off at 0.9 times
+ * the Nyquist frequency. Entry i holds the filter response i / TABLE_RESOLUTION samples from the
+ * center. The last entry is zero to allow interpolation up to the end of the table.
+ */
+static const q15_t filter_table[ZERO_CROSSINGS * TABLE_RESOLUTION + 1] = {
+	0x7333, 0x7331, 0x7329, 0x731D, 0x730B, 0x72F5, 0x72D9, 0x72B9, 0x7293, 0x7269, 0x723A,
+	0x7205, 0x71CC, 0x718E, 0x714B, 0x7103, 0x70B7, 0x7065, 0x700F, 0x6FB4, 0x6F54, 0x6EF0,
+	0x6E87, 0x6E1A, 0x6DA7, 0x6D31, 0x6CB5, 0x6C36, 0x6BB1, 0x6B29, 0x6A9C, 0x6A0B, 0x6975,
+	0x68DB, 0x683E, 0x679C, 0x66F6, 0x664C, 0x659E, 0x64EC, 0x6436, 0x637D, 0x62BF, 0x61FE,
+	0x613A, 0x6072, 0x5FA6, 0x5ED7, 0x5E05, 0x5D30, 0x5C57, 0x5B7B, 0x5A9C, 0x59BA, 0x58D5,
+	0x57ED, 0x5702, 0x5615, 0x5525, 0x5432, 0x533D, 0x5245, 0x514B, 0x504F, 0x4F51, 0x4E50,
+	0x4D4E, 0x4C49, 0x4B43, 0x4A3A, 0x4930, 0x4824, 0x4717, 0x4608, 0x44F8, 0x43E7, 0x42D4,
+	0x41C0, 0x40AB, 0x3F95, 0x3E7E, 0x3D66, 0x3C4D, 0x3B34, 0x3A1A, 0x3900, 0x37E5, 0x36CA,
+	0x35AE, 0x3493, 0x3377, 0x325B, 0x313F, 0x3023, 0x2F08, 0x2DEC, 0x2CD2, 0x2BB7, 0x2A9D,
+	0x2984, 0x286B, 0x2753, 0x263C, 0x2525, 0x2410, 0x22FC, 0x21E8, 0x20D6, 0x1FC5, 0x1EB6,
+	0x1DA8, 0x1C9B, 0x1B90, 0x1A86, 0x197E, 0x1878, 0x1774, 0x1671, 0x1571, 0x1472, 0x1375,
+	0x127B, 0x1182, 0x108C, 0x0F98, 0x0EA6, 0x0DB7, 0x0CCA, 0x0BE0, 0x0AF8, 0x0A12, 0x0930,
+	0x084F, 0x0772, 0x0698, 0x05C0, 0x04EB, 0x0419, 0x034A, 0x027D, 0x01B4, 0x00EE, 0x002B,
+	0xFF6B, 0xFEAE, 0xFDF4, 0xFD3E, 0xFC8B, 0xFBDB, 0xFB2E, 0xFA84, 0xF9DE, 0xF93B, 0xF89C,
+	0xF800, 0xF767, 0xF6D2, 0xF640, 0xF5B1, 0xF527, 0xF49F, 0xF41B, 0xF39A, 0xF31D, 0xF2A4,
+	0xF22E, 0xF1BB, 0xF14C, 0xF0E0, 0xF078, 0xF014, 0xEFB3, 0xEF55, 0xEEFB, 0xEEA4, 0xEE51,
+	0xEE01, 0xEDB5, 0xED6C, 0xED26, 0xECE4, 0xECA6, 0xEC6A, 0xEC32, 0xEBFE, 0xEBCC, 0xEB9E,
+	0xEB73, 0xEB4C, 0xEB28, 0xEB07, 0xEAE9, 0xEACE, 0xEAB6, 0xEAA1, 0xEA90, 0xEA81, 0xEA76,
+	0xEA6D, 0xEA67, 0xEA65, 0xEA65, 0xEA68, 0xEA6D, 0xEA76, 0xEA81, 0xEA8E, 0xEA9F, 0xEAB2,
+	0xEAC7, 0xEADF, 0xEAFA, 0xEB16, 0xEB36, 0xEB57, 0xEB7B, 0xEBA1, 0xEBC9, 0xEBF4, 0xEC20,
+	0xEC4F, 0xEC7F, 0xECB2, 0xECE6, 0xED1C, 0xED54, 0xED8E, 0xEDCA, 0xEE07, 0xEE45, 0xEE86,
+	0xEEC8, 0xEF0B, 0xEF50, 0xEF96, 0xEFDD, 0xF026, 0xF070, 0xF0BB, 0xF107, 0xF154, 0xF1A2,
+	0xF1F1, 0xF241, 0xF292, 0xF2E4, 0xF336, 0xF38A, 0xF3DD, 0xF432, 0xF487, 0xF4DC, 0xF532,
+	0xF589, 0xF5E0, 0xF637, 0xF68E, 0xF6E6, 0xF73E, 0xF795, 0xF7EE, 0xF846, 0xF89E, 0xF8F6,
+	0xF94E, 0xF9A6, 0xF9FD, 0xFA55, 0xFAAC, 0xFB03, 0xFB59, 0xFBB0, 0xFC05, 0xFC5B, 0xFCB0,
+	0xFD04, 0xFD58, 0xFDAB, 0xFDFD, 0xFE4F, 0xFEA0, 0xFEF1, 0xFF41, 0xFF8F, 0xFFDE, 0x002B,
+	0x0077, 0x00C3, 0x010D, 0x0157, 0x019F, 0x01E7, 0x022D, 0x0272, 0x02B7, 0x02FA, 0x033C,
+	0x037D, 0x03BC, 0x03FB, 0x0438, 0x0474, 0x04AF, 0x04E9, 0x0521, 0x0558, 0x058E, 0x05C2,
+	0x05F5, 0x0627, 0x0657, 0x0686, 0x06B3, 0x06E0, 0x070A, 0x0734, 0x075C, 0x0782, 0x07A8,
+	0x07CB, 0x07EE, 0x080F, 0x082E, 0x084C, 0x0869, 0x0884, 0x089E, 0x08B6, 0x08CD, 0x08E3,
+	0x08F7, 0x090A, 0x091B, 0x092B, 0x093A, 0x0947, 0x0953, 0x095D, 0x0966, 0x096E, 0x0975,
+	0x097A, 0x097E, 0x0980, 0x0981, 0x0981, 0x0980, 0x097E, 0x097A, 0x0975, 0x096F, 0x0968,
+	0x095F, 0x0956, 0x094B, 0x093F, 0x0932, 0x0924, 0x0915, 0x0905, 0x08F4, 0x08E2, 0x08CF,
+	0x08BB, 0x08A6, 0x0890, 0x0879, 0x0861, 0x0849, 0x0830, 0x0815, 0x07FB, 0x07DF, 0x07C2,
+	0x07A5, 0x0787, 0x0769, 0x074A, 0x072A, 0x070A, 0x06E9, 0x06C7, 0x06A5, 0x0683, 0x0660,
+	0x063C, 0x0618, 0x05F4, 0x05CF, 0x05AA, 0x0585, 0x055F, 0x0539, 0x0513, 0x04EC, 0x04C6,
+	0x049F, 0x0478, 0x0450, 0x0429, 0x0401, 0x03DA, 0x03B2, 0x038A, 0x0362, 0x033A, 0x0313,
+	0x02EB, 0x02C3, 0x029C, 0x0274, 0x024D, 0x0225, 0x01FE, 0x01D7, 0x01B0, 0x018A, 0x0163,
+	0x013D, 0x0118, 0x00F2, 0x00CD, 0x00A8, 0x0083, 0x005F, 0x003B, 0x0017, 0xFFF4, 0xFFD2,
+	0xFFAF, 0xFF8D, 0xFF6C, 0xFF4B, 0xFF2A, 0xFF0A, 0xFEEB, 0xFECC, 0xFEAD, 0xFE8F, 0xFE72,
+	0xFE55, 0xFE38, 0xFE1C, 0xFE01, 0xFDE6, 0xFDCC, 0xFDB3, 0xFD9A, 0xFD82, 0xFD6A, 0xFD53,
+	0xFD3C, 0xFD27, 0xFD11, 0xFCFD, 0xFCE9, 0xFCD6, 0xFCC3, 0xFCB1, 0xFCA0, 0xFC8F, 0xFC7F,
+	0xFC70, 0xFC61, 0xFC53, 0xFC45, 0xFC39, 0xFC2D, 0xFC21, 0xFC16, 0xFC0C, 0xFC03, 0xFBFA,
+	0xFBF2, 0xFBEA, 0xFBE3, 0xFBDD, 0xFBD7, 0xFBD2, 0xFBCE, 0xFBCA, 0xFBC7, 0xFBC4, 0xFBC3,
+	0xFBC1, 0xFBC0, 0xFBC0, 0xFBC1, 0xFBC1, 0xFBC3, 0xFBC5, 0xFBC8, 0xFBCB, 0xFBCE, 0xFBD3,
+	0xFBD7, 0xFBDD, 0xFBE2, 0xFBE8, 0xFBEF, 0xFBF6, 0xFBFE, 0xFC06, 0xFC0E, 0xFC17, 0xFC21,
+	0xFC2A, 0xFC35, 0xFC3F, 0xFC4A, 0xFC55, 0xFC61, 0xFC6D, 0xFC79, 0xFC86, 0xFC93, 0xFCA0,
+	0xFCAE, 0xFCBC, 0xFCCA, 0xFCD8, 0xFCE7, 0xFCF6, 0xFD05, 0xFD14, 0xFD24, 0xFD34, 0xFD43,
+	0xFD54, 0xFD64, 0xFD74, 0xFD85, 0xFD96, 0xFDA6, 0xFDB7, 0xFDC8, 0xFDD9, 0xFDEB, 0xFDFC,
+	0xFE0D, 0xFE1F, 0xFE30, 0xFE41, 0xFE53, 0xFE64, 0xFE76, 0xFE87, 0xFE99, 0xFEAA, 0xFEBB,
+	0xFECD, 0xFEDE, 0xFEEF, 0xFF00, 0xFF11, 0xFF22, 0xFF33, 0xFF44, 0xFF54, 0xFF65, 0xFF75,
+	0xFF86, 0xFF96, 0xFFA6, 0xFFB5, 0xFFC5, 0xFFD4, 0xFFE4, 0xFFF3, 0x0002, 0x0010, 0x001F,
+	0x002D, 0x003B, 0x0049, 0x0057, 0x0064, 0x0071, 0x007E, 0x008B, 0x0097, 0x00A4, 0x00B0,
+	0x00BB, 0x00C7, 0x00D2, 0x00DD, 0x00E8, 0x00F2, 0x00FC, 0x0106, 0x0110, 0x0119, 0x0122,
+	0x012B, 0x0133, 0x013B, 0x0143, 0x014B, 0x0152, 0x0159, 0x0160, 0x0167, 0x016D, 0x0173,
+	0x0179, 0x017E, 0x0183, 0x0188, 0x018C, 0x0191, 0x0195, 0x0198, 0x019C, 0x019F, 0x01A2,
+	0x01A4, 0x01A7, 0x01A9, 0x01AB, 0x01AC, 0x01AE, 0x01AF, 0x01AF, 0x01B0, 0x01B0, 0x01B0,
+	0x01B0, 0x01B0, 0x01AF, 0x01AE, 0x01AD, 0x01AC, 0x01AB, 0x01A9, 0x01A7, 0x01A5, 0x01A3,
+	0x01A0, 0x019D, 0x019A, 0x0197, 0x0194, 0x0191, 0x018D, 0x0189, 0x0185, 0x0181, 0x017D,
+	0x0179, 0x0174, 0x016F, 0x016B, 0x0166, 0x0161, 0x015B, 0x0156, 0x0151, 0x014B, 0x0146,
+	0x0140, 0x013A, 0x0134, 0x012E, 0x0128, 0x0122, 0x011C, 0x0116, 0x010F, 0x0109, 0x0103,
+	0x00FC, 0x00F6, 0x00EF, 0x00E8, 0x00E2, 0x00DB, 0x00D5, 0x00CE, 0x00C7, 0x00C1, 0x00BA,
+	0x00B3, 0x00AD, 0x00A6, 0x009F, 0x0099, 0x0092, 0x008B, 0x0085, 0x007E, 0x0078, 0x0071,
+	0x006B, 0x0064, 0x005E, 0x0058, 0x0051, 0x004B, 0x0045, 0x003F, 0x0039, 0x0033, 0x002D,
+	0x0027, 0x0021, 0x001C, 0x0016, 0x0011, 0x000B, 0x0006, 0x0001, 0xFFFB, 0xFFF6, 0xFFF1,
+	0xFFEC, 0xFFE8, 0xFFE3, 0xFFDE, 0xFFDA, 0xFFD5, 0xFFD1, 0xFFCD, 0xFFC8, 0xFFC4, 0xFFC0,
+	0xFFBD, 0xFFB9, 0xFFB5, 0xFFB2, 0xFFAE, 0xFFAB, 0xFFA8, 0xFFA5, 0xFFA2, 0xFF9F, 0xFF9C,
+	0xFF99, 0xFF97, 0xFF94, 0xFF92, 0xFF8F, 0xFF8D, 0xFF8B, 0xFF89, 0xFF87, 0xFF86, 0xFF84,
+	0xFF83, 0xFF81, 0xFF80, 0xFF7E, 0xFF7D, 0xFF7C, 0xFF7B, 0xFF7A, 0xFF7A, 0xFF79, 0xFF78,
+	0xFF78, 0xFF77, 0xFF77, 0xFF77, 0xFF77, 0xFF77, 0xFF77, 0xFF77, 0xFF77, 0xFF77, 0xFF78,
+	0xFF78, 0xFF78, 0xFF79, 0xFF7A, 0xFF7A, 0xFF7B, 0xFF7C, 0xFF7D, 0xFF7E, 0xFF7F, 0xFF80,
+	0xFF81, 0xFF82, 0xFF83, 0xFF84, 0xFF86, 0xFF87, 0xFF89, 0xFF8A, 0xFF8B, 0xFF8D, 0xFF8F,
+	0xFF90, 0xFF92, 0xFF94, 0xFF95, 0xFF97, 0xFF99, 0xFF9B, 0xFF9C, 0xFF9E, 0xFFA0, 0xFFA2,
+	0xFFA4, 0xFFA6, 0xFFA8, 0xFFAA, 0xFFAC, 0xFFAE, 0xFFB0, 0xFFB2, 0xFFB4, 0xFFB6, 0xFFB8,
+	0xFFBA, 0xFFBC, 0xFFBE, 0xFFC0, 0xFFC2, 0xFFC4, 0xFFC6, 0xFFC8, 0xFFCA, 0xFFCC, 0xFFCE,
+	0xFFD0, 0xFFD2, 0xFFD4, 0xFFD6, 0xFFD8, 0xFFDA, 0xFFDC, 0xFFDE, 0xFFDF, 0xFFE1, 0xFFE3,
+	0xFFE5, 0xFFE7, 0xFFE8, 0xFFEA, 0xFFEC, 0xFFEE, 0xFFEF, 0xFFF1, 0xFFF2, 0xFFF4, 0xFFF6,
+	0xFFF7, 0xFFF9, 0xFFFA, 0xFFFB, 0xFFFD, 0xFFFE, 0x0000, 0x0001, 0x0002, 0x0003, 0x0005,
+	0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010,
+	0x0011, 0x0012, 0x0012, 0x0013, 0x0014, 0x0015, 0x0015, 0x0016, 0x0016, 0x0017, 0x0018,
+	0x0018, 0x0019, 0x0019, 0x0019, 0x001A, 0x001A, 0x001B, 0x001B, 0x001B, 0x001B, 0x001C,
+	0x001C, 0x001C, 0x001C, 0x001C, 0x001C, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D, 0x001D,
+	0x001D, 0x001D, 0x001D, 0x001C, 0x001C, 0x001C, 0x001C, 0x001C, 0x001C, 0x001C, 0x001B,
+	0x001B, 0x001B, 0x001B, 0x001A, 0x001A, 0x001A, 0x0019, 0x0019, 0x0019, 0x0019, 0x0018,
+	0x0018, 0x0018, 0x0017, 0x0017, 0x0016, 0x0016, 0x0016, 0x0015, 0x0015, 0x0014, 0x0014,
+	0x0014, 0x0013, 0x0013, 0x0012, 0x0012, 0x0012, 0x0011, 0x0011, 0x0010, 0x0010, 0x000F,
+	0x000F, 0x000F, 0x000E, 0x000E, 0x000D, 0x000D, 0x000D, 0x000C, 0x000C, 0x000B, 0x000B,
+	0x000B, 0x000A, 0x000A, 0x0009, 0x0009, 0x0009, 0x0008, 0x0008, 0x0008, 0x0007, 0x0007,
+	0x0007, 0x0006, 0x0006, 0x0006, 0x0005, 0x0005, 0x0005, 0x0004, 0x0004, 0x0004, 0x0004,
+	0x0003, 0x0003, 0x0003, 0x0003, 0x0002, 0x0002, 0x0002, 0x0002, 0x0001, 0x0001, 0x0001,
+	0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF,
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+	0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE,
+	0xFFFE, 0x0000
+};
+
+/**
+ * @brief Apply one wing of the filter.
+ *
+ * @param x		First input sample of the wing.
+ * @param dir		Direction to walk the input samples in, away from the output position.
+ * @param pos		Filter table position of the first input sample (Q16.16).
+ * @param table_step	Filter table distance between two input samples (Q16.16).
+ */
+static ALWAYS_INLINE int64_t wing_filter(sample_t const *x, int dir, uint32_t pos,
+					 uint32_t table_step)
+{
+	int64_t acc = 0;
+
+	for (; pos < TABLE_END; pos += table_step) {
+		uint32_t i = pos >> 16;
+		/* Neighboring entries differ by less than 2^15, so the product fits in 32 bits */
+		int32_t coef = filter_table[i] +
+			       (((filter_table[i + 1] - filter_table[i]) * (int32_t)(pos & 0xFFFF)) >>
+				16);
+
+		acc += (int64_t)coef * *x;
+		x += dir;
+	}
+
+	return acc;
+}
+
+static sample_t output_sample_get(struct sample_rate_converter_polyphase const *pp)
+{
+	uint32_t n = pp->time >> 32;
+	/* Fractional position of the output between input sample n and n + 1 (Q16) */
+	uint32_t frac = (uint32_t)pp->time >> 16;
+	int64_t acc;
+
+	acc = wing_filter(&pp->buf[n], -1, ((uint64_t)frac * pp->table_step) >> 16,
+			  pp->table_step);
+	acc += wing_filter(&pp->buf[n + 1], 1, ((uint64_t)(BIT(16) - frac) * pp->table_step) >> 16,
+			   pp->table_step);
+
+	acc = ((acc >> 15) * pp->gain + (1 << 15)) >> 16;
+
+	return CLAMP(acc, SAMPLE_MIN, SAMPLE_MAX);
+}
+
+static void step_update(struct sample_rate_converter_polyphase *pp)
+{
+	pp->step = pp->step_nominal + ((int64_t)pp->step_nominal * pp->adjust_ppb) / PPB;
+}
+
+int sample_rate_converter_polyphase_configure(struct sample_rate_converter_ctx *ctx,
+					      uint32_t sample_rate_input,
+					      uint32_t sample_rate_output)
+{
+	struct sample_rate_converter_polyphase *pp = &ctx->polyphase;
+	uint32_t table_step;
+	uint32_t wing;
+
+	if ((sample_rate_input == 0) || (sample_rate_output == 0)) {
+		LOG_ERR("Sample rate can not be zero");
+		return -EINVAL;
+	}
+
+	if (sample_rate_output < sample_rate_input) {
+		/* Stretch the filter to move the cut-off below the output Nyquist frequency */
+		table_step = DIV_ROUND_UP(((uint64_t)TABLE_RESOLUTION << 16) * sample_rate_output,
+					  sample_rate_input);
+	} else {
+		table_step = TABLE_RESOLUTION << 16;
+	}
+
+	/* Number of input samples covered by each wing. Rounding the table step up keeps the wing
+	 * within its exact width.
+	 */
+	wing = DIV_ROUND_UP(TABLE_END, table_step);
+	if (wing > CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_MAX_TAPS / 2) {
+		LOG_ERR("Conversion from %d to %d needs more than %d filter taps",
+			sample_rate_input, sample_rate_output,
+			CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_MAX_TAPS);
+		return -EINVAL;
+	}
+
+	pp->table_step = table_step;
+	/* Stretching the filter also scales up its gain */
+	pp->gain = table_step / TABLE_RESOLUTION;
+	pp->wing = wing;
+	pp->step_nominal = ((uint64_t)sample_rate_input << 32) / sample_rate_output;
+	step_update(pp);
+
+	/* Start with silence in the left wing, so the first output is at the first input */
+	pp->buf_samples = wing - 1;
+	memset(pp->buf, 0, pp->buf_samples * sizeof(sample_t));
+	pp->time = (uint64_t)(wing - 1) << 32;
+
+	LOG_DBG("Polyphase resampler initialized. Input sample rate: %d, Output sample rate: %d, "
+		"taps: %d",
+		sample_rate_input, sample_rate_output, 2 * wing);
+
+	return 0;
+}
+
+int sample_rate_converter_polyphase_adjust(struct sample_rate_converter_ctx *ctx,
+					   int32_t adjust_ppb)
+{
+	struct sample_rate_converter_polyphase *pp = &ctx->polyphase;
+
+	if (abs(adjust_ppb) >
+	    CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_MAX_ADJUST_PPM * PPB_PER_PPM) {
+		LOG_ERR("Ratio adjustment %d ppb out of range", adjust_ppb);
+		return -EINVAL;
+	}
+
+	pp->adjust_ppb = adjust_ppb;
+	step_update(pp);
+
+	return 0;
+}
+
+int sample_rate_converter_polyphase_process(struct sample_rate_converter_ctx *ctx,
+					    void const *const input, size_t samples_in,
+					    void *const output, size_t output_size,
+					    size_t *output_written)
+{
+	struct sample_rate_converter_polyphase *pp = &ctx->polyphase;
+	sample_t *out = output;
+	uint32_t buf_samples = pp->buf_samples + samples_in;
+	size_t samples_out = 0;
+	uint32_t drop;
+
+	/* Output samples can be produced until the right wing runs past the last input sample */
+	if (buf_samples > pp->wing) {
+		uint64_t end = (uint64_t)(buf_samples - pp->wing) << 32;
+
+		if (pp->time < end) {
+			samples_out = DIV_ROUND_UP(end - pp->time, pp->step);
+		}
+	}
+
+	if (samples_out * sizeof(sample_t) > output_size) {
+		LOG_ERR("Conversion process will produce more bytes than the output buffer can "
+			"hold");
+		return -EINVAL;
+	}
+
+	memcpy(&pp->buf[pp->buf_samples], input, samples_in * sizeof(sample_t));
+	pp->buf_samples = buf_samples;
+
+	for (size_t i = 0; i < samples_out; i++) {
+		out[i] = output_sample_get(pp);
+		pp->time += pp->step;
+	}
+
+	/* Drop the samples that are no longer needed by the left wing */
+	drop = (pp->time >> 32) - (pp->wing - 1);
+	__ASSERT_NO_MSG(drop <= pp->buf_samples);
+
+	memmove(pp->buf, &pp->buf[drop], (pp->buf_samples - drop) * sizeof(sample_t));
+	pp->buf_samples -= drop;
+	pp->time -= (uint64_t)drop << 32;
+
+	*output_written = samples_out * sizeof(sample_t);
+
+	return 0;
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SAMPLE_RATE_CONVERTER_POLYPHASE_H_
+#define _SAMPLE_RATE_CONVERTER_POLYPHASE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Configure the polyphase resampler for a new pair of sample rates.
+ *
+ * @details Resets the sample history and keeps the drift compensation set with
+ *	    sample_rate_converter_polyphase_adjust().
+ *
+ * @param[in,out]	ctx			Pointer to the sample rate conversion context.
+ * @param[in]		sample_rate_input	Sample rate of the input samples.
+ * @param[in]		sample_rate_output	Sample rate of the output samples.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Sample rates not supported within the configured number of filter taps.
+ */
+int sample_rate_converter_polyphase_configure(struct sample_rate_converter_ctx *ctx,
+					      uint32_t sample_rate_input,
+					      uint32_t sample_rate_output);
+
+/**
+ * @brief Set the drift compensation of the polyphase resampler.
+ *
+ * @param[in,out]	ctx		Pointer to the sample rate conversion context.
+ * @param[in]		adjust_ppb	Adjustment of the conversion ratio in parts per billion.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Adjustment out of range.
+ */
+int sample_rate_converter_polyphase_adjust(struct sample_rate_converter_ctx *ctx,
+					   int32_t adjust_ppb);
+
+/**
+ * @brief Resample a block of samples with the polyphase resampler.
+ *
+ * @param[in,out]	ctx		Pointer to the sample rate conversion context.
+ * @param[in]		input		Pointer to samples to process.
+ * @param[in]		samples_in	Number of input samples.
+ * @param[out]		output		Array that output will be written.
+ * @param[in]		output_size	Size of the output array in bytes.
+ * @param[out]		output_written	Number of bytes written to output.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Output array too small for the produced samples.
+ */
+int sample_rate_converter_polyphase_process(struct sample_rate_converter_ctx *ctx,
+					    void const *const input, size_t samples_in,
+					    void *const output, size_t output_size,
+					    size_t *output_written);
+
+#endif /* _SAMPLE_RATE_CONVERTER_POLYPHASE_H_ */
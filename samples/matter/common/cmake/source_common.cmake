@@ -72,7 +72,11 @@ if(CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS)
     endif()
 
     if(CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_END_USER_LOGS OR CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_NETWORK_LOGS)
-        target_sources(app PRIVATE ${MATTER_COMMONS_SRC_DIR}/diagnostic/diagnostic_logs_retention.cpp)
+        if(CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_FORMAT_BINARY)
+            target_sources(app PRIVATE ${MATTER_COMMONS_SRC_DIR}/diagnostic/diagnostic_logs_binary_retention.cpp)
+        else()
+            target_sources(app PRIVATE ${MATTER_COMMONS_SRC_DIR}/diagnostic/diagnostic_logs_retention.cpp)
+        endif()
         if(CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_REDIRECT)
             target_sources(app PRIVATE ${MATTER_COMMONS_SRC_DIR}/diagnostic/log_backend_diagnostic.cpp)
         endif()
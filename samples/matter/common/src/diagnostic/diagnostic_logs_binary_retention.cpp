@@ -0,0 +1,465 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "diagnostic_logs_binary_retention.h"
+
+#include <lib/support/CodeUtils.h>
+#include <system/SystemError.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/linker/linker-defs.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log_output.h>
+#include <zephyr/sys/crc.h>
+
+#include <algorithm>
+
+using namespace chip;
+
+namespace
+{
+
+/* Increment when the layout of the stored records changes. */
+constexpr uint32_t kFormatVersion = 1;
+
+/* The same flags are used by the log backend to format the logs in the text format. */
+constexpr uint32_t kLogOutputFlags =
+	LOG_OUTPUT_FLAG_TIMESTAMP | LOG_OUTPUT_FLAG_FORMAT_TIMESTAMP | LOG_OUTPUT_FLAG_LEVEL;
+
+struct OutputContext {
+	uint8_t *mBuffer;
+	size_t mCapacity;
+	size_t mSize;
+};
+
+int WriteOutput(uint8_t *data, size_t length, void *context)
+{
+	OutputContext *output = reinterpret_cast<OutputContext *>(context);
+
+	/* Count everything to learn the size of the text, but copy only what fits the output buffer. */
+	if (output->mBuffer && output->mSize < output->mCapacity) {
+		memcpy(output->mBuffer + output->mSize, data, std::min(length, output->mCapacity - output->mSize));
+	}
+
+	output->mSize += length;
+
+	return length;
+}
+
+uint8_t sOutputBuffer[256];
+LOG_OUTPUT_DEFINE(log_output_read, WriteOutput, sOutputBuffer, sizeof(sOutputBuffer));
+
+/* Log message rebuilt from the record, it must be aligned as any message allocated by the logger. */
+alignas(Z_LOG_MSG_ALIGNMENT) uint8_t
+	sMessageBuffer[sizeof(struct log_msg) + CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_MAX_RECORD_SIZE];
+
+} /* namespace */
+
+uint8_t DiagnosticLogsBinaryRetention::sRecordBuffer[sizeof(RecordHeader) + kMaxRecordPayloadSize];
+
+uint32_t DiagnosticLogsBinaryRetention::GetImageTag()
+{
+	/* Log message records keep pointers to the format strings and the log source names of the image that created
+	 * them. Derive the tag from the whole read-only data region, including its location, so that the records are
+	 * dropped after any update which changes a string or moves it. The region is read once, on initialization. */
+	const uintptr_t rodataStart = reinterpret_cast<uintptr_t>(__rodata_region_start);
+	const size_t rodataSize = __rodata_region_end - __rodata_region_start;
+	uint32_t tag = crc32_ieee(reinterpret_cast<const uint8_t *>(&kFormatVersion), sizeof(kFormatVersion));
+
+	tag = crc32_ieee_update(tag, reinterpret_cast<const uint8_t *>(&rodataStart), sizeof(rodataStart));
+	tag = crc32_ieee_update(tag, reinterpret_cast<const uint8_t *>(&rodataSize), sizeof(rodataSize));
+	tag = crc32_ieee_update(tag, reinterpret_cast<const uint8_t *>(__rodata_region_start), rodataSize);
+
+	return tag;
+}
+
+uint32_t DiagnosticLogsBinaryRetention::Advance(uint32_t pos, size_t size) const
+{
+	return static_cast<uint32_t>((static_cast<uint64_t>(pos) + size) % mRange);
+}
+
+uint32_t DiagnosticLogsBinaryRetention::Distance(uint32_t from, uint32_t to) const
+{
+	return static_cast<uint32_t>((static_cast<uint64_t>(to) + mRange - from) % mRange);
+}
+
+bool DiagnosticLogsBinaryRetention::IsInRange(uint32_t pos, uint32_t begin, uint32_t end) const
+{
+	return Distance(begin, pos) <= Distance(begin, end);
+}
+
+bool DiagnosticLogsBinaryRetention::IsOverwritten(uint32_t pos)
+{
+	/* Writers move the beginning forward before overwriting the oldest records. */
+	return !IsInRange(pos, GetLogsBegin(), GetLogsEnd());
+}
+
+int DiagnosticLogsBinaryRetention::WriteRing(uint32_t pos, const void *data, size_t size)
+{
+	const uint32_t offset = pos % mCapacity;
+	const size_t size1 = std::min(size, mCapacity - offset);
+
+	if (size == 0) {
+		return 0;
+	}
+
+	int ret = retention_write(mPartition, sizeof(PartitionHeader) + offset, reinterpret_cast<const uint8_t *>(data),
+				  size1);
+
+	/* Save the part that wrapped around. */
+	if (ret == 0 && size > size1) {
+		ret = retention_write(mPartition, sizeof(PartitionHeader),
+				      reinterpret_cast<const uint8_t *>(data) + size1, size - size1);
+	}
+
+	return ret;
+}
+
+int DiagnosticLogsBinaryRetention::ReadRing(uint32_t pos, void *data, size_t size)
+{
+	const uint32_t offset = pos % mCapacity;
+	const size_t size1 = std::min(size, mCapacity - offset);
+
+	if (size == 0) {
+		return 0;
+	}
+
+	int ret = retention_read(mPartition, sizeof(PartitionHeader) + offset, reinterpret_cast<uint8_t *>(data),
+				 size1);
+
+	/* Read the part that wrapped around. */
+	if (ret == 0 && size > size1) {
+		ret = retention_read(mPartition, sizeof(PartitionHeader), reinterpret_cast<uint8_t *>(data) + size1,
+				     size - size1);
+	}
+
+	return ret;
+}
+
+int DiagnosticLogsBinaryRetention::WriteHeader()
+{
+	PartitionHeader header = { mImageTag, GetLogsBegin(), GetLogsEnd() };
+
+	return retention_write(mPartition, 0, reinterpret_cast<uint8_t *>(&header), sizeof(header));
+}
+
+CHIP_ERROR DiagnosticLogsBinaryRetention::Init()
+{
+	if (mIsInitialized) {
+		return CHIP_NO_ERROR;
+	}
+
+	mCapacity = retention_size(mPartition);
+	VerifyOrReturnError(mCapacity > sizeof(PartitionHeader) + sizeof(RecordHeader), CHIP_ERROR_INTERNAL);
+
+	mCapacity = mCapacity - sizeof(PartitionHeader);
+	mRange = mCapacity * (UINT32_MAX / mCapacity);
+	mImageTag = GetImageTag();
+
+	PartitionHeader header;
+	bool isValid = retention_is_valid(mPartition) == 1 &&
+		       retention_read(mPartition, 0, reinterpret_cast<uint8_t *>(&header), sizeof(header)) == 0;
+
+	isValid = isValid && header.mImageTag == mImageTag && header.mBegin < mRange && header.mEnd < mRange &&
+		  Distance(header.mBegin, header.mEnd) <= mCapacity;
+
+	/* Drop the records written by a different image or corrupted, as they cannot be converted to text. */
+	if (isValid) {
+		atomic_set(&mBegin, header.mBegin);
+		atomic_set(&mEnd, header.mEnd);
+	} else {
+		atomic_set(&mBegin, 0);
+		atomic_set(&mEnd, 0);
+
+		int ret = WriteHeader();
+		VerifyOrReturnError(ret == 0, System::MapErrorZephyr(ret));
+	}
+
+	mIsInitialized = true;
+
+	return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DiagnosticLogsBinaryRetention::Clear()
+{
+	VerifyOrReturnError(mIsInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+	k_sched_lock();
+
+	/* Do not rewind the positions, so that readers in progress notice the records are gone. */
+	atomic_set(&mBegin, atomic_get(&mEnd));
+	int ret = WriteHeader();
+
+	k_sched_unlock();
+
+	return System::MapErrorZephyr(ret);
+}
+
+CHIP_ERROR DiagnosticLogsBinaryRetention::WriteRecord(RecordType type, const void *first, size_t firstSize,
+						      const void *second, size_t secondSize, const void *third,
+						      size_t thirdSize)
+{
+	VerifyOrReturnError(mIsInitialized, CHIP_ERROR_INCORRECT_STATE);
+	/* The scheduler lock does not exclude interrupts, so the records cannot be written from an interrupt. */
+	VerifyOrReturnError(!k_is_in_isr(), CHIP_ERROR_INCORRECT_STATE);
+
+	const size_t payloadSize = firstSize + secondSize + thirdSize;
+	const size_t recordSize = sizeof(RecordHeader) + payloadSize;
+
+	VerifyOrReturnError(recordSize <= mCapacity && payloadSize <= kMaxRecordPayloadSize,
+			    CHIP_ERROR_BUFFER_TOO_SMALL);
+
+	const RecordHeader header = { static_cast<uint16_t>(payloadSize), type, 0 };
+	int ret = 0;
+
+	/* Writes are short and never block, as the retention mutexes are disabled. Serializing them with the scheduler
+	 * lock is enough and cheaper than a mutex. The logs can be pushed from any thread, so the lock is still
+	 * needed. */
+	k_sched_lock();
+
+	/* Assemble the record, so that it is saved with a single write. */
+	uint8_t *record = sRecordBuffer;
+	record = std::copy_n(reinterpret_cast<const uint8_t *>(&header), sizeof(header), record);
+	record = std::copy_n(reinterpret_cast<const uint8_t *>(first), firstSize, record);
+	record = std::copy_n(reinterpret_cast<const uint8_t *>(second), secondSize, record);
+	std::copy_n(reinterpret_cast<const uint8_t *>(third), thirdSize, record);
+
+	uint32_t begin = GetLogsBegin();
+	const uint32_t end = GetLogsEnd();
+
+	/* There is no place for the new record. Forget the oldest records by moving the beginning forward. */
+	while (Distance(begin, end) + recordSize > mCapacity) {
+		RecordHeader oldest;
+
+		ret = ReadRing(begin, &oldest, sizeof(oldest));
+		if (ret != 0 || sizeof(oldest) + oldest.mSize > Distance(begin, end)) {
+			/* The records cannot be parsed, forget all of them. */
+			begin = end;
+			break;
+		}
+
+		begin = Advance(begin, sizeof(oldest) + oldest.mSize);
+	}
+
+	/* Publish the new beginning before overwriting the oldest records, so that readers can detect it. */
+	atomic_set(&mBegin, begin);
+
+	ret = WriteRing(end, sRecordBuffer, recordSize);
+
+	if (ret == 0) {
+		atomic_set(&mEnd, Advance(end, recordSize));
+		ret = WriteHeader();
+	}
+
+	k_sched_unlock();
+
+	return System::MapErrorZephyr(ret);
+}
+
+CHIP_ERROR DiagnosticLogsBinaryRetention::PushLog(const void *data, size_t size)
+{
+	VerifyOrReturnError(data, CHIP_ERROR_INVALID_ARGUMENT);
+
+	const uint8_t *text = reinterpret_cast<const uint8_t *>(data);
+
+	/* Text records are concatenated when read, so the text longer than a record is split into several ones. */
+	while (size > 0) {
+		const size_t chunkSize = std::min(size, kMaxRecordPayloadSize);
+
+		ReturnErrorOnFailure(WriteRecord(RecordType::kText, text, chunkSize, nullptr, 0, nullptr, 0));
+
+		text += chunkSize;
+		size -= chunkSize;
+	}
+
+	return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DiagnosticLogsBinaryRetention::PushLogMessage(struct log_msg *msg)
+{
+	VerifyOrReturnError(msg, CHIP_ERROR_INVALID_ARGUMENT);
+
+	void *source = const_cast<void *>(log_msg_get_source(msg));
+	VerifyOrReturnError(source, CHIP_ERROR_INVALID_ARGUMENT);
+
+	size_t packageSize;
+	size_t dataSize;
+	uint8_t *package = log_msg_get_package(msg, &packageSize);
+	uint8_t *data = log_msg_get_data(msg, &dataSize);
+
+	/* The package cannot be shortened, but the hexdump data can be truncated. */
+	VerifyOrReturnError(sizeof(LogMessageHeader) + packageSize <= kMaxRecordPayloadSize,
+			    CHIP_ERROR_BUFFER_TOO_SMALL);
+	dataSize = std::min(dataSize, kMaxRecordPayloadSize - sizeof(LogMessageHeader) - packageSize);
+
+	LogMessageHeader header = {};
+	header.mTimestamp = log_msg_get_timestamp(msg);
+	/* Source id has to be obtained from different places, depending on runtime filtering. */
+	header.mSourceId = IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ?
+				   log_dynamic_source_id(reinterpret_cast<log_source_dynamic_data *>(source)) :
+				   log_const_source_id(reinterpret_cast<log_source_const_data *>(source));
+	header.mPackageSize = static_cast<uint16_t>(packageSize);
+	header.mDataSize = static_cast<uint16_t>(dataSize);
+	header.mDomain = log_msg_get_domain(msg);
+	header.mLevel = log_msg_get_level(msg);
+
+	return WriteRecord(RecordType::kLogMessage, &header, sizeof(header), package, packageSize, data, dataSize);
+}
+
+int DiagnosticLogsBinaryRetention::ReadLogMessage(uint32_t pos, size_t size)
+{
+	struct log_msg *msg = reinterpret_cast<struct log_msg *>(sMessageBuffer);
+	LogMessageHeader header;
+
+	if (size < sizeof(header) || size > kMaxRecordPayloadSize) {
+		return -EBADMSG;
+	}
+
+	int ret = ReadRing(pos, &header, sizeof(header));
+	if (ret != 0) {
+		return ret;
+	}
+
+	if (sizeof(header) + header.mPackageSize + header.mDataSize != size ||
+	    header.mDomain != Z_LOG_LOCAL_DOMAIN_ID || header.mSourceId >= log_src_cnt_get(Z_LOG_LOCAL_DOMAIN_ID)) {
+		return -EBADMSG;
+	}
+
+	const struct log_msg_desc desc = Z_LOG_MSG_DESC_INITIALIZER(header.mDomain, header.mLevel,
+								     header.mPackageSize, header.mDataSize);
+
+	msg->hdr.desc = desc;
+	msg->hdr.source = IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ?
+				  static_cast<const void *>(&TYPE_SECTION_START(log_dynamic)[header.mSourceId]) :
+				  static_cast<const void *>(&TYPE_SECTION_START(log_const)[header.mSourceId]);
+	msg->hdr.timestamp = header.mTimestamp;
+#ifdef CONFIG_LOG_THREAD_ID_PREFIX
+	msg->hdr.tid = nullptr;
+#endif
+
+	return ReadRing(Advance(pos, sizeof(header)), msg->data, header.mPackageSize + header.mDataSize);
+}
+
+CHIP_ERROR DiagnosticLogsBinaryRetention::GetLogs(chip::MutableByteSpan &outBuffer, uint32_t &readPos,
+						  uint32_t &endPos, size_t &outSize)
+{
+	VerifyOrReturnError(mIsInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+	OutputContext output = { outBuffer.data(), outBuffer.size(), 0 };
+	CHIP_ERROR err = CHIP_NO_ERROR;
+
+	log_output_ctx_set(&log_output_read, &output);
+
+	while (readPos != endPos) {
+		const size_t recordStart = output.mSize;
+		RecordHeader header;
+
+		int ret = ReadRing(readPos, &header, sizeof(header));
+		bool isValid = ret == 0 && sizeof(header) + header.mSize <= Distance(readPos, endPos);
+
+		if (isValid && header.mType == RecordType::kText) {
+			/* Copy the text directly, truncated to the space left in the output buffer. */
+			if (output.mBuffer) {
+				ret = ReadRing(Advance(readPos, sizeof(header)), output.mBuffer + output.mSize,
+					       std::min<size_t>(header.mSize, output.mCapacity - output.mSize));
+				isValid = ret == 0;
+			}
+			output.mSize += header.mSize;
+		} else if (isValid && header.mType == RecordType::kLogMessage) {
+			ret = ReadLogMessage(Advance(readPos, sizeof(header)), header.mSize);
+			isValid = ret == 0;
+		} else {
+			isValid = false;
+		}
+
+		if (IsOverwritten(readPos)) {
+			/* The record was overwritten while being read, continue from the oldest record still stored. */
+			output.mSize = recordStart;
+			readPos = GetLogsBegin();
+			if (!IsInRange(endPos, readPos, GetLogsEnd())) {
+				endPos = readPos;
+			}
+			continue;
+		}
+
+		if (!isValid) {
+			/* The rest of the records cannot be parsed, stop reading. */
+			output.mSize = recordStart;
+			endPos = readPos;
+			err = ret == 0 || ret == -EBADMSG ? CHIP_NO_ERROR : System::MapErrorZephyr(ret);
+			break;
+		}
+
+		if (header.mType == RecordType::kLogMessage) {
+			log_output_msg_process(&log_output_read, reinterpret_cast<struct log_msg *>(sMessageBuffer),
+					       kLogOutputFlags);
+		}
+
+		/* Leave the record that does not fit for the next chunk, unless it is the only one. */
+		if (output.mBuffer && output.mSize > output.mCapacity && recordStart > 0) {
+			output.mSize = recordStart;
+			break;
+		}
+
+		readPos = Advance(readPos, sizeof(header) + header.mSize);
+
+		if (output.mBuffer && output.mSize >= output.mCapacity) {
+			break;
+		}
+	}
+
+	outSize = output.mSize;
+	outBuffer.reduce_size(std::min(output.mSize, outBuffer.size()));
+
+	return err;
+}
+
+size_t DiagnosticLogsBinaryRetentionReader::GetLogsSize()
+{
+	MutableByteSpan sizeOnly;
+	uint32_t readPos = mDiagnosticLogsRetention.GetLogsBegin();
+	uint32_t endPos = mDiagnosticLogsRetention.GetLogsEnd();
+	size_t size = 0;
+
+	/* The records are converted to text without storing it, only to learn its size. */
+	mDiagnosticLogsRetention.GetLogs(sizeOnly, readPos, endPos, size);
+
+	return size;
+}
+
+CHIP_ERROR DiagnosticLogsBinaryRetentionReader::GetLogs(chip::MutableByteSpan &outBuffer, bool &outIsEndOfLog)
+{
+	size_t unusedSize;
+
+	if (!mReadInProgress) {
+		/* Remember the data end, so that the logs written during the read process are not included. */
+		mReadPos = mDiagnosticLogsRetention.GetLogsBegin();
+		mEndPos = mDiagnosticLogsRetention.GetLogsEnd();
+		mReadInProgress = true;
+	}
+
+	CHIP_ERROR err = mDiagnosticLogsRetention.GetLogs(outBuffer, mReadPos, mEndPos, unusedSize);
+
+	if (mReadPos == mEndPos) {
+		mReadInProgress = false;
+		outIsEndOfLog = true;
+	} else {
+		outIsEndOfLog = false;
+	}
+
+	return err;
+}
+
+CHIP_ERROR DiagnosticLogsBinaryRetentionReader::FinishLogs()
+{
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_REMOVE_CRASH_AFTER_READ
+	return mDiagnosticLogsRetention.Clear();
+#else
+	/* Do nothing. */
+	return CHIP_NO_ERROR;
+#endif /* CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_REMOVE_CRASH_AFTER_READ */
+}
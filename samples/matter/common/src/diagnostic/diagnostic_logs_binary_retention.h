@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include "diagnostic_logs_intent_iface.h"
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+#include <zephyr/logging/log_msg.h>
+#include <zephyr/retention/retention.h>
+#include <zephyr/sys/atomic.h>
+
+/*
+   DiagnosticLogsBinaryRetention stores logs in the retention RAM as compact binary records instead of formatted text.
+   Log messages redirected from the logger are saved as the raw cbprintf package, so no formatting takes place on the
+   logging path. The records are converted to text only when the Matter controller reads the logs.
+
+   Positions of the oldest and the newest record are kept in atomic cursors. Writers update them under the scheduler
+   lock, and readers never block writers. Instead, a reader checks the cursors after copying each record and
+   skips the records that were overwritten in the meantime.
+
+   Log message records refer to the format strings stored in the firmware image, so they are discarded on boot
+   if the image has changed.
+
+   The scheduler lock does not exclude interrupts, so the records must not be written from an interrupt context.
+*/
+class DiagnosticLogsBinaryRetention {
+public:
+	DiagnosticLogsBinaryRetention(const struct device *partition) : mPartition(partition) {}
+
+	/**
+	 * @brief Validates the retention RAM content and initializes the module.
+	 *
+	 * @return CHIP_NO_ERROR on success, the other error code on failure.
+	 */
+	CHIP_ERROR Init();
+
+	/**
+	 * @brief Stores given text logs in the retention RAM.
+	 *
+	 * If the buffer is full, the new record overrides the oldest ones.
+	 * Text longer than the maximum record size is split into several records.
+	 * Must not be called from an interrupt context.
+	 *
+	 * @param data address of logs data to be stored in the buffer
+	 * @param size size of data to be stored in the buffer
+	 *
+	 * @return CHIP_NO_ERROR on success, the other error code on failure.
+	 */
+	CHIP_ERROR PushLog(const void *data, size_t size);
+
+	/**
+	 * @brief Stores given logger message in the retention RAM without formatting it.
+	 *
+	 * If the buffer is full, the new record overrides the oldest ones.
+	 * Hexdump data which does not fit the maximum record size is truncated.
+	 * Must not be called from an interrupt context.
+	 *
+	 * @param msg logger message to be stored in the buffer
+	 *
+	 * @return CHIP_NO_ERROR on success, the other error code on failure.
+	 */
+	CHIP_ERROR PushLogMessage(struct log_msg *msg);
+
+	/**
+	 * @brief Clear the logs stored in the retention memory.
+	 *
+	 * @return CHIP_NO_ERROR on success, the other error code on failure.
+	 */
+	CHIP_ERROR Clear();
+
+	/**
+	 * @brief Get the position of the oldest record.
+	 */
+	uint32_t GetLogsBegin() { return static_cast<uint32_t>(atomic_get(&mBegin)); }
+
+	/**
+	 * @brief Get the position following the newest record.
+	 */
+	uint32_t GetLogsEnd() { return static_cast<uint32_t>(atomic_get(&mEnd)); }
+
+	/**
+	 * @brief Convert the records starting at the given position to text.
+	 *
+	 * Records are converted until the end position is reached or the next record does not fit the output buffer.
+	 * If the first record does not fit the output buffer, it is truncated.
+	 * Positions are moved forward if the records they point to have been overwritten in the meantime.
+	 * Must be called from the Matter thread.
+	 *
+	 * @param outBuffer output buffer to store the logs, or an empty span to compute the size only
+	 * @param readPos position of the first record to read, updated to the first not read record
+	 * @param endPos position at which the reading stops
+	 * @param outSize number of bytes of text the read records are converted to
+	 *
+	 * @return CHIP_NO_ERROR on success, the other error code on failure.
+	 */
+	CHIP_ERROR GetLogs(chip::MutableByteSpan &outBuffer, uint32_t &readPos, uint32_t &endPos, size_t &outSize);
+
+private:
+	enum class RecordType : uint8_t { kText = 1, kLogMessage = 2 };
+
+	struct PartitionHeader {
+		uint32_t mImageTag;
+		uint32_t mBegin;
+		uint32_t mEnd;
+	};
+
+	struct RecordHeader {
+		uint16_t mSize;
+		RecordType mType;
+		uint8_t mReserved;
+	};
+
+	struct LogMessageHeader {
+		log_timestamp_t mTimestamp;
+		uint16_t mSourceId;
+		uint16_t mPackageSize;
+		uint16_t mDataSize;
+		uint8_t mDomain;
+		uint8_t mLevel;
+	};
+
+	static constexpr size_t kMaxRecordPayloadSize = CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_MAX_RECORD_SIZE;
+
+	uint32_t Advance(uint32_t pos, size_t size) const;
+	uint32_t Distance(uint32_t from, uint32_t to) const;
+	bool IsInRange(uint32_t pos, uint32_t begin, uint32_t end) const;
+	bool IsOverwritten(uint32_t pos);
+
+	int WriteRing(uint32_t pos, const void *data, size_t size);
+	int ReadRing(uint32_t pos, void *data, size_t size);
+	int WriteHeader();
+	CHIP_ERROR WriteRecord(RecordType type, const void *first, size_t firstSize, const void *second,
+			       size_t secondSize, const void *third, size_t thirdSize);
+	int ReadLogMessage(uint32_t pos, size_t size);
+
+	static uint32_t GetImageTag();
+
+	bool mIsInitialized = false;
+	uint32_t mImageTag = 0;
+	size_t mCapacity = 0;
+	/* Positions grow monotonically modulo the largest multiple of the capacity fitting into 32 bits,
+	 * so that a position that has been overwritten can be told apart from the current one. */
+	uint32_t mRange = 0;
+	atomic_t mBegin = ATOMIC_INIT(0);
+	atomic_t mEnd = ATOMIC_INIT(0);
+
+	const struct device *mPartition;
+
+	/* The record is assembled in the buffer before it is written. */
+	static uint8_t sRecordBuffer[sizeof(RecordHeader) + kMaxRecordPayloadSize];
+};
+
+class DiagnosticLogsBinaryRetentionReader : public Nrf::Matter::DiagnosticLogsIntentIface {
+public:
+	DiagnosticLogsBinaryRetentionReader(DiagnosticLogsBinaryRetention &diagnosticLogsRetention)
+		: mDiagnosticLogsRetention(diagnosticLogsRetention)
+	{
+	}
+
+	/**
+	 * @brief Get the captured logs converted to text.
+	 *
+	 * @param outBuffer output buffer to store the logs
+	 * @param outIsEndOfLog flag informing whether the stored data is complete log or one of the few chunks
+	 *
+	 * @return CHIP_NO_ERROR on success, the other error code on failure.
+	 */
+	CHIP_ERROR GetLogs(chip::MutableByteSpan &outBuffer, bool &outIsEndOfLog) override;
+
+	/**
+	 * @brief Finish the log capturing. This method is used to perform potential clean up after session.
+	 */
+	CHIP_ERROR FinishLogs() override;
+
+	/**
+	 * @brief Get the size of captured logs converted to text.
+	 *
+	 * @return size of captured logs in bytes
+	 */
+	size_t GetLogsSize() override;
+
+private:
+	uint32_t mReadPos = 0;
+	uint32_t mEndPos = 0;
+	bool mReadInProgress = false;
+	DiagnosticLogsBinaryRetention &mDiagnosticLogsRetention;
+};
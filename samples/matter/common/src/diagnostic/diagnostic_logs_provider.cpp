@@ -65,12 +65,12 @@ void IntentData::Clear()
 		break;
 	case chip::app::Clusters::DiagnosticLogs::IntentEnum::kEndUserSupport:
 #ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_END_USER_LOGS
-		Platform::Delete(reinterpret_cast<DiagnosticLogsRetentionReader *>(mIntentImpl));
+		Platform::Delete(reinterpret_cast<LogsRetentionReader *>(mIntentImpl));
 #endif /* CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_END_USER_LOGS */
 		break;
 	case chip::app::Clusters::DiagnosticLogs::IntentEnum::kNetworkDiag:
 #ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_NETWORK_LOGS
-		Platform::Delete(reinterpret_cast<DiagnosticLogsRetentionReader *>(mIntentImpl));
+		Platform::Delete(reinterpret_cast<LogsRetentionReader *>(mIntentImpl));
 #endif /* CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_NETWORK_LOGS */
 		break;
 	default:
@@ -91,7 +91,7 @@ CHIP_ERROR DiagnosticLogProvider::SetIntentImplementation(IntentEnum intent, Int
 		break;
 	case IntentEnum::kEndUserSupport:
 #ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_END_USER_LOGS
-		intentData.mIntentImpl = Platform::New<DiagnosticLogsRetentionReader>(mEndUserLogs);
+		intentData.mIntentImpl = Platform::New<LogsRetentionReader>(mEndUserLogs);
 		if (!intentData.mIntentImpl) {
 			return CHIP_ERROR_NO_MEMORY;
 		}
@@ -99,7 +99,7 @@ CHIP_ERROR DiagnosticLogProvider::SetIntentImplementation(IntentEnum intent, Int
 		break;
 	case IntentEnum::kNetworkDiag:
 #ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_NETWORK_LOGS
-		intentData.mIntentImpl = Platform::New<DiagnosticLogsRetentionReader>(mNetworkLogs);
+		intentData.mIntentImpl = Platform::New<LogsRetentionReader>(mNetworkLogs);
 		if (!intentData.mIntentImpl) {
 			return CHIP_ERROR_NO_MEMORY;
 		}
@@ -231,16 +231,14 @@ size_t DiagnosticLogProvider::GetSizeForIntent(IntentEnum intent)
 	switch (intent) {
 #ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_END_USER_LOGS
 	case IntentEnum::kEndUserSupport: {
-		Platform::UniquePtr<DiagnosticLogsRetentionReader> userData(
-			Platform::New<DiagnosticLogsRetentionReader>(mEndUserLogs));
+		Platform::UniquePtr<LogsRetentionReader> userData(Platform::New<LogsRetentionReader>(mEndUserLogs));
 		logSize = userData->GetLogsSize();
 		break;
 	}
 #endif /* CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_END_USER_LOGS */
 #ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_NETWORK_LOGS
 	case IntentEnum::kNetworkDiag: {
-		Platform::UniquePtr<DiagnosticLogsRetentionReader> networkData(
-			Platform::New<DiagnosticLogsRetentionReader>(mNetworkLogs));
+		Platform::UniquePtr<LogsRetentionReader> networkData(Platform::New<LogsRetentionReader>(mNetworkLogs));
 		logSize = networkData->GetLogsSize();
 		break;
 	}
@@ -365,6 +363,35 @@ CHIP_ERROR DiagnosticLogProvider::PushLog(IntentEnum intent, const void *data, s
 	return err;
 }
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_FORMAT_BINARY
+CHIP_ERROR DiagnosticLogProvider::PushLogMessage(IntentEnum intent, struct log_msg *msg)
+{
+	CHIP_ERROR err = CHIP_NO_ERROR;
+
+	switch (intent) {
+	case IntentEnum::kEndUserSupport:
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_END_USER_LOGS
+		err = mEndUserLogs.PushLogMessage(msg);
+#else
+		err = CHIP_ERROR_NOT_IMPLEMENTED;
+#endif /* CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_END_USER_LOGS */
+		break;
+	case IntentEnum::kNetworkDiag:
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_NETWORK_LOGS
+		err = mNetworkLogs.PushLogMessage(msg);
+#else
+		err = CHIP_ERROR_NOT_IMPLEMENTED;
+#endif /* CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_NETWORK_LOGS */
+		break;
+	default:
+		err = CHIP_ERROR_INVALID_ARGUMENT;
+		break;
+	}
+
+	return err;
+}
+#endif /* CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_FORMAT_BINARY */
+
 void emberAfDiagnosticLogsClusterInitCallback(chip::EndpointId endpoint)
 {
 	auto &logProvider = DiagnosticLogProvider::GetInstance();
@@ -8,7 +8,9 @@
 
 #include "diagnostic_logs_intent_iface.h"
 
-#if defined(CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_END_USER_LOGS) ||                                                 \
+#if defined(CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_FORMAT_BINARY)
+#include "diagnostic_logs_binary_retention.h"
+#elif defined(CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_END_USER_LOGS) ||                                               \
 	defined(CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_NETWORK_LOGS)
 #include "diagnostic_logs_retention.h"
 #endif
@@ -21,6 +23,15 @@
 namespace Nrf::Matter
 {
 
+#if defined(CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_FORMAT_BINARY)
+using LogsRetention = DiagnosticLogsBinaryRetention;
+using LogsRetentionReader = DiagnosticLogsBinaryRetentionReader;
+#elif defined(CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_END_USER_LOGS) ||                                               \
+	defined(CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_NETWORK_LOGS)
+using LogsRetention = DiagnosticLogsRetention;
+using LogsRetentionReader = DiagnosticLogsRetentionReader;
+#endif
+
 struct IntentData {
 	chip::app::Clusters::DiagnosticLogs::IntentEnum mIntent =
 		chip::app::Clusters::DiagnosticLogs::IntentEnum::kUnknownEnumValue;
@@ -118,6 +129,22 @@ public:
 	 */
 	CHIP_ERROR PushLog(chip::app::Clusters::DiagnosticLogs::IntentEnum intent, const void *data, size_t size);
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_FORMAT_BINARY
+	/**
+	 * @brief Push the logger message to the logs ring buffer without formatting it.
+	 *
+	 * If the buffer is full, the new message overrides the oldest data.
+	 * The message is converted to text when the logs are read.
+	 * It supports only end user and network intents.
+	 *
+	 * @param intent the type of pushed log
+	 * @param msg logger message to be stored in the buffer
+	 *
+	 * @return CHIP_NO_ERROR on success, the other error code on failure.
+	 */
+	CHIP_ERROR PushLogMessage(chip::app::Clusters::DiagnosticLogs::IntentEnum intent, struct log_msg *msg);
+#endif /* CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_FORMAT_BINARY */
+
 private:
 	/* The maximum number of the simultaneous sessions */
 	constexpr static uint16_t kMaxLogSessionHandle =
@@ -154,11 +181,11 @@ private:
 		mIntentMap;
 
 #ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_NETWORK_LOGS
-	DiagnosticLogsRetention mNetworkLogs;
+	LogsRetention mNetworkLogs;
 #endif /* CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_NETWORK_LOGS */
 
 #ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_END_USER_LOGS
-	DiagnosticLogsRetention mEndUserLogs;
+	LogsRetention mEndUserLogs;
 #endif /* CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_END_USER_LOGS */
 };
 
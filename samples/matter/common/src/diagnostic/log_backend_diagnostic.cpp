@@ -10,6 +10,8 @@
 #include <zephyr/logging/log_backend.h>
 
 static uint32_t sLogFormat = LOG_OUTPUT_TEXT;
+
+#ifndef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_FORMAT_BINARY
 /* The buffer size was selected to be able to store single log line (usually in Matter we have logs < 200 B).
  * In case the log will not fit it will be printed anyway, but usng fragmentation, so setting a small buffer
  * increases the time of printing.
@@ -34,6 +36,7 @@ static int RedirectEndUserLog(uint8_t *data, size_t length, void *context)
 
 LOG_OUTPUT_DEFINE(log_output_network, RedirectNetworkLog, sLogBuffer, sizeof(sLogBuffer));
 LOG_OUTPUT_DEFINE(log_output_end_user, RedirectEndUserLog, sLogBuffer, sizeof(sLogBuffer));
+#endif /* CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_FORMAT_BINARY */
 
 void ProcessLog(const struct log_backend *const backend, union log_msg_generic *msg)
 {
@@ -43,7 +46,9 @@ void ProcessLog(const struct log_backend *const backend, union log_msg_generic *
 		return;
 	}
 
+#ifndef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_FORMAT_BINARY
 	const uint32_t flags = LOG_OUTPUT_FLAG_TIMESTAMP | LOG_OUTPUT_FLAG_FORMAT_TIMESTAMP | LOG_OUTPUT_FLAG_LEVEL;
+#endif
 	/* Source id has to be obtained from different places, depending on runtime filtering. */
 	uint32_t sourceId = IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ?
 				    log_dynamic_source_id(reinterpret_cast<log_source_dynamic_data *>(source)) :
@@ -54,7 +59,12 @@ void ProcessLog(const struct log_backend *const backend, union log_msg_generic *
 		return;
 	}
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_FORMAT_BINARY
+	/* The message is stored as is and formatted only when the logs are read. */
+	auto &provider = Nrf::Matter::DiagnosticLogProvider::GetInstance();
+#else
 	const log_format_func_t logFormatter = log_format_func_t_get(sLogFormat);
+#endif
 
 	/* The assumption following redirection is done:
 	 * - chip -> diagnostic network logs
@@ -63,12 +73,20 @@ void ProcessLog(const struct log_backend *const backend, union log_msg_generic *
 	 */
 #ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_NETWORK_LOGS
 	if (strncmp(sourceName, "chip", strlen("chip")) == 0) {
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_FORMAT_BINARY
+		provider.PushLogMessage(chip::app::Clusters::DiagnosticLogs::IntentEnum::kNetworkDiag, &msg->log);
+#else
 		logFormatter(&log_output_network, &msg->log, flags);
+#endif
 	}
 #endif
 #ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_END_USER_LOGS
 	if (strncmp(sourceName, "app", strlen("app")) == 0) {
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_FORMAT_BINARY
+		provider.PushLogMessage(chip::app::Clusters::DiagnosticLogs::IntentEnum::kEndUserSupport, &msg->log);
+#else
 		logFormatter(&log_output_end_user, &msg->log, flags);
+#endif
 	}
 #endif
 }
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace Nrf
+{
+/*
+   HashedFiniteMap template container is a FiniteMap variant that finds items in constant time on average,
+   instead of scanning all the slots. It offers the same API as FiniteMap, so it can be used instead of it
+   when the map is large or used on a hot path.
+   The items are stored in the publicly available mMap member, and an open addressing hash table with linear
+   probing maps the keys to the mMap slots. The free slots are kept on a free list, so inserting an item does not
+   scan the map either.
+   The differences to FiniteMap are:
+     * GetFirstFreeSlot returns the slot that will be used by the next Insert, which is not necessarily
+	   the first free slot in mMap.
+     * The items are not kept in the first Size() slots of mMap, so the iteration over mMap must skip the slots
+	   with kInvalidKey.
+	Prerequisites:
+     * T1 must be an integral type and the maximum numeric limit for the T1-type value is reserved and assigned as
+   an invalid key. Pointers can be used as keys after casting them to uintptr_t.
+     * T2 must have move semantics and bool()/==operators implemented
+*/
+template <typename T1, typename T2, uint16_t N> struct HashedFiniteMap {
+	static_assert(std::is_integral_v<T1>);
+	static_assert(N > 0 && N < std::numeric_limits<uint16_t>::max());
+
+	static constexpr T1 kInvalidKey{ std::numeric_limits<T1>::max() };
+	static constexpr std::size_t kNoSlotsFound{ N + 1 };
+	using ElementCounterType = uint16_t;
+
+	struct Item {
+		/* Initialize with invalid key (0 is a valid key) */
+		T1 key{ kInvalidKey };
+		T2 value;
+	};
+
+	HashedFiniteMap()
+	{
+		for (auto &bucket : mBuckets) {
+			bucket = kEmptyBucket;
+		}
+
+		for (ElementCounterType slot = 0; slot < N; slot++) {
+			mNextFreeSlot[slot] = slot + 1;
+		}
+	}
+
+	bool Insert(T1 key, T2 &&value)
+	{
+		if (key == kInvalidKey || mFreeSlot == N) {
+			return false;
+		}
+
+		std::size_t bucket = FindBucket(key);
+		if (mBuckets[bucket] != kEmptyBucket) {
+			/* The key already exists in the map, return prematurely. */
+			return false;
+		}
+
+		ElementCounterType slot = mFreeSlot;
+		mFreeSlot = mNextFreeSlot[slot];
+		mMap[slot].key = key;
+		mMap[slot].value = std::move(value);
+		mBuckets[bucket] = slot;
+		mElementsCount++;
+		return true;
+	}
+
+	bool Erase(T1 key)
+	{
+		std::size_t bucket = FindBucket(key);
+		ElementCounterType slot = mBuckets[bucket];
+
+		if (slot == kEmptyBucket) {
+			return false;
+		}
+
+		mMap[slot].value = T2{};
+		mMap[slot].key = kInvalidKey;
+		mNextFreeSlot[slot] = mFreeSlot;
+		mFreeSlot = slot;
+		mElementsCount--;
+		RemoveBucket(bucket);
+		return true;
+	}
+
+	/* Always use Contains() before using operator[]. */
+	T2 &operator[](T1 key)
+	{
+		static T2 dummyObject;
+		ElementCounterType slot = mBuckets[FindBucket(key)];
+
+		if (slot == kEmptyBucket) {
+			return dummyObject;
+		}
+		return mMap[slot].value;
+	}
+
+	bool Contains(T1 key) { return mBuckets[FindBucket(key)] != kEmptyBucket; }
+
+	ElementCounterType FreeSlots() { return N - mElementsCount; }
+
+	ElementCounterType Size() { return mElementsCount; }
+
+	ElementCounterType GetFirstFreeSlot() { return mFreeSlot == N ? kNoSlotsFound : mFreeSlot; }
+
+	uint8_t GetDuplicatesCount(const T2 &value, T1 *key)
+	{
+		/* Find the first duplicated item and return its key,
+		 so that the application can handle the duplicate by itself. */
+		*key = kInvalidKey;
+		uint8_t numberOfDuplicates = 0;
+		for (auto it = std::begin(mMap); it != std::end(mMap); ++it) {
+			if (it->key != kInvalidKey && it->value == value) {
+				*(key++) = it->key;
+				numberOfDuplicates++;
+			}
+		}
+
+		return numberOfDuplicates;
+	}
+
+	Item mMap[N];
+	ElementCounterType mElementsCount{ 0 };
+
+private:
+	static constexpr uint8_t BucketBits()
+	{
+		/* Keep the load factor at or below 50% to keep the probe sequences short. */
+		uint8_t bits = 1;
+		while ((std::size_t{ 1 } << bits) < 2 * std::size_t{ N }) {
+			bits++;
+		}
+		return bits;
+	}
+
+	static constexpr uint8_t kBucketBits = BucketBits();
+	static constexpr std::size_t kBucketsCount = std::size_t{ 1 } << kBucketBits;
+	static constexpr std::size_t kBucketMask = kBucketsCount - 1;
+	static constexpr ElementCounterType kEmptyBucket = std::numeric_limits<ElementCounterType>::max();
+
+	static std::size_t Hash(T1 key)
+	{
+		/* Fibonacci hashing, the top bits of the product depend on all bits of the key. */
+		uint64_t product = static_cast<uint64_t>(key) * UINT64_C(0x9E3779B97F4A7C15);
+		return static_cast<std::size_t>(product >> (64 - kBucketBits));
+	}
+
+	/* Return the bucket holding the key, or the empty bucket ending its probe sequence. */
+	std::size_t FindBucket(T1 key)
+	{
+		std::size_t bucket = Hash(key);
+
+		while (mBuckets[bucket] != kEmptyBucket && mMap[mBuckets[bucket]].key != key) {
+			bucket = (bucket + 1) & kBucketMask;
+		}
+		return bucket;
+	}
+
+	/* Empty the bucket and move the following items of the probe sequence into the gap, so that lookups
+	 * can stop at the first empty bucket without tombstones. */
+	void RemoveBucket(std::size_t hole)
+	{
+		std::size_t bucket = hole;
+
+		while (true) {
+			bucket = (bucket + 1) & kBucketMask;
+			if (mBuckets[bucket] == kEmptyBucket) {
+				break;
+			}
+
+			/* The item can fill the hole if the hole lies between its home bucket and its bucket. */
+			std::size_t home = Hash(mMap[mBuckets[bucket]].key);
+			if (((bucket - home) & kBucketMask) >= ((bucket - hole) & kBucketMask)) {
+				mBuckets[hole] = mBuckets[bucket];
+				hole = bucket;
+			}
+		}
+
+		mBuckets[hole] = kEmptyBucket;
+	}
+
+	ElementCounterType mBuckets[kBucketsCount];
+	ElementCounterType mNextFreeSlot[N];
+	ElementCounterType mFreeSlot{ 0 };
+};
+
+} /* namespace Nrf */
@@ -10,6 +10,7 @@ import logging
 import signal
 from stream import Stream
 from rtt2stream import Rtt2Stream
+from file2stream import File2Stream
 from model_creator import ModelCreator
 
 is_waiting = True
@@ -17,15 +18,25 @@ def signal_handler(sig, frame):
     global is_waiting
     is_waiting = False
 
-def rtt2stream(stream, event, event_close, log_lvl_number):
+def rtt2stream(stream, event, event_close, log_lvl_number, enabled_events):
     signal.signal(signal.SIGINT, signal.SIG_IGN)
     try:
-        rtt2s = Rtt2Stream(stream, event_close, log_lvl=log_lvl_number)
+        rtt2s = Rtt2Stream(stream, event_close, log_lvl=log_lvl_number,
+                           enabled_events=enabled_events)
         event.wait()
         rtt2s.read_and_transmit_data()
     except Exception as e:
         print("[ERROR] Unhandled exception in Profiler Rtt to stream module: {}".format(e))
 
+def file2stream(stream, event, event_close, input_file, log_lvl_number):
+    signal.signal(signal.SIGINT, signal.SIG_IGN)
+    try:
+        file2s = File2Stream(stream, event_close, input_file, log_lvl=log_lvl_number)
+        event.wait()
+        file2s.read_and_transmit_data()
+    except Exception as e:
+        print("[ERROR] Unhandled exception in Profiler file to stream module: {}".format(e))
+
 def model_creator(stream, event, event_close, dataset_name, log_lvl_number):
     signal.signal(signal.SIGINT, signal.SIG_IGN)
     try:
@@ -50,6 +61,10 @@ def main():
     parser.add_argument('time', type=int, help='Time of collecting data [s]')
     parser.add_argument('dataset_name', help='Name of dataset')
     parser.add_argument('--log', help='Log level')
+    parser.add_argument('--events', nargs='+', metavar='EVENT',
+                        help='Names of event types to be profiled (by default, all of them)')
+    parser.add_argument('--input-file',
+                        help='Read data written by the file transport instead of using RTT')
     args = parser.parse_args()
 
     if args.log is not None:
@@ -66,10 +81,18 @@ def main():
     streams = Stream.create_stream(2)
 
     processes = []
-    processes.append((Process(target=rtt2stream,
-                                args=(streams[0], event, event_close_rtt2stream, log_lvl_number),
-                                daemon=True),
-                        event_close_rtt2stream))
+    if args.input_file is not None:
+        processes.append((Process(target=file2stream,
+                                    args=(streams[0], event, event_close_rtt2stream,
+                                        args.input_file, log_lvl_number),
+                                    daemon=True),
+                            event_close_rtt2stream))
+    else:
+        processes.append((Process(target=rtt2stream,
+                                    args=(streams[0], event, event_close_rtt2stream,
+                                        log_lvl_number, args.events),
+                                    daemon=True),
+                            event_close_rtt2stream))
     processes.append((Process(target=model_creator,
                                 args=(streams[1], event, event_close_model_creator,
                                     args.dataset_name, log_lvl_number),
@@ -0,0 +1,45 @@
+#
+# Copyright (c) 2025 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+import sys
+import logging
+from stream import StreamError
+
+class File2Stream:
+    def __init__(self, out_stream, event_close, data_filename, log_lvl=logging.INFO):
+        self.out_stream = out_stream
+        self.event_close = event_close
+        self.data_filename = data_filename
+        # Event type descriptions are written by the device to the file with the .info suffix.
+        self.info_filename = data_filename + '.info'
+
+        self.logger = logging.getLogger('file2stream')
+        self.logger_console = logging.StreamHandler()
+        self.logger.setLevel(log_lvl)
+        self.log_format = logging.Formatter('[%(levelname)s] %(name)s: %(message)s')
+        self.logger_console.setFormatter(self.log_format)
+        self.logger.addHandler(self.logger_console)
+
+    def read_and_transmit_data(self):
+        try:
+            with open(self.info_filename, 'rb') as f:
+                desc_buf = f.read()
+            self.out_stream.send_desc(desc_buf)
+
+            with open(self.data_filename, 'rb') as f:
+                while True:
+                    buf = f.read(4096)
+                    if len(buf) == 0:
+                        break
+                    self.out_stream.send_ev(buf)
+        except IOError as err:
+            self.logger.error("Problem with reading file: {}".format(err))
+            sys.exit()
+        except StreamError as err:
+            self.logger.error("Error: {}. Unable to send data".format(err))
+            sys.exit()
+
+        self.logger.info("All data read from {}".format(self.data_filename))
+        self.event_close.wait()
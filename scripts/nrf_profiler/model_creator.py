@@ -18,8 +18,10 @@ class Command(Enum):
     START = 1
     STOP = 2
     INFO = 3
+    SET_MASK = 4
 
-NRF_PROFILER_FATAL_ERROR_EVENT_NAME = "_nrf_profiler_fatal_error_event_"
+NRF_PROFILER_DROPPED_EVENTS_EVENT_NAME = "_nrf_profiler_dropped_events_"
+NRF_PROFILER_TIMESTAMP_DELTA_EVENT_NAME = "_nrf_profiler_timestamp_delta_"
 
 class ModelCreator:
 
@@ -48,6 +50,9 @@ class ModelCreator:
 
         self.timestamp_overflows = 0
         self.after_half = False
+        self.timestamp_delta = False
+        self.timestamp_raw_prev = 0
+        self.dropped_events_id = None
 
         self.processed_events = ProcessedEvents()
         self.temp_events = []
@@ -145,6 +150,10 @@ class ModelCreator:
             self.raw_data.get_event_type_id('event_processing_start')
         self.event_processing_end_id = \
             self.raw_data.get_event_type_id('event_processing_end')
+        self.dropped_events_id = \
+            self.raw_data.get_event_type_id(NRF_PROFILER_DROPPED_EVENTS_EVENT_NAME)
+        self.timestamp_delta = \
+            self.raw_data.get_event_type_id(NRF_PROFILER_TIMESTAMP_DELTA_EVENT_NAME) is not None
 
         if self.sending:
             event_types_dict = dict((k, v.serialize())
@@ -156,6 +165,20 @@ class ModelCreator:
                 self.logger.error("Sending error: {}. Cannot send descriptions.".format(err))
                 sys.exit()
 
+    def _read_timestamp_delta(self):
+        # Difference from the previous timestamp is zigzag and varint encoded.
+        value = 0
+        shift = 0
+        while True:
+            byte = self._read_bytes(1)[0]
+            value |= (byte & 0x7f) << shift
+            shift += 7
+            if not byte & 0x80:
+                break
+        delta = (value >> 1) ^ -(value & 1)
+        self.timestamp_raw_prev = (self.timestamp_raw_prev + delta) % self.config['timestamp_raw_max']
+        return self.timestamp_raw_prev
+
     def _read_single_event(self):
         id = int.from_bytes(
             self._read_bytes(1),
@@ -163,12 +186,15 @@ class ModelCreator:
             signed=False)
         et = self.raw_data.registered_events_types[id]
 
-        buf = self._read_bytes(4)
-        timestamp_raw = (
-            int.from_bytes(
-                buf,
-                byteorder=self.config['byteorder'],
-                signed=False))
+        if self.timestamp_delta:
+            timestamp_raw = self._read_timestamp_delta()
+        else:
+            buf = self._read_bytes(4)
+            timestamp_raw = (
+                int.from_bytes(
+                    buf,
+                    byteorder=self.config['byteorder'],
+                    signed=False))
 
         if self.after_half \
         and timestamp_raw < 0.4 * self.config['timestamp_raw_max']:
@@ -253,9 +279,10 @@ class ModelCreator:
                 self.event_types_filename)
         while True:
             event = self._read_single_event()
-            if self.raw_data.registered_events_types[event.type_id].name == NRF_PROFILER_FATAL_ERROR_EVENT_NAME:
-                self.logger.error("Fatal error of Profiler on device! Event has been dropped. "
-                                  "Data buffer has overflown. No more events will be received.")
+            if event.type_id == self.dropped_events_id:
+                self.logger.warning("Data buffer has overflown on device! "
+                                    "{} events have been dropped.".format(event.data[0]))
+                continue
 
             if event.type_id == self.event_processing_start_id:
                 self.start_event = event
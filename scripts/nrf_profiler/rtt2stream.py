@@ -10,18 +10,23 @@ import time
 from pynrfjprog.LowLevel import API
 from pynrfjprog.APIError import APIError
 from enum import Enum
+from io import StringIO
+import csv
 from stream import StreamError
 
 class Command(Enum):
     START = 1
     STOP = 2
     INFO = 3
+    SET_MASK = 4
 
 class Rtt2Stream:
-    def __init__(self, out_stream, event_close, config=RttNordicConfig, log_lvl=logging.INFO):
+    def __init__(self, out_stream, event_close, config=RttNordicConfig, log_lvl=logging.INFO,
+                 enabled_events=None):
         self.config = config
 
         self.out_stream = out_stream
+        self.enabled_events = enabled_events
 
         self.event_close = event_close
 
@@ -181,6 +186,9 @@ class Rtt2Stream:
             self._disconnect_rtt()
             sys.exit()
 
+        if self.enabled_events is not None:
+            self._set_event_mask(desc_buf)
+
         self._start_logging_events()
         while True:
             if self.event_close.is_set():
@@ -205,9 +213,28 @@ class Rtt2Stream:
     def _stop_logging_events(self):
         self._send_command(Command.STOP)
 
-    def _send_command(self, command_type):
+    def _set_event_mask(self, desc_buf):
+        ids = {}
+        for row in csv.reader(StringIO(desc_buf.decode()), delimiter=','):
+            # Empty field is sent after last event description
+            if len(row) == 0:
+                break
+            ids[row[0]] = int(row[1])
+
+        mask = bytearray((max(ids.values()) + 8) // 8)
+        for name in self.enabled_events:
+            if name not in ids:
+                self.logger.warning("Event type {} is not registered".format(name))
+                continue
+            mask[ids[name] // 8] |= 1 << (ids[name] % 8)
+
+        self.logger.info("Profiling only event types: {}".format(', '.join(self.enabled_events)))
+        self._send_command(Command.SET_MASK, bytes([len(mask)]) + mask)
+
+    def _send_command(self, command_type, payload=b''):
         command = bytearray(1)
         command[0] = command_type.value
+        command.extend(payload)
         try:
             self.jlink.rtt_write(self.rtt_down_channels['command'], command, None)
         except APIError:
@@ -8,6 +8,8 @@
 #include <zephyr/kernel.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/slist.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/init.h>
 #include <app_event_manager.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/reboot.h>
@@ -20,7 +22,9 @@ static void event_processor_fn(struct k_work *work);
 struct app_event_manager_event_display_bm _app_event_manager_event_display_bm;
 
 static K_WORK_DEFINE(event_processor, event_processor_fn);
+#if !IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIORITY_LANES)
 static sys_slist_t eventq = SYS_SLIST_STATIC_INIT(&eventq);
+#endif
 static struct k_spinlock lock;
 
 static bool log_is_event_displayed(const struct event_type *et)
@@ -76,23 +80,25 @@ static void log_event(const struct app_event_header *aeh)
 	}
 }
 
-static void log_event_progress(const struct event_type *et,
-			       const struct event_listener *el)
+static bool log_is_handler_displayed(const struct event_type *et)
 {
-	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENTS) ||
-	    !IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENT_HANDLERS) ||
-	    !log_is_event_displayed(et)) {
+	return IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENTS) &&
+	       IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENT_HANDLERS) &&
+	       log_is_event_displayed(et);
+}
+
+static void log_event_progress(bool displayed, const struct event_listener *el)
+{
+	if (!displayed) {
 		return;
 	}
 
 	LOG_INF("|\tnotifying %s", el->name);
 }
 
-static void log_event_consumed(const struct event_type *et)
+static void log_event_consumed(bool displayed)
 {
-	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENTS) ||
-	    !IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENT_HANDLERS) ||
-	    !log_is_event_displayed(et)) {
+	if (!displayed) {
 		return;
 	}
 
@@ -114,6 +120,65 @@ static void log_event_init(void)
 	}
 }
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+atomic_t _app_event_manager_pool_fallback_cnt[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+
+static bool pool_owns(const struct k_mem_slab *pool, const void *addr)
+{
+	const char *start = pool->buffer;
+	const char *end = start + (pool->info.num_blocks * pool->info.block_size);
+
+	return ((const char *)addr >= start) && ((const char *)addr < end);
+}
+
+void *_app_event_manager_pool_alloc(const struct event_type *et, size_t size)
+{
+	APP_EVENT_ASSERT_ID(et);
+
+	struct k_mem_slab *pool = et->pool;
+	void *event;
+
+	if ((pool != NULL) && (size <= pool->info.block_size) &&
+	    !k_mem_slab_alloc(pool, &event, K_NO_WAIT)) {
+		return event;
+	}
+
+	if (pool != NULL) {
+		atomic_inc(&_app_event_manager_pool_fallback_cnt[et - _event_type_list_start]);
+	}
+
+	return app_event_manager_alloc(size);
+}
+
+/* Return the event to its pool. Returns false if the event was not allocated from pool. */
+static bool pool_free(void *addr)
+{
+	const struct app_event_header *aeh = addr;
+	struct k_mem_slab *pool = aeh->type_id->pool;
+
+	if ((pool == NULL) || !pool_owns(pool, addr)) {
+		return false;
+	}
+
+	k_mem_slab_free(pool, addr);
+	return true;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_EVENT_POOLS */
+
+/* Events allocated from pools are returned to the pools here, only the other events are passed to
+ * app_event_manager_free.
+ */
+static void event_free(struct app_event_header *aeh)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+	if (pool_free(aeh)) {
+		return;
+	}
+#endif
+
+	app_event_manager_free(aeh);
+}
+
 void * __weak app_event_manager_alloc(size_t size)
 {
 	void *event = k_malloc(size);
@@ -137,41 +202,178 @@ void __weak app_event_manager_free(void *addr)
 	k_free(addr);
 }
 
-static void event_processor_fn(struct k_work *work)
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_DISPATCH_TABLE)
+/* Maximum number of preprocess or postprocess hooks supported by the dispatch table. */
+#define DISPATCH_TABLE_HOOK_CNT_MAX	32
+
+/* Dispatch information precomputed for an event type. */
+struct event_dispatch {
+	/* Bitmask of preprocess hooks that are called for the event type. */
+	uint32_t preprocess_hooks;
+
+	/* Bitmask of postprocess hooks that are called for the event type. */
+	uint32_t postprocess_hooks;
+
+	/* True if any subscriber of the event type may consume the event. */
+	bool may_consume;
+};
+
+static struct event_dispatch dispatch_table[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+
+/* False if there are too many hooks to be represented in the dispatch table. */
+static bool dispatch_table_hooks;
+
+/* The table is built before any event can be submitted. */
+static int dispatch_table_init(void)
 {
-	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
+	size_t preprocess_hook_cnt;
+	size_t postprocess_hook_cnt;
+	int err = 0;
+
+	STRUCT_SECTION_COUNT(event_preprocess_hook, &preprocess_hook_cnt);
+	STRUCT_SECTION_COUNT(event_postprocess_hook, &postprocess_hook_cnt);
+
+	if ((preprocess_hook_cnt > DISPATCH_TABLE_HOOK_CNT_MAX) ||
+	    (postprocess_hook_cnt > DISPATCH_TABLE_HOOK_CNT_MAX)) {
+		LOG_ERR("Too many hooks for dispatch table (%zu preprocess, %zu postprocess)",
+			preprocess_hook_cnt, postprocess_hook_cnt);
+		err = -E2BIG;
+	}
 
-	/* Make current event list local. */
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	/* The hooks are filtered when they are called if they do not fit in the table. */
+	dispatch_table_hooks = !err;
 
-	if (sys_slist_is_empty(&eventq)) {
-		k_spin_unlock(&lock, key);
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		struct event_dispatch *d = &dispatch_table[et - _event_type_list_start];
+		size_t idx;
+
+		idx = 0;
+		STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
+			if (dispatch_table_hooks && ((h->type == NULL) || (h->type == et))) {
+				d->preprocess_hooks |= BIT(idx);
+			}
+			idx++;
+		}
+
+		idx = 0;
+		STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
+			if (dispatch_table_hooks && ((h->type == NULL) || (h->type == et))) {
+				d->postprocess_hooks |= BIT(idx);
+			}
+			idx++;
+		}
+
+		d->may_consume = false;
+		for (const struct event_subscriber *es = et->subs_start;
+		     es != et->subs_stop;
+		     es++) {
+			if (!es->listener->no_consume) {
+				d->may_consume = true;
+				break;
+			}
+		}
+	}
+
+	return err;
+}
+
+SYS_INIT(dispatch_table_init, PRE_KERNEL_1, 0);
+
+static void preprocess_hooks_call(const struct app_event_header *aeh, uint32_t mask)
+{
+	while (mask) {
+		struct event_preprocess_hook *h;
+
+		STRUCT_SECTION_GET(event_preprocess_hook, u32_count_trailing_zeros(mask), &h);
+		mask &= mask - 1;
+		h->hook(aeh);
+	}
+}
+
+static void postprocess_hooks_call(const struct app_event_header *aeh, uint32_t mask)
+{
+	while (mask) {
+		struct event_postprocess_hook *h;
+
+		STRUCT_SECTION_GET(event_postprocess_hook, u32_count_trailing_zeros(mask), &h);
+		mask &= mask - 1;
+		h->hook(aeh);
+	}
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_DISPATCH_TABLE */
+
+static void preprocess_hooks_run(const struct app_event_header *aeh)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
 		return;
 	}
 
-	sys_slist_merge_slist(&events, &eventq);
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_DISPATCH_TABLE)
+	if (dispatch_table_hooks) {
+		size_t idx = aeh->type_id - _event_type_list_start;
 
-	k_spin_unlock(&lock, key);
+		preprocess_hooks_call(aeh, dispatch_table[idx].preprocess_hooks);
+		return;
+	}
+#endif
 
-	/* Traverse the list of events. */
-	sys_snode_t *node;
-	while (NULL != (node = sys_slist_get(&events))) {
-		struct app_event_header *aeh = CONTAINER_OF(node,
-						       struct app_event_header,
-						       node);
+	STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
+		if ((h->type == NULL) || (h->type == aeh->type_id)) {
+			h->hook(aeh);
+		}
+	}
+}
 
-		APP_EVENT_ASSERT_ID(aeh->type_id);
+static void postprocess_hooks_run(const struct app_event_header *aeh)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
+		return;
+	}
 
-		const struct event_type *et = aeh->type_id;
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_DISPATCH_TABLE)
+	if (dispatch_table_hooks) {
+		size_t idx = aeh->type_id - _event_type_list_start;
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
-				h->hook(aeh);
-			}
+		postprocess_hooks_call(aeh, dispatch_table[idx].postprocess_hooks);
+		return;
+	}
+#endif
+
+	STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
+		if ((h->type == NULL) || (h->type == aeh->type_id)) {
+			h->hook(aeh);
 		}
+	}
+}
+
+static bool event_may_be_consumed(const struct event_type *et)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_DISPATCH_TABLE)
+	return dispatch_table[et - _event_type_list_start].may_consume;
+#else
+	return true;
+#endif
+}
+
+static void event_process(struct app_event_header *aeh)
+{
+	APP_EVENT_ASSERT_ID(aeh->type_id);
+
+	const struct event_type *et = aeh->type_id;
+	bool handler_displayed = log_is_handler_displayed(et);
+
+	preprocess_hooks_run(aeh);
 
-		log_event(aeh);
+	log_event(aeh);
 
+	if (!event_may_be_consumed(et) && !handler_displayed) {
+		/* None of the listeners consumes the event, all of them are notified. */
+		for (const struct event_subscriber *es = et->subs_start;
+		     es != et->subs_stop;
+		     es++) {
+			(void)es->listener->notification(aeh);
+		}
+	} else {
 		bool consumed = false;
 
 		for (const struct event_subscriber *es = et->subs_start;
@@ -185,36 +387,218 @@ static void event_processor_fn(struct k_work *work)
 			__ASSERT_NO_MSG(el != NULL);
 			__ASSERT_NO_MSG(el->notification != NULL);
 
-			log_event_progress(et, el);
+			log_event_progress(handler_displayed, el);
 
 			consumed = el->notification(aeh);
 
 			if (consumed) {
-				log_event_consumed(et);
+				__ASSERT(!el->no_consume, "Listener %s must not consume events",
+					 el->name);
+				/* Return value of a non-consuming listener is ignored. */
+				consumed = !el->no_consume;
 			}
-		}
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
-				h->hook(aeh);
+			if (consumed) {
+				log_event_consumed(handler_displayed);
 			}
 		}
+	}
+
+	postprocess_hooks_run(aeh);
 
-		app_event_manager_free(aeh);
+	event_free(aeh);
+}
+
+static void submit_hooks_call(const struct app_event_header *aeh)
+{
+	STRUCT_SECTION_FOREACH(event_submit_hook, h) {
+		h->hook(aeh);
 	}
 }
 
-void _event_submit(struct app_event_header *aeh)
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIORITY_LANES)
+static struct mpsc lane_normal = MPSC_INIT(lane_normal);
+static struct mpsc lane_high = MPSC_INIT(lane_high);
+
+static bool is_high_priority(const struct app_event_header *aeh)
 {
-	__ASSERT_NO_MSG(aeh);
-	APP_EVENT_ASSERT_ID(aeh->type_id);
+	return app_event_get_type_flag(aeh->type_id, APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY);
+}
 
+static struct app_event_header *lane_event_get(struct mpsc *lane)
+{
+	/* The lane may transiently look empty while a producer is in the middle of a push.
+	 * In that case the producer kicks the lane consumer again after the push is done.
+	 */
+	struct mpsc_node *n = mpsc_pop(lane);
+
+	return (n == NULL) ? NULL : CONTAINER_OF(n, struct app_event_header, lane_node);
+}
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_THREAD)
+static K_SEM_DEFINE(high_prio_sem, 0, 1);
+
+static void high_prio_thread_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		struct app_event_header *aeh;
+
+		k_sem_take(&high_prio_sem, K_FOREVER);
+
+		while ((aeh = lane_event_get(&lane_high)) != NULL) {
+			event_process(aeh);
+		}
+	}
+}
+
+K_THREAD_DEFINE(app_event_manager_high_prio_thread,
+		CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_THREAD_STACK_SIZE,
+		high_prio_thread_fn, NULL, NULL, NULL,
+		CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_THREAD_PRIORITY, 0, 0);
+#endif /* CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_THREAD */
+
+static void event_processor_fn(struct k_work *work)
+{
+	struct app_event_header *aeh;
+
+	/* High priority events are processed before every normal priority event, unless
+	 * the high priority lane is served by the dedicated thread.
+	 */
+	while (true) {
+		aeh = IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_THREAD) ?
+		      NULL : lane_event_get(&lane_high);
+
+		if (aeh == NULL) {
+			aeh = lane_event_get(&lane_normal);
+		}
+
+		if (aeh == NULL) {
+			break;
+		}
+
+		event_process(aeh);
+	}
+}
+
+/* Push the event to its lane. Returns true if the event was pushed to the high priority lane. */
+static bool lane_push(struct app_event_header *aeh)
+{
+	bool high_prio = is_high_priority(aeh);
+
+	mpsc_push(high_prio ? &lane_high : &lane_normal, &aeh->lane_node);
+
+	return high_prio;
+}
+
+static void lane_list_push(sys_slist_t *events, bool *high_pushed, bool *normal_pushed)
+{
+	sys_snode_t *node;
+
+	while ((node = sys_slist_get(events)) != NULL) {
+		struct app_event_header *aeh = CONTAINER_OF(node, struct app_event_header, node);
+
+		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
+			submit_hooks_call(aeh);
+		}
+
+		/* The event node is reused by the lane, so it must be taken from the list first. */
+		if (lane_push(aeh)) {
+			*high_pushed = true;
+		} else {
+			*normal_pushed = true;
+		}
+	}
+}
+
+static void lanes_kick(bool high_pushed, bool normal_pushed)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIO_THREAD)
+	if (high_pushed) {
+		k_sem_give(&high_prio_sem);
+	}
+
+	if (normal_pushed) {
+		k_work_submit(&event_processor);
+	}
+#else
+	k_work_submit(&event_processor);
+#endif
+}
+
+static void event_enqueue(struct app_event_header *aeh)
+{
+	bool high_prio;
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
+		/* Submit hooks must be called in the same order as events are queued. */
+		k_spinlock_key_t key = k_spin_lock(&lock);
+
+		submit_hooks_call(aeh);
+		high_prio = lane_push(aeh);
+		k_spin_unlock(&lock, key);
+	} else {
+		high_prio = lane_push(aeh);
+	}
+
+	lanes_kick(high_prio, !high_prio);
+}
+
+static void event_list_enqueue(sys_slist_t *events)
+{
+	bool high_pushed = false;
+	bool normal_pushed = false;
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
+		k_spinlock_key_t key = k_spin_lock(&lock);
+
+		lane_list_push(events, &high_pushed, &normal_pushed);
+		k_spin_unlock(&lock, key);
+	} else {
+		lane_list_push(events, &high_pushed, &normal_pushed);
+	}
+
+	lanes_kick(high_pushed, normal_pushed);
+}
+
+#else /* CONFIG_APP_EVENT_MANAGER_PRIORITY_LANES */
+
+static void event_processor_fn(struct k_work *work)
+{
+	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
+
+	/* Make current event list local. */
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (sys_slist_is_empty(&eventq)) {
+		k_spin_unlock(&lock, key);
+		return;
+	}
+
+	sys_slist_merge_slist(&events, &eventq);
+
+	k_spin_unlock(&lock, key);
+
+	/* Traverse the list of events. */
+	sys_snode_t *node;
+	while (NULL != (node = sys_slist_get(&events))) {
+		struct app_event_header *aeh = CONTAINER_OF(node,
+						       struct app_event_header,
+						       node);
+
+		event_process(aeh);
+	}
+}
+
+static void event_enqueue(struct app_event_header *aeh)
+{
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
-		STRUCT_SECTION_FOREACH(event_submit_hook, h) {
-			h->hook(aeh);
-		}
+		submit_hooks_call(aeh);
 	}
 	sys_slist_append(&eventq, &aeh->node);
 	k_spin_unlock(&lock, key);
@@ -222,6 +606,52 @@ void _event_submit(struct app_event_header *aeh)
 	k_work_submit(&event_processor);
 }
 
+static void event_list_enqueue(sys_slist_t *events)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
+		sys_snode_t *node;
+
+		SYS_SLIST_FOR_EACH_NODE(events, node) {
+			submit_hooks_call(CONTAINER_OF(node, struct app_event_header, node));
+		}
+	}
+	sys_slist_merge_slist(&eventq, events);
+	k_spin_unlock(&lock, key);
+
+	k_work_submit(&event_processor);
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_PRIORITY_LANES */
+
+void _event_submit(struct app_event_header *aeh)
+{
+	__ASSERT_NO_MSG(aeh);
+	APP_EVENT_ASSERT_ID(aeh->type_id);
+
+	event_enqueue(aeh);
+}
+
+void app_event_manager_submit_list(sys_slist_t *events)
+{
+	__ASSERT_NO_MSG(events);
+
+	if (sys_slist_is_empty(events)) {
+		return;
+	}
+
+	if (IS_ENABLED(CONFIG_ASSERT)) {
+		sys_snode_t *node;
+
+		SYS_SLIST_FOR_EACH_NODE(events, node) {
+			APP_EVENT_ASSERT_ID(CONTAINER_OF(node, struct app_event_header,
+							 node)->type_id);
+		}
+	}
+
+	event_list_enqueue(events);
+}
+
 int app_event_manager_init(void)
 {
 	int ret = 0;
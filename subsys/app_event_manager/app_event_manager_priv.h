@@ -16,6 +16,7 @@
 #include <zephyr/types.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/mpsc_lockfree.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -119,6 +120,15 @@ extern "C" {
 #define _EVENT_ID(ename) (&_CONCAT(__event_type_, ename))
 
 
+/* Allocate memory for an event of the given ename type. */
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+#define _APP_EVENT_ALLOC(ename, size) \
+	_app_event_manager_pool_alloc(_EVENT_ID(ename), (size))
+#else
+#define _APP_EVENT_ALLOC(ename, size) app_event_manager_alloc(size)
+#endif
+
+
 /* Macro generates a function of name new_ename where ename is provided as
  * an argument. Allocator function is used to create an event of the given
  * ename type.
@@ -127,7 +137,7 @@ extern "C" {
 	static inline struct ename *_CONCAT(new_, ename)(void)			\
 	{									\
 		struct ename *event =						\
-			(struct ename *)app_event_manager_alloc(sizeof(*event));\
+			(struct ename *)_APP_EVENT_ALLOC(ename, sizeof(*event));\
 		BUILD_ASSERT(offsetof(struct ename, header) == 0,		\
 				 "");						\
 		if (event != NULL) {						\
@@ -145,7 +155,7 @@ extern "C" {
 	static inline struct ename *_CONCAT(new_, ename)(size_t size)			\
 	{										\
 		struct ename *event =							\
-			(struct ename *)app_event_manager_alloc(sizeof(*event) + size);	\
+			(struct ename *)_APP_EVENT_ALLOC(ename, sizeof(*event) + size);	\
 		BUILD_ASSERT((offsetof(struct ename, dyndata) +				\
 				  sizeof(event->dyndata.size)) ==			\
 				 sizeof(*event), "");					\
@@ -195,6 +205,14 @@ extern "C" {
 	}
 
 
+#define _APP_EVENT_LISTENER_NO_CONSUME(lname, notification_fn)				\
+	STRUCT_SECTION_ITERABLE(event_listener, _CONCAT(__event_listener_, lname)) = {	\
+		.name = STRINGIFY(lname),						\
+		.notification = (notification_fn),					\
+		.no_consume = true,							\
+	}
+
+
 #define _APP_EVENT_TYPE_DECLARE_COMMON(ename)						\
 	extern Z_DECL_ALIGN(struct event_type) _CONCAT(__event_type_, ename);		\
 	_APP_EVENT_CASTER_FN(ename);							\
@@ -219,14 +237,42 @@ extern "C" {
 #define _APP_EVENT_TYPE_DEFINE_SIZES(ename)
 #endif
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+/* Convenience macro generating event pool name. */
+#define _APP_EVENT_POOL_NAME(ename) _CONCAT(__event_pool_, ename)
+
+/* Memory pool is not created if the number of blocks is set to 0. */
+#define _APP_EVENT_POOL_DEFINE(ename, block_cnt)					\
+	COND_CODE_0(block_cnt, (), (							\
+		K_MEM_SLAB_DEFINE_STATIC(_APP_EVENT_POOL_NAME(ename),			\
+					 WB_UP(sizeof(struct ename)),			\
+					 block_cnt,					\
+					 __alignof__(struct ename));			\
+	))
+
+#define _APP_EVENT_TYPE_DEFINE_POOL(ename, block_cnt)					\
+	.pool = COND_CODE_0(block_cnt, (NULL), (&_APP_EVENT_POOL_NAME(ename))),
+
+#define _APP_EVENT_POOL_DEFAULT_BLOCK_CNT CONFIG_APP_EVENT_MANAGER_EVENT_POOL_BLOCK_CNT
+#else
+#define _APP_EVENT_POOL_DEFINE(ename, block_cnt)
+#define _APP_EVENT_TYPE_DEFINE_POOL(ename, block_cnt)
+#define _APP_EVENT_POOL_DEFAULT_BLOCK_CNT 0
+#endif
+
 /** @brief Event header.
  *
  * When defining an event structure, the application event header
  * must be placed as the first field.
  */
 struct app_event_header {
-	/** Linked list node used to chain events. */
-	sys_snode_t node;
+	union {
+		/** Linked list node used to chain events. */
+		sys_snode_t node;
+
+		/** Lock-free queue node used to chain events in priority lanes. */
+		struct mpsc_node lane_node;
+	};
 
 	/** Pointer to the event type object. */
 	const struct event_type *type_id;
@@ -292,6 +338,11 @@ struct event_type {
 	/** The size of the event structure */
 	uint16_t struct_size;
 #endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+	/** Memory pool dedicated to events of this type, NULL if the pool is not used. */
+	struct k_mem_slab *pool;
+#endif
 };
 
 
@@ -300,10 +351,17 @@ extern struct event_type _event_type_list_end[];
 
 
 #define _APP_EVENT_TYPE_DEFINE(ename, log_fn, trace_data_pointer, et_flags)		\
+	_APP_EVENT_TYPE_DEFINE_WITH_POOL(ename, log_fn, trace_data_pointer, et_flags,	\
+					 _APP_EVENT_POOL_DEFAULT_BLOCK_CNT)
+
+
+#define _APP_EVENT_TYPE_DEFINE_WITH_POOL(ename, log_fn, trace_data_pointer, et_flags,	\
+					 pool_block_cnt)				\
 	BUILD_ASSERT(((et_flags) & ((BIT_MASK(APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START-	\
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START))<<					\
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START)) == 0);				\
 	_APP_EVENT_SUBSCRIBERS_ARRAY_TAGS(ename);					\
+	_APP_EVENT_POOL_DEFINE(ename, pool_block_cnt)					\
 	STRUCT_SECTION_ITERABLE(event_type, _CONCAT(__event_type_, ename)) = {		\
 		.name            = STRINGIFY(ename),					\
 		.subs_start      = _APP_EVENT_SUBSCRIBERS_START_TAG(ename),		\
@@ -315,6 +373,7 @@ extern struct event_type _event_type_list_end[];
 				((et_flags) | BIT(APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)) :	\
 				((et_flags) & (~BIT(APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)))),\
 		_APP_EVENT_TYPE_DEFINE_SIZES(ename) /* No comma here intentionally */	\
+		_APP_EVENT_TYPE_DEFINE_POOL(ename, pool_block_cnt) /* No comma here intentionally */ \
 	}
 
 /**
@@ -326,6 +385,24 @@ struct app_event_manager_event_display_bm {
 
 extern struct app_event_manager_event_display_bm _app_event_manager_event_display_bm;
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+/**
+ * @brief Number of events allocated from heap because the event type pool was exhausted.
+ */
+extern atomic_t _app_event_manager_pool_fallback_cnt[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+
+/** @brief Allocate an event from the memory pool of the given event type.
+ *
+ * If the pool is exhausted or not used by the event type, the memory is allocated
+ * using @ref app_event_manager_alloc.
+ *
+ * @param et    Pointer to the event type.
+ * @param size  Amount of memory requested (in bytes).
+ * @retval Address of the allocated memory if successful, otherwise NULL.
+ */
+void *_app_event_manager_pool_alloc(const struct event_type *et, size_t size);
+#endif
+
 
 /* Event hooks subscribers */
 #define _APP_EVENT_HOOK_REGISTER(section, hook_fn, prio)           \
@@ -334,6 +411,13 @@ extern struct app_event_manager_event_display_bm _app_event_manager_event_displa
 		.hook = (hook_fn)                                          \
 	}
 
+#define _APP_EVENT_HOOK_REGISTER_FOR_EVENT(section, hook_fn, ename, prio)	\
+	BUILD_ASSERT((hook_fn) != NULL, "Registered hook cannot be NULL");	\
+	STRUCT_SECTION_ITERABLE(section, _CONCAT(_CONCAT(prio, hook_fn), ename)) = { \
+		.hook = (hook_fn),						\
+		.type = _EVENT_ID(ename),					\
+	}
+
 #define _APP_EVENT_MANAGER_HOOK_POSTINIT_REGISTER(hook_fn, prio)             \
 	BUILD_ASSERT(IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTINIT_HOOK),     \
 		     "Enable APP_EVENT_MANAGER_POSTINIT_HOOK before usage"); \
@@ -354,6 +438,29 @@ extern struct app_event_manager_event_display_bm _app_event_manager_event_displa
 		     "Enable APP_EVENT_MANAGER_POSTPROCESS_HOOKS before usage"); \
 	_APP_EVENT_HOOK_REGISTER(event_postprocess_hook, hook_fn, prio)
 
+#define _APP_EVENT_HOOK_PREPROCESS_REGISTER_FOR_EVENT(hook_fn, ename, prio)    \
+	BUILD_ASSERT(IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS),     \
+		     "Enable APP_EVENT_MANAGER_PREPROCESS_HOOKS before usage"); \
+	_APP_EVENT_HOOK_REGISTER_FOR_EVENT(event_preprocess_hook, hook_fn, ename, prio)
+
+#define _APP_EVENT_HOOK_POSTPROCESS_REGISTER_FOR_EVENT(hook_fn, ename, prio)    \
+	BUILD_ASSERT(IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS),     \
+		     "Enable APP_EVENT_MANAGER_POSTPROCESS_HOOKS before usage"); \
+	_APP_EVENT_HOOK_REGISTER_FOR_EVENT(event_postprocess_hook, hook_fn, ename, prio)
+
+/* Helpers for batched event submission. */
+#define _APP_EVENT_BATCH_APPEND(event) \
+	sys_slist_append(&_app_event_batch, &(event)->header.node)
+
+#define _APP_EVENT_SUBMIT_BATCH(...)							\
+	do {										\
+		sys_slist_t _app_event_batch;						\
+											\
+		sys_slist_init(&_app_event_batch);					\
+		FOR_EACH(_APP_EVENT_BATCH_APPEND, (;), __VA_ARGS__);			\
+		app_event_manager_submit_list(&_app_event_batch);			\
+	} while (0)
+
 /**
  * @brief Joining together event type flags.
  */
@@ -387,6 +494,9 @@ struct event_listener {
 	 * not propagated to further listeners, or false, otherwise.
 	 */
 	bool (*notification)(const struct app_event_header *aeh);
+
+	/** True if the listener never consumes events. Its return value is ignored. */
+	bool no_consume;
 };
 
 
@@ -416,6 +526,9 @@ struct event_submit_hook {
 struct event_preprocess_hook {
 	/** @brief Hook function */
 	void (*hook)(const struct app_event_header *aeh);
+
+	/** @brief Event type the hook is called for, NULL if called for all event types */
+	const struct event_type *type;
 };
 
 /** @brief Structure used to register event postprocess hook
@@ -423,6 +536,9 @@ struct event_preprocess_hook {
 struct event_postprocess_hook {
 	/** @brief Hook function */
 	void (*hook)(const struct app_event_header *aeh);
+
+	/** @brief Event type the hook is called for, NULL if called for all event types */
+	const struct event_type *type;
 };
 
 
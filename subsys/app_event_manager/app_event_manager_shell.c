@@ -81,6 +81,37 @@ static int show_subscribers(const struct shell *shell, size_t argc,
 	return 0;
 }
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+static int show_pools(const struct shell *shell, size_t argc,
+		char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "Event pools:\n");
+
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		size_t ev_id = et - _event_type_list_start;
+		struct k_mem_slab *pool = et->pool;
+
+		if (pool == NULL) {
+			shell_fprintf(shell, SHELL_NORMAL,
+				      "|\t[E:%s] no pool\n", et->name);
+			continue;
+		}
+
+		shell_fprintf(shell, SHELL_NORMAL,
+			      "|\t[E:%s] block size: %zu, used: %u/%u, max used: %u, "
+			      "heap fallbacks: %ld\n",
+			      et->name,
+			      pool->info.block_size,
+			      k_mem_slab_num_used_get(pool),
+			      pool->info.num_blocks,
+			      k_mem_slab_max_used_get(pool),
+			      (long)atomic_get(&_app_event_manager_pool_fallback_cnt[ev_id]));
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_EVENT_POOLS */
+
 static void set_event_displaying(const struct shell *shell, size_t argc,
 				 char **argv, bool enable)
 {
@@ -155,6 +186,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_app_event_manager,
 	SHELL_CMD_ARG(show_subscribers, NULL, "Show subscribers",
 		      show_subscribers, 0, 0),
 	SHELL_CMD_ARG(show_events, NULL, "Show events", show_events, 0, 0),
+	IF_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS,
+		   (SHELL_CMD_ARG(show_pools, NULL, "Show event pools usage",
+				  show_pools, 0, 0),))
 	SHELL_CMD_ARG(disable, NULL, "Disable displaying event with given ID",
 		      disable_event_displaying, 0,
 		      sizeof(_app_event_manager_event_display_bm) * 8 - 1),
@@ -7,6 +7,10 @@
 #include <inttypes.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/net_buf.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/sys/hash_function.h>
 
 #include <bluetooth/gatt_dm.h>
 
@@ -22,6 +26,23 @@ LOG_MODULE_REGISTER(bt_gatt_dm, CONFIG_BT_GATT_DM_LOG_LEVEL);
 BUILD_ASSERT(sizeof(struct bt_gatt_service_val) % DATA_ALIGN == 0);
 BUILD_ASSERT(sizeof(struct bt_gatt_chrc) % DATA_ALIGN == 0);
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+#define CACHE_SUBTREE "bt/dm"
+/* Settings subtree of a peer: "bt/dm/<address><type>" */
+#define CACHE_PEER_KEY_LEN (sizeof(CACHE_SUBTREE) + 1 + 12 + 2)
+/* Name of a cached discovery result: "<start handle><hash of the searched UUID>" */
+#define CACHE_NAME_LEN (4 + 8)
+#define CACHE_KEY_LEN (CACHE_PEER_KEY_LEN + 1 + CACHE_NAME_LEN)
+#define CACHE_HASH_NAME "hash"
+/* Serialized UUID: length and value */
+#define CACHE_UUID_SIZE_MAX (1 + BT_UUID_SIZE_128)
+/* Serialized attribute: handle, permissions, UUID and the largest attribute value */
+#define CACHE_ATTR_SIZE_MAX (2 + 1 + CACHE_UUID_SIZE_MAX + 2 + 1 + CACHE_UUID_SIZE_MAX)
+/* Number of settings keys removed at once when the cache of a peer is removed */
+#define CACHE_PURGE_BATCH 8
+#define DB_HASH_SIZE 16
+#endif
+
 #if defined(CONFIG_BT_GATT_DM_WORKQ_OWN)
 K_THREAD_STACK_DEFINE(bt_gatt_dm_wq_stack_area, CONFIG_BT_GATT_DM_WORKQ_STACK_SIZE);
 static struct k_work_q bt_gatt_dm_wq;
@@ -40,6 +61,15 @@ static int gatt_dm_wq_init(void)
 SYS_INIT(gatt_dm_wq_init, POST_KERNEL, CONFIG_BT_GATT_DM_WORKQ_INIT_PRIO);
 #endif
 
+static void dm_work_submit(struct k_work *work)
+{
+#if defined(CONFIG_BT_GATT_DM_WORKQ_OWN)
+	k_work_submit_to_queue(&bt_gatt_dm_wq, work);
+#else
+	k_work_submit(work);
+#endif
+}
+
 /* Flags for parsed attribute array state */
 enum {
 	STATE_ATTRS_LOCKED,
@@ -92,6 +122,28 @@ struct bt_gatt_dm {
 
 	/* Work item used for discovery callbacks. */
 	struct k_work discover_work;
+
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	/* Discovery cache of the peer */
+	struct {
+		/* Identity address of the peer */
+		bt_addr_le_t addr;
+		/* Database Hash read from the peer */
+		uint8_t db_hash[DB_HASH_SIZE];
+		/* Parameters used to read the Database Hash */
+		struct bt_gatt_read_params read_params;
+		/* Work item used to serve the discovery from the cache */
+		struct k_work work;
+		/* The start handle of the current discovery */
+		uint16_t start_handle;
+		/* The Database Hash was read and must be checked */
+		bool hash_read;
+		/* The cache matches the database of the peer */
+		bool valid;
+		/* The result of the current discovery must be stored */
+		bool store;
+	} cache;
+#endif
 };
 
 /* Currently only one instance is supported */
@@ -268,9 +320,614 @@ static struct bt_gatt_dm_attr *attr_find_by_handle(
 	return NULL;
 }
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+union cache_uuid {
+	struct bt_uuid uuid;
+	struct bt_uuid_16 u16;
+	struct bt_uuid_32 u32;
+	struct bt_uuid_128 u128;
+};
+
+struct cache_value {
+	uint8_t *data;
+	size_t len;
+};
+
+struct cache_purge_ctx {
+	char names[CACHE_PURGE_BATCH][CACHE_NAME_LEN + 1];
+	size_t cnt;
+};
+
+static void cache_peer_key(char *key, const bt_addr_le_t *addr)
+{
+	snprintk(key, CACHE_PEER_KEY_LEN, CACHE_SUBTREE "/%02x%02x%02x%02x%02x%02x%02x",
+		 addr->a.val[5], addr->a.val[4], addr->a.val[3], addr->a.val[2],
+		 addr->a.val[1], addr->a.val[0], addr->type);
+}
+
+static void cache_key(char *key, const bt_addr_le_t *addr, const char *name)
+{
+	char peer_key[CACHE_PEER_KEY_LEN];
+
+	cache_peer_key(peer_key, addr);
+	snprintk(key, CACHE_KEY_LEN, "%s/%s", peer_key, name);
+}
+
+static void cache_uuid_put(struct net_buf_simple *buf, const struct bt_uuid *uuid)
+{
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		net_buf_simple_add_u8(buf, BT_UUID_SIZE_16);
+		net_buf_simple_add_le16(buf, BT_UUID_16(uuid)->val);
+		break;
+	case BT_UUID_TYPE_32:
+		net_buf_simple_add_u8(buf, BT_UUID_SIZE_32);
+		net_buf_simple_add_le32(buf, BT_UUID_32(uuid)->val);
+		break;
+	case BT_UUID_TYPE_128:
+		net_buf_simple_add_u8(buf, BT_UUID_SIZE_128);
+		net_buf_simple_add_mem(buf, BT_UUID_128(uuid)->val, BT_UUID_SIZE_128);
+		break;
+	default:
+		net_buf_simple_add_u8(buf, 0);
+		break;
+	}
+}
+
+static int cache_uuid_pull(struct net_buf_simple *buf, union cache_uuid *uuid)
+{
+	uint8_t len;
+
+	if (buf->len < 1) {
+		return -EINVAL;
+	}
+
+	len = net_buf_simple_pull_u8(buf);
+	if (buf->len < len ||
+	    !bt_uuid_create(&uuid->uuid, net_buf_simple_pull_mem(buf, len), len)) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* The searched service UUID is a part of the key, as the same start handle
+ * gives different results for different UUIDs.
+ */
+static void cache_query_put(const struct bt_gatt_dm *dm, struct net_buf_simple *buf)
+{
+	if (dm->search_svc_by_uuid) {
+		cache_uuid_put(buf, &dm->svc_uuid.uuid);
+	} else {
+		net_buf_simple_add_u8(buf, 0);
+	}
+}
+
+static void cache_record_key(const struct bt_gatt_dm *dm, char *key)
+{
+	NET_BUF_SIMPLE_DEFINE(query, CACHE_UUID_SIZE_MAX);
+	char name[CACHE_NAME_LEN + 1];
+
+	cache_query_put(dm, &query);
+	snprintk(name, sizeof(name), "%04x%08x", dm->cache.start_handle,
+		 sys_hash32(query.data, query.len));
+	cache_key(key, &dm->cache.addr, name);
+}
+
+static int cache_value_set(const char *key, size_t len, settings_read_cb read_cb,
+			   void *cb_arg, void *param)
+{
+	struct cache_value *value = param;
+	ssize_t ret;
+
+	/* Only the value of the loaded key is used, not the values of its subkeys. */
+	if (key || len == 0 || value->data) {
+		return 0;
+	}
+
+	value->data = k_malloc(len);
+	if (!value->data) {
+		return -ENOMEM;
+	}
+
+	ret = read_cb(cb_arg, value->data, len);
+	if (ret != len) {
+		k_free(value->data);
+		value->data = NULL;
+		return (ret < 0) ? ret : -EINVAL;
+	}
+
+	value->len = len;
+
+	return 0;
+}
+
+/* The value is allocated on the heap and must be released with k_free. */
+static int cache_value_load(const char *key, struct cache_value *value)
+{
+	int err;
+
+	value->data = NULL;
+	value->len = 0;
+
+	err = settings_load_subtree_direct(key, cache_value_set, value);
+	if (err) {
+		k_free(value->data);
+		return err;
+	}
+
+	return value->data ? 0 : -ENOENT;
+}
+
+static int cache_purge_collect(const char *key, size_t len, settings_read_cb read_cb,
+			       void *cb_arg, void *param)
+{
+	struct cache_purge_ctx *ctx = param;
+
+	if (!key || ctx->cnt == ARRAY_SIZE(ctx->names) || strlen(key) > CACHE_NAME_LEN) {
+		return 0;
+	}
+
+	strcpy(ctx->names[ctx->cnt++], key);
+
+	return 0;
+}
+
+static int cache_purge(const bt_addr_le_t *addr)
+{
+	struct cache_purge_ctx ctx;
+	char peer_key[CACHE_PEER_KEY_LEN];
+	char key[CACHE_KEY_LEN];
+	int err;
+
+	cache_peer_key(peer_key, addr);
+
+	/* The keys are not deleted while the subtree is loaded. */
+	do {
+		ctx.cnt = 0;
+
+		err = settings_load_subtree_direct(peer_key, cache_purge_collect, &ctx);
+		if (err) {
+			return err;
+		}
+
+		for (size_t i = 0; i < ctx.cnt; i++) {
+			cache_key(key, addr, ctx.names[i]);
+
+			err = settings_delete(key);
+			if (err) {
+				return err;
+			}
+		}
+	} while (ctx.cnt == ARRAY_SIZE(ctx.names));
+
+	return 0;
+}
+
+static void cache_attr_put(struct net_buf_simple *buf, const struct bt_gatt_dm_attr *attr)
+{
+	const struct bt_gatt_service_val *service_val = bt_gatt_dm_attr_service_val(attr);
+	const struct bt_gatt_chrc *chrc = bt_gatt_dm_attr_chrc_val(attr);
+
+	net_buf_simple_add_le16(buf, attr->handle);
+	net_buf_simple_add_u8(buf, attr->perm);
+	cache_uuid_put(buf, attr->uuid);
+
+	if (service_val) {
+		net_buf_simple_add_le16(buf, service_val->end_handle);
+		cache_uuid_put(buf, service_val->uuid);
+	} else if (chrc) {
+		net_buf_simple_add_le16(buf, chrc->value_handle);
+		net_buf_simple_add_u8(buf, chrc->properties);
+		cache_uuid_put(buf, chrc->uuid);
+	}
+}
+
+static int cache_attr_pull(struct bt_gatt_dm *dm, struct net_buf_simple *buf)
+{
+	union cache_uuid uuid;
+	struct bt_gatt_attr attr = {
+		.uuid = &uuid.uuid,
+	};
+	struct bt_gatt_dm_attr *cur_attr;
+	struct bt_gatt_service_val *service_val;
+	struct bt_gatt_chrc *chrc;
+	size_t additional_len = 0;
+
+	if (buf->len < sizeof(uint16_t) + sizeof(uint8_t)) {
+		return -EINVAL;
+	}
+
+	attr.handle = net_buf_simple_pull_le16(buf);
+	attr.perm = net_buf_simple_pull_u8(buf);
+
+	if (cache_uuid_pull(buf, &uuid)) {
+		return -EINVAL;
+	}
+
+	if (!bt_uuid_cmp(attr.uuid, BT_UUID_GATT_PRIMARY) ||
+	    !bt_uuid_cmp(attr.uuid, BT_UUID_GATT_SECONDARY)) {
+		additional_len = sizeof(*service_val);
+	} else if (!bt_uuid_cmp(attr.uuid, BT_UUID_GATT_CHRC)) {
+		additional_len = sizeof(*chrc);
+	}
+
+	cur_attr = attr_store(dm, &attr, additional_len);
+	if (!cur_attr) {
+		return -ENOMEM;
+	}
+
+	service_val = bt_gatt_dm_attr_service_val(cur_attr);
+	chrc = bt_gatt_dm_attr_chrc_val(cur_attr);
+
+	if (service_val) {
+		if (buf->len < sizeof(uint16_t)) {
+			return -EINVAL;
+		}
+
+		service_val->end_handle = net_buf_simple_pull_le16(buf);
+
+		if (cache_uuid_pull(buf, &uuid)) {
+			return -EINVAL;
+		}
+
+		service_val->uuid = uuid_store(dm, &uuid.uuid);
+		if (!service_val->uuid) {
+			return -ENOMEM;
+		}
+	} else if (chrc) {
+		if (buf->len < sizeof(uint16_t) + sizeof(uint8_t)) {
+			return -EINVAL;
+		}
+
+		chrc->value_handle = net_buf_simple_pull_le16(buf);
+		chrc->properties = net_buf_simple_pull_u8(buf);
+
+		if (cache_uuid_pull(buf, &uuid)) {
+			return -EINVAL;
+		}
+
+		chrc->uuid = uuid_store(dm, &uuid.uuid);
+		if (!chrc->uuid) {
+			return -ENOMEM;
+		}
+	}
+
+	return 0;
+}
+
+/* Stores the result of the discovery that was not served from the cache.
+ * Results without any service are stored as well, so that the end of
+ * the database is also known.
+ */
+static void cache_store(struct bt_gatt_dm *dm)
+{
+	struct net_buf_simple buf;
+	char key[CACHE_KEY_LEN];
+	uint8_t *data;
+	size_t size;
+	int err;
+
+	if (!dm->cache.store) {
+		return;
+	}
+
+	dm->cache.store = false;
+
+	size = CACHE_UUID_SIZE_MAX + sizeof(uint16_t) + dm->cur_attr_id * CACHE_ATTR_SIZE_MAX;
+	data = k_malloc(size);
+	if (!data) {
+		LOG_WRN("No memory to store discovery cache");
+		return;
+	}
+
+	net_buf_simple_init_with_data(&buf, data, size);
+	net_buf_simple_reset(&buf);
+
+	cache_query_put(dm, &buf);
+	net_buf_simple_add_le16(&buf, dm->cur_attr_id);
+
+	for (size_t i = 0; i < dm->cur_attr_id; i++) {
+		cache_attr_put(&buf, &dm->attrs[i]);
+	}
+
+	cache_record_key(dm, key);
+
+	err = settings_save_one(key, buf.data, buf.len);
+	if (err) {
+		LOG_WRN("Failed to store discovery cache, err: %d", err);
+	} else {
+		LOG_DBG("Stored %s, %u bytes", key, buf.len);
+	}
+
+	k_free(data);
+}
+
+/* Restores the attributes of the current discovery from the cache. */
+static int cache_restore(struct bt_gatt_dm *dm, size_t *attr_cnt)
+{
+	NET_BUF_SIMPLE_DEFINE(query, CACHE_UUID_SIZE_MAX);
+	struct cache_value value;
+	struct net_buf_simple buf;
+	const struct bt_gatt_service_val *service_val;
+	char key[CACHE_KEY_LEN];
+	size_t cnt;
+	int err;
+
+	cache_record_key(dm, key);
+
+	err = cache_value_load(key, &value);
+	if (err) {
+		return err;
+	}
+
+	net_buf_simple_init_with_data(&buf, value.data, value.len);
+	cache_query_put(dm, &query);
+
+	/* Results with the same hash of the searched UUID are not used. */
+	if (buf.len < query.len + sizeof(uint16_t) ||
+	    memcmp(net_buf_simple_pull_mem(&buf, query.len), query.data, query.len)) {
+		err = -ENOENT;
+		goto free;
+	}
+
+	cnt = net_buf_simple_pull_le16(&buf);
+
+	for (size_t i = 0; i < cnt; i++) {
+		err = cache_attr_pull(dm, &buf);
+		if (err) {
+			goto release;
+		}
+	}
+
+	if (cnt) {
+		service_val = bt_gatt_dm_attr_service_val(&dm->attrs[0]);
+		if (!service_val) {
+			err = -EINVAL;
+			goto release;
+		}
+
+		/* Leave the discovery parameters as the discovery of the service would. */
+		dm->discover_params.end_handle = service_val->end_handle;
+		if (dm->attrs[0].handle != service_val->end_handle) {
+			dm->discover_params.uuid = NULL;
+		}
+	}
+
+	*attr_cnt = cnt;
+	goto free;
+
+release:
+	LOG_WRN("Invalid discovery cache %s, err: %d", key, err);
+	svc_attr_memory_release(dm);
+free:
+	k_free(value.data);
+
+	return err;
+}
+
+/* Checks the Database Hash read from the peer against the stored one. If the
+ * database has changed, the cache of the peer is removed and the new
+ * Database Hash is stored.
+ */
+static void cache_db_hash_check(struct bt_gatt_dm *dm)
+{
+	struct cache_value value;
+	char key[CACHE_KEY_LEN];
+	bool match;
+	int err;
+
+	cache_key(key, &dm->cache.addr, CACHE_HASH_NAME);
+
+	if (!cache_value_load(key, &value)) {
+		match = (value.len == DB_HASH_SIZE) &&
+			!memcmp(value.data, dm->cache.db_hash, DB_HASH_SIZE);
+		k_free(value.data);
+
+		if (match) {
+			dm->cache.valid = true;
+			return;
+		}
+	}
+
+	LOG_DBG("Database Hash changed");
+
+	err = cache_purge(&dm->cache.addr);
+	if (!err) {
+		err = settings_save_one(key, dm->cache.db_hash, DB_HASH_SIZE);
+	}
+
+	if (err) {
+		LOG_WRN("Failed to update discovery cache, err: %d", err);
+		return;
+	}
+
+	dm->cache.valid = true;
+}
+
+static uint8_t cache_db_hash_read(struct bt_conn *conn, uint8_t err,
+				  struct bt_gatt_read_params *params,
+				  const void *data, uint16_t length)
+{
+	struct bt_gatt_dm *dm = CONTAINER_OF(params, struct bt_gatt_dm, cache.read_params);
+
+	if (!err && data && length == DB_HASH_SIZE) {
+		memcpy(dm->cache.db_hash, data, DB_HASH_SIZE);
+		dm->cache.hash_read = true;
+	} else {
+		LOG_DBG("No Database Hash, discovery cache not used, err: %u", err);
+	}
+
+	/* The settings are not accessed from the Bluetooth thread. */
+	dm_work_submit(&dm->cache.work);
+
+	return BT_GATT_ITER_STOP;
+}
+
+struct cache_bond_find {
+	const bt_addr_le_t *addr;
+	bool found;
+};
+
+static void cache_bond_find(const struct bt_bond_info *info, void *user_data)
+{
+	struct cache_bond_find *ctx = user_data;
+
+	if (bt_addr_le_eq(ctx->addr, &info->addr)) {
+		ctx->found = true;
+	}
+}
+
+/* Starts reading the Database Hash of a bonded peer. The discovery is
+ * continued from the cache work once the Database Hash is read.
+ */
+static int cache_start(struct bt_gatt_dm *dm)
+{
+	static const struct bt_uuid_16 db_hash_uuid = BT_UUID_INIT_16(BT_UUID_GATT_DB_HASH_VAL);
+	struct bt_conn_info info;
+	struct cache_bond_find bond = {0};
+	int err;
+
+	dm->cache.hash_read = false;
+	dm->cache.valid = false;
+	dm->cache.store = false;
+	dm->cache.start_handle = dm->discover_params.start_handle;
+
+	err = bt_conn_get_info(dm->conn, &info);
+	if (err || info.type != BT_CONN_TYPE_LE) {
+		return -ENOTSUP;
+	}
+
+	bond.addr = info.le.dst;
+	bt_foreach_bond(info.id, cache_bond_find, &bond);
+	if (!bond.found) {
+		return -ENOENT;
+	}
+
+	bt_addr_le_copy(&dm->cache.addr, info.le.dst);
+
+	dm->cache.read_params.func = cache_db_hash_read;
+	dm->cache.read_params.handle_count = 0;
+	dm->cache.read_params.by_uuid.start_handle = 0x0001;
+	dm->cache.read_params.by_uuid.end_handle = 0xffff;
+	dm->cache.read_params.by_uuid.uuid = &db_hash_uuid.uuid;
+
+	err = bt_gatt_read(dm->conn, &dm->cache.read_params);
+	if (err) {
+		LOG_WRN("Database Hash read failed, error: %d.", err);
+	}
+
+	return err;
+}
+
+/* Peers whose cache is to be removed. */
+static bt_addr_le_t cache_purge_addrs[CONFIG_BT_MAX_PAIRED];
+static size_t cache_purge_cnt;
+static struct k_spinlock cache_purge_lock;
+
+static void cache_purge_work_handler(struct k_work *work)
+{
+	struct bt_gatt_dm *dm = &bt_gatt_dm_inst;
+	bt_addr_le_t addr;
+	k_spinlock_key_t key;
+	int err;
+
+	while (true) {
+		key = k_spin_lock(&cache_purge_lock);
+
+		if (!cache_purge_cnt) {
+			k_spin_unlock(&cache_purge_lock, key);
+			return;
+		}
+
+		bt_addr_le_copy(&addr, &cache_purge_addrs[--cache_purge_cnt]);
+		k_spin_unlock(&cache_purge_lock, key);
+
+		/* The cache work runs in the same workqueue, so the cache
+		 * is not invalidated while it is being restored.
+		 */
+		if (bt_addr_le_eq(&dm->cache.addr, &addr)) {
+			dm->cache.valid = false;
+		}
+
+		err = cache_purge(&addr);
+		if (err) {
+			LOG_WRN("Failed to remove discovery cache, err: %d", err);
+		}
+	}
+}
+
+static K_WORK_DEFINE(cache_purge_work, cache_purge_work_handler);
+
+/* Queues the removal of the cache of a peer. The settings are not accessed
+ * from the caller context, as it can be the Bluetooth thread.
+ */
+static int cache_purge_queue(const bt_addr_le_t *addr)
+{
+	k_spinlock_key_t key;
+	bool queued = false;
+
+	key = k_spin_lock(&cache_purge_lock);
+
+	for (size_t i = 0; i < cache_purge_cnt; i++) {
+		if (bt_addr_le_eq(&cache_purge_addrs[i], addr)) {
+			queued = true;
+			break;
+		}
+	}
+
+	if (!queued && cache_purge_cnt < ARRAY_SIZE(cache_purge_addrs)) {
+		bt_addr_le_copy(&cache_purge_addrs[cache_purge_cnt++], addr);
+		queued = true;
+	}
+
+	k_spin_unlock(&cache_purge_lock, key);
+
+	if (!queued) {
+		return -ENOMEM;
+	}
+
+	dm_work_submit(&cache_purge_work);
+
+	return 0;
+}
+
+static void cache_bond_deleted(uint8_t id, const bt_addr_le_t *peer)
+{
+	if (cache_purge_queue(peer)) {
+		LOG_WRN("Discovery cache removal not queued");
+	}
+}
+
+static struct bt_conn_auth_info_cb cache_auth_info_cb = {
+	.bond_deleted = cache_bond_deleted,
+};
+
+static int gatt_dm_cache_init(void)
+{
+	return bt_conn_auth_info_cb_register(&cache_auth_info_cb);
+}
+
+SYS_INIT(gatt_dm_cache_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+
+/* The cache is loaded on demand. The handler only prevents warnings about
+ * the keys of the subtree when the settings are loaded.
+ */
+static int cache_settings_set(const char *name, size_t len, settings_read_cb read_cb,
+			      void *cb_arg)
+{
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(bt_dm, CACHE_SUBTREE, NULL, cache_settings_set, NULL, NULL);
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 static void discovery_complete(struct bt_gatt_dm *dm)
 {
 	LOG_DBG("Discovery complete.");
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	cache_store(dm);
+#endif
 	atomic_set_bit(dm->state_flags, STATE_ATTRS_RELEASE_PENDING);
 	if (dm->callback->completed) {
 		dm->callback->completed(dm, dm->context);
@@ -281,6 +938,9 @@ static void discovery_complete_not_found(struct bt_gatt_dm *dm)
 {
 	LOG_DBG("Discover complete. No service found.");
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	cache_store(dm);
+#endif
 	svc_attr_memory_release(dm);
 	atomic_clear_bit(dm->state_flags, STATE_ATTRS_LOCKED);
 
@@ -291,6 +951,9 @@ static void discovery_complete_not_found(struct bt_gatt_dm *dm)
 
 static void discovery_complete_error(struct bt_gatt_dm *dm, int err)
 {
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	dm->cache.store = false;
+#endif
 	svc_attr_memory_release(dm);
 	atomic_clear_bit(dm->state_flags, STATE_ATTRS_LOCKED);
 	if (dm->callback->error_found) {
@@ -315,6 +978,42 @@ static void gatt_discover_work(struct k_work *work)
 	}
 }
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+static void cache_work_handler(struct k_work *work)
+{
+	struct bt_gatt_dm *dm = CONTAINER_OF(work, struct bt_gatt_dm, cache.work);
+	size_t attr_cnt;
+
+	if (!atomic_test_bit(dm->state_flags, STATE_ATTRS_LOCKED)) {
+		LOG_WRN("Attributes not locked");
+		return;
+	}
+
+	if (dm->cache.hash_read) {
+		dm->cache.hash_read = false;
+		cache_db_hash_check(dm);
+	}
+
+	if (dm->cache.valid) {
+		if (!cache_restore(dm, &attr_cnt)) {
+			LOG_DBG("Discovery served from cache");
+
+			if (attr_cnt) {
+				discovery_complete(dm);
+			} else {
+				discovery_complete_not_found(dm);
+			}
+
+			return;
+		}
+
+		dm->cache.store = true;
+	}
+
+	gatt_discover_work(&dm->discover_work);
+}
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 static uint8_t discovery_process_service(struct bt_gatt_dm *dm,
 				      const struct bt_gatt_attr *attr,
 				      struct bt_gatt_discover_params *params)
@@ -373,11 +1072,7 @@ static uint8_t discovery_process_service(struct bt_gatt_dm *dm,
 	dm->discover_params.start_handle = cur_attr->handle + 1;
 	LOG_DBG("Starting descriptors discovery");
 
-#if defined(CONFIG_BT_GATT_DM_WORKQ_OWN)
-	k_work_submit_to_queue(&bt_gatt_dm_wq, &dm->discover_work);
-#else
-	k_work_submit(&dm->discover_work);
-#endif
+	dm_work_submit(&dm->discover_work);
 
 	return BT_GATT_ITER_STOP;
 }
@@ -396,11 +1091,7 @@ static uint8_t discovery_process_attribute(struct bt_gatt_dm *dm,
 			dm->discover_params.type =
 				BT_GATT_DISCOVER_CHARACTERISTIC;
 
-#if defined(CONFIG_BT_GATT_DM_WORKQ_OWN)
-			k_work_submit_to_queue(&bt_gatt_dm_wq, &dm->discover_work);
-#else
-			k_work_submit(&dm->discover_work);
-#endif
+			dm_work_submit(&dm->discover_work);
 		} else {
 			discovery_complete(dm);
 		}
@@ -679,6 +1370,14 @@ int bt_gatt_dm_start(struct bt_conn *conn,
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
 	k_work_init(&dm->discover_work, gatt_discover_work);
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	k_work_init(&dm->cache.work, cache_work_handler);
+
+	if (!cache_start(dm)) {
+		return 0;
+	}
+#endif
+
 	err = bt_gatt_discover(conn, &dm->discover_params);
 	if (err) {
 		LOG_ERR("Discover failed, error: %d.", err);
@@ -722,6 +1421,15 @@ int bt_gatt_dm_continue(struct bt_gatt_dm *dm, void *context)
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
 	dm->discover_params.uuid = dm->search_svc_by_uuid ? &dm->svc_uuid.uuid : NULL;
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	dm->cache.start_handle = dm->discover_params.start_handle;
+
+	if (dm->cache.valid) {
+		dm_work_submit(&dm->cache.work);
+		return 0;
+	}
+#endif
+
 	err = bt_gatt_discover(dm->conn, &dm->discover_params);
 	if (err) {
 		LOG_ERR("Discover failed, error: %d.", err);
@@ -740,12 +1448,26 @@ int bt_gatt_dm_data_release(struct bt_gatt_dm *dm)
 	}
 
 	k_work_cancel(&dm->discover_work);
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	k_work_cancel(&dm->cache.work);
+#endif
 	svc_attr_memory_release(dm);
 	atomic_clear_bit(dm->state_flags, STATE_ATTRS_LOCKED);
 
 	return 0;
 }
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+int bt_gatt_dm_cache_invalidate(const bt_addr_le_t *addr)
+{
+	if (!addr) {
+		return -EINVAL;
+	}
+
+	return cache_purge_queue(addr);
+}
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 #if CONFIG_BT_GATT_DM_DATA_PRINT
 
 #define UUID_STR_LEN 37
@@ -22,9 +22,120 @@ static struct bt_mesh_rpl replay_list[CONFIG_BT_MESH_CRPL];
 
 EMDS_STATIC_ENTRY_DEFINE(rpl_store, CONFIG_BT_MESH_RPL_INDEX, replay_list, sizeof(replay_list));
 
+#if CONFIG_BT_MESH_RPL_HASH
+/* Open addressed hash index of the replay list, keyed by the source address.
+ * The index entries store the replay list index incremented by one, so that
+ * zero marks an empty entry. The used replay list entries are kept at the start
+ * of the list, and are only removed by clearing the list or by the IV Index
+ * update, after which the index is rebuilt.
+ */
+static uint16_t rpl_hash[2 * CONFIG_BT_MESH_CRPL];
+
+/* Number of the used replay list entries. */
+static size_t rpl_cnt;
+
+/* The replay list is loaded from EMDS after boot, so the index is built
+ * when the list is first checked.
+ */
+static bool rpl_hash_valid;
+
+BUILD_ASSERT(CONFIG_BT_MESH_CRPL < UINT16_MAX);
+
+static size_t rpl_hash_slot(uint16_t src)
+{
+	return ((src * 2654435761U) >> 16) % ARRAY_SIZE(rpl_hash);
+}
+
+static void rpl_hash_add(const struct bt_mesh_rpl *rpl)
+{
+	size_t i = rpl_hash_slot(rpl->src);
+
+	while (rpl_hash[i]) {
+		i = (i + 1) % ARRAY_SIZE(rpl_hash);
+	}
+
+	rpl_hash[i] = (rpl - replay_list) + 1;
+}
+
+static void rpl_hash_build(void)
+{
+	(void)memset(rpl_hash, 0, sizeof(rpl_hash));
+
+	for (rpl_cnt = 0; rpl_cnt < ARRAY_SIZE(replay_list); rpl_cnt++) {
+		if (!replay_list[rpl_cnt].src) {
+			break;
+		}
+
+		rpl_hash_add(&replay_list[rpl_cnt]);
+	}
+
+	rpl_hash_valid = true;
+}
+
+static bool rpl_hash_stale(void)
+{
+	/* The replay list has been loaded after the index was built. */
+	return (rpl_cnt < ARRAY_SIZE(replay_list) && replay_list[rpl_cnt].src) ||
+	       (rpl_cnt > 0 && !replay_list[rpl_cnt - 1].src);
+}
+
+static void rpl_hash_update(const struct bt_mesh_rpl *rpl, uint16_t old_src)
+{
+	if (!rpl_hash_valid) {
+		return;
+	}
+
+	if (!old_src && (rpl == &replay_list[rpl_cnt])) {
+		rpl_hash_add(rpl);
+		rpl_cnt++;
+	} else {
+		/* The slot was given to several sources by the check of
+		 * pending segmented messages.
+		 */
+		rpl_hash_valid = false;
+	}
+}
+#endif /* CONFIG_BT_MESH_RPL_HASH */
+
+/* Get the replay list entry of the source address, or the first empty entry if
+ * the source address is not in the list. Returns NULL if the list is full.
+ */
+static struct bt_mesh_rpl *rpl_get(uint16_t src)
+{
+#if CONFIG_BT_MESH_RPL_HASH
+	if (!rpl_hash_valid || rpl_hash_stale()) {
+		rpl_hash_build();
+	}
+
+	for (size_t i = rpl_hash_slot(src); rpl_hash[i]; i = (i + 1) % ARRAY_SIZE(rpl_hash)) {
+		struct bt_mesh_rpl *rpl = &replay_list[rpl_hash[i] - 1];
+
+		if (rpl->src == src) {
+			return rpl;
+		}
+	}
+
+	return (rpl_cnt < ARRAY_SIZE(replay_list)) ? &replay_list[rpl_cnt] : NULL;
+#else
+	for (int i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		struct bt_mesh_rpl *rpl = &replay_list[i];
+
+		if (!rpl->src || rpl->src == src) {
+			return rpl;
+		}
+	}
+
+	return NULL;
+#endif /* CONFIG_BT_MESH_RPL_HASH */
+}
+
 void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		struct bt_mesh_net_rx *rx)
 {
+#if CONFIG_BT_MESH_RPL_HASH
+	uint16_t old_src = rpl->src;
+#endif /* CONFIG_BT_MESH_RPL_HASH */
+
 	/* If this is the first message on the new IV index, we should reset it
 	 * to zero to avoid invalid combinations of IV index and seg.
 	 */
@@ -35,6 +146,14 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 	rpl->src = rx->ctx.addr;
 	rpl->seq = rx->seq;
 	rpl->old_iv = rx->old_iv;
+
+#if CONFIG_BT_MESH_RPL_HASH
+	if (rpl->src != old_src) {
+		rpl_hash_update(rpl, old_src);
+	}
+#endif /* CONFIG_BT_MESH_RPL_HASH */
+
+	emds_entry_dirty_set(&emds_rpl_store);
 }
 
 /* Check the Replay Protection List for a replay attempt. If non-NULL match
@@ -45,7 +164,7 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		struct bt_mesh_rpl **match, bool bridge)
 {
-	int i;
+	struct bt_mesh_rpl *rpl;
 
 	/* Don't bother checking messages from ourselves */
 	if (rx->net_if == BT_MESH_NET_IF_LOCAL) {
@@ -57,48 +176,50 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		return false;
 	}
 
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		struct bt_mesh_rpl *rpl = &replay_list[i];
-
-		/* Empty slot */
-		if (!rpl->src) {
-			if (match) {
-				*match = rpl;
-			} else {
-				bt_mesh_rpl_update(rpl, rx);
-			}
+	rpl = rpl_get(rx->ctx.addr);
+	if (!rpl) {
+		LOG_ERR("RPL is full!");
+		return true;
+	}
 
-			return false;
+	/* Empty slot */
+	if (!rpl->src) {
+		if (match) {
+			*match = rpl;
+		} else {
+			bt_mesh_rpl_update(rpl, rx);
 		}
 
-		/* Existing slot for given address */
-		if (rpl->src == rx->ctx.addr) {
-			if (rx->old_iv && !rpl->old_iv) {
-				return true;
-			}
+		return false;
+	}
 
-			if ((!rx->old_iv && rpl->old_iv) ||
-			    rpl->seq < rx->seq) {
-				if (match) {
-					*match = rpl;
-				} else {
-					bt_mesh_rpl_update(rpl, rx);
-				}
+	/* Existing slot for given address */
+	if (rx->old_iv && !rpl->old_iv) {
+		return true;
+	}
 
-				return false;
-			} else {
-				return true;
-			}
+	if ((!rx->old_iv && rpl->old_iv) ||
+	    rpl->seq < rx->seq) {
+		if (match) {
+			*match = rpl;
+		} else {
+			bt_mesh_rpl_update(rpl, rx);
 		}
+
+		return false;
 	}
 
-	LOG_ERR("RPL is full!");
 	return true;
 }
 
 void bt_mesh_rpl_clear(void)
 {
 	(void)memset(replay_list, 0, sizeof(replay_list));
+	emds_entry_dirty_set(&emds_rpl_store);
+
+#if CONFIG_BT_MESH_RPL_HASH
+	rpl_hash_valid = false;
+#endif /* CONFIG_BT_MESH_RPL_HASH */
 }
 
 void bt_mesh_rpl_reset(void)
@@ -130,6 +251,11 @@ void bt_mesh_rpl_reset(void)
 	}
 
 	(void) memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+	emds_entry_dirty_set(&emds_rpl_store);
+
+#if CONFIG_BT_MESH_RPL_HASH
+	rpl_hash_valid = false;
+#endif /* CONFIG_BT_MESH_RPL_HASH */
 }
 
 void bt_mesh_rpl_pending_store(uint16_t addr)
@@ -114,6 +114,44 @@ void sensor_status_id_decode(struct net_buf_simple *buf, uint8_t *len, uint16_t
 	}
 }
 
+int sensor_status_decode(struct net_buf_simple *buf,
+			 struct sensor_status_entry *entries, uint32_t count)
+{
+	struct net_buf_simple_state state;
+	size_t pos = 0;
+	uint32_t i;
+
+	for (i = 0; i < count && buf->len; i++) {
+		net_buf_simple_save(buf, &state);
+		sensor_status_id_decode(buf, &entries[i].len, &entries[i].id);
+
+		if (buf->len < entries[i].len) {
+			if (i == 0) {
+				LOG_WRN("Invalid length for 0x%04x: %u",
+					entries[i].id, entries[i].len);
+				return -EMSGSIZE;
+			}
+
+			/* Fail in the next call, after the valid entries are
+			 * processed.
+			 */
+			net_buf_simple_restore(buf, &state);
+			break;
+		}
+
+		entries[i].data = net_buf_simple_pull_mem(buf, entries[i].len);
+	}
+
+	/* Sensor servers list their sensors in ascending order of the IDs, so
+	 * each type is found from the position of the previous one.
+	 */
+	for (uint32_t j = 0; j < i; j++) {
+		entries[j].type = sensor_type_find(entries[j].id, &pos);
+	}
+
+	return i;
+}
+
 void sensor_descriptor_decode(struct net_buf_simple *buf,
 			struct bt_mesh_sensor_info *sensor)
 {
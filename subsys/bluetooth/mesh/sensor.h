@@ -80,9 +80,52 @@ int sensor_status_encode(struct net_buf_simple *buf,
 			 const struct bt_mesh_sensor *sensor,
 			 const struct bt_mesh_sensor_value *values);
 
+/** Entry of a Sensor Status message. */
+struct sensor_status_entry {
+	/** Sensor type, or NULL if the sensor type ID is unknown. */
+	const struct bt_mesh_sensor_type *type;
+	/** Encoded sensor data. */
+	uint8_t *data;
+	/** Sensor type ID. */
+	uint16_t id;
+	/** Length of the encoded sensor data. */
+	uint8_t len;
+};
+
+/** @brief Find a sensor type, continuing from a previous search.
+ *
+ *  The sensor types are sorted by their IDs. When the IDs of consecutive
+ *  searches are ascending, each search starts at the position of the previous
+ *  one.
+ *
+ *  @param[in] id      Sensor type ID.
+ *  @param[in,out] pos Position of the previous search. Must be 0 for the first
+ *                     search.
+ *
+ *  @return The sensor type, or NULL if the ID is unknown.
+ */
+const struct bt_mesh_sensor_type *sensor_type_find(uint16_t id, size_t *pos);
+
 int sensor_status_id_encode(struct net_buf_simple *buf, uint8_t len, uint16_t id);
 void sensor_status_id_decode(struct net_buf_simple *buf, uint8_t *len, uint16_t *id);
 
+/** @brief Decode the entries of a Sensor Status message.
+ *
+ *  Pulls up to @c count entries from the buffer, and resolves the sensor types
+ *  of all of them in one pass through the sensor types. If the data of an
+ *  entry is truncated, the decoding stops before it, and the next call returns
+ *  an error.
+ *
+ *  @param[in] buf      Sensor Status message.
+ *  @param[out] entries Decoded entries.
+ *  @param[in] count    Maximum number of entries to decode.
+ *
+ *  @return The number of decoded entries, or a negative error code if the
+ *          first entry is invalid.
+ */
+int sensor_status_decode(struct net_buf_simple *buf,
+			 struct sensor_status_entry *entries, uint32_t count);
+
 void sensor_descriptor_decode(struct net_buf_simple *buf,
 			      struct bt_mesh_sensor_info *sensor);
 void sensor_descriptor_encode(struct net_buf_simple *buf,
@@ -14,6 +14,9 @@
 #include "zephyr/logging/log.h"
 LOG_MODULE_REGISTER(bt_mesh_sensor_cli);
 
+/* Number of Sensor Status message entries decoded at a time. */
+#define STATUS_DECODE_BATCH_LEN 8
+
 struct list_rsp {
 	struct bt_mesh_sensor_info *sensors;
 	uint32_t count;
@@ -107,67 +110,71 @@ static int handle_status(const struct bt_mesh_model *model, struct bt_mesh_msg_c
 {
 	struct bt_mesh_sensor_cli *cli = model->rt->user_data;
 	struct sensor_data_list_rsp *rsp = NULL;
+	struct sensor_status_entry entries[STATUS_DECODE_BATCH_LEN];
 	uint32_t count = 0;
+	int entry_count;
 	int err;
 
 	(void)bt_mesh_msg_ack_ctx_match(&cli->ack_ctx, BT_MESH_SENSOR_OP_STATUS, ctx->addr,
 					(void **)&rsp);
 
 	while (buf->len) {
-		const struct bt_mesh_sensor_type *type;
-		uint8_t length;
-		uint16_t id;
-
-		sensor_status_id_decode(buf, &length, &id);
-		if (length == 0) {
-			if (rsp && rsp->count == 1 && rsp->sensors[0].type &&
-			    rsp->sensors[0].type->id == id) {
-				rsp->sensors[0].type = NULL;
-				bt_mesh_msg_ack_ctx_rx(&cli->ack_ctx);
-				rsp = NULL;
+		entry_count = sensor_status_decode(buf, entries, ARRAY_SIZE(entries));
+		if (entry_count < 0) {
+			return entry_count;
+		}
+
+		for (int i = 0; i < entry_count; i++) {
+			const struct bt_mesh_sensor_type *type = entries[i].type;
+			uint8_t length = entries[i].len;
+			uint16_t id = entries[i].id;
+
+			if (length == 0) {
+				if (rsp && rsp->count == 1 && rsp->sensors[0].type &&
+				    rsp->sensors[0].type->id == id) {
+					rsp->sensors[0].type = NULL;
+					bt_mesh_msg_ack_ctx_rx(&cli->ack_ctx);
+					rsp = NULL;
+				}
+
+				continue;
 			}
 
-			continue;
-		}
+			if (!type) {
+				unknown_type(cli, ctx, id, BT_MESH_SENSOR_OP_STATUS);
+				continue;
+			}
 
-		type = bt_mesh_sensor_type_get(id);
-		if (!type) {
-			if (buf->len < length) {
-				LOG_WRN("Invalid length for 0x%04x: %u", id,
-					length);
+			uint8_t expected_len = sensor_value_len(type);
+
+			if (length != expected_len) {
+				LOG_WRN("Invalid length for 0x%04x: %u (expected %u)",
+					id, length, expected_len);
 				return -EMSGSIZE;
 			}
-			net_buf_simple_pull(buf, length);
-			unknown_type(cli, ctx, id, BT_MESH_SENSOR_OP_STATUS);
-			continue;
-		}
 
-		uint8_t expected_len = sensor_value_len(type);
+			struct bt_mesh_sensor_value value[CONFIG_BT_MESH_SENSOR_CHANNELS_MAX];
+			struct net_buf_simple data;
 
-		if (length != expected_len) {
-			LOG_WRN("Invalid length for 0x%04x: %u (expected %u)",
-				id, length, expected_len);
-			return -EMSGSIZE;
-		}
-
-		struct bt_mesh_sensor_value value[CONFIG_BT_MESH_SENSOR_CHANNELS_MAX];
+			net_buf_simple_init_with_data(&data, entries[i].data, length);
 
-		err = sensor_value_decode(buf, type, value);
-		if (err) {
-			LOG_ERR("Invalid format, err=%d", err);
-			return err; /* Invalid format, should ignore message */
-		}
+			err = sensor_value_decode(&data, type, value);
+			if (err) {
+				LOG_ERR("Invalid format, err=%d", err);
+				return err; /* Invalid format, should ignore message */
+			}
 
-		if (cli->cb && cli->cb->data) {
-			cli->cb->data(cli, ctx, type, value);
-		}
+			if (cli->cb && cli->cb->data) {
+				cli->cb->data(cli, ctx, type, value);
+			}
 
-		if (rsp && count <= rsp->count) {
-			memcpy(rsp->sensors[count].value, value,
-			       sizeof(struct bt_mesh_sensor_value) * type->channel_count);
+			if (rsp && count <= rsp->count) {
+				memcpy(rsp->sensors[count].value, value,
+				       sizeof(struct bt_mesh_sensor_value) * type->channel_count);
 
-			rsp->sensors[count].type = type;
-			++count;
+				rsp->sensors[count].type = type;
+				++count;
+			}
 		}
 	}
 
@@ -230,6 +230,57 @@ struct conn_blocklist {
 };
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
+#if CONFIG_BT_SCAN_FILTER_STATS
+/* Number of advertising reports matched by each filter. */
+struct bt_scan_filter_hits {
+	uint32_t name[CONFIG_BT_SCAN_NAME_CNT];
+	uint32_t short_name[CONFIG_BT_SCAN_SHORT_NAME_CNT];
+	uint32_t addr[CONFIG_BT_SCAN_ADDRESS_CNT];
+	uint32_t uuid[CONFIG_BT_SCAN_UUID_CNT];
+	uint32_t appearance[CONFIG_BT_SCAN_APPEARANCE_CNT];
+	uint32_t manufacturer_data[CONFIG_BT_SCAN_MANUFACTURER_DATA_CNT];
+};
+
+#define FILTER_HIT(_type, _idx) (bt_scan.hits._type[_idx]++)
+#else
+#define FILTER_HIT(_type, _idx)
+#endif /* CONFIG_BT_SCAN_FILTER_STATS */
+
+#if CONFIG_BT_SCAN_DEDUP
+/* Deduplication entry of a device address and advertising data pair. */
+struct dedup_entry {
+	/* Node in the least recently reported list. */
+	sys_dnode_t lru_node;
+
+	/* Node in the hash bucket. */
+	sys_snode_t bucket_node;
+
+	/* Device address. */
+	bt_addr_le_t addr;
+
+	/* Hash of the advertising data. */
+	uint32_t ad_hash;
+
+	/* Uptime of the last delivered report in milliseconds. */
+	uint32_t timestamp;
+};
+
+/* Advertising report deduplication table. */
+struct dedup_table {
+	/* Array of the entries. */
+	struct dedup_entry entry[CONFIG_BT_SCAN_DEDUP_LEN];
+
+	/* Entries hashed by the address and advertising data hash. */
+	sys_slist_t bucket[CONFIG_BT_SCAN_DEDUP_LEN];
+
+	/* Entries from the least to the most recently reported. */
+	sys_dlist_t lru;
+
+	/* Count of the used entries. */
+	size_t count;
+};
+#endif /* CONFIG_BT_SCAN_DEDUP */
+
 /* Scanning module instance. Options for the different scanning modes.
  * This structure stores all module settings. It is used to enable
  * or disable scanning modes and to configure filters.
@@ -266,8 +317,382 @@ static struct bt_scan {
 	struct conn_blocklist blocklist;
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
+#if CONFIG_BT_SCAN_FILTER_STATS
+	/* Filter hit counters. */
+	struct bt_scan_filter_hits hits;
+#endif /* CONFIG_BT_SCAN_FILTER_STATS */
+
+#if CONFIG_BT_SCAN_DEDUP
+	/* Advertising report deduplication table. */
+	struct dedup_table dedup;
+#endif /* CONFIG_BT_SCAN_DEDUP */
+
 } bt_scan;
 
+#if CONFIG_BT_SCAN_FILTER_HASH
+/* Entry indexes are stored incremented by one in the lookup tables,
+ * so that zero marks an empty entry.
+ */
+BUILD_ASSERT(CONFIG_BT_SCAN_ADDRESS_CNT < UINT8_MAX);
+BUILD_ASSERT(CONFIG_BT_SCAN_UUID_CNT < UINT8_MAX);
+BUILD_ASSERT(CONFIG_BT_SCAN_NAME_CNT < UINT8_MAX);
+BUILD_ASSERT(CONFIG_BT_SCAN_SHORT_NAME_CNT < UINT8_MAX);
+
+/* Bytes of the Bluetooth Base UUID that precede the 32-bit UUID value. */
+static const uint8_t uuid_base[BT_SCAN_UUID_128_SIZE - sizeof(uint32_t)] = {
+	0xfb, 0x34, 0x9b, 0x5f, 0x80, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x00
+};
+
+/* Address hash table. The table does not store the addresses, but the
+ * indexes of the addresses in the array of its owner. The entries of
+ * a bucket are chained, so that any entry can be removed.
+ */
+struct addr_table {
+	/* The first address of the owner array. */
+	const bt_addr_le_t *addr;
+
+	/* Distance between two addresses in the owner array. */
+	size_t stride;
+
+	/* First entry of each bucket. */
+	uint8_t *bucket;
+
+	/* Next entry in the same bucket. */
+	uint8_t *next;
+
+	/* Number of buckets. */
+	size_t bucket_cnt;
+};
+
+#define ADDR_TABLE_DEFINE(_name, _addr, _stride, _len)				\
+	BUILD_ASSERT((_len) < UINT8_MAX);					\
+	static uint8_t _name##_bucket[MAX(_len, 1)];				\
+	static uint8_t _name##_next[MAX(_len, 1)];				\
+	static const struct addr_table _name = {				\
+		.addr = (_addr),						\
+		.stride = (_stride),						\
+		.bucket = _name##_bucket,					\
+		.next = _name##_next,						\
+		.bucket_cnt = MAX(_len, 1),					\
+	}
+
+/* Trie node of the name filters. */
+struct name_trie_node {
+	/* First child node, 0 if none. */
+	uint16_t child;
+
+	/* Next node with the same parent, 0 if none. */
+	uint16_t sibling;
+
+	/* Name character. */
+	char c;
+
+	/* The lowest index of the names that start with the node prefix. */
+	uint8_t first;
+
+	/* Index of the name that ends at the node, 0 if none. */
+	uint8_t end;
+};
+
+/* Trie of the name filters. Node 0 is the root. */
+struct name_trie {
+	struct name_trie_node *node;
+
+	/* Number of nodes in the node array. */
+	uint16_t size;
+
+	/* Number of used nodes. */
+	uint16_t used;
+};
+
+#define NAME_TRIE_DEFINE(_name, _cnt, _len)					\
+	BUILD_ASSERT((_cnt) * (_len) < UINT16_MAX);				\
+	static struct name_trie_node _name##_node[(_cnt) * (_len) + 1];	\
+	static struct name_trie _name = {					\
+		.node = _name##_node,						\
+		.size = ARRAY_SIZE(_name##_node),				\
+	}
+
+/* UUID in the form used by the lookup. UUIDs based on the Bluetooth Base UUID
+ * are reduced to their 32-bit value, so that the lookup matches the same UUIDs
+ * as bt_uuid_cmp(), regardless of the size of the advertised UUID.
+ */
+struct uuid_key {
+	bool base;
+	union {
+		uint32_t val;
+		uint8_t val128[BT_SCAN_UUID_128_SIZE];
+	};
+};
+
+/* UUID hash table with linear probing. */
+static uint8_t uuid_table[MAX(2 * CONFIG_BT_SCAN_UUID_CNT, 1)];
+static struct uuid_key uuid_table_key[MAX(CONFIG_BT_SCAN_UUID_CNT, 1)];
+
+ADDR_TABLE_DEFINE(addr_filter_table, bt_scan.scan_filters.addr.target_addr,
+		  sizeof(bt_addr_le_t), CONFIG_BT_SCAN_ADDRESS_CNT);
+
+NAME_TRIE_DEFINE(name_trie, CONFIG_BT_SCAN_NAME_CNT, CONFIG_BT_SCAN_NAME_MAX_LEN);
+NAME_TRIE_DEFINE(short_name_trie, CONFIG_BT_SCAN_SHORT_NAME_CNT,
+		 CONFIG_BT_SCAN_SHORT_NAME_MAX_LEN);
+
+#if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
+ADDR_TABLE_DEFINE(attempts_table, &bt_scan.attempts_filter.device[0].addr,
+		  sizeof(struct conn_attempts_device), CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER_LEN);
+#endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
+
+#if CONFIG_BT_SCAN_BLOCKLIST
+ADDR_TABLE_DEFINE(blocklist_table, bt_scan.blocklist.addr, sizeof(bt_addr_le_t),
+		  CONFIG_BT_SCAN_BLOCKLIST_LEN);
+#endif /* CONFIG_BT_SCAN_BLOCKLIST */
+
+static uint32_t hash_mix(uint32_t hash)
+{
+	hash *= 0x9e3779b1;
+
+	return hash ^ (hash >> 16);
+}
+
+static size_t addr_table_bucket(const struct addr_table *table, const bt_addr_le_t *addr)
+{
+	uint32_t hash = sys_get_le32(addr->a.val) ^
+			(sys_get_le16(&addr->a.val[4]) << 8) ^ addr->type;
+
+	return hash_mix(hash) % table->bucket_cnt;
+}
+
+static const bt_addr_le_t *addr_table_addr(const struct addr_table *table, size_t idx)
+{
+	return (const bt_addr_le_t *)((const uint8_t *)table->addr + idx * table->stride);
+}
+
+static int addr_table_find(const struct addr_table *table, const bt_addr_le_t *addr)
+{
+	uint8_t entry = table->bucket[addr_table_bucket(table, addr)];
+
+	while (entry) {
+		if (bt_addr_le_cmp(addr, addr_table_addr(table, entry - 1)) == 0) {
+			return entry - 1;
+		}
+
+		entry = table->next[entry - 1];
+	}
+
+	return -ENOENT;
+}
+
+/* Add the address that is stored in the owner array at the given index. */
+static void addr_table_add(const struct addr_table *table, size_t idx)
+{
+	uint8_t *bucket = &table->bucket[addr_table_bucket(table, addr_table_addr(table, idx))];
+
+	table->next[idx] = *bucket;
+	*bucket = idx + 1;
+}
+
+#if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
+/* Remove the address that is stored in the owner array at the given index. */
+static void addr_table_remove(const struct addr_table *table, size_t idx)
+{
+	uint8_t *entry = &table->bucket[addr_table_bucket(table, addr_table_addr(table, idx))];
+
+	while (*entry) {
+		if (*entry == idx + 1) {
+			*entry = table->next[idx];
+
+			return;
+		}
+
+		entry = &table->next[*entry - 1];
+	}
+}
+#endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
+
+static void addr_table_clear(const struct addr_table *table)
+{
+	memset(table->bucket, 0, table->bucket_cnt);
+}
+
+static void name_trie_add(struct name_trie *trie, const char *name, size_t len, uint8_t idx)
+{
+	uint16_t node = 0;
+
+	if (!trie->used) {
+		memset(&trie->node[0], 0, sizeof(trie->node[0]));
+		trie->node[0].first = idx;
+		trie->used = 1;
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		uint16_t child = trie->node[node].child;
+
+		while (child && (trie->node[child].c != name[i])) {
+			child = trie->node[child].sibling;
+		}
+
+		if (!child) {
+			__ASSERT_NO_MSG(trie->used < trie->size);
+
+			child = trie->used++;
+			trie->node[child] = (struct name_trie_node) {
+				.sibling = trie->node[node].child,
+				.c = name[i],
+				.first = idx,
+			};
+			trie->node[node].child = child;
+		}
+
+		node = child;
+	}
+
+	trie->node[node].end = idx + 1;
+}
+
+/* Find the lowest index of the names that can match the advertised name,
+ * following the rules of strncmp(). The advertised name matches the names
+ * that start with it, or the name that ends at its first null character.
+ */
+static int name_trie_find(const struct name_trie *trie, const uint8_t *data, uint8_t len)
+{
+	uint16_t node = 0;
+
+	if (!trie->used) {
+		return -ENOENT;
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		uint16_t child = trie->node[node].child;
+
+		if (data[i] == '\0') {
+			return trie->node[node].end ? (trie->node[node].end - 1) : -ENOENT;
+		}
+
+		while (child && (trie->node[child].c != data[i])) {
+			child = trie->node[child].sibling;
+		}
+
+		if (!child) {
+			return -ENOENT;
+		}
+
+		node = child;
+	}
+
+	return trie->node[node].first;
+}
+
+static void name_trie_clear(struct name_trie *trie)
+{
+	trie->used = 0;
+}
+
+static void uuid_key_from_data(struct uuid_key *key, const uint8_t *data, uint8_t len)
+{
+	key->base = true;
+
+	switch (len) {
+	case sizeof(uint16_t):
+		key->val = sys_get_le16(data);
+		break;
+
+	case sizeof(uint32_t):
+		key->val = sys_get_le32(data);
+		break;
+
+	default:
+		if (memcmp(data, uuid_base, sizeof(uuid_base)) == 0) {
+			key->val = sys_get_le32(&data[sizeof(uuid_base)]);
+		} else {
+			key->base = false;
+			memcpy(key->val128, data, sizeof(key->val128));
+		}
+		break;
+	}
+}
+
+static void uuid_key_from_uuid(struct uuid_key *key, const struct bt_uuid *uuid)
+{
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		key->base = true;
+		key->val = BT_UUID_16(uuid)->val;
+		break;
+
+	case BT_UUID_TYPE_32:
+		key->base = true;
+		key->val = BT_UUID_32(uuid)->val;
+		break;
+
+	default:
+		uuid_key_from_data(key, BT_UUID_128(uuid)->val, BT_SCAN_UUID_128_SIZE);
+		break;
+	}
+}
+
+static bool uuid_key_eq(const struct uuid_key *a, const struct uuid_key *b)
+{
+	if (a->base != b->base) {
+		return false;
+	}
+
+	if (a->base) {
+		return a->val == b->val;
+	}
+
+	return memcmp(a->val128, b->val128, sizeof(a->val128)) == 0;
+}
+
+static size_t uuid_table_slot(const struct uuid_key *key)
+{
+	uint32_t hash = key->val;
+
+	if (!key->base) {
+		for (size_t i = sizeof(uint32_t); i < sizeof(key->val128); i += sizeof(uint32_t)) {
+			hash ^= sys_get_le32(&key->val128[i]);
+		}
+	}
+
+	return hash_mix(hash) % ARRAY_SIZE(uuid_table);
+}
+
+static int uuid_table_find(const struct uuid_key *key)
+{
+	size_t slot = uuid_table_slot(key);
+
+	while (uuid_table[slot]) {
+		if (uuid_key_eq(key, &uuid_table_key[uuid_table[slot] - 1])) {
+			return uuid_table[slot] - 1;
+		}
+
+		slot = (slot + 1) % ARRAY_SIZE(uuid_table);
+	}
+
+	return -ENOENT;
+}
+
+static void uuid_table_add(const struct bt_uuid *uuid, uint8_t idx)
+{
+	size_t slot;
+
+	uuid_key_from_uuid(&uuid_table_key[idx], uuid);
+
+	slot = uuid_table_slot(&uuid_table_key[idx]);
+	while (uuid_table[slot]) {
+		slot = (slot + 1) % ARRAY_SIZE(uuid_table);
+	}
+
+	uuid_table[slot] = idx + 1;
+}
+
+static void filter_tables_clear(void)
+{
+	addr_table_clear(&addr_filter_table);
+	name_trie_clear(&name_trie);
+	name_trie_clear(&short_name_trie);
+	memset(uuid_table, 0, sizeof(uuid_table));
+}
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
+
 static sys_slist_t callback_list;
 
 void bt_scan_cb_register(struct bt_scan_cb *cb)
@@ -331,20 +756,29 @@ static void notify_connecting_error(struct bt_scan_device_info *device_info)
 #endif /* CONFIG_BT_CENTRAL */
 
 #if CONFIG_BT_SCAN_BLOCKLIST
-static bool blocklist_device_check(const bt_addr_le_t *addr)
+static int blocklist_find(const bt_addr_le_t *addr)
 {
-	bool blocklist_device = false;
-
-	k_mutex_lock(&scan_mutex, K_FOREVER);
-
+#if CONFIG_BT_SCAN_FILTER_HASH
+	return addr_table_find(&blocklist_table, addr);
+#else
 	for (size_t i = 0; i < bt_scan.blocklist.count; i++) {
 		if (bt_addr_le_cmp(&bt_scan.blocklist.addr[i], addr) == 0) {
-			blocklist_device = true;
-
-			break;
+			return i;
 		}
 	}
 
+	return -ENOENT;
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
+}
+
+static bool blocklist_device_check(const bt_addr_le_t *addr)
+{
+	bool blocklist_device;
+
+	k_mutex_lock(&scan_mutex, K_FOREVER);
+
+	blocklist_device = (blocklist_find(addr) >= 0);
+
 	k_mutex_unlock(&scan_mutex);
 
 	return blocklist_device;
@@ -352,13 +786,41 @@ static bool blocklist_device_check(const bt_addr_le_t *addr)
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
 #if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
+static struct conn_attempts_device *attempts_filter_find(struct conn_attempts_filter *filter,
+							  const bt_addr_le_t *addr)
+{
+#if CONFIG_BT_SCAN_FILTER_HASH
+	int idx = addr_table_find(&attempts_table, addr);
+
+	return (idx < 0) ? NULL : &filter->device[idx];
+#else
+	for (size_t i = 0; i < filter->count; i++) {
+		struct conn_attempts_device *device = &filter->device[i];
+
+		if (bt_addr_le_cmp(addr, &device->addr) == 0) {
+			return device;
+		}
+	}
+
+	return NULL;
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
+}
+
 static void attempts_filter_force_add(struct conn_attempts_filter *filter,
 				      const bt_addr_le_t *addr)
 {
+#if CONFIG_BT_SCAN_FILTER_HASH
+	addr_table_remove(&attempts_table, filter->oldest_idx);
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
+
 	/* Overwrite the oldest device */
 	filter->device[filter->oldest_idx].attempts = 0;
 	bt_addr_le_copy(&filter->device[filter->oldest_idx].addr, addr);
 
+#if CONFIG_BT_SCAN_FILTER_HASH
+	addr_table_add(&attempts_table, filter->oldest_idx);
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
+
 	if (filter->oldest_idx == (ARRAY_SIZE(filter->device) - 1)) {
 		filter->oldest_idx = 0;
 
@@ -378,14 +840,9 @@ static void scan_attempts_filter_device_add(const bt_addr_le_t *addr)
 	k_mutex_lock(&scan_mutex, K_FOREVER);
 
 	/* Check if device is already in the filter array. */
-	for (size_t i = 0; i < filter->count; i++) {
-		struct conn_attempts_device *device = &filter->device[i];
-
-		if (bt_addr_le_cmp(addr, &device->addr) == 0) {
-			LOG_DBG("Device %s is already in the filter array",
-				addr_str);
-			goto out;
-		}
+	if (attempts_filter_find(filter, addr)) {
+		LOG_DBG("Device %s is already in the filter array", addr_str);
+		goto out;
 	}
 
 	if (filter->count >= ARRAY_SIZE(filter->device)) {
@@ -393,6 +850,9 @@ static void scan_attempts_filter_device_add(const bt_addr_le_t *addr)
 		attempts_filter_force_add(filter, addr);
 	} else {
 		bt_addr_le_copy(&filter->device[filter->count].addr, addr);
+#if CONFIG_BT_SCAN_FILTER_HASH
+		addr_table_add(&attempts_table, filter->count);
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
 		filter->count++;
 	}
 
@@ -403,20 +863,13 @@ out:
 static void device_conn_attempts_count(struct bt_conn *conn)
 {
 	const bt_addr_le_t *addr = bt_conn_get_dst(conn);
-	struct conn_attempts_filter *filter = &bt_scan.attempts_filter;
+	struct conn_attempts_device *device;
 
 	k_mutex_lock(&scan_mutex, K_FOREVER);
 
-	for (size_t i = 0; i < filter->count; i++) {
-		struct conn_attempts_device *device = &filter->device[i];
-
-		if (bt_addr_le_cmp(addr, &device->addr) == 0) {
-			if (device->attempts < CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT) {
-				device->attempts++;
-			}
-
-			break;
-		}
+	device = attempts_filter_find(&bt_scan.attempts_filter, addr);
+	if (device && (device->attempts < CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT)) {
+		device->attempts++;
 	}
 
 	k_mutex_unlock(&scan_mutex);
@@ -424,27 +877,22 @@ static void device_conn_attempts_count(struct bt_conn *conn)
 
 static bool conn_attempts_exceeded(const bt_addr_le_t *addr)
 {
-	struct conn_attempts_filter *filter = &bt_scan.attempts_filter;
-	char addr_str[BT_ADDR_LE_STR_LEN];
+	struct conn_attempts_device *device;
 	bool attempts_exceeded = false;
 
-	bt_addr_le_to_str(addr, addr_str, sizeof(addr_str));
-
 	k_mutex_lock(&scan_mutex, K_FOREVER);
 
 	/* Check if the device is in the filter array. */
-	for (size_t i = 0; i < filter->count; i++) {
-		struct conn_attempts_device *device = &filter->device[i];
-
-		if (bt_addr_le_cmp(addr, &device->addr) == 0) {
-			if (device->attempts >= CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT) {
-				LOG_DBG("Connection attempts count for %s exceeded",
-					addr_str);
-				attempts_exceeded = true;
-			}
+	device = attempts_filter_find(&bt_scan.attempts_filter, addr);
+	if (device && (device->attempts >= CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT)) {
+		if (IS_ENABLED(CONFIG_BT_SCAN_LOG_LEVEL_DBG)) {
+			char addr_str[BT_ADDR_LE_STR_LEN];
 
-			break;
+			bt_addr_le_to_str(addr, addr_str, sizeof(addr_str));
+			LOG_DBG("Connection attempts count for %s exceeded", addr_str);
 		}
+
+		attempts_exceeded = true;
 	}
 
 	k_mutex_unlock(&scan_mutex);
@@ -471,6 +919,202 @@ static bool scan_device_filter_check(const bt_addr_le_t *addr)
 	return true;
 }
 
+#if CONFIG_BT_SCAN_DEDUP
+/* FNV-1a hash. */
+static uint32_t dedup_hash(uint32_t hash, const uint8_t *data, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ data[i]) * 0x01000193;
+	}
+
+	return hash;
+}
+
+static sys_slist_t *dedup_bucket(const bt_addr_le_t *addr, uint32_t ad_hash)
+{
+	uint32_t hash = dedup_hash(ad_hash, (const uint8_t *)addr, sizeof(*addr));
+
+	return &bt_scan.dedup.bucket[hash % CONFIG_BT_SCAN_DEDUP_LEN];
+}
+
+static struct dedup_entry *dedup_find(sys_slist_t *bucket, const bt_addr_le_t *addr,
+				      uint32_t ad_hash)
+{
+	struct dedup_entry *entry;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(bucket, entry, bucket_node) {
+		if ((entry->ad_hash == ad_hash) &&
+		    (bt_addr_le_cmp(&entry->addr, addr) == 0)) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+void bt_scan_dedup_clear(void)
+{
+	struct dedup_table *dedup = &bt_scan.dedup;
+
+	k_mutex_lock(&scan_mutex, K_FOREVER);
+
+	sys_dlist_init(&dedup->lru);
+
+	for (size_t i = 0; i < ARRAY_SIZE(dedup->bucket); i++) {
+		sys_slist_init(&dedup->bucket[i]);
+	}
+
+	dedup->count = 0;
+
+	k_mutex_unlock(&scan_mutex);
+}
+
+/* Returns false if the advertising report repeats the last delivered
+ * report of the device within the deduplication window. The changed flag
+ * is set if the advertising data of the device is not in the table.
+ */
+static bool dedup_check(const bt_addr_le_t *addr, const struct net_buf_simple *ad,
+			bool *changed)
+{
+	struct dedup_table *dedup = &bt_scan.dedup;
+	uint32_t ad_hash = dedup_hash(0x811c9dc5, ad->data, ad->len);
+	uint32_t now = k_uptime_get_32();
+	sys_slist_t *bucket = dedup_bucket(addr, ad_hash);
+	struct dedup_entry *entry;
+	bool deliver = true;
+
+	k_mutex_lock(&scan_mutex, K_FOREVER);
+
+	entry = dedup_find(bucket, addr, ad_hash);
+	if (entry) {
+		*changed = false;
+
+		/* Keep the entry as long as the device advertises. */
+		sys_dlist_remove(&entry->lru_node);
+
+		if ((now - entry->timestamp) < CONFIG_BT_SCAN_DEDUP_WINDOW_MS) {
+			deliver = false;
+		} else {
+			entry->timestamp = now;
+		}
+	} else {
+		*changed = true;
+
+		if (dedup->count < ARRAY_SIZE(dedup->entry)) {
+			entry = &dedup->entry[dedup->count];
+			dedup->count++;
+		} else {
+			/* Replace the least recently reported entry. */
+			entry = CONTAINER_OF(sys_dlist_get(&dedup->lru),
+					     struct dedup_entry, lru_node);
+			sys_slist_find_and_remove(dedup_bucket(&entry->addr, entry->ad_hash),
+						  &entry->bucket_node);
+		}
+
+		bt_addr_le_copy(&entry->addr, addr);
+		entry->ad_hash = ad_hash;
+		entry->timestamp = now;
+		sys_slist_prepend(bucket, &entry->bucket_node);
+	}
+
+	sys_dlist_append(&dedup->lru, &entry->lru_node);
+
+	k_mutex_unlock(&scan_mutex);
+
+	return deliver;
+}
+#endif /* CONFIG_BT_SCAN_DEDUP */
+
+#if CONFIG_BT_SCAN_CHANGED_DEVICES
+static sys_slist_t changed_devices_cb_list;
+
+/* The batch is collected in one buffer while the other one is delivered. */
+static struct bt_scan_changed_device changed_device[2][CONFIG_BT_SCAN_CHANGED_DEVICES_MAX];
+static size_t changed_device_cnt;
+static uint8_t changed_device_buf;
+
+static void changed_devices_notify(struct k_work *work)
+{
+	struct bt_scan_changed_devices_cb *cb;
+	const struct bt_scan_changed_device *devices;
+	size_t count;
+
+	k_mutex_lock(&scan_mutex, K_FOREVER);
+
+	devices = changed_device[changed_device_buf];
+	count = changed_device_cnt;
+
+	changed_device_buf ^= 1;
+	changed_device_cnt = 0;
+
+	k_mutex_unlock(&scan_mutex);
+
+	if (!count) {
+		return;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&changed_devices_cb_list, cb, node) {
+		cb->changed(devices, count);
+	}
+}
+
+static K_WORK_DELAYABLE_DEFINE(changed_devices_work, changed_devices_notify);
+
+void bt_scan_changed_devices_cb_register(struct bt_scan_changed_devices_cb *cb)
+{
+	if (!cb || !cb->changed) {
+		return;
+	}
+
+	sys_slist_append(&changed_devices_cb_list, &cb->node);
+}
+
+static void changed_device_add(const struct bt_le_scan_recv_info *info, bool filter_match)
+{
+	struct bt_scan_changed_device *device = NULL;
+	struct bt_scan_changed_device *devices;
+
+	if (sys_slist_is_empty(&changed_devices_cb_list)) {
+		return;
+	}
+
+	k_mutex_lock(&scan_mutex, K_FOREVER);
+
+	devices = changed_device[changed_device_buf];
+
+	/* A device is reported once in a batch, with its last report. */
+	for (size_t i = 0; i < changed_device_cnt; i++) {
+		if (bt_addr_le_cmp(&devices[i].addr, info->addr) == 0) {
+			device = &devices[i];
+			break;
+		}
+	}
+
+	if (!device && (changed_device_cnt < CONFIG_BT_SCAN_CHANGED_DEVICES_MAX)) {
+		device = &devices[changed_device_cnt];
+		bt_addr_le_copy(&device->addr, info->addr);
+		changed_device_cnt++;
+	}
+
+	if (device) {
+		device->rssi = info->rssi;
+		device->adv_props = info->adv_props;
+		device->filter_match = filter_match;
+	}
+
+	k_mutex_unlock(&scan_mutex);
+
+	if (!device) {
+		LOG_DBG("Changed devices batch full");
+		return;
+	}
+
+	/* The batch is delivered at the fixed interval after its first change. */
+	k_work_schedule(&changed_devices_work,
+			K_MSEC(CONFIG_BT_SCAN_CHANGED_DEVICES_INTERVAL_MS));
+}
+#endif /* CONFIG_BT_SCAN_CHANGED_DEVICES */
+
 #if CONFIG_BT_CENTRAL
 static void scan_connect_with_target(struct bt_scan_control *control,
 				     const bt_addr_le_t *addr)
@@ -506,22 +1150,39 @@ static void scan_connect_with_target(struct bt_scan_control *control,
 }
 #endif /* CONFIG_BT_CENTRAL */
 
-static bool adv_addr_compare(const bt_addr_le_t *target_addr,
-			     struct bt_scan_control *control)
+static int adv_addr_find(const bt_addr_le_t *target_addr)
 {
+#if CONFIG_BT_SCAN_FILTER_HASH
+	return addr_table_find(&addr_filter_table, target_addr);
+#else
 	const bt_addr_le_t *addr =
 			bt_scan.scan_filters.addr.target_addr;
 	uint8_t counter = bt_scan.scan_filters.addr.cnt;
 
 	for (size_t i = 0; i < counter; i++) {
 		if (bt_addr_le_cmp(target_addr, &addr[i]) == 0) {
-			control->filter_status.addr.addr = &addr[i];
-
-			return true;
+			return i;
 		}
 	}
 
-	return false;
+	return -ENOENT;
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
+}
+
+static bool adv_addr_compare(const bt_addr_le_t *target_addr,
+			     struct bt_scan_control *control)
+{
+	int idx = adv_addr_find(target_addr);
+
+	if (idx < 0) {
+		return false;
+	}
+
+	control->filter_status.addr.addr =
+			&bt_scan.scan_filters.addr.target_addr[idx];
+	FILTER_HIT(addr, idx);
+
+	return true;
 }
 
 static bool is_addr_filter_enabled(void)
@@ -556,15 +1217,17 @@ static int scan_addr_filter_add(const bt_addr_le_t *target_addr)
 	}
 
 	/* Check for duplicated filter. */
-	for (size_t i = 0; i < counter; i++) {
-		if (bt_addr_le_cmp(target_addr, &addr_filter[i]) == 0) {
-			return 0;
-		}
+	if (adv_addr_find(target_addr) >= 0) {
+		return 0;
 	}
 
 	/* Add target address to filter. */
 	bt_addr_le_copy(&addr_filter[counter], target_addr);
 
+#if CONFIG_BT_SCAN_FILTER_HASH
+	addr_table_add(&addr_filter_table, counter);
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
+
 	LOG_DBG("Filter set on address type %i",
 		addr_filter[counter].type);
 
@@ -592,9 +1255,19 @@ static bool adv_name_compare(const struct bt_data *data,
 			&bt_scan.scan_filters.name;
 	uint8_t counter = bt_scan.scan_filters.name.cnt;
 	uint8_t data_len = data->data_len;
+#if CONFIG_BT_SCAN_FILTER_HASH
+	/* The trie rejects most names and points to the first matching one. */
+	int first = name_trie_find(&name_trie, data->data, data_len);
+
+	if (first < 0) {
+		return false;
+	}
+#else
+	int first = 0;
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
 
 	/* Compare the name found with the name filter. */
-	for (size_t i = 0; i < counter; i++) {
+	for (size_t i = first; i < counter; i++) {
 		if (adv_name_cmp(data->data,
 				 data_len,
 				 name_filter->target_name[i])) {
@@ -602,6 +1275,7 @@ static bool adv_name_compare(const struct bt_data *data,
 			control->filter_status.name.name =
 				name_filter->target_name[i];
 			control->filter_status.name.len = data_len;
+			FILTER_HIT(name, i);
 
 			return true;
 		}
@@ -654,9 +1328,15 @@ static int scan_name_filter_add(const char *name)
 	}
 
 	/* Add name to filter. */
+	memset(bt_scan.scan_filters.name.target_name[counter], 0,
+	       sizeof(bt_scan.scan_filters.name.target_name[counter]));
 	memcpy(bt_scan.scan_filters.name.target_name[counter],
 	       name, name_len);
 
+#if CONFIG_BT_SCAN_FILTER_HASH
+	name_trie_add(&name_trie, name, name_len, counter);
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
+
 	bt_scan.scan_filters.name.cnt++;
 
 	LOG_DBG("Adding filter on %s name", name);
@@ -684,9 +1364,21 @@ static bool adv_short_name_compare(const struct bt_data *data,
 			&bt_scan.scan_filters.short_name;
 	uint8_t counter = bt_scan.scan_filters.short_name.cnt;
 	uint8_t data_len = data->data_len;
+#if CONFIG_BT_SCAN_FILTER_HASH
+	/* The trie does not check the minimum length of the names,
+	 * the names that follow the first one are still compared.
+	 */
+	int first = name_trie_find(&short_name_trie, data->data, data_len);
+
+	if (first < 0) {
+		return false;
+	}
+#else
+	int first = 0;
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
 
 	/* Compare the name found with the name filters. */
-	for (size_t i = 0; i < counter; i++) {
+	for (size_t i = first; i < counter; i++) {
 		if (adv_short_name_cmp(data->data,
 				       data_len,
 				       name_filter->name[i].target_name,
@@ -695,6 +1387,7 @@ static bool adv_short_name_compare(const struct bt_data *data,
 			control->filter_status.short_name.name =
 				name_filter->name[i].target_name;
 			control->filter_status.short_name.len = data_len;
+			FILTER_HIT(short_name, i);
 
 			return true;
 		}
@@ -753,10 +1446,16 @@ static int scan_short_name_filter_add(const struct bt_scan_short_name *short_nam
 
 	/* Add name to the filter. */
 	short_name_filter->name[counter].min_len = short_name->min_len;
+	memset(short_name_filter->name[counter].target_name, 0,
+	       sizeof(short_name_filter->name[counter].target_name));
 	memcpy(short_name_filter->name[counter].target_name,
 	       short_name->name,
 	       name_len);
 
+#if CONFIG_BT_SCAN_FILTER_HASH
+	name_trie_add(&short_name_trie, short_name->name, name_len, counter);
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
+
 	bt_scan.scan_filters.short_name.cnt++;
 
 	LOG_DBG("Adding filter on %s name", short_name->name);
@@ -764,27 +1463,56 @@ static int scan_short_name_filter_add(const struct bt_scan_short_name *short_nam
 	return 0;
 }
 
-static bool find_uuid(const uint8_t *data,
-		      uint8_t data_len,
-		      uint8_t uuid_type,
-		      const struct bt_scan_uuid *target_uuid)
+static uint8_t uuid_type_len(uint8_t uuid_type)
 {
-	uint8_t uuid_len;
-
 	switch (uuid_type) {
 	case BT_UUID_TYPE_16:
-		uuid_len = sizeof(uint16_t);
-		break;
+		return sizeof(uint16_t);
 
 	case BT_UUID_TYPE_32:
-		uuid_len = sizeof(uint32_t);
-		break;
+		return sizeof(uint32_t);
 
 	case BT_UUID_TYPE_128:
-		uuid_len = BT_SCAN_UUID_128_SIZE * sizeof(uint8_t);
-		break;
+		return BT_SCAN_UUID_128_SIZE * sizeof(uint8_t);
 
 	default:
+		return 0;
+	}
+}
+
+#if CONFIG_BT_SCAN_FILTER_HASH
+/* Mark the UUID filters that match any of the advertised UUIDs. */
+static void adv_uuid_lookup(const struct bt_data *data, uint8_t uuid_type,
+			    bool *found)
+{
+	uint8_t uuid_len = uuid_type_len(uuid_type);
+	struct uuid_key key;
+	int idx;
+
+	memset(found, 0, bt_scan.scan_filters.uuid.cnt * sizeof(*found));
+
+	if (!uuid_len) {
+		return;
+	}
+
+	for (size_t i = 0; (i + uuid_len) <= data->data_len; i += uuid_len) {
+		uuid_key_from_data(&key, &data->data[i], uuid_len);
+
+		idx = uuid_table_find(&key);
+		if (idx >= 0) {
+			found[idx] = true;
+		}
+	}
+}
+#else
+static bool find_uuid(const uint8_t *data,
+		      uint8_t data_len,
+		      uint8_t uuid_type,
+		      const struct bt_scan_uuid *target_uuid)
+{
+	uint8_t uuid_len = uuid_type_len(uuid_type);
+
+	if (!uuid_len) {
 		return false;
 	}
 
@@ -802,6 +1530,7 @@ static bool find_uuid(const uint8_t *data,
 
 	return false;
 }
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
 
 static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
 			     struct bt_scan_control *control)
@@ -810,13 +1539,23 @@ static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
 			&bt_scan.scan_filters.uuid;
 	const bool all_filters_mode = bt_scan.scan_filters.all_mode;
 	const uint8_t counter = bt_scan.scan_filters.uuid.cnt;
-	uint8_t data_len = data->data_len;
 	uint8_t uuid_match_cnt = 0;
-
-	for (size_t i = 0; i < counter; i++) {
-
-		if (find_uuid(data->data, data_len, uuid_type,
-			      &uuid_filter->uuid[i])) {
+	size_t i;
+#if CONFIG_BT_SCAN_FILTER_HASH
+	bool found[MAX(CONFIG_BT_SCAN_UUID_CNT, 1)];
+
+	adv_uuid_lookup(data, uuid_type, found);
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
+
+	for (i = 0; i < counter; i++) {
+#if CONFIG_BT_SCAN_FILTER_HASH
+		bool match = found[i];
+#else
+		bool match = find_uuid(data->data, data->data_len, uuid_type,
+				       &uuid_filter->uuid[i]);
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
+
+		if (match) {
 			control->filter_status.uuid.uuid[uuid_match_cnt] =
 				uuid_filter->uuid[i].uuid;
 
@@ -841,6 +1580,16 @@ static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
 	 */
 	if ((all_filters_mode && (uuid_match_cnt == counter)) ||
 	    ((!all_filters_mode) && (uuid_match_cnt > 0))) {
+#if CONFIG_BT_SCAN_FILTER_STATS
+		if (all_filters_mode) {
+			for (size_t j = 0; j < counter; j++) {
+				FILTER_HIT(uuid, j);
+			}
+		} else {
+			FILTER_HIT(uuid, i);
+		}
+#endif /* CONFIG_BT_SCAN_FILTER_STATS */
+
 		return true;
 	}
 
@@ -917,6 +1666,10 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 		return -EINVAL;
 	}
 
+#if CONFIG_BT_SCAN_FILTER_HASH
+	uuid_table_add(uuid, counter);
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
+
 	bt_scan.scan_filters.uuid.cnt++;
 	LOG_DBG("Added filter on UUID type %x", uuid->type);
 
@@ -960,6 +1713,7 @@ static bool adv_appearance_compare(const struct bt_data *data,
 
 			control->filter_status.appearance.appearance =
 					&appearance_filter->appearance[i];
+			FILTER_HIT(appearance, i);
 
 			return true;
 		}
@@ -1047,6 +1801,7 @@ static bool adv_manufacturer_data_compare(const struct bt_data *data,
 				md_filter->manufacturer_data[i].data;
 			control->filter_status.manufacturer_data.len =
 				md_filter->manufacturer_data[i].data_len;
+			FILTER_HIT(manufacturer_data, i);
 
 			return true;
 		}
@@ -1211,6 +1966,11 @@ int bt_scan_filter_add(enum bt_scan_filter_type type,
 
 	k_mutex_unlock(&scan_mutex);
 
+#if CONFIG_BT_SCAN_DEDUP
+	/* The devices are checked again against the changed filters. */
+	bt_scan_dedup_clear();
+#endif /* CONFIG_BT_SCAN_DEDUP */
+
 	return err;
 }
 
@@ -1242,7 +2002,19 @@ void bt_scan_filter_remove_all(void)
 		&bt_scan.scan_filters.manufacturer_data;
 	manufacturer_data_filter->cnt = 0;
 
+#if CONFIG_BT_SCAN_FILTER_HASH
+	filter_tables_clear();
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
+
+#if CONFIG_BT_SCAN_FILTER_STATS
+	memset(&bt_scan.hits, 0, sizeof(bt_scan.hits));
+#endif /* CONFIG_BT_SCAN_FILTER_STATS */
+
 	k_mutex_unlock(&scan_mutex);
+
+#if CONFIG_BT_SCAN_DEDUP
+	bt_scan_dedup_clear();
+#endif /* CONFIG_BT_SCAN_DEDUP */
 }
 
 void bt_scan_filter_disable(void)
@@ -1254,6 +2026,10 @@ void bt_scan_filter_disable(void)
 	bt_scan.scan_filters.uuid.enabled = false;
 	bt_scan.scan_filters.appearance.enabled = false;
 	bt_scan.scan_filters.manufacturer_data.enabled = false;
+
+#if CONFIG_BT_SCAN_DEDUP
+	bt_scan_dedup_clear();
+#endif /* CONFIG_BT_SCAN_DEDUP */
 }
 
 int bt_scan_filter_enable(uint8_t mode, bool match_all)
@@ -1325,6 +2101,75 @@ int bt_scan_filter_status_get(struct bt_filter_status *status)
 	return 0;
 }
 
+#if CONFIG_BT_SCAN_FILTER_STATS
+int bt_scan_filter_hits_get(enum bt_scan_filter_type type, uint8_t idx,
+			    uint32_t *hits)
+{
+	const struct bt_scan_filters *filters = &bt_scan.scan_filters;
+	const uint32_t *counters;
+	uint8_t cnt;
+	int err = 0;
+
+	if (!hits) {
+		return -EINVAL;
+	}
+
+	switch (type) {
+	case BT_SCAN_FILTER_TYPE_NAME:
+		counters = bt_scan.hits.name;
+		cnt = filters->name.cnt;
+		break;
+
+	case BT_SCAN_FILTER_TYPE_SHORT_NAME:
+		counters = bt_scan.hits.short_name;
+		cnt = filters->short_name.cnt;
+		break;
+
+	case BT_SCAN_FILTER_TYPE_ADDR:
+		counters = bt_scan.hits.addr;
+		cnt = filters->addr.cnt;
+		break;
+
+	case BT_SCAN_FILTER_TYPE_UUID:
+		counters = bt_scan.hits.uuid;
+		cnt = filters->uuid.cnt;
+		break;
+
+	case BT_SCAN_FILTER_TYPE_APPEARANCE:
+		counters = bt_scan.hits.appearance;
+		cnt = filters->appearance.cnt;
+		break;
+
+	case BT_SCAN_FILTER_TYPE_MANUFACTURER_DATA:
+		counters = bt_scan.hits.manufacturer_data;
+		cnt = filters->manufacturer_data.cnt;
+		break;
+
+	default:
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&scan_mutex, K_FOREVER);
+
+	if (idx < cnt) {
+		*hits = counters[idx];
+	} else {
+		err = -EINVAL;
+	}
+
+	k_mutex_unlock(&scan_mutex);
+
+	return err;
+}
+
+void bt_scan_filter_hits_reset(void)
+{
+	k_mutex_lock(&scan_mutex, K_FOREVER);
+	memset(&bt_scan.hits, 0, sizeof(bt_scan.hits));
+	k_mutex_unlock(&scan_mutex);
+}
+#endif /* CONFIG_BT_SCAN_FILTER_STATS */
+
 int bt_scan_stop(void)
 {
 	return bt_le_scan_stop();
@@ -1338,6 +2183,18 @@ void bt_scan_init(const struct bt_scan_init_param *init)
 	/* Disable all scanning filters. */
 	memset(&bt_scan.scan_filters, 0, sizeof(bt_scan.scan_filters));
 
+#if CONFIG_BT_SCAN_FILTER_HASH
+	filter_tables_clear();
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
+
+#if CONFIG_BT_SCAN_FILTER_STATS
+	memset(&bt_scan.hits, 0, sizeof(bt_scan.hits));
+#endif /* CONFIG_BT_SCAN_FILTER_STATS */
+
+#if CONFIG_BT_SCAN_DEDUP
+	bt_scan_dedup_clear();
+#endif /* CONFIG_BT_SCAN_DEDUP */
+
 	/* If the pointer to the initialization structure exist,
 	 * use it to scan the configuration.
 	 */
@@ -1458,13 +2315,27 @@ static bool adv_data_found(struct bt_data *data, void *user_data)
 	return true;
 }
 
-static void filter_state_check(struct bt_scan_control *control,
-			       const bt_addr_le_t *addr)
+static bool adv_data_check_needed(const struct bt_scan_control *control)
 {
-	if (!scan_device_filter_check(addr)) {
-		return;
+	uint8_t adv_data_filter_cnt = control->filter_cnt;
+
+	if (is_addr_filter_enabled()) {
+		/* In the multifilter mode, a device that does not match
+		 * the address filter cannot match the other filters.
+		 */
+		if (control->all_mode && !control->filter_status.addr.match) {
+			return false;
+		}
+
+		adv_data_filter_cnt--;
 	}
 
+	return adv_data_filter_cnt > 0;
+}
+
+static bool filter_state_check(struct bt_scan_control *control,
+			       const bt_addr_le_t *addr)
+{
 	if (control->all_mode &&
 	    (control->filter_match_cnt == control->filter_cnt)) {
 		notify_filter_matched(&control->device_info,
@@ -1473,6 +2344,8 @@ static void filter_state_check(struct bt_scan_control *control,
 #if CONFIG_BT_CENTRAL
 		scan_connect_with_target(control, addr);
 #endif /* CONFIG_BT_CENTRAL */
+
+		return true;
 	}
 
 	/* In the normal filter mode, only one filter match is
@@ -1485,10 +2358,13 @@ static void filter_state_check(struct bt_scan_control *control,
 #if CONFIG_BT_CENTRAL
 		scan_connect_with_target(control, addr);
 #endif /* CONFIG_BT_CENTRAL */
-	} else {
-		notify_filter_no_match(&control->device_info,
-				       control->connectable);
+
+		return true;
 	}
+
+	notify_filter_no_match(&control->device_info, control->connectable);
+
+	return false;
 }
 
 static void scan_recv(const struct bt_le_scan_recv_info *info,
@@ -1496,6 +2372,22 @@ static void scan_recv(const struct bt_le_scan_recv_info *info,
 {
 	struct bt_scan_control scan_control;
 	struct net_buf_simple_state state;
+#if CONFIG_BT_SCAN_DEDUP
+	bool changed;
+#endif /* CONFIG_BT_SCAN_DEDUP */
+
+	/* The blocklist and the connection attempts filter reject a device
+	 * without any event, so they are checked before the other filters.
+	 */
+	if (!scan_device_filter_check(info->addr)) {
+		return;
+	}
+
+#if CONFIG_BT_SCAN_DEDUP
+	if (!dedup_check(info->addr, ad, &changed)) {
+		return;
+	}
+#endif /* CONFIG_BT_SCAN_DEDUP */
 
 	memset(&scan_control, 0, sizeof(scan_control));
 
@@ -1513,9 +2405,11 @@ static void scan_recv(const struct bt_le_scan_recv_info *info,
 	/* Save advertising buffer state to transfer it
 	 * data to application if futher processing is needed.
 	 */
-	net_buf_simple_save(ad, &state);
-	bt_data_parse(ad, adv_data_found, (void *)&scan_control);
-	net_buf_simple_restore(ad, &state);
+	if (adv_data_check_needed(&scan_control)) {
+		net_buf_simple_save(ad, &state);
+		bt_data_parse(ad, adv_data_found, (void *)&scan_control);
+		net_buf_simple_restore(ad, &state);
+	}
 
 	scan_control.device_info.recv_info = info;
 	scan_control.device_info.conn_param = &bt_scan.conn_param;
@@ -1525,7 +2419,15 @@ static void scan_recv(const struct bt_le_scan_recv_info *info,
 	 * the number of the filters matched to generate the notification.
 	 * If the event handler is not NULL, notify the main application.
 	 */
+#if CONFIG_BT_SCAN_CHANGED_DEVICES
+	bool match = filter_state_check(&scan_control, info->addr);
+
+	if (changed) {
+		changed_device_add(info, match);
+	}
+#else
 	filter_state_check(&scan_control, info->addr);
+#endif /* CONFIG_BT_SCAN_CHANGED_DEVICES */
 }
 
 static struct bt_le_scan_cb scan_cb = {
@@ -1589,13 +2491,10 @@ int bt_scan_blocklist_device_add(const bt_addr_le_t *addr)
 	k_mutex_lock(&scan_mutex, K_FOREVER);
 
 	/* Check if the device is already on the blocklist. */
-	for (size_t i = 0; i < ARRAY_SIZE(bt_scan.blocklist.addr); i++) {
-		if (bt_addr_le_cmp(&bt_scan.blocklist.addr[i], addr) == 0) {
-			LOG_DBG("Device %s is already on the blocklist",
-				addr_str);
+	if (blocklist_find(addr) >= 0) {
+		LOG_DBG("Device %s is already on the blocklist", addr_str);
 
-			goto out;
-		}
+		goto out;
 	}
 
 	if (bt_scan.blocklist.count >= ARRAY_SIZE(bt_scan.blocklist.addr)) {
@@ -1604,6 +2503,9 @@ int bt_scan_blocklist_device_add(const bt_addr_le_t *addr)
 	} else {
 		bt_addr_le_copy(&bt_scan.blocklist.addr[bt_scan.blocklist.count],
 				addr);
+#if CONFIG_BT_SCAN_FILTER_HASH
+		addr_table_add(&blocklist_table, bt_scan.blocklist.count);
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
 		bt_scan.blocklist.count++;
 		LOG_INF("Device %s added to the scanning blocklist", addr_str);
 	}
@@ -1618,6 +2520,9 @@ void bt_scan_blocklist_clear(void)
 {
 	k_mutex_lock(&scan_mutex, K_FOREVER);
 	memset(&bt_scan.blocklist, 0, sizeof(bt_scan.blocklist));
+#if CONFIG_BT_SCAN_FILTER_HASH
+	addr_table_clear(&blocklist_table);
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
 	k_mutex_unlock(&scan_mutex);
 }
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
@@ -1627,6 +2532,9 @@ void bt_scan_conn_attempts_filter_clear(void)
 {
 	k_mutex_lock(&scan_mutex, K_FOREVER);
 	memset(&bt_scan.attempts_filter, 0, sizeof(bt_scan.attempts_filter));
+#if CONFIG_BT_SCAN_FILTER_HASH
+	addr_table_clear(&attempts_table);
+#endif /* CONFIG_BT_SCAN_FILTER_HASH */
 	k_mutex_unlock(&scan_mutex);
 }
 #endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
@@ -85,6 +85,8 @@ static struct emds_snapshot_candidate allocated_snapshot;
 static sys_slist_t emds_dynamic_entries;
 static struct emds_partition partition[PARTITIONS_NUM_MAX];
 static emds_store_cb_t app_store_cb;
+/* Whether the allocated snapshot can reference the data of the previous snapshots */
+static bool incremental_store;
 
 static void emds_print_init_info(void)
 {
@@ -185,11 +187,72 @@ int emds_entry_add(struct emds_dynamic_entry *entry)
 		}
 	}
 
+	if (entry->entry.len > EMDS_ENTRY_LEN_MAX) {
+		return -EINVAL;
+	}
+
+	memset(&entry->state, 0, sizeof(entry->state));
+	entry->entry.state = &entry->state;
 	sys_slist_append(&emds_dynamic_entries, &entry->node);
 
 	return 0;
 }
 
+void emds_entry_dirty_set(const struct emds_entry *entry)
+{
+	if (entry->state) {
+		entry->state->dirty = true;
+	}
+}
+
+static void emds_entries_state_reset(void)
+{
+	STRUCT_SECTION_FOREACH(emds_entry, ch) {
+		memset(ch->state, 0, sizeof(*ch->state));
+	}
+
+	struct emds_dynamic_entry *ch;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
+		memset(&ch->state, 0, sizeof(ch->state));
+	}
+}
+
+/* Check if the entry can be stored as a reference to its data in the previous snapshots */
+static bool emds_entry_ref_allowed(const struct emds_entry *entry)
+{
+	const struct emds_entry_state *state = entry->state;
+
+	return incremental_store && state->valid && !state->dirty && state->len == entry->len &&
+	       entry->len + sizeof(struct emds_data_entry) > sizeof(struct emds_data_ref);
+}
+
+static size_t emds_entry_stored_size(const struct emds_entry *entry)
+{
+	if (emds_entry_ref_allowed(entry)) {
+		return sizeof(struct emds_data_ref);
+	}
+
+	return entry->len + sizeof(struct emds_data_entry);
+}
+
+static size_t emds_incremental_size(void)
+{
+	size_t size = 0;
+
+	STRUCT_SECTION_FOREACH(emds_entry, ch) {
+		size += emds_entry_stored_size(ch);
+	}
+
+	struct emds_dynamic_entry *ch;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
+		size += emds_entry_stored_size(&ch->entry);
+	}
+
+	return size;
+}
+
 static int emds_entries_size(size_t *size)
 {
 	int entries = 0;
@@ -239,6 +302,10 @@ int emds_store_time_get(uint32_t *store_time)
 		return rc;
 	}
 
+	if (incremental_store) {
+		store_size = emds_incremental_size();
+	}
+
 	words = DIV_ROUND_UP(store_size, 4);
 	words += DIV_ROUND_UP(sizeof(struct emds_snapshot_metadata), 4);
 	chunk_handling = DIV_ROUND_UP(store_size, CHUNK_SIZE);
@@ -249,60 +316,143 @@ int emds_store_time_get(uint32_t *store_time)
 	return 0;
 }
 
-static uint8_t *emds_entry_memory_get(struct emds_data_entry *entry)
+static struct emds_entry *emds_entry_get(uint16_t id)
 {
 	STRUCT_SECTION_FOREACH(emds_entry, ch) {
-		if (ch->id == entry->id) {
-			entry->length = MIN(ch->len, entry->length);
-			return ch->data;
+		if (ch->id == id) {
+			return ch;
 		}
 	}
 
 	struct emds_dynamic_entry *ch;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
-		if (ch->entry.id == entry->id) {
-			entry->length = MIN(ch->entry.len, entry->length);
-			return ch->entry.data;
+		if (ch->entry.id == id) {
+			return &ch->entry;
 		}
 	}
 
-	LOG_WRN("Entry with ID %u not found", entry->id);
+	LOG_WRN("Entry with ID %u not found", id);
 	return NULL;
 }
 
+static int emds_data_crc_get(const struct flash_area *fa, off_t data_off, size_t len,
+			     uint32_t *crc)
+{
+	uint8_t data_chunk[CHUNK_SIZE];
+	size_t chunk_size;
+	int rc;
+
+	*crc = 0;
+
+	while (len > 0) {
+		chunk_size = MIN(len, sizeof(data_chunk));
+		rc = flash_area_read(fa, data_off, data_chunk, chunk_size);
+		if (rc) {
+			return rc;
+		}
+
+		*crc = crc32_k_4_2_update(*crc, data_chunk, chunk_size);
+		data_off += chunk_size;
+		len -= chunk_size;
+	}
+
+	return 0;
+}
+
+/* Read the entry data, and remember where it is stored for the incremental snapshots. The data
+ * of a reference is in one of the previous snapshots, which are not covered by the CRC of the
+ * loaded snapshot, so it is checked against the CRC stored in the reference before the entry is
+ * overwritten. An entry with corrupted data is skipped, and it is stored in full by the next
+ * snapshot.
+ */
+static int emds_entry_read(const struct flash_area *fa, const struct emds_data_ref *ref,
+			   bool is_ref)
+{
+	struct emds_entry *entry;
+	size_t len;
+	uint32_t crc;
+	int rc;
+
+	entry = emds_entry_get(ref->id);
+	if (!entry) {
+		return 0;
+	}
+
+	len = MIN(entry->len, ref->length);
+
+	if (is_ref && len == ref->length) {
+		rc = emds_data_crc_get(fa, ref->data_off, len, &crc);
+		if (rc) {
+			LOG_ERR("Failed to read data for entry ID %u: %d", ref->id, rc);
+			return -EIO;
+		}
+
+		if (crc != ref->data_crc) {
+			LOG_ERR("Referenced data for entry ID %u is corrupted", ref->id);
+			return 0;
+		}
+	}
+
+	rc = flash_area_read(fa, ref->data_off, entry->data, len);
+	if (rc) {
+		LOG_ERR("Failed to read data for entry ID %u: %d", ref->id, rc);
+		return -EIO;
+	}
+
+	if (len != ref->length || (!is_ref && !IS_ENABLED(CONFIG_EMDS_INCREMENTAL))) {
+		return 0;
+	}
+
+	entry->state->data_off = ref->data_off;
+	entry->state->data_crc = is_ref ? ref->data_crc : crc32_k_4_2_update(0, entry->data, len);
+	entry->state->len = len;
+	entry->state->valid = true;
+
+	return 0;
+}
+
 static int emds_read_data(const struct flash_area *fa, struct emds_snapshot_metadata *metadata)
 {
-	struct emds_data_entry entry;
+	struct emds_data_ref ref;
 	off_t data_off = metadata->data_instance_off;
 	int32_t data_len = metadata->data_instance_len;
-	int32_t flash_entry_data_len;
-	uint8_t *data_buf;
+	bool is_ref;
 	int rc;
 
 	while (data_len > 0) {
-		rc = flash_area_read(fa, data_off, &entry, sizeof(entry));
+		rc = flash_area_read(fa, data_off, &ref, sizeof(struct emds_data_entry));
 		if (rc) {
 			LOG_ERR("Failed to read data entry: %d", rc);
 			return -EIO;
 		}
 
-		data_off += sizeof(entry);
-		data_len -= sizeof(entry);
-		flash_entry_data_len = entry.length;
-
-		data_buf = emds_entry_memory_get(&entry);
+		data_off += sizeof(struct emds_data_entry);
+		data_len -= sizeof(struct emds_data_entry);
+		is_ref = ref.length & EMDS_DATA_ENTRY_REF;
 
-		if (data_buf) {
-			rc = flash_area_read(fa, data_off, data_buf, entry.length);
+		if (is_ref) {
+			rc = flash_area_read(fa, data_off,
+					     (uint8_t *)&ref + sizeof(struct emds_data_entry),
+					     sizeof(ref) - sizeof(struct emds_data_entry));
 			if (rc) {
-				LOG_ERR("Failed to read data for entry ID %u: %d", entry.id, rc);
+				LOG_ERR("Failed to read data reference: %d", rc);
 				return -EIO;
 			}
+
+			ref.length &= ~EMDS_DATA_ENTRY_REF;
+			data_off += sizeof(ref) - sizeof(struct emds_data_entry);
+			data_len -= sizeof(ref) - sizeof(struct emds_data_entry);
+		} else {
+			ref.data_off = data_off;
+			data_off += ref.length;
+			data_len -= ref.length;
 		}
 
-		data_off += flash_entry_data_len;
-		data_len -= flash_entry_data_len;
+		rc = emds_entry_read(fa, &ref, is_ref);
+		if (rc) {
+			return rc;
+		}
 	}
 
 	return 0;
@@ -311,11 +461,15 @@ static int emds_read_data(const struct flash_area *fa, struct emds_snapshot_meta
 int emds_load(void)
 {
 	struct emds_snapshot_candidate candidate = {0};
+	int rc;
 
 	if (emds_state == EMDS_STATE_NOT_INITIALIZED) {
 		return -ECANCELED;
 	}
 
+	incremental_store = false;
+	emds_entries_state_reset();
+
 	for (int i = 0; i < PARTITIONS_NUM_MAX; i++) {
 		if (emds_flash_scan_partition(&partition[i], &candidate)) {
 			LOG_ERR("Failed to scan partition: %d", i);
@@ -338,8 +492,13 @@ int emds_load(void)
 	LOG_DBG("Found freshest snapshot in partition %d with fresh_cnt %u",
 		freshest_snapshot.partition_index, freshest_snapshot.metadata.fresh_cnt);
 
-	return emds_read_data(partition[freshest_snapshot.partition_index].fa,
-			      &freshest_snapshot.metadata);
+	rc = emds_read_data(partition[freshest_snapshot.partition_index].fa,
+			    &freshest_snapshot.metadata);
+	if (rc) {
+		emds_entries_state_reset();
+	}
+
+	return rc;
 }
 
 int emds_prepare(void)
@@ -358,8 +517,12 @@ int emds_prepare(void)
 	(void)emds_store_size_get(&data_size);
 
 	allocated_snapshot.metadata.fresh_cnt = freshest_snapshot.metadata.fresh_cnt + 1;
+	incremental_store = false;
 
-	/* First try to allocate snapshot in the same partition where freshest snapshot exists */
+	/* First try to allocate snapshot in the same partition where freshest snapshot exists.
+	 * The space for all data is allocated, as any entry can be modified before the store.
+	 * Only the snapshots in this partition can reference the data of the freshest snapshot.
+	 */
 	if (freshest_snapshot.metadata.fresh_cnt > 0) {
 		freshest_partition_idx = freshest_snapshot.partition_index;
 		rc = emds_flash_allocate_snapshot(&partition[freshest_partition_idx],
@@ -367,6 +530,7 @@ int emds_prepare(void)
 						  data_size);
 		if (rc == 0) {
 			allocated_snapshot.partition_index = freshest_partition_idx;
+			incremental_store = IS_ENABLED(CONFIG_EMDS_INCREMENTAL);
 			emds_state = EMDS_STATE_READY;
 			return 0;
 		}
@@ -438,6 +602,20 @@ static void entry_to_stream(const struct emds_partition *partition, off_t *data_
 		.length = entry->len,
 	};
 
+	if (emds_entry_ref_allowed(entry)) {
+		struct emds_data_ref data_ref = {
+			.id = entry->id,
+			.length = entry->len | EMDS_DATA_ENTRY_REF,
+			.data_off = entry->state->data_off,
+			.data_crc = entry->state->data_crc,
+		};
+
+		LOG_DBG("Storing reference to entry ID %u, length %u", entry->id, entry->len);
+		data_to_stream(partition, data_off, (uint8_t *)&data_ref, out, wp,
+			       sizeof(data_ref));
+		return;
+	}
+
 	LOG_DBG("Storing entry ID %u, length %u", entry->id, entry->len);
 	data_to_stream(partition, data_off, (uint8_t *)&data_entry, out, wp, sizeof(data_entry));
 	data_to_stream(partition, data_off, entry->data, out, wp, entry->len);
@@ -462,6 +640,7 @@ int emds_store(void)
 	size_t wp = 0;
 	off_t data_off = allocated_snapshot.metadata.data_instance_off;
 	int idx = allocated_snapshot.partition_index;
+	bool metadata_first;
 	int rc = 0;
 
 	if (emds_state != EMDS_STATE_READY) {
@@ -476,7 +655,13 @@ int emds_store(void)
 		goto unlock_and_exit;
 	}
 
-	if (flash_params_get_erase_cap(partition[idx].fp) & FLASH_ERASE_C_EXPLICIT) {
+	/* The length of an incremental snapshot is only known once it is written, so its metadata
+	 * is written last.
+	 */
+	metadata_first = !incremental_store &&
+			 (flash_params_get_erase_cap(partition[idx].fp) & FLASH_ERASE_C_EXPLICIT);
+
+	if (metadata_first) {
 		LOG_DBG("Writing metadata on offset: 0x%4lx, address : 0x%4lx",
 			 allocated_snapshot.metadata_off,
 			 allocated_snapshot.metadata_off + partition[idx].fa->fa_off);
@@ -497,7 +682,15 @@ int emds_store(void)
 
 	stream_fflush(&partition[idx], &data_off, data_chunk, &wp);
 
-	if (flash_params_get_erase_cap(partition[idx].fp) & FLASH_ERASE_C_EXPLICIT) {
+	if (incremental_store) {
+		allocated_snapshot.metadata.data_instance_len =
+			data_off - allocated_snapshot.metadata.data_instance_off;
+		allocated_snapshot.metadata.metadata_crc = crc32_k_4_2_update(
+			0, (const unsigned char *)&allocated_snapshot.metadata,
+			offsetof(struct emds_snapshot_metadata, metadata_crc));
+	}
+
+	if (metadata_first) {
 		LOG_DBG("Writing snapshot crc on offset: 0x%4lx, crc : 0x%4x",
 			 allocated_snapshot.metadata_off +
 					      offsetof(struct emds_snapshot_metadata, snapshot_crc),
@@ -539,6 +732,8 @@ int emds_clear(void)
 	}
 
 	emds_state = EMDS_STATE_INITIALIZED;
+	incremental_store = false;
+	emds_entries_state_reset();
 	memset(&freshest_snapshot, 0, sizeof(freshest_snapshot));
 	memset(&allocated_snapshot, 0, sizeof(allocated_snapshot));
 	for (int i = 0; i < PARTITIONS_NUM_MAX; i++) {
@@ -15,7 +15,7 @@ LOG_MODULE_REGISTER(emds_flash, CONFIG_EMDS_LOG_LEVEL);
 #if defined CONFIG_SOC_FLASH_NRF_RRAM
 #include <hal/nrf_rramc.h>
 #include <zephyr/sys/barrier.h>
-#else
+#elif defined CONFIG_SOC_FLASH_NRF
 #include <nrfx_nvmc.h>
 #endif
 
@@ -297,6 +297,7 @@ int emds_flash_allocate_snapshot(const struct emds_partition *partition,
 	return 0;
 }
 
+#if defined CONFIG_SOC_FLASH_NRF_RRAM || defined CONFIG_SOC_FLASH_NRF
 static void nvmc_wait_ready(void)
 {
 #if defined CONFIG_SOC_FLASH_NRF_RRAM
@@ -363,6 +364,21 @@ void emds_flash_write_data(const struct emds_partition *partition, off_t data_of
 #endif
 	nvmc_wait_ready();
 }
+#else
+/* Flash devices without direct access, like the flash simulator, are written through the
+ * flash driver. The store time is then not deterministic.
+ */
+void emds_flash_write_data(const struct emds_partition *partition, off_t data_off, void *data_chunk,
+			   size_t data_size)
+{
+	int rc;
+
+	rc = flash_area_write(partition->fa, data_off, data_chunk, data_size);
+	if (rc) {
+		LOG_ERR("Failed to write data at offset 0x%04lx: %d", data_off, rc);
+	}
+}
+#endif
 
 int emds_flash_erase_partition(const struct emds_partition *partition)
 {
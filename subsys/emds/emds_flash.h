@@ -55,6 +55,28 @@ struct emds_data_entry {
 	uint8_t data[];
 } __packed;
 
+/** Flag in the length of the data entry marking it as a reference. */
+#define EMDS_DATA_ENTRY_REF BIT(15)
+
+/**
+ * @brief Emergency data storage data reference structure
+ *
+ * Stored in an incremental snapshot instead of the data entry for the entries that have not
+ * been modified since the previous snapshot. The reference points to the data in one of the
+ * previous snapshots in the same partition.
+ *
+ * @param id Unique data identifier.
+ * @param length Data length, with the EMDS_DATA_ENTRY_REF flag set.
+ * @param data_off Offset of the data in the partition.
+ * @param data_crc CRC of the data.
+ */
+struct emds_data_ref {
+	uint16_t id;
+	uint16_t length;
+	uint32_t data_off;
+	uint32_t data_crc;
+} __packed;
+
 /**
  * @brief Emergency data storage metadata structure
  *
@@ -12,6 +12,7 @@
 
 #include "log_rpc_group.h"
 #include "log_backend_rpc_history.h"
+#include "log_rpc_dict.h"
 
 #include <logging/log_rpc.h>
 #include <nrf_rpc/nrf_rpc_serialize.h>
@@ -21,6 +22,8 @@
 #include <zephyr/debug/coredump.h>
 #include <zephyr/kernel.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/cbprintf.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/logging/log_backend.h>
 #include <zephyr/logging/log_backend_std.h>
@@ -92,8 +95,12 @@ static struct coredump_mem_region_node dump_region = {
 static const uint8_t CRASH_INFO_MAGIC[] = { 'D', 'U', 'M', 'P', 'I', 'N', 'F', 'O' };
 #endif
 
+#if defined(CONFIG_LOG_BACKEND_RPC_STREAM_FORMAT_TEXT) || defined(CONFIG_LOG_BACKEND_RPC_HISTORY)
+#define LOG_BACKEND_RPC_FORMAT_TEXT 1
+
 static const uint32_t common_output_flags =
 	LOG_OUTPUT_FLAG_TIMESTAMP | LOG_OUTPUT_FLAG_FORMAT_TIMESTAMP;
+#endif
 
 static bool panic_mode;
 static uint32_t log_format = LOG_OUTPUT_TEXT;
@@ -421,6 +428,8 @@ NRF_RPC_CBOR_CMD_DECODER(log_rpc_group, log_rpc_crash_info, LOG_RPC_CMD_GET_CRAS
 
 #endif /* CONFIG_LOG_BACKEND_RPC_CRASH_LOG */
 
+#ifdef LOG_BACKEND_RPC_FORMAT_TEXT
+
 static void format_message(struct log_msg *msg, uint32_t flags, log_output_func_t output_func,
 			   void *output_ctx)
 {
@@ -475,6 +484,10 @@ static size_t format_message_to_buf(struct log_msg *msg, uint32_t flags, uint8_t
 	return output_ctx.total_len;
 }
 
+#endif /* LOG_BACKEND_RPC_FORMAT_TEXT */
+
+#ifdef CONFIG_LOG_BACKEND_RPC_STREAM_FORMAT_TEXT
+
 static void stream_message(struct log_msg *msg)
 {
 	const uint32_t flags = common_output_flags | LOG_OUTPUT_FLAG_CRLF_NONE;
@@ -500,58 +513,201 @@ static void stream_message(struct log_msg *msg)
 	nrf_rpc_cbor_evt_no_err(&log_rpc_group, LOG_RPC_EVT_MSG, &ctx);
 }
 
-static const char *log_msg_source_name_get(struct log_msg *msg)
+#endif /* CONFIG_LOG_BACKEND_RPC_STREAM_FORMAT_TEXT */
+
+static int32_t log_msg_source_id_get(struct log_msg *msg)
 {
 	void *source;
-	uint32_t source_id;
 
 	if (log_msg_get_domain(msg) != Z_LOG_LOCAL_DOMAIN_ID) {
-		return NULL;
+		return -1;
 	}
 
 	source = (void *)log_msg_get_source(msg);
 
 	if (source == NULL) {
-		return NULL;
+		return -1;
+	}
+
+	return IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ? log_dynamic_source_id(source)
+							: log_const_source_id(source);
+}
+
+#ifdef CONFIG_LOG_BACKEND_RPC_STREAM_FORMAT_DICTIONARY
+
+static K_MUTEX_DEFINE(batch_mtx);
+static uint8_t batch_buf[CONFIG_LOG_BACKEND_RPC_BATCH_SIZE];
+static struct nrf_rpc_cbor_ctx batch_ctx;
+static void batch_flush_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(batch_flush_work, batch_flush_work_handler);
+
+static void record_get(struct log_msg *msg, struct log_rpc_dict_record *record)
+{
+	record->level = (enum log_rpc_level)log_msg_get_level(msg);
+	record->source_id = log_msg_source_id_get(msg);
+	record->timestamp_us = log_output_timestamp_to_us(log_msg_get_timestamp(msg));
+	record->package = log_msg_get_package(msg, &record->package_size);
+	record->data = log_msg_get_data(msg, &record->data_size);
+}
+
+static void batch_reset(void)
+{
+	zcbor_new_encode_state(batch_ctx.zs, ARRAY_SIZE(batch_ctx.zs), batch_buf,
+			       sizeof(batch_buf), 0);
+}
+
+static size_t batch_free_space_get(void)
+{
+	return batch_ctx.zs[0].payload_end - batch_ctx.zs[0].payload_mut;
+}
+
+/* Must be called with batch_mtx held, or in the panic mode. */
+static void batch_flush(void)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+	size_t length = batch_ctx.zs[0].payload_mut - batch_buf;
+
+	if (length == 0) {
+		return;
+	}
+
+	NRF_RPC_CBOR_ALLOC(&log_rpc_group, ctx, length);
+	memcpy(ctx.zs[0].payload_mut, batch_buf, length);
+	ctx.zs[0].payload_mut += length;
+	nrf_rpc_cbor_evt_no_err(&log_rpc_group, LOG_RPC_EVT_MSG_BATCH, &ctx);
+
+	batch_reset();
+}
+
+static void batch_flush_work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	/* Nothing is sent over nRF RPC after the panic, so the collected messages are lost. */
+	if (panic_mode) {
+		return;
+	}
+
+	k_mutex_lock(&batch_mtx, K_FOREVER);
+	batch_flush();
+	k_mutex_unlock(&batch_mtx);
+}
+
+static void stream_message(struct log_msg *msg)
+{
+	struct log_rpc_dict_record record;
+	size_t record_size;
+
+	record_get(msg, &record);
+	record_size = log_rpc_dict_record_size(&record);
+
+	k_mutex_lock(&batch_mtx, K_FOREVER);
+
+	if (record_size > batch_free_space_get()) {
+		batch_flush();
+	}
+
+	if (record_size > batch_free_space_get()) {
+		/* The message does not fit in the batch buffer at all, send it on its own. */
+		struct nrf_rpc_cbor_ctx ctx;
+
+		NRF_RPC_CBOR_ALLOC(&log_rpc_group, ctx, record_size);
+		log_rpc_dict_record_encode(&ctx, &record);
+		nrf_rpc_cbor_evt_no_err(&log_rpc_group, LOG_RPC_EVT_MSG_BATCH, &ctx);
+	} else {
+		log_rpc_dict_record_encode(&batch_ctx, &record);
+		k_work_schedule(&batch_flush_work, K_MSEC(CONFIG_LOG_BACKEND_RPC_BATCH_FLUSH_INTERVAL_MS));
 	}
 
-	source_id = IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ? log_dynamic_source_id(source)
-							     : log_const_source_id(source);
+	k_mutex_unlock(&batch_mtx);
+}
+
+static void log_rpc_get_source_name_handler(const struct nrf_rpc_group *group,
+					    struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
+{
+	struct nrf_rpc_cbor_ctx rsp_ctx;
+	uint32_t source_id;
+	const char *name = NULL;
+
+	source_id = nrf_rpc_decode_uint(ctx);
 
-	return TYPE_SECTION_START(log_const)[source_id].name;
+	if (!nrf_rpc_decoding_done_and_check(group, ctx)) {
+		nrf_rpc_err(-EBADMSG, NRF_RPC_ERR_SRC_RECV, group, LOG_RPC_CMD_GET_SOURCE_NAME,
+			    NRF_RPC_PACKET_TYPE_CMD);
+		return;
+	}
+
+	if (source_id < log_src_cnt_get(Z_LOG_LOCAL_DOMAIN_ID)) {
+		name = log_source_name_get(Z_LOG_LOCAL_DOMAIN_ID, source_id);
+	}
+
+	NRF_RPC_CBOR_ALLOC(group, rsp_ctx, 3 + (name ? strlen(name) : 0));
+	nrf_rpc_encode_str(&rsp_ctx, name, -1);
+	nrf_rpc_cbor_rsp_no_err(group, &rsp_ctx);
 }
 
+NRF_RPC_CBOR_CMD_DECODER(log_rpc_group, log_rpc_get_source_name_handler,
+			 LOG_RPC_CMD_GET_SOURCE_NAME, log_rpc_get_source_name_handler, NULL);
+
+#endif /* CONFIG_LOG_BACKEND_RPC_STREAM_FORMAT_DICTIONARY */
+
+/*
+ * Drop messages coming from nRF RPC to avoid the log feedback loop:
+ * 1. log added
+ * 2. log sent over nRF RPC
+ * 3. more logs generated by nRF RPC
+ * 4. more logs sent over nRF RPC
+ * ...
+ */
+static const char *const filtered_out_sources[] = {
+	"nrf_rpc",
+	"NRF_RPC",
+};
+
+/* Filtered out local log sources, determined once at initialization. */
+static ATOMIC_DEFINE(filtered_out_source_ids, CONFIG_LOG_BACKEND_RPC_FILTER_MAX_SOURCES);
+
 static bool starts_with(const char *str, const char *prefix)
 {
 	return strncmp(str, prefix, strlen(prefix)) == 0;
 }
 
-static bool should_filter_out(struct log_msg *msg)
+static bool source_name_filtered_out(const char *source_name)
 {
-	/*
-	 * Drop messages coming from nRF RPC to avoid the log feedback loop:
-	 * 1. log added
-	 * 2. log sent over nRF RPC
-	 * 3. more logs generated by nRF RPC
-	 * 4. more logs sent over nRF RPC
-	 * ...
-	 */
-	static const char *const filtered_out_sources[] = {
-		"nrf_rpc",
-		"NRF_RPC",
-	};
+	for (size_t i = 0; i < ARRAY_SIZE(filtered_out_sources); i++) {
+		if (starts_with(source_name, filtered_out_sources[i])) {
+			return true;
+		}
+	}
 
-	const char *source_name = log_msg_source_name_get(msg);
+	return false;
+}
 
-	if (source_name != NULL) {
-		for (size_t i = 0; i < ARRAY_SIZE(filtered_out_sources); i++) {
-			if (starts_with(source_name, filtered_out_sources[i])) {
-				return true;
-			}
+static void filtered_out_source_ids_init(void)
+{
+	uint32_t count = MIN(log_src_cnt_get(Z_LOG_LOCAL_DOMAIN_ID),
+			     CONFIG_LOG_BACKEND_RPC_FILTER_MAX_SOURCES);
+
+	for (uint32_t source_id = 0; source_id < count; source_id++) {
+		if (source_name_filtered_out(TYPE_SECTION_START(log_const)[source_id].name)) {
+			atomic_set_bit(filtered_out_source_ids, source_id);
 		}
 	}
+}
 
-	return false;
+static bool should_filter_out(struct log_msg *msg)
+{
+	int32_t source_id = log_msg_source_id_get(msg);
+
+	if (source_id < 0) {
+		return false;
+	}
+
+	if (source_id < CONFIG_LOG_BACKEND_RPC_FILTER_MAX_SOURCES) {
+		return atomic_test_bit(filtered_out_source_ids, source_id);
+	}
+
+	return source_name_filtered_out(TYPE_SECTION_START(log_const)[source_id].name);
 }
 
 static void process(const struct log_backend *const backend, union log_msg_generic *msg_generic)
@@ -604,6 +760,12 @@ static void init(struct log_backend const *const backend)
 {
 	ARG_UNUSED(backend);
 
+	filtered_out_source_ids_init();
+
+#ifdef CONFIG_LOG_BACKEND_RPC_STREAM_FORMAT_DICTIONARY
+	batch_reset();
+#endif
+
 #ifdef CONFIG_LOG_BACKEND_RPC_HISTORY
 	log_rpc_history_init();
 	k_work_queue_init(&history_transfer_workq);
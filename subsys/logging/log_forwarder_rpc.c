@@ -10,17 +10,23 @@
  *
  */
 
+#include "log_rpc_dict.h"
 #include "log_rpc_group.h"
 
 #include <logging/log_rpc.h>
 #include <nrf_rpc/nrf_rpc_serialize.h>
 
 #include <nrf_rpc_cbor.h>
+#include <zcbor_decode.h>
 
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/cbprintf.h>
+#include <zephyr/sys/printk.h>
 #include <zephyr/sys/util.h>
 
+#include <string.h>
+
 LOG_MODULE_REGISTER(remote, LOG_LEVEL_DBG);
 
 static K_MUTEX_DEFINE(history_transfer_mtx);
@@ -28,6 +34,62 @@ static uint32_t history_transfer_id;
 static log_rpc_history_handler_t history_handler;
 static log_rpc_history_threshold_reached_handler_t history_threshold_reached_handler;
 
+static struct {
+	uint32_t source_id;
+	char name[CONFIG_LOG_FORWARDER_RPC_SOURCE_NAME_SIZE];
+} source_cache[CONFIG_LOG_FORWARDER_RPC_SOURCE_CACHE_SIZE];
+
+/* Log message batch received in the dictionary format, waiting to be formatted. */
+struct msg_batch {
+	void *fifo_reserved;
+	size_t length;
+	uint8_t data[];
+};
+
+static K_HEAP_DEFINE(batch_heap, CONFIG_LOG_FORWARDER_RPC_BATCH_QUEUE_SIZE);
+static K_FIFO_DEFINE(batch_fifo);
+
+static void forward_message(enum log_rpc_level level, const char *message, size_t message_size)
+{
+	switch (level) {
+	case LOG_RPC_LEVEL_ERR:
+		LOG_ERR("%.*s", message_size, message);
+		break;
+	case LOG_RPC_LEVEL_WRN:
+		LOG_WRN("%.*s", message_size, message);
+		break;
+	case LOG_RPC_LEVEL_INF:
+		LOG_INF("%.*s", message_size, message);
+		break;
+	case LOG_RPC_LEVEL_DBG:
+		LOG_DBG("%.*s", message_size, message);
+		break;
+	default:
+		break;
+	}
+}
+
+static void forward_hexdump(enum log_rpc_level level, const uint8_t *data, size_t data_size,
+			    const char *message)
+{
+	switch (level) {
+	case LOG_RPC_LEVEL_ERR:
+		LOG_HEXDUMP_ERR(data, data_size, message);
+		break;
+	case LOG_RPC_LEVEL_WRN:
+		LOG_HEXDUMP_WRN(data, data_size, message);
+		break;
+	case LOG_RPC_LEVEL_INF:
+		LOG_HEXDUMP_INF(data, data_size, message);
+		break;
+	case LOG_RPC_LEVEL_DBG:
+		LOG_HEXDUMP_DBG(data, data_size, message);
+		break;
+	default:
+		break;
+	}
+}
+
 static void log_rpc_msg_handler(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
 				void *handler_data)
 {
@@ -39,22 +101,7 @@ static void log_rpc_msg_handler(const struct nrf_rpc_group *group, struct nrf_rp
 	message = nrf_rpc_decode_buffer_ptr_and_size(ctx, &message_size);
 
 	if (message) {
-		switch (level) {
-		case LOG_RPC_LEVEL_ERR:
-			LOG_ERR("%.*s", message_size, message);
-			break;
-		case LOG_RPC_LEVEL_WRN:
-			LOG_WRN("%.*s", message_size, message);
-			break;
-		case LOG_RPC_LEVEL_INF:
-			LOG_INF("%.*s", message_size, message);
-			break;
-		case LOG_RPC_LEVEL_DBG:
-			LOG_DBG("%.*s", message_size, message);
-			break;
-		default:
-			break;
-		}
+		forward_message(level, message, message_size);
 	}
 
 	if (!nrf_rpc_decoding_done_and_check(&log_rpc_group, ctx)) {
@@ -66,6 +113,128 @@ static void log_rpc_msg_handler(const struct nrf_rpc_group *group, struct nrf_rp
 NRF_RPC_CBOR_EVT_DECODER(log_rpc_group, log_rpc_msg_handler, LOG_RPC_EVT_MSG, log_rpc_msg_handler,
 			 NULL);
 
+static void source_name_fetch(uint32_t source_id, char *name, size_t name_size)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+
+	NRF_RPC_CBOR_ALLOC(&log_rpc_group, ctx, 1 + sizeof(source_id));
+	nrf_rpc_encode_uint(&ctx, source_id);
+	nrf_rpc_cbor_cmd_rsp_no_err(&log_rpc_group, LOG_RPC_CMD_GET_SOURCE_NAME, &ctx);
+
+	if (!nrf_rpc_decode_str(&ctx, name, name_size)) {
+		snprintk(name, name_size, "%u", source_id);
+	}
+
+	if (!nrf_rpc_decoding_done_and_check(&log_rpc_group, &ctx)) {
+		nrf_rpc_err(-EBADMSG, NRF_RPC_ERR_SRC_RECV, &log_rpc_group,
+			    LOG_RPC_CMD_GET_SOURCE_NAME, NRF_RPC_PACKET_TYPE_RSP);
+	}
+}
+
+/* Must be called from the batch thread, which is the only user of the cache. */
+static const char *source_name_get(uint32_t source_id)
+{
+	/* Entries are zero-initialized, so an empty name marks an unused entry. */
+	size_t index = source_id % ARRAY_SIZE(source_cache);
+
+	if (source_cache[index].source_id != source_id || source_cache[index].name[0] == '\0') {
+		source_cache[index].source_id = source_id;
+		source_name_fetch(source_id, source_cache[index].name,
+				  sizeof(source_cache[index].name));
+	}
+
+	return source_cache[index].name;
+}
+
+static void forward_batch(struct nrf_rpc_cbor_ctx *ctx)
+{
+	uint8_t package_buf[CONFIG_LOG_FORWARDER_RPC_PACKAGE_BUFFER_SIZE]
+		__aligned(CBPRINTF_PACKAGE_ALIGNMENT);
+	char output_buf[CONFIG_LOG_FORWARDER_RPC_OUTPUT_BUFFER_SIZE];
+	struct log_rpc_dict_record record;
+	size_t length;
+
+	while (log_rpc_dict_record_decode(ctx, &record)) {
+		if (record.package_size > sizeof(package_buf)) {
+			LOG_WRN("Dropped %zu B log message", record.package_size);
+			continue;
+		}
+
+		/* The package must be aligned to be formatted. */
+		memcpy(package_buf, record.package, record.package_size);
+
+		length = log_rpc_dict_record_format(
+			output_buf, sizeof(output_buf) - 1, &record,
+			record.source_id >= 0 ? source_name_get(record.source_id) : NULL,
+			package_buf);
+
+		if (record.data != NULL) {
+			output_buf[length] = '\0';
+			forward_hexdump(record.level, record.data, record.data_size, output_buf);
+		} else {
+			forward_message(record.level, output_buf, length);
+		}
+	}
+
+	if (!nrf_rpc_decode_valid(ctx)) {
+		nrf_rpc_err(-EBADMSG, NRF_RPC_ERR_SRC_RECV, &log_rpc_group, LOG_RPC_EVT_MSG_BATCH,
+			    NRF_RPC_PACKET_TYPE_EVT);
+	}
+}
+
+static void batch_thread_fn(void *p1, void *p2, void *p3)
+{
+	struct msg_batch *batch;
+	struct nrf_rpc_cbor_ctx ctx;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		batch = k_fifo_get(&batch_fifo, K_FOREVER);
+
+		zcbor_new_decode_state(ctx.zs, ARRAY_SIZE(ctx.zs), batch->data, batch->length,
+				       ZCBOR_MAX_ELEM_COUNT, NULL, 0);
+		forward_batch(&ctx);
+
+		k_heap_free(&batch_heap, batch);
+	}
+}
+
+K_THREAD_DEFINE(log_rpc_batch_thread, CONFIG_LOG_FORWARDER_RPC_THREAD_STACK_SIZE,
+		batch_thread_fn, NULL, NULL, NULL, K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
+
+/*
+ * Formatting a batch may require fetching source names with nRF RPC commands, which
+ * must not be sent from an nRF RPC event handler. The batch is copied and formatted
+ * in the batch thread instead.
+ */
+static void log_rpc_msg_batch_handler(const struct nrf_rpc_group *group,
+				      struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
+{
+	const uint8_t *payload = ctx->zs[0].payload;
+	size_t length = ctx->zs[0].payload_end - payload;
+	struct msg_batch *batch;
+
+	batch = k_heap_alloc(&batch_heap, sizeof(*batch) + length, K_NO_WAIT);
+
+	if (batch != NULL) {
+		batch->length = length;
+		memcpy(batch->data, payload, length);
+		k_fifo_put(&batch_fifo, batch);
+	}
+
+	nrf_rpc_cbor_decoding_done(group, ctx);
+
+	if (batch == NULL) {
+		LOG_WRN("Dropped %zu B log message batch", length);
+	}
+}
+
+NRF_RPC_CBOR_EVT_DECODER(log_rpc_group, log_rpc_msg_batch_handler, LOG_RPC_EVT_MSG_BATCH,
+			 log_rpc_msg_batch_handler, NULL);
+
 void log_rpc_set_stream_level(enum log_rpc_level level)
 {
 	struct nrf_rpc_cbor_ctx ctx;
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "log_rpc_dict.h"
+
+#include <nrf_rpc/nrf_rpc_serialize.h>
+
+#include <zephyr/sys/cbprintf.h>
+#include <zephyr/sys_clock.h>
+#include <zephyr/sys/util.h>
+
+#include <string.h>
+
+/* Maximum size of the level, source ID, timestamp and the headers of the byte strings. */
+#define RECORD_HEADER_SIZE (1 + 5 + 9 + 5 + 5)
+#define PACKAGE_CONVERT_FLAGS (CBPRINTF_PACKAGE_CONVERT_RO_STR | CBPRINTF_PACKAGE_CONVERT_RW_STR)
+
+struct output_to_buf_ctx {
+	char *out;
+	size_t out_len;
+	size_t length;
+};
+
+static int package_to_buf(const void *buf, size_t length, void *ctx)
+{
+	uint8_t **out = ctx;
+
+	memcpy(*out, buf, length);
+	*out += length;
+
+	return (int)length;
+}
+
+static int output_to_buf(int c, void *ctx)
+{
+	struct output_to_buf_ctx *output_ctx = ctx;
+
+	if (output_ctx->length < output_ctx->out_len) {
+		output_ctx->out[output_ctx->length++] = (char)c;
+	}
+
+	return c;
+}
+
+size_t log_rpc_dict_record_size(const struct log_rpc_dict_record *record)
+{
+	/* Only calculates the package length with the strings appended, nothing is formatted. */
+	return RECORD_HEADER_SIZE + record->data_size +
+	       cbprintf_package_convert((void *)record->package, record->package_size, NULL, NULL,
+					PACKAGE_CONVERT_FLAGS, NULL, 0);
+}
+
+void log_rpc_dict_record_encode(struct nrf_rpc_cbor_ctx *ctx,
+				const struct log_rpc_dict_record *record)
+{
+	nrf_rpc_encode_uint(ctx, record->level);
+
+	if (record->source_id >= 0) {
+		nrf_rpc_encode_uint(ctx, record->source_id);
+	} else {
+		nrf_rpc_encode_null(ctx);
+	}
+
+	nrf_rpc_encode_uint64(ctx, record->timestamp_us);
+
+	if (zcbor_bstr_start_encode(ctx->zs)) {
+		cbprintf_package_convert((void *)record->package, record->package_size,
+					 package_to_buf, &ctx->zs[0].payload_mut,
+					 PACKAGE_CONVERT_FLAGS, NULL, 0);
+		zcbor_bstr_end_encode(ctx->zs, NULL);
+	}
+
+	nrf_rpc_encode_buffer(ctx, record->data_size > 0 ? record->data : NULL, record->data_size);
+}
+
+bool log_rpc_dict_record_decode(struct nrf_rpc_cbor_ctx *ctx, struct log_rpc_dict_record *record)
+{
+	if (!nrf_rpc_decode_valid(ctx) || nrf_rpc_decode_is_null(ctx)) {
+		return false;
+	}
+
+	record->level = nrf_rpc_decode_uint(ctx);
+	record->source_id = nrf_rpc_decode_is_null(ctx) ? -1 : (int32_t)nrf_rpc_decode_uint(ctx);
+	record->timestamp_us = nrf_rpc_decode_uint64(ctx);
+	record->package = nrf_rpc_decode_buffer_ptr_and_size(ctx, &record->package_size);
+	record->data = nrf_rpc_decode_buffer_ptr_and_size(ctx, &record->data_size);
+
+	if (record->data == NULL) {
+		record->data_size = 0;
+	}
+
+	return nrf_rpc_decode_valid(ctx) && (record->package != NULL);
+}
+
+size_t log_rpc_dict_record_format(char *out, size_t out_len,
+				  const struct log_rpc_dict_record *record, const char *source_name,
+				  void *package)
+{
+	uint64_t timestamp_us = record->timestamp_us;
+	uint32_t us = timestamp_us % USEC_PER_MSEC;
+	uint32_t ms = (timestamp_us / USEC_PER_MSEC) % MSEC_PER_SEC;
+	uint32_t seconds = timestamp_us / USEC_PER_SEC;
+	struct output_to_buf_ctx output_ctx = {
+		.out = out,
+		.out_len = out_len,
+	};
+
+	cbprintf(output_to_buf, &output_ctx, "[%02u:%02u:%02u.%03u,%03u] %s%s", seconds / 3600,
+		 (seconds / 60) % 60, seconds % 60, ms, us, source_name ? source_name : "",
+		 source_name ? ": " : "");
+	cbpprintf(output_to_buf, &output_ctx, package);
+
+	return output_ctx.length;
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef LOG_RPC_DICT_H_
+#define LOG_RPC_DICT_H_
+
+#include <logging/log_rpc.h>
+
+#include <nrf_rpc_cbor.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Log messages streamed in the dictionary format are sent as records of:
+ * - level,
+ * - source ID or null if the message has no local source,
+ * - timestamp in microseconds,
+ * - cbprintf package with all strings appended,
+ * - hexdump data or null.
+ */
+struct log_rpc_dict_record {
+	enum log_rpc_level level;
+	/* Negative if the message has no local source. */
+	int32_t source_id;
+	uint64_t timestamp_us;
+	const uint8_t *package;
+	size_t package_size;
+	const uint8_t *data;
+	size_t data_size;
+};
+
+/* Get the maximum size of the encoded record, with the package strings appended. */
+size_t log_rpc_dict_record_size(const struct log_rpc_dict_record *record);
+
+/* Encode the record, appending the strings referenced by the package to the package. */
+void log_rpc_dict_record_encode(struct nrf_rpc_cbor_ctx *ctx,
+				const struct log_rpc_dict_record *record);
+
+/*
+ * Decode the next record of a batch. Returns false at the null item ending the batch,
+ * or if the record is malformed, which can be checked with nrf_rpc_decode_valid().
+ */
+bool log_rpc_dict_record_decode(struct nrf_rpc_cbor_ctx *ctx, struct log_rpc_dict_record *record);
+
+/*
+ * Format the record the same way as the backend does for the text format, that is
+ * "[hh:mm:ss.mmm,uuu] source: message". The package is a copy of the record package
+ * aligned to CBPRINTF_PACKAGE_ALIGNMENT. Returns the length of the formatted message,
+ * which is truncated to out_len.
+ */
+size_t log_rpc_dict_record_format(char *out, size_t out_len,
+				  const struct log_rpc_dict_record *record, const char *source_name,
+				  void *package);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_RPC_DICT_H_ */
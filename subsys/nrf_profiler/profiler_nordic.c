@@ -9,10 +9,11 @@
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/byteorder.h>
 #include <zephyr/kernel.h>
-#include <SEGGER_RTT.h>
+#include <zephyr/sys/barrier.h>
 #include <nrf_profiler.h>
 #include <string.h>
-#include <nrfx.h>
+
+#include "profiler_nordic_transport.h"
 
 
 enum state {
@@ -26,16 +27,38 @@ enum state {
 struct nrf_profiler_event_enabled_bm _nrf_profiler_event_enabled_bm;
 
 static K_SEM_DEFINE(nrf_profiler_sem, 0, 1);
+static K_SEM_DEFINE(nrf_profiler_command_sem, 0, 1);
 static atomic_t nrf_profiler_state;
-static uint16_t fatal_error_event_id;
+static uint16_t dropped_events_event_id;
+static uint32_t dropped_events_cnt;
+static uint32_t last_timestamp;
 static struct k_spinlock lock;
 
 enum nordic_command {
 	NORDIC_COMMAND_START	= 1,
 	NORDIC_COMMAND_STOP	= 2,
-	NORDIC_COMMAND_INFO	= 3
+	NORDIC_COMMAND_INFO	= 3,
+	NORDIC_COMMAND_SET_MASK	= 4
 };
 
+/* Maximum length of the varint encoding of a 32-bit value. */
+#define VARINT_U32_LEN_MAX 5
+
+/* Every event starts with the event type ID followed by the timestamp. The delta timestamp
+ * is stored as a 32-bit value in the last bytes of the header until the event is sent.
+ * It is then replaced by the varint encoding and the event type ID is moved right before it.
+ */
+#ifdef CONFIG_NRF_PROFILER_NORDIC_TIMESTAMP_DELTA
+#define EVENT_HEADER_LEN (sizeof(uint8_t) + VARINT_U32_LEN_MAX)
+#else
+#define EVENT_HEADER_LEN (sizeof(uint8_t) + sizeof(uint32_t))
+#endif
+
+BUILD_ASSERT(EVENT_HEADER_LEN <= CONFIG_NRF_PROFILER_CUSTOM_EVENT_BUF_LEN,
+	     "Custom event buffer is too small to fit the event header");
+
+#define EVENT_MASK_LEN DIV_ROUND_UP(NRF_PROFILER_MAX_NUMBER_OF_APPLICATION_AND_INTERNAL_EVENTS, 8)
+
 char descr[NRF_PROFILER_MAX_NUMBER_OF_APPLICATION_AND_INTERNAL_EVENTS]
 	  [CONFIG_NRF_PROFILER_MAX_LENGTH_OF_CUSTOM_EVENTS_DESCRIPTIONS];
 static char *arg_types_encodings[] = {
@@ -51,47 +74,10 @@ static char *arg_types_encodings[] = {
 
 uint8_t nrf_profiler_num_events;
 
-static uint8_t buffer_data[CONFIG_NRF_PROFILER_NORDIC_DATA_BUFFER_SIZE];
-static uint8_t buffer_info[CONFIG_NRF_PROFILER_NORDIC_INFO_BUFFER_SIZE];
-static uint8_t buffer_commands[CONFIG_NRF_PROFILER_NORDIC_COMMAND_BUFFER_SIZE];
-
-static k_tid_t protocol_thread_id;
-
 static K_THREAD_STACK_DEFINE(nrf_profiler_nordic_stack,
 			     CONFIG_NRF_PROFILER_NORDIC_STACK_SIZE);
 static struct k_thread nrf_profiler_nordic_thread;
 
-static int send_info_data(const char *data, size_t data_len)
-{
-	uint8_t retry_cnt = 0;
-	static const uint8_t retry_cnt_max = 100;
-
-	size_t num_bytes_send;
-
-	num_bytes_send = SEGGER_RTT_WriteNoLock(
-				  CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_INFO,
-				  data, data_len);
-
-	while (num_bytes_send != data_len) {
-		/* Give host time to read the data and free some space
-		 * in the buffer. */
-		k_sleep(K_MSEC(100));
-		num_bytes_send = SEGGER_RTT_WriteNoLock(
-				  CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_INFO,
-				  data, data_len);
-
-		/* Avoid being blocked in while loop if host does not read
-		 * the RTT data.
-		 */
-		retry_cnt++;
-		if (retry_cnt > retry_cnt_max) {
-			return -ENOBUFS;
-		}
-	}
-
-	return 0;
-}
-
 static void send_system_description(void)
 {
 	/* Memory barrier to make sure that data is visible
@@ -99,18 +85,62 @@ static void send_system_description(void)
 	 */
 	uint8_t ne = nrf_profiler_num_events;
 
-	__DMB();
+	barrier_dmem_fence_full();
 	char end_line = '\n';
 	int err = 0;
 
 	for (size_t t = 0; ((t < ne) && !err); t++) {
-		err = send_info_data(descr[t], strlen(descr[t]));
+		err = nrf_profiler_transport_info_write(descr[t], strlen(descr[t]));
 		if (!err) {
-			err = send_info_data(&end_line, 1);
+			err = nrf_profiler_transport_info_write(&end_line, 1);
 		}
 	}
 	if (!err) {
-		(void)send_info_data(&end_line, 1);
+		(void)nrf_profiler_transport_info_write(&end_line, 1);
+	}
+}
+
+static void start_logging(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (atomic_cas(&nrf_profiler_state, STATE_INACTIVE, STATE_ACTIVE)) {
+		/* Host expects the first delta timestamp to be relative to zero. */
+		last_timestamp = 0;
+	}
+	k_spin_unlock(&lock, key);
+}
+
+/* Discard the pending command bytes after an invalid command, so that the next command
+ * is read from its start.
+ */
+static void commands_discard(void)
+{
+	uint8_t unused;
+
+	while (nrf_profiler_transport_cmd_read(&unused, sizeof(unused))) {
+	}
+}
+
+static void set_event_mask(void)
+{
+	uint8_t mask[EVENT_MASK_LEN];
+	uint8_t mask_len;
+	uint8_t ne = nrf_profiler_num_events;
+
+	/* Mask length is followed by the mask, where bit n enables the event type with ID n.
+	 * The host sends the mask only for the event types that are registered.
+	 */
+	if (!nrf_profiler_transport_cmd_read(&mask_len, sizeof(mask_len)) ||
+	    (mask_len > DIV_ROUND_UP(ne, 8)) ||
+	    (nrf_profiler_transport_cmd_read(mask, mask_len) != mask_len)) {
+		commands_discard();
+		return;
+	}
+
+	for (size_t i = 0; (i < ne) && (i < mask_len * 8); i++) {
+		atomic_set_bit_to(_nrf_profiler_event_enabled_bm.flags, i,
+				  mask[i / 8] & BIT(i % 8));
 	}
 }
 
@@ -120,13 +150,13 @@ static void nrf_profiler_nordic_thread_fn(void)
 		uint8_t read_data;
 		enum nordic_command command;
 
-		if (SEGGER_RTT_Read(
-		     CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_COMMANDS,
-		     &read_data, sizeof(read_data))) {
+		/* Handle all pending commands, so that none of them waits for the next poll. */
+		while ((atomic_get(&nrf_profiler_state) != STATE_TERMINATED) &&
+		       nrf_profiler_transport_cmd_read(&read_data, sizeof(read_data))) {
 			command = (enum nordic_command)read_data;
 			switch (command) {
 			case NORDIC_COMMAND_START:
-				atomic_cas(&nrf_profiler_state, STATE_INACTIVE, STATE_ACTIVE);
+				start_logging();
 				break;
 			case NORDIC_COMMAND_STOP:
 				atomic_cas(&nrf_profiler_state, STATE_ACTIVE, STATE_INACTIVE);
@@ -134,13 +164,24 @@ static void nrf_profiler_nordic_thread_fn(void)
 			case NORDIC_COMMAND_INFO:
 				send_system_description();
 				break;
+			case NORDIC_COMMAND_SET_MASK:
+				set_event_mask();
+				break;
 			default:
-				__ASSERT_NO_MSG(false);
+				commands_discard();
 				break;
 			}
 		}
-		k_sleep(K_MSEC(500));
+
+		nrf_profiler_transport_flush();
+
+		/* Transport does not signal incoming commands. The thread is woken up
+		 * earlier only on termination.
+		 */
+		(void)k_sem_take(&nrf_profiler_command_sem,
+				 K_MSEC(CONFIG_NRF_PROFILER_NORDIC_COMMAND_POLL_PERIOD));
 	}
+	nrf_profiler_transport_flush();
 	k_sem_give(&nrf_profiler_sem);
 }
 
@@ -160,46 +201,37 @@ int nrf_profiler_init(void)
 		}
 	}
 
+	int ret = nrf_profiler_transport_init();
+
+	if (ret) {
+		atomic_set(&nrf_profiler_state, STATE_DISABLED);
+		k_sched_unlock();
+		return ret;
+	}
+
 	if (IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_START_LOGGING_ON_SYSTEM_START)) {
 		atomic_cas(&nrf_profiler_state, STATE_INACTIVE, STATE_ACTIVE);
 	}
 
-	int ret;
-
-	ret = SEGGER_RTT_ConfigUpBuffer(
-		CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_DATA,
-		"Nordic nrf_profiler data",
-		buffer_data,
-		CONFIG_NRF_PROFILER_NORDIC_DATA_BUFFER_SIZE,
-		SEGGER_RTT_MODE_NO_BLOCK_SKIP);
-	__ASSERT_NO_MSG(ret >= 0);
-
-	ret = SEGGER_RTT_ConfigUpBuffer(
-		CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_INFO,
-		"Nordic nrf_profiler info",
-		buffer_info,
-		CONFIG_NRF_PROFILER_NORDIC_INFO_BUFFER_SIZE,
-		SEGGER_RTT_MODE_NO_BLOCK_SKIP);
-	__ASSERT_NO_MSG(ret >= 0);
-
-	ret = SEGGER_RTT_ConfigDownBuffer(
-		CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_COMMANDS,
-		"Nordic nrf_profiler command",
-		buffer_commands,
-		CONFIG_NRF_PROFILER_NORDIC_COMMAND_BUFFER_SIZE,
-		SEGGER_RTT_MODE_NO_BLOCK_SKIP);
-	__ASSERT_NO_MSG(ret >= 0);
-
-	protocol_thread_id =  k_thread_create(&nrf_profiler_nordic_thread,
+	k_thread_create(&nrf_profiler_nordic_thread,
 			nrf_profiler_nordic_stack,
 			K_THREAD_STACK_SIZEOF(nrf_profiler_nordic_stack),
 			(k_thread_entry_t) nrf_profiler_nordic_thread_fn,
 			NULL, NULL, NULL,
 			CONFIG_NRF_PROFILER_NORDIC_THREAD_PRIORITY, 0, K_NO_WAIT);
 
-	/* Registering fatal error event */
-	fatal_error_event_id = nrf_profiler_register_event_type("_nrf_profiler_fatal_error_event_",
-							    NULL, NULL, 0);
+	/* Registering internal events */
+	static const char * const dropped_events_arg_names[] = {"count"};
+	static const enum nrf_profiler_arg dropped_events_arg_types[] = {NRF_PROFILER_ARG_U32};
+
+	dropped_events_event_id = nrf_profiler_register_event_type("_nrf_profiler_dropped_events_",
+								   dropped_events_arg_names,
+								   dropped_events_arg_types, 1);
+
+	if (IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_TIMESTAMP_DELTA)) {
+		/* The event is never sent. It informs the host that timestamps are delta encoded. */
+		(void)nrf_profiler_register_event_type("_nrf_profiler_timestamp_delta_", NULL, NULL, 0);
+	}
 
 	k_sched_unlock();
 	return 0;
@@ -212,7 +244,7 @@ void nrf_profiler_term(void)
 		return;
 	}
 
-	k_wakeup(protocol_thread_id);
+	k_sem_give(&nrf_profiler_command_sem);
 	k_sem_take(&nrf_profiler_sem, K_FOREVER);
 }
 
@@ -262,8 +294,14 @@ uint16_t nrf_profiler_register_event_type(const char *name, const char * const *
 	/* Memory barrier to make sure that data is visible
 	 * before being accessed
 	 */
-	__DMB();
+	barrier_dmem_fence_full();
 	nrf_profiler_num_events++;
+
+	if (IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_TRANSPORT_FILE)) {
+		/* No host requests the descriptions, so write them once registered. */
+		(void)nrf_profiler_transport_info_write(descr[ne], strlen(descr[ne]));
+		(void)nrf_profiler_transport_info_write("\n", 1);
+	}
 	k_sched_unlock();
 
 	return ne;
@@ -271,8 +309,8 @@ uint16_t nrf_profiler_register_event_type(const char *name, const char * const *
 
 void nrf_profiler_log_start(struct log_event_buf *buf)
 {
-	/* Adding one to pointer to make space for event type ID */
-	buf->payload = buf->payload_start + sizeof(uint8_t);
+	/* Leaving space for event type ID and timestamp encoding */
+	buf->payload = buf->payload_start + EVENT_HEADER_LEN - sizeof(uint32_t);
 	nrf_profiler_log_encode_uint32(buf, k_cycle_get_32());
 }
 
@@ -340,29 +378,59 @@ void nrf_profiler_log_add_mem_address(struct log_event_buf *buf,
 	nrf_profiler_log_encode_uint32(buf, (uint32_t)mem_address);
 }
 
-static bool nrf_profiler_RTT_send(struct log_event_buf *buf, uint8_t type_id)
+static uint32_t zigzag_encode(int32_t value)
 {
-	buf->payload_start[0] = type_id;
-	size_t data_len = buf->payload - buf->payload_start;
+	return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
 
-	size_t num_bytes_send = SEGGER_RTT_WriteNoLock(
-			CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_DATA,
-			buf->payload_start, data_len);
-	return (num_bytes_send == data_len);
+static bool event_send(struct log_event_buf *buf, uint8_t type_id)
+{
+	uint8_t *event = buf->payload_start;
+
+	if (IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_TIMESTAMP_DELTA)) {
+		uint8_t *header_end = buf->payload_start + EVENT_HEADER_LEN;
+		uint32_t timestamp = sys_get_le32(header_end - sizeof(uint32_t));
+		/* Events may be sent in a different order than they were started. */
+		uint32_t delta = zigzag_encode((int32_t)(timestamp - last_timestamp));
+		uint8_t varint[VARINT_U32_LEN_MAX];
+		size_t varint_len = 0;
+
+		do {
+			varint[varint_len] = delta & 0x7f;
+			delta >>= 7;
+			if (delta) {
+				varint[varint_len] |= 0x80;
+			}
+			varint_len++;
+		} while (delta);
+
+		event = header_end - varint_len - sizeof(uint8_t);
+		memcpy(event + sizeof(uint8_t), varint, varint_len);
+		event[0] = type_id;
+
+		if (!nrf_profiler_transport_data_write(event, buf->payload - event)) {
+			return false;
+		}
+
+		last_timestamp = timestamp;
+		return true;
+	}
+
+	event[0] = type_id;
+
+	return nrf_profiler_transport_data_write(event, buf->payload - event);
 }
 
-static void nrf_profiler_fatal_error(void)
+static void dropped_events_send(void)
 {
 	struct log_event_buf buf;
 
 	nrf_profiler_log_start(&buf);
-	while (true) {
-		/* Sending Fatal Error event */
-		if (nrf_profiler_RTT_send(&buf, (uint8_t)fatal_error_event_id)) {
-			break;
-		}
+	nrf_profiler_log_encode_uint32(&buf, dropped_events_cnt);
+
+	if (event_send(&buf, (uint8_t)dropped_events_event_id)) {
+		dropped_events_cnt = 0;
 	}
-	k_oops();
 }
 
 void nrf_profiler_log_send(struct log_event_buf *buf, uint16_t event_type_id)
@@ -374,8 +442,13 @@ void nrf_profiler_log_send(struct log_event_buf *buf, uint16_t event_type_id)
 
 		k_spinlock_key_t key = k_spin_lock(&lock);
 
-		if (!nrf_profiler_RTT_send(buf, type_id)) {
-			nrf_profiler_fatal_error();
+		/* Report dropped events before the event, once there is space for it. */
+		if (dropped_events_cnt > 0) {
+			dropped_events_send();
+		}
+
+		if (!event_send(buf, type_id) && (dropped_events_cnt < UINT32_MAX)) {
+			dropped_events_cnt++;
 		}
 		k_spin_unlock(&lock, key);
 	}
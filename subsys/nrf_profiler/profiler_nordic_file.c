@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <cmdline.h>
+#include <posix_native_task.h>
+
+#include "profiler_nordic_transport.h"
+#include "profiler_nordic_file_bottom.h"
+
+#define INFO_FILE_SUFFIX ".info"
+
+static char *data_file_path = CONFIG_NRF_PROFILER_NORDIC_FILE_PATH;
+static char *cmd_file_path = CONFIG_NRF_PROFILER_NORDIC_FILE_CMD_PATH;
+static int data_fd = -1;
+static int info_fd = -1;
+static int cmd_fd = -1;
+
+/* Events are buffered and written to the file from the nrf_profiler thread, the same as
+ * the RTT buffer is read by the host. Events are dropped if the buffer is full.
+ */
+RING_BUF_DECLARE(data_buf, CONFIG_NRF_PROFILER_NORDIC_DATA_BUFFER_SIZE);
+static struct k_spinlock data_buf_lock;
+
+int nrf_profiler_transport_init(void)
+{
+	char info_file_path[256];
+	int ret;
+
+	ret = snprintf(info_file_path, sizeof(info_file_path), "%s" INFO_FILE_SUFFIX,
+		       data_file_path);
+	if ((ret < 0) || (ret >= sizeof(info_file_path))) {
+		return -ENAMETOOLONG;
+	}
+
+	data_fd = nrf_profiler_file_bottom_open(data_file_path, 1);
+	info_fd = nrf_profiler_file_bottom_open(info_file_path, 1);
+	if ((data_fd < 0) || (info_fd < 0)) {
+		printk("nrf_profiler: cannot open %s\n", data_file_path);
+		return -EIO;
+	}
+
+	if (strlen(cmd_file_path) > 0) {
+		cmd_fd = nrf_profiler_file_bottom_open(cmd_file_path, 0);
+		if (cmd_fd < 0) {
+			printk("nrf_profiler: cannot open %s\n", cmd_file_path);
+			return -EIO;
+		}
+	}
+
+	return 0;
+}
+
+bool nrf_profiler_transport_data_write(const void *data, size_t len)
+{
+	k_spinlock_key_t key = k_spin_lock(&data_buf_lock);
+	bool written = false;
+
+	if (ring_buf_space_get(&data_buf) >= len) {
+		written = (ring_buf_put(&data_buf, data, len) == len);
+	}
+
+	k_spin_unlock(&data_buf_lock, key);
+
+	return written;
+}
+
+void nrf_profiler_transport_flush(void)
+{
+	k_spinlock_key_t key;
+	uint8_t *data;
+	uint32_t len;
+
+	do {
+		key = k_spin_lock(&data_buf_lock);
+		len = ring_buf_get_claim(&data_buf, &data, UINT32_MAX);
+		k_spin_unlock(&data_buf_lock, key);
+
+		/* The claimed data is not overwritten until the claim is finished. */
+		if (len > 0) {
+			(void)nrf_profiler_file_bottom_write(data_fd, data, len);
+		}
+
+		key = k_spin_lock(&data_buf_lock);
+		(void)ring_buf_get_finish(&data_buf, len);
+		k_spin_unlock(&data_buf_lock, key);
+	} while (len > 0);
+}
+
+int nrf_profiler_transport_info_write(const void *data, size_t len)
+{
+	if (nrf_profiler_file_bottom_write(info_fd, data, len) != (long)len) {
+		return -EIO;
+	}
+
+	return 0;
+}
+
+size_t nrf_profiler_transport_cmd_read(void *data, size_t len)
+{
+	long ret;
+
+	/* Commands are appended to the command file by the host. */
+	if (cmd_fd < 0) {
+		return 0;
+	}
+
+	ret = nrf_profiler_file_bottom_read(cmd_fd, data, len);
+
+	return (ret > 0) ? ret : 0;
+}
+
+static void nrf_profiler_file_options(void)
+{
+	static struct args_struct_t options[] = {
+		{
+			.option = "nrf_profiler_file",
+			.name = "path",
+			.type = 's',
+			.dest = (void *)&data_file_path,
+			.descript = "Path of the file the nrf_profiler data stream is written to. "
+				    "Event type descriptions are written to the file with the "
+				    INFO_FILE_SUFFIX " suffix added."
+		},
+		{
+			.option = "nrf_profiler_cmd_file",
+			.name = "path",
+			.type = 's',
+			.dest = (void *)&cmd_file_path,
+			.descript = "Path of the file the nrf_profiler reads host commands from, "
+				    "as they are appended to it."
+		},
+		ARG_TABLE_ENDMARKER
+	};
+
+	native_add_command_line_opts(options);
+}
+
+static void nrf_profiler_file_close(void)
+{
+	if (info_fd >= 0) {
+		/* Empty line is written after the last event description. */
+		(void)nrf_profiler_file_bottom_write(info_fd, "\n", 1);
+		nrf_profiler_file_bottom_close(info_fd);
+	}
+
+	if (data_fd >= 0) {
+		nrf_profiler_transport_flush();
+		nrf_profiler_file_bottom_close(data_fd);
+	}
+
+	if (cmd_fd >= 0) {
+		nrf_profiler_file_bottom_close(cmd_fd);
+	}
+}
+
+NATIVE_TASK(nrf_profiler_file_options, PRE_BOOT_1, 1);
+NATIVE_TASK(nrf_profiler_file_close, ON_EXIT, 1);
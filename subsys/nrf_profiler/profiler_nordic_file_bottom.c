@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "profiler_nordic_file_bottom.h"
+
+int nrf_profiler_file_bottom_open(const char *path, int write)
+{
+	if (write) {
+		return open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	}
+
+	return open(path, O_RDONLY | O_CREAT, 0644);
+}
+
+long nrf_profiler_file_bottom_write(int fd, const void *data, size_t len)
+{
+	ssize_t ret;
+
+	do {
+		ret = write(fd, data, len);
+	} while ((ret < 0) && (errno == EINTR));
+
+	return ret;
+}
+
+long nrf_profiler_file_bottom_read(int fd, void *data, size_t len)
+{
+	ssize_t ret;
+
+	do {
+		ret = read(fd, data, len);
+	} while ((ret < 0) && (errno == EINTR));
+
+	return ret;
+}
+
+void nrf_profiler_file_bottom_close(int fd)
+{
+	close(fd);
+}
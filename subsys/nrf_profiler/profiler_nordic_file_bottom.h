@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _PROFILER_NORDIC_FILE_BOTTOM_H_
+#define _PROFILER_NORDIC_FILE_BOTTOM_H_
+
+#include <stddef.h>
+
+/* Host side of the nrf_profiler file transport. It is built with the host C library,
+ * so this header must not include Zephyr headers.
+ */
+
+/* Open the file for writing, or for reading if write is 0. The file is created if it does
+ * not exist, and truncated if it is opened for writing.
+ */
+int nrf_profiler_file_bottom_open(const char *path, int write);
+long nrf_profiler_file_bottom_write(int fd, const void *data, size_t len);
+long nrf_profiler_file_bottom_read(int fd, void *data, size_t len);
+void nrf_profiler_file_bottom_close(int fd);
+
+#endif /* _PROFILER_NORDIC_FILE_BOTTOM_H_ */
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2018 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <SEGGER_RTT.h>
+
+#include "profiler_nordic_transport.h"
+
+static uint8_t buffer_data[CONFIG_NRF_PROFILER_NORDIC_DATA_BUFFER_SIZE];
+static uint8_t buffer_info[CONFIG_NRF_PROFILER_NORDIC_INFO_BUFFER_SIZE];
+static uint8_t buffer_commands[CONFIG_NRF_PROFILER_NORDIC_COMMAND_BUFFER_SIZE];
+
+int nrf_profiler_transport_init(void)
+{
+	int ret;
+
+	ret = SEGGER_RTT_ConfigUpBuffer(
+		CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_DATA,
+		"Nordic nrf_profiler data",
+		buffer_data,
+		CONFIG_NRF_PROFILER_NORDIC_DATA_BUFFER_SIZE,
+		SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+	__ASSERT_NO_MSG(ret >= 0);
+
+	ret = SEGGER_RTT_ConfigUpBuffer(
+		CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_INFO,
+		"Nordic nrf_profiler info",
+		buffer_info,
+		CONFIG_NRF_PROFILER_NORDIC_INFO_BUFFER_SIZE,
+		SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+	__ASSERT_NO_MSG(ret >= 0);
+
+	ret = SEGGER_RTT_ConfigDownBuffer(
+		CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_COMMANDS,
+		"Nordic nrf_profiler command",
+		buffer_commands,
+		CONFIG_NRF_PROFILER_NORDIC_COMMAND_BUFFER_SIZE,
+		SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+	__ASSERT_NO_MSG(ret >= 0);
+
+	return 0;
+}
+
+bool nrf_profiler_transport_data_write(const void *data, size_t len)
+{
+	/* In the skip mode, the data is either written as a whole or dropped. */
+	return SEGGER_RTT_WriteNoLock(CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_DATA,
+				      data, len) == len;
+}
+
+void nrf_profiler_transport_flush(void)
+{
+	/* The host reads the data directly from the RTT buffer. */
+}
+
+int nrf_profiler_transport_info_write(const void *data, size_t len)
+{
+	uint8_t retry_cnt = 0;
+	static const uint8_t retry_cnt_max = 100;
+
+	size_t num_bytes_send;
+
+	num_bytes_send = SEGGER_RTT_WriteNoLock(
+				  CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_INFO,
+				  data, len);
+
+	while (num_bytes_send != len) {
+		/* Give host time to read the data and free some space
+		 * in the buffer. */
+		k_sleep(K_MSEC(100));
+		num_bytes_send = SEGGER_RTT_WriteNoLock(
+				  CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_INFO,
+				  data, len);
+
+		/* Avoid being blocked in while loop if host does not read
+		 * the RTT data.
+		 */
+		retry_cnt++;
+		if (retry_cnt > retry_cnt_max) {
+			return -ENOBUFS;
+		}
+	}
+
+	return 0;
+}
+
+size_t nrf_profiler_transport_cmd_read(void *data, size_t len)
+{
+	return SEGGER_RTT_Read(CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_COMMANDS, data, len);
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _PROFILER_NORDIC_TRANSPORT_H_
+#define _PROFILER_NORDIC_TRANSPORT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Transport used by the Nordic nrf_profiler to exchange data with the host.
+ * This header is private to the nrf_profiler.
+ */
+
+/** @brief Initialize the transport.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -errno Otherwise.
+ */
+int nrf_profiler_transport_init(void);
+
+/** @brief Write a single event to the data stream.
+ *
+ * The event is either written as a whole or dropped.
+ *
+ * @note This function is called with the nrf_profiler spinlock held and
+ *       can be called from interrupts.
+ *
+ * @param data Pointer to the event.
+ * @param len Length of the event.
+ *
+ * @return True if the event was written, false if it was dropped.
+ */
+bool nrf_profiler_transport_data_write(const void *data, size_t len);
+
+/** @brief Pass the buffered events to the host.
+ *
+ * The function is called periodically from the nrf_profiler thread.
+ */
+void nrf_profiler_transport_flush(void);
+
+/** @brief Write event type descriptions to the info stream.
+ *
+ * @param data Pointer to the description text.
+ * @param len Length of the description text.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -errno Otherwise.
+ */
+int nrf_profiler_transport_info_write(const void *data, size_t len);
+
+/** @brief Read command bytes sent by the host.
+ *
+ * The host writes each command as a whole, so once the first byte of a command
+ * is read, the remaining bytes of the command are available.
+ *
+ * @param data Pointer to the buffer for the command bytes.
+ * @param len Number of bytes to read.
+ *
+ * @return Number of bytes read.
+ */
+size_t nrf_profiler_transport_cmd_read(void *data, size_t len);
+
+#endif /* _PROFILER_NORDIC_TRANSPORT_H_ */
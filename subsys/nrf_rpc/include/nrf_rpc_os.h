@@ -46,6 +46,54 @@ int nrf_rpc_os_init(nrf_rpc_os_work_t callback);
 
 void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len);
 
+/** @brief Statistics of the nRF RPC thread pool. */
+struct nrf_rpc_os_thread_pool_stats {
+	/** Number of packets passed to the pool threads. */
+	uint32_t dispatched;
+	/** Number of packets executed by other thread than the home thread of the group. */
+	uint32_t stolen;
+	/** Number of times the sender was blocked because all queues were full. */
+	uint32_t blocked;
+	/** Number of times the backpressure was signaled. */
+	uint32_t backpressure;
+	/** Number of currently queued packets. */
+	uint32_t queued;
+	/** Maximum number of queued packets. */
+	uint32_t max_queued;
+	/** Number of threads currently executing packets. */
+	uint32_t busy;
+	/** Maximum number of threads executing packets at the same time. */
+	uint32_t max_busy;
+	/** Maximum time between queuing and starting to execute a packet. */
+	uint32_t max_latency_us;
+	/** Sum of times between queuing and starting to execute packets. */
+	uint64_t total_latency_us;
+};
+
+/** @brief Thread pool backpressure hook.
+ *
+ * Called from the nRF RPC transport receive context with @p active set to true when the
+ * number of queued packets reaches @kconfig{CONFIG_NRF_RPC_THREAD_POOL_HIGH_WATERMARK}.
+ * Called from the thread pool with @p active set to false when the number of queued packets
+ * drops to the half of the watermark. The default implementation does nothing.
+ *
+ * @param active Backpressure state.
+ */
+void nrf_rpc_os_thread_pool_backpressure_hook(bool active);
+
+#if CONFIG_NRF_RPC_THREAD_POOL_STATS
+
+/** @brief Get statistics of the thread pool.
+ *
+ * @param[out] stats Statistics.
+ */
+void nrf_rpc_os_thread_pool_stats_get(struct nrf_rpc_os_thread_pool_stats *stats);
+
+/** @brief Reset statistics of the thread pool. */
+void nrf_rpc_os_thread_pool_stats_reset(void);
+
+#endif /* CONFIG_NRF_RPC_THREAD_POOL_STATS */
+
 static inline int nrf_rpc_os_event_init(struct nrf_rpc_os_event *event)
 {
 	return k_sem_init(&event->sem, 0, 1);
@@ -10,6 +10,8 @@
 #include "nrf_rpc_os.h"
 #include <zephyr/sys/math_extras.h>
 
+#include <string.h>
+
 /* Maximum number of remote thread that this implementation allows. */
 #define MAX_REMOTE_THREADS 255
 
@@ -20,16 +22,62 @@
 	(~(((atomic_val_t)1 << (8 * sizeof(atomic_val_t) -		       \
 				CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE)) - 1))
 
-struct pool_start_msg {
+static nrf_rpc_os_work_t thread_pool_callback;
+
+#if CONFIG_NRF_RPC_THREAD_POOL_WORK_STEALING
+
+#define POOL_SIZE  CONFIG_NRF_RPC_THREAD_POOL_SIZE
+#define QUEUE_SIZE CONFIG_NRF_RPC_THREAD_POOL_QUEUE_SIZE
+
+/* Layout of the nRF RPC packet header, as encoded by the nRF RPC core. */
+enum packet_header_idx {
+	PACKET_TYPE_IDX,
+	PACKET_ID_IDX,
+	PACKET_DST_IDX,
+	PACKET_SRC_IDX,
+	PACKET_GROUP_ID_IDX,
+	PACKET_HEADER_SIZE,
+};
+
+BUILD_ASSERT(POOL_SIZE <= 32, "Thread pool with work stealing supports up to 32 threads");
+
+struct pool_item {
 	const uint8_t *data;
 	size_t len;
+	uint32_t enqueue_cycles;
 };
 
-static nrf_rpc_os_work_t thread_pool_callback;
+struct pool_queue {
+	struct pool_item items[QUEUE_SIZE];
+	uint8_t head;
+	uint8_t count;
+};
+
+static struct pool_queue pool_queues[POOL_SIZE];
+static struct k_sem pool_thread_sems[POOL_SIZE];
+static struct k_sem pool_space_sem;
+static struct k_spinlock pool_lock;
+static uint32_t pool_idle_mask;
+static uint32_t pool_queued;
+static bool pool_backpressure;
+
+#if CONFIG_NRF_RPC_THREAD_POOL_STATS
+static struct nrf_rpc_os_thread_pool_stats pool_stats;
+static uint32_t pool_busy;
+#endif
+
+#else /* CONFIG_NRF_RPC_THREAD_POOL_WORK_STEALING */
+
+struct pool_start_msg {
+	const uint8_t *data;
+	size_t len;
+};
 
 static struct pool_start_msg pool_start_msg_buf[2];
 static struct k_msgq pool_start_msg;
 
+#endif /* CONFIG_NRF_RPC_THREAD_POOL_WORK_STEALING */
+
 static struct k_sem context_reserved;
 static atomic_t context_mask;
 
@@ -46,6 +94,219 @@ BUILD_ASSERT(CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE <= 8 * sizeof(atomic_val_t),
 BUILD_ASSERT(sizeof(uint32_t) == sizeof(atomic_val_t),
 	     "Only atomic_val_t is implemented that is the same as uint32_t");
 
+#if CONFIG_NRF_RPC_THREAD_POOL_WORK_STEALING
+
+static void queue_push(struct pool_queue *queue, const struct pool_item *item)
+{
+	queue->items[(queue->head + queue->count) % QUEUE_SIZE] = *item;
+	queue->count++;
+}
+
+static void queue_pop(struct pool_queue *queue, struct pool_item *item)
+{
+	*item = queue->items[queue->head];
+	queue->head = (queue->head + 1) % QUEUE_SIZE;
+	queue->count--;
+}
+
+static uint32_t home_thread_get(const uint8_t *data, size_t len)
+{
+	if (len < PACKET_HEADER_SIZE) {
+		return 0;
+	}
+
+	return data[PACKET_GROUP_ID_IDX] % POOL_SIZE;
+}
+
+/* Returns own queue of the thread if not empty, otherwise the longest queue of other threads. */
+static struct pool_queue *queue_to_serve(uint32_t idx, bool *stolen)
+{
+	struct pool_queue *longest = NULL;
+
+	*stolen = false;
+
+	if (pool_queues[idx].count > 0) {
+		return &pool_queues[idx];
+	}
+
+	for (size_t i = 0; i < POOL_SIZE; i++) {
+		if (pool_queues[i].count > 0 &&
+		    (longest == NULL || pool_queues[i].count > longest->count)) {
+			longest = &pool_queues[i];
+		}
+	}
+
+	*stolen = true;
+
+	return longest;
+}
+
+static void thread_pool_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t idx = (uint32_t)(uintptr_t)p1;
+	struct pool_queue *queue;
+	struct pool_item item;
+	k_spinlock_key_t key;
+	bool backpressure_off;
+	bool stolen;
+
+	do {
+		key = k_spin_lock(&pool_lock);
+
+		queue = queue_to_serve(idx, &stolen);
+		if (queue == NULL) {
+			pool_idle_mask |= BIT(idx);
+			k_spin_unlock(&pool_lock, key);
+			k_sem_take(&pool_thread_sems[idx], K_FOREVER);
+			continue;
+		}
+
+		queue_pop(queue, &item);
+		pool_queued--;
+
+		backpressure_off = pool_backpressure &&
+				   (pool_queued <= CONFIG_NRF_RPC_THREAD_POOL_HIGH_WATERMARK / 2);
+		if (backpressure_off) {
+			pool_backpressure = false;
+		}
+
+#if CONFIG_NRF_RPC_THREAD_POOL_STATS
+		uint32_t latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - item.enqueue_cycles);
+
+		pool_stats.dispatched++;
+		pool_stats.stolen += stolen ? 1 : 0;
+		pool_stats.total_latency_us += latency_us;
+		pool_stats.max_latency_us = MAX(pool_stats.max_latency_us, latency_us);
+		pool_busy++;
+		pool_stats.max_busy = MAX(pool_stats.max_busy, pool_busy);
+#endif
+
+		k_spin_unlock(&pool_lock, key);
+
+		k_sem_give(&pool_space_sem);
+
+		if (backpressure_off) {
+			nrf_rpc_os_thread_pool_backpressure_hook(false);
+		}
+
+		thread_pool_callback(item.data, item.len);
+
+#if CONFIG_NRF_RPC_THREAD_POOL_STATS
+		key = k_spin_lock(&pool_lock);
+		pool_busy--;
+		k_spin_unlock(&pool_lock, key);
+#endif
+	} while (1);
+}
+
+static void thread_pool_init(void)
+{
+	k_sem_init(&pool_space_sem, POOL_SIZE * QUEUE_SIZE, POOL_SIZE * QUEUE_SIZE);
+
+	for (size_t i = 0; i < POOL_SIZE; i++) {
+		k_sem_init(&pool_thread_sems[i], 0, 1);
+	}
+}
+
+void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len)
+{
+	uint32_t home = home_thread_get(data, len);
+	struct pool_queue *queue = &pool_queues[home];
+	struct pool_item item;
+	k_spinlock_key_t key;
+	bool backpressure_on = false;
+	int wakeup = -1;
+
+	if (k_sem_take(&pool_space_sem, K_NO_WAIT) != 0) {
+		/* All queues are full, so there is no other way than to block the caller. */
+		NRF_RPC_WRN("Thread pool queues full");
+#if CONFIG_NRF_RPC_THREAD_POOL_STATS
+		key = k_spin_lock(&pool_lock);
+		pool_stats.blocked++;
+		k_spin_unlock(&pool_lock, key);
+#endif
+		k_sem_take(&pool_space_sem, K_FOREVER);
+	}
+
+	item.data = data;
+	item.len = len;
+	item.enqueue_cycles = k_cycle_get_32();
+
+	key = k_spin_lock(&pool_lock);
+
+	if (queue->count == QUEUE_SIZE) {
+		/* Spill over to the least loaded queue, the item will be stolen from there. */
+		for (size_t i = 0; i < POOL_SIZE; i++) {
+			if (pool_queues[i].count < queue->count) {
+				queue = &pool_queues[i];
+			}
+		}
+	}
+
+	queue_push(queue, &item);
+	pool_queued++;
+
+	if (!pool_backpressure && pool_queued >= CONFIG_NRF_RPC_THREAD_POOL_HIGH_WATERMARK) {
+		pool_backpressure = true;
+		backpressure_on = true;
+	}
+
+#if CONFIG_NRF_RPC_THREAD_POOL_STATS
+	pool_stats.max_queued = MAX(pool_stats.max_queued, pool_queued);
+	pool_stats.backpressure += backpressure_on ? 1 : 0;
+#endif
+
+	/* Prefer the home thread of the group. Otherwise, any idle thread steals the item. */
+	if (pool_idle_mask & BIT(home)) {
+		wakeup = home;
+	} else if (pool_idle_mask != 0) {
+		wakeup = u32_count_trailing_zeros(pool_idle_mask);
+	}
+
+	if (wakeup >= 0) {
+		pool_idle_mask &= ~BIT(wakeup);
+	}
+
+	k_spin_unlock(&pool_lock, key);
+
+	if (wakeup >= 0) {
+		k_sem_give(&pool_thread_sems[wakeup]);
+	}
+
+	if (backpressure_on) {
+		nrf_rpc_os_thread_pool_backpressure_hook(true);
+	}
+}
+
+__weak void nrf_rpc_os_thread_pool_backpressure_hook(bool active)
+{
+	ARG_UNUSED(active);
+}
+
+#if CONFIG_NRF_RPC_THREAD_POOL_STATS
+void nrf_rpc_os_thread_pool_stats_get(struct nrf_rpc_os_thread_pool_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&pool_lock);
+
+	*stats = pool_stats;
+	stats->queued = pool_queued;
+	stats->busy = pool_busy;
+
+	k_spin_unlock(&pool_lock, key);
+}
+
+void nrf_rpc_os_thread_pool_stats_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&pool_lock);
+
+	memset(&pool_stats, 0, sizeof(pool_stats));
+
+	k_spin_unlock(&pool_lock, key);
+}
+#endif /* CONFIG_NRF_RPC_THREAD_POOL_STATS */
+
+#else /* CONFIG_NRF_RPC_THREAD_POOL_WORK_STEALING */
+
 static void thread_pool_entry(void *p1, void *p2, void *p3)
 {
 	struct pool_start_msg msg;
@@ -56,6 +317,24 @@ static void thread_pool_entry(void *p1, void *p2, void *p3)
 	} while (1);
 }
 
+static void thread_pool_init(void)
+{
+	k_msgq_init(&pool_start_msg, (char *)pool_start_msg_buf,
+		    sizeof(struct pool_start_msg),
+		    ARRAY_SIZE(pool_start_msg_buf));
+}
+
+void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len)
+{
+	struct pool_start_msg msg;
+
+	msg.data = data;
+	msg.len = len;
+	k_msgq_put(&pool_start_msg, &msg, K_FOREVER);
+}
+
+#endif /* CONFIG_NRF_RPC_THREAD_POOL_WORK_STEALING */
+
 int nrf_rpc_os_init(nrf_rpc_os_work_t callback)
 {
 	int err;
@@ -73,15 +352,13 @@ int nrf_rpc_os_init(nrf_rpc_os_work_t callback)
 
 	atomic_set(&context_mask, CONTEXT_MASK_INIT_VALUE);
 
-	k_msgq_init(&pool_start_msg, (char *)pool_start_msg_buf,
-		    sizeof(struct pool_start_msg),
-		    ARRAY_SIZE(pool_start_msg_buf));
+	thread_pool_init();
 
 	for (i = 0; i < CONFIG_NRF_RPC_THREAD_POOL_SIZE; i++) {
 		k_thread_create(&pool_threads[i], pool_stacks[i],
 			K_THREAD_STACK_SIZEOF(pool_stacks[i]),
 			thread_pool_entry,
-			NULL, NULL, NULL,
+			(void *)(uintptr_t)i, NULL, NULL,
 			CONFIG_NRF_RPC_THREAD_PRIORITY, 0, K_NO_WAIT);
 		k_thread_name_set(&pool_threads[i], "rpc");
 	}
@@ -89,15 +366,6 @@ int nrf_rpc_os_init(nrf_rpc_os_work_t callback)
 	return 0;
 }
 
-void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len)
-{
-	struct pool_start_msg msg;
-
-	msg.data = data;
-	msg.len = len;
-	k_msgq_put(&pool_start_msg, &msg, K_FOREVER);
-}
-
 void nrf_rpc_os_msg_set(struct nrf_rpc_os_msg *msg, const uint8_t *data,
 			size_t len)
 {
@@ -15,9 +15,45 @@
 #include <zephyr/sys/byteorder.h>
 #include <zephyr/sys/crc.h>
 
+#include <string.h>
+
 LOG_MODULE_REGISTER(nrf_rpc_uart, CONFIG_NRF_RPC_TR_LOG_LEVEL);
 
 #define CRC_SIZE sizeof(uint16_t)
+#define SEQ_SIZE sizeof(uint8_t)
+
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+#define WINDOW_SIZE    CONFIG_NRF_RPC_UART_WINDOW_SIZE
+#define FLAGS_SIZE     sizeof(uint8_t)
+#define ACK_FRAME_SIZE (SEQ_SIZE + CRC_SIZE)
+#define FRAME_HEADER_SIZE (FLAGS_SIZE + SEQ_SIZE)
+
+/* Set in the frames sent after the transport is initialized, until the first ack is received. */
+#define FRAME_FLAG_SYN BIT(0)
+
+BUILD_ASSERT(IS_POWER_OF_TWO(WINDOW_SIZE), "Window size must be a power of two");
+#else
+#define ACK_FRAME_SIZE CRC_SIZE
+#define FRAME_HEADER_SIZE 0
+#endif
+
+/* Size of the buffer used to collect delimiters, escape sequences and short runs of bytes. */
+#define TX_STAGING_SIZE 32
+/* Runs of bytes that do not need escaping and are longer than this are transmitted in place. */
+#define TX_COPY_THRESHOLD 8
+
+#if CONFIG_NRF_RPC_UART_TX_BUF_POOL
+#define TX_BUF_SIZE ROUND_UP(CONFIG_NRF_RPC_UART_MAX_PACKET_SIZE, sizeof(void *))
+
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+/*
+ * Buffers are kept in the window of the instance until the slots are reused, so each instance
+ * has its own pool.
+ */
+BUILD_ASSERT(CONFIG_NRF_RPC_UART_TX_BUF_POOL_SIZE > CONFIG_NRF_RPC_UART_WINDOW_SIZE,
+	     "TX buffer pool must be larger than the sliding window");
+#endif
+#endif
 
 enum {
 	HDLC_CHAR_ESCAPE = 0x7d,
@@ -54,6 +90,31 @@ struct hdlc_decode_ctx {
 	uint16_t capacity;
 };
 
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+struct tx_window_slot {
+	const uint8_t *data;
+	size_t len;
+};
+
+struct tx_window {
+	struct tx_window_slot slots[WINDOW_SIZE];
+	/* Sequence number of the oldest unacknowledged frame. */
+	uint8_t base;
+	/* Sequence number of the next new frame. */
+	uint8_t next;
+	/* Number of retransmissions of the oldest unacknowledged frame. */
+	uint8_t attempts;
+	/* No frame has been acknowledged since the transport was initialized. */
+	bool syn;
+	/* Frames were dropped after all transmission attempts. */
+	bool dropped;
+	struct k_spinlock lock;
+	/* Counts free slots in the window. */
+	struct k_sem free_sem;
+	struct k_work_delayable retx_work;
+};
+#endif /* CONFIG_NRF_RPC_UART_RELIABLE_WINDOW */
+
 struct nrf_rpc_uart {
 	const struct device *uart;
 	nrf_rpc_tr_receive_handler_t receive_callback;
@@ -72,11 +133,11 @@ struct nrf_rpc_uart {
 
 	/* HDLC ack decoding state */
 	struct hdlc_decode_ctx rx_ack_ctx;
-	uint8_t rx_ack[CRC_SIZE];
+	uint8_t rx_ack[ACK_FRAME_SIZE];
 
 	/* HDLC packet decoding state */
 	struct hdlc_decode_ctx rx_pkt_ctx;
-	uint8_t rx_pkt[CONFIG_NRF_RPC_UART_MAX_PACKET_SIZE];
+	uint8_t rx_pkt[FRAME_HEADER_SIZE + CONFIG_NRF_RPC_UART_MAX_PACKET_SIZE + CRC_SIZE];
 
 	/* Ack waiting semaphore */
 	struct k_sem ack_sem;
@@ -86,6 +147,36 @@ struct nrf_rpc_uart {
 
 	/* TX lock */
 	struct k_mutex tx_lock;
+
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+	struct tx_window tx_win;
+	uint8_t rx_seq_expected;
+	bool rx_seq_sync;
+	/* The last received frame had the SYN flag set. */
+	bool rx_syn;
+#endif
+
+#if CONFIG_NRF_RPC_UART_ASYNC_API
+	/* RX DMA buffers used alternately by the UART driver */
+	uint8_t rx_dma_buf[2][CONFIG_NRF_RPC_UART_RX_DMA_BUF_SIZE];
+	uint8_t rx_dma_buf_next;
+
+	/*
+	 * TX DMA buffers for the parts of the frame that are not transmitted in place. One buffer
+	 * is filled while the other one is transmitted.
+	 */
+	uint8_t tx_staging[2][TX_STAGING_SIZE];
+	uint8_t tx_staging_idx;
+	size_t tx_staging_len;
+	bool tx_busy;
+	struct k_sem tx_done_sem;
+#endif
+
+#if CONFIG_NRF_RPC_UART_TX_BUF_POOL
+	struct k_mem_slab tx_buf_pool;
+	uint8_t tx_buf_pool_mem[CONFIG_NRF_RPC_UART_TX_BUF_POOL_SIZE][TX_BUF_SIZE]
+		__aligned(sizeof(void *));
+#endif
 };
 
 static void log_hexdump_dbg(const uint8_t *data, size_t length, const char *fmt, ...)
@@ -102,15 +193,34 @@ static void log_hexdump_dbg(const uint8_t *data, size_t length, const char *fmt,
 	}
 }
 
-static void send_byte(const struct device *dev, uint8_t byte);
+static int frame_begin(struct nrf_rpc_uart *uart_tr);
+static int frame_append(struct nrf_rpc_uart *uart_tr, const uint8_t *data, size_t len);
+static int frame_end(struct nrf_rpc_uart *uart_tr);
+
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+static void window_ack(struct nrf_rpc_uart *uart_tr, uint8_t seq);
+#endif
 
 static void ack_rx(struct nrf_rpc_uart *uart_tr)
 {
-	if (!IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE) || uart_tr->rx_ack_ctx.len != CRC_SIZE) {
+	if (!IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE) ||
+	    uart_tr->rx_ack_ctx.len != ACK_FRAME_SIZE) {
 		log_hexdump_dbg(uart_tr->rx_ack, uart_tr->rx_ack_ctx.len, ">>> RX invalid frame");
 		return;
 	}
 
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+	uint8_t seq = uart_tr->rx_ack[0];
+	uint16_t crc_val = sys_get_le16(&uart_tr->rx_ack[SEQ_SIZE]);
+
+	if (crc_val != crc16_ccitt(0xffff, &seq, SEQ_SIZE)) {
+		LOG_WRN("Invalid ack CRC");
+		return;
+	}
+
+	LOG_DBG(">>> RX ack %u", seq);
+	window_ack(uart_tr, seq);
+#else
 	uint16_t rx_ack = sys_get_le16(uart_tr->rx_ack);
 
 	LOG_DBG(">>> RX ack %04x", rx_ack);
@@ -121,33 +231,40 @@ static void ack_rx(struct nrf_rpc_uart *uart_tr)
 	}
 
 	k_sem_give(&uart_tr->ack_sem);
+#endif
 }
 
 static void ack_tx(struct nrf_rpc_uart *uart_tr, uint16_t ack_pld)
 {
-	uint8_t ack[2];
+	uint8_t ack[ACK_FRAME_SIZE];
 
 	if (!IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE)) {
 		return;
 	}
 
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+	/* Cumulative ack: sequence number of the last frame received in order. */
+	ack[0] = (uint8_t)ack_pld;
+	sys_put_le16(crc16_ccitt(0xffff, ack, SEQ_SIZE), &ack[SEQ_SIZE]);
+#else
 	sys_put_le16(ack_pld, ack);
+#endif
+
 	k_mutex_lock(&uart_tr->ack_tx_lock, K_FOREVER);
 	LOG_DBG("<<< TX ack %04x", ack_pld);
 
-	uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
-
-	send_byte(uart_tr->uart, ack[0]);
-	send_byte(uart_tr->uart, ack[1]);
-
-	uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
+	/* A lost ack is recovered by the retransmission of the packet. */
+	if (frame_begin(uart_tr) == 0 && frame_append(uart_tr, ack, sizeof(ack)) == 0) {
+		(void)frame_end(uart_tr);
+	}
 
 	k_mutex_unlock(&uart_tr->ack_tx_lock);
 }
 
+#if !CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
 static uint16_t tx_flip(struct nrf_rpc_uart *uart_tr, uint16_t crc_val)
 {
-	if (!IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE)) {
+	if (!IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE_STOP_AND_WAIT)) {
 		return crc_val;
 	}
 
@@ -166,7 +283,7 @@ static bool rx_flip_check(struct nrf_rpc_uart *uart_tr, uint16_t crc_val)
 {
 	uint16_t last_rx_crc;
 
-	if (!IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE)) {
+	if (!IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE_STOP_AND_WAIT)) {
 		return false;
 	}
 
@@ -180,10 +297,11 @@ static bool rx_flip_check(struct nrf_rpc_uart *uart_tr, uint16_t crc_val)
 
 	return true;
 }
+#endif /* !CONFIG_NRF_RPC_UART_RELIABLE_WINDOW */
 
 static bool crc_compare(uint16_t rx_crc, uint16_t calc_crc)
 {
-	if (IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE)) {
+	if (IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE_STOP_AND_WAIT)) {
 		return (rx_crc & 0x7fffu) == (calc_crc & 0x7fffu);
 	}
 
@@ -229,53 +347,156 @@ static void hdlc_decode_byte(struct hdlc_decode_ctx *ctx, uint8_t *out, uint8_t
 	out[ctx->len++] = in;
 }
 
+static bool hdlc_is_special(uint8_t byte)
+{
+	return byte == HDLC_CHAR_DELIMITER || byte == HDLC_CHAR_ESCAPE;
+}
+
+/*
+ * Decodes the input until a complete frame is found or the whole input is consumed.
+ * Returns the number of consumed bytes.
+ */
+static size_t hdlc_decode(struct hdlc_decode_ctx *ctx, uint8_t *out, const uint8_t *in, size_t len)
+{
+	size_t i = 0;
+
+	while (i < len) {
+		if (ctx->state == HDLC_STATE_UNSYNC) {
+			const uint8_t *delimiter = memchr(&in[i], HDLC_CHAR_DELIMITER, len - i);
+
+			if (delimiter == NULL) {
+				return len;
+			}
+
+			i = delimiter - in;
+		} else if (ctx->state == HDLC_STATE_FRAME) {
+			/* Copy the run of bytes that do not need unescaping at once. */
+			size_t run = 0;
+
+			while (i + run < len && !hdlc_is_special(in[i + run])) {
+				run++;
+			}
+
+			if (run > 0) {
+				if (ctx->len + run > ctx->capacity) {
+					/* Ignore too long frame */
+					ctx->state = HDLC_STATE_UNSYNC;
+				} else {
+					memcpy(&out[ctx->len], &in[i], run);
+					ctx->len += run;
+				}
+
+				i += run;
+				continue;
+			}
+		}
+
+		hdlc_decode_byte(ctx, out, in[i++]);
+
+		if (ctx->state == HDLC_STATE_FRAME_FOUND) {
+			break;
+		}
+	}
+
+	return i;
+}
+
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+static bool rx_seq_check(struct nrf_rpc_uart *uart_tr, uint8_t flags, uint8_t seq)
+{
+	uint8_t expected = uart_tr->rx_seq_expected;
+	/*
+	 * The first frame with the SYN flag restarts the sequence, as the peer has initialized its
+	 * transport. The following SYN frames are checked against the window, as they are sent
+	 * before the peer receives the first ack.
+	 */
+	bool reset = (flags & FRAME_FLAG_SYN) && !uart_tr->rx_syn;
+
+	if (uart_tr->rx_seq_sync && reset) {
+		LOG_INF("Peer initialized, resynchronized at packet %u", seq);
+	} else if (uart_tr->rx_seq_sync && seq != expected) {
+		if ((uint8_t)(expected - 1 - seq) < WINDOW_SIZE) {
+			/* Retransmitted frame, so the previous ack might have been lost. */
+			LOG_WRN("Duplicate packet %u", seq);
+			ack_tx(uart_tr, (uint8_t)(expected - 1));
+			return false;
+		}
+
+		if ((uint8_t)(seq - expected) < WINDOW_SIZE) {
+			/* A preceding frame was lost. Wait until the sender retransmits it. */
+			LOG_WRN("Out of order packet %u, expected %u", seq, expected);
+			return false;
+		}
+
+		LOG_INF("Resynchronized at packet %u", seq);
+	}
+
+	uart_tr->rx_syn = (flags & FRAME_FLAG_SYN);
+	uart_tr->rx_seq_sync = true;
+	uart_tr->rx_seq_expected = seq + 1;
+	ack_tx(uart_tr, seq);
+
+	return true;
+}
+#endif /* CONFIG_NRF_RPC_UART_RELIABLE_WINDOW */
+
+static void rx_packet_handle(struct nrf_rpc_uart *uart_tr)
+{
+	const uint8_t *packet = uart_tr->rx_pkt;
+	size_t len = uart_tr->rx_pkt_ctx.len - CRC_SIZE;
+	uint16_t crc_received = sys_get_le16(packet + len);
+	uint16_t crc_calculated = crc16_ccitt(0xffff, packet, len);
+
+	log_hexdump_dbg(packet, len, ">>> RX packet %04x", crc_received);
+
+	if (!crc_compare(crc_received, crc_calculated)) {
+		LOG_ERR("Invalid packet CRC: calculated %04x but received %04x", crc_calculated,
+			crc_received);
+		return;
+	}
+
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+	if (!rx_seq_check(uart_tr, packet[0], packet[FLAGS_SIZE])) {
+		return;
+	}
+
+	packet += FRAME_HEADER_SIZE;
+	len -= FRAME_HEADER_SIZE;
+#else
+	ack_tx(uart_tr, crc_received);
+
+	if (rx_flip_check(uart_tr, crc_received)) {
+		LOG_WRN("Duplicate packet %04x", crc_received);
+		return;
+	}
+#endif
+
+	uart_tr->receive_callback(uart_tr->transport, packet, len, uart_tr->receive_ctx);
+}
+
 static void work_handler(struct k_work *work)
 {
 	struct nrf_rpc_uart *uart_tr = CONTAINER_OF(work, struct nrf_rpc_uart, rx_work);
 	uint8_t *data;
 	size_t len;
 	int ret;
-	uint16_t crc_received = 0;
-	uint16_t crc_calculated = 0;
 
 	while (!ring_buf_is_empty(&uart_tr->rx_ringbuf)) {
 		len = ring_buf_get_claim(&uart_tr->rx_ringbuf, &data,
 					 CONFIG_NRF_RPC_UART_MAX_PACKET_SIZE);
-		for (size_t i = 0; i < len; i++) {
-			hdlc_decode_byte(&uart_tr->rx_pkt_ctx, uart_tr->rx_pkt, data[i]);
+		for (size_t i = 0; i < len;) {
+			i += hdlc_decode(&uart_tr->rx_pkt_ctx, uart_tr->rx_pkt, &data[i], len - i);
 
 			if (uart_tr->rx_pkt_ctx.state != HDLC_STATE_FRAME_FOUND) {
 				continue;
 			}
 
 			/* ACKs are already handled in ISR, so process only normal packets here */
-			if (uart_tr->rx_pkt_ctx.len <= CRC_SIZE) {
+			if (uart_tr->rx_pkt_ctx.len <= ACK_FRAME_SIZE) {
 				continue;
 			}
 
-			uart_tr->rx_pkt_ctx.len -= CRC_SIZE;
-			crc_received = sys_get_le16(uart_tr->rx_pkt + uart_tr->rx_pkt_ctx.len);
-			crc_calculated =
-				crc16_ccitt(0xffff, uart_tr->rx_pkt, uart_tr->rx_pkt_ctx.len);
-
-			log_hexdump_dbg(uart_tr->rx_pkt, uart_tr->rx_pkt_ctx.len,
-					">>> RX packet %04x", crc_received);
-
-			if (!crc_compare(crc_received, crc_calculated)) {
-				LOG_ERR("Invalid packet CRC: calculated %04x but received %04x",
-					crc_calculated, crc_received);
-				continue;
-			}
-
-			ack_tx(uart_tr, crc_received);
-
-			if (rx_flip_check(uart_tr, crc_received)) {
-				LOG_WRN("Duplicate packet %04x", crc_received);
-			} else {
-				uart_tr->receive_callback(uart_tr->transport, uart_tr->rx_pkt,
-							  uart_tr->rx_pkt_ctx.len,
-							  uart_tr->receive_ctx);
-			}
+			rx_packet_handle(uart_tr);
 		}
 
 		ret = ring_buf_get_finish(&uart_tr->rx_ringbuf, len);
@@ -287,8 +508,8 @@ static void work_handler(struct k_work *work)
 
 static void decode_ack(struct nrf_rpc_uart *inst, const uint8_t *in, size_t len)
 {
-	for (size_t i = 0; i < len; i++) {
-		hdlc_decode_byte(&inst->rx_ack_ctx, inst->rx_ack, in[i]);
+	for (size_t i = 0; i < len;) {
+		i += hdlc_decode(&inst->rx_ack_ctx, inst->rx_ack, &in[i], len - i);
 
 		if (inst->rx_ack_ctx.state == HDLC_STATE_FRAME_FOUND) {
 			ack_rx(inst);
@@ -296,6 +517,193 @@ static void decode_ack(struct nrf_rpc_uart *inst, const uint8_t *in, size_t len)
 	}
 }
 
+#if CONFIG_NRF_RPC_UART_ASYNC_API
+static void rx_dma_enable(struct nrf_rpc_uart *uart_tr)
+{
+	int ret;
+
+	uart_tr->rx_dma_buf_next = 1;
+	ret = uart_rx_enable(uart_tr->uart, uart_tr->rx_dma_buf[0], sizeof(uart_tr->rx_dma_buf[0]),
+			     CONFIG_NRF_RPC_UART_RX_TIMEOUT);
+	if (ret < 0) {
+		LOG_ERR("Failed to enable UART RX: %d", ret);
+	}
+}
+
+static void rx_dma_data(struct nrf_rpc_uart *uart_tr, const uint8_t *data, size_t len)
+{
+	uint32_t written;
+
+	decode_ack(uart_tr, data, len);
+
+	written = ring_buf_put(&uart_tr->rx_ringbuf, data, len);
+	if (written < len) {
+		LOG_WRN("RX ring buffer full");
+	}
+
+	if (written > 0) {
+		k_work_submit_to_queue(&uart_tr->rx_workq, &uart_tr->rx_work);
+	}
+}
+
+static void uart_async_cb(const struct device *dev, struct uart_event *evt, void *user_data)
+{
+	struct nrf_rpc_uart *uart_tr = user_data;
+	uint8_t *buf;
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+		k_sem_give(&uart_tr->tx_done_sem);
+		break;
+	case UART_RX_RDY:
+		rx_dma_data(uart_tr, evt->data.rx.buf + evt->data.rx.offset, evt->data.rx.len);
+		break;
+	case UART_RX_BUF_REQUEST:
+		buf = uart_tr->rx_dma_buf[uart_tr->rx_dma_buf_next];
+		uart_tr->rx_dma_buf_next ^= 1;
+		(void)uart_rx_buf_rsp(dev, buf, sizeof(uart_tr->rx_dma_buf[0]));
+		break;
+	case UART_RX_STOPPED:
+		LOG_WRN("UART RX stopped: %d", evt->data.rx_stop.reason);
+		break;
+	case UART_RX_DISABLED:
+		/* Reception is disabled after an error, restart it. */
+		rx_dma_enable(uart_tr);
+		break;
+	default:
+		break;
+	}
+}
+
+static void tx_wait(struct nrf_rpc_uart *uart_tr)
+{
+	if (uart_tr->tx_busy) {
+		k_sem_take(&uart_tr->tx_done_sem, K_FOREVER);
+		uart_tr->tx_busy = false;
+	}
+}
+
+/*
+ * Starts the transmission of a chunk once the previous chunk is transmitted. No chunk is in
+ * flight when the transmission fails, so the frame data may be released.
+ */
+static int tx_chunk(struct nrf_rpc_uart *uart_tr, const uint8_t *data, size_t len)
+{
+	int ret;
+
+	tx_wait(uart_tr);
+
+	ret = uart_tx(uart_tr->uart, data, len, SYS_FOREVER_US);
+	if (ret < 0) {
+		LOG_ERR("Failed to transmit frame: %d", ret);
+		return ret;
+	}
+
+	uart_tr->tx_busy = true;
+
+	return 0;
+}
+
+static int tx_staging_flush(struct nrf_rpc_uart *uart_tr)
+{
+	int ret = 0;
+
+	if (uart_tr->tx_staging_len > 0) {
+		ret = tx_chunk(uart_tr, uart_tr->tx_staging[uart_tr->tx_staging_idx],
+			       uart_tr->tx_staging_len);
+		uart_tr->tx_staging_idx ^= 1;
+		uart_tr->tx_staging_len = 0;
+	}
+
+	return ret;
+}
+
+static int tx_staging_put(struct nrf_rpc_uart *uart_tr, uint8_t byte)
+{
+	int ret;
+
+	if (uart_tr->tx_staging_len == TX_STAGING_SIZE) {
+		ret = tx_staging_flush(uart_tr);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	uart_tr->tx_staging[uart_tr->tx_staging_idx][uart_tr->tx_staging_len++] = byte;
+
+	return 0;
+}
+
+static int frame_begin(struct nrf_rpc_uart *uart_tr)
+{
+	uart_tr->tx_staging_len = 0;
+
+	return tx_staging_put(uart_tr, HDLC_CHAR_DELIMITER);
+}
+
+/*
+ * The frame is transmitted as a sequence of chunks. Long runs of bytes that do not need escaping
+ * are transmitted directly from the packet buffer, so the packet is never copied. Delimiters,
+ * escape sequences and short runs are collected in the staging buffers, while the previous chunk
+ * is transmitted. If a chunk cannot be transmitted, the rest of the frame is not sent, and the
+ * receiver drops the incomplete frame.
+ */
+static int frame_append(struct nrf_rpc_uart *uart_tr, const uint8_t *data, size_t len)
+{
+	int ret = 0;
+
+	while (len > 0 && ret == 0) {
+		size_t run = 0;
+
+		while (run < len && !hdlc_is_special(data[run])) {
+			run++;
+		}
+
+		if (run > TX_COPY_THRESHOLD) {
+			ret = tx_staging_flush(uart_tr);
+			if (ret == 0) {
+				ret = tx_chunk(uart_tr, data, run);
+			}
+		} else {
+			for (size_t i = 0; i < run && ret == 0; i++) {
+				ret = tx_staging_put(uart_tr, data[i]);
+			}
+		}
+
+		data += run;
+		len -= run;
+
+		if (len > 0 && ret == 0) {
+			ret = tx_staging_put(uart_tr, HDLC_CHAR_ESCAPE);
+			if (ret == 0) {
+				ret = tx_staging_put(uart_tr, data[0] ^ 0x20);
+			}
+			data++;
+			len--;
+		}
+	}
+
+	return ret;
+}
+
+static int frame_end(struct nrf_rpc_uart *uart_tr)
+{
+	int ret;
+
+	ret = tx_staging_put(uart_tr, HDLC_CHAR_DELIMITER);
+	if (ret == 0) {
+		ret = tx_staging_flush(uart_tr);
+	}
+
+	/* The frame data may be released once the frame is sent. */
+	tx_wait(uart_tr);
+
+	return ret;
+}
+
+#else /* CONFIG_NRF_RPC_UART_ASYNC_API */
+
 static void serial_cb(const struct device *uart, void *user_data)
 {
 	struct nrf_rpc_uart *uart_tr = user_data;
@@ -332,6 +740,198 @@ static void serial_cb(const struct device *uart, void *user_data)
 	}
 }
 
+static void send_byte(const struct device *dev, uint8_t byte)
+{
+	if (hdlc_is_special(byte)) {
+		uart_poll_out(dev, HDLC_CHAR_ESCAPE);
+		byte ^= 0x20;
+	}
+
+	uart_poll_out(dev, byte);
+}
+
+static int frame_begin(struct nrf_rpc_uart *uart_tr)
+{
+	uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
+
+	return 0;
+}
+
+static int frame_append(struct nrf_rpc_uart *uart_tr, const uint8_t *data, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		send_byte(uart_tr->uart, data[i]);
+	}
+
+	return 0;
+}
+
+static int frame_end(struct nrf_rpc_uart *uart_tr)
+{
+	uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
+
+	return 0;
+}
+
+#endif /* CONFIG_NRF_RPC_UART_ASYNC_API */
+
+static void tx_buf_release(struct nrf_rpc_uart *uart_tr, const uint8_t *buf)
+{
+#if CONFIG_NRF_RPC_UART_TX_BUF_POOL
+	if (buf != NULL) {
+		k_mem_slab_free(&uart_tr->tx_buf_pool, (void *)buf);
+	}
+#else
+	ARG_UNUSED(uart_tr);
+	k_free((void *)buf);
+#endif
+}
+
+/* Transmits the frame made of the packet and its CRC, preceded by the optional header. */
+static int frame_tx(struct nrf_rpc_uart *uart_tr, const uint8_t *header, size_t header_len,
+		    const uint8_t *data, size_t len, const uint8_t *crc)
+{
+	int ret;
+
+	ret = frame_begin(uart_tr);
+	if (ret == 0) {
+		ret = frame_append(uart_tr, header, header_len);
+	}
+	if (ret == 0) {
+		ret = frame_append(uart_tr, data, len);
+	}
+	if (ret == 0) {
+		ret = frame_append(uart_tr, crc, CRC_SIZE);
+	}
+	if (ret == 0) {
+		ret = frame_end(uart_tr);
+	}
+
+	return ret;
+}
+
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+static int window_frame_tx(struct nrf_rpc_uart *uart_tr, uint8_t seq)
+{
+	const struct tx_window_slot *slot = &uart_tr->tx_win.slots[seq & (WINDOW_SIZE - 1)];
+	uint8_t header[FRAME_HEADER_SIZE];
+	uint8_t crc[CRC_SIZE];
+	uint16_t crc_val;
+	int ret;
+
+	header[0] = uart_tr->tx_win.syn ? FRAME_FLAG_SYN : 0;
+	header[FLAGS_SIZE] = seq;
+
+	crc_val = crc16_ccitt(0xffff, header, sizeof(header));
+	crc_val = crc16_ccitt(crc_val, slot->data, slot->len);
+	sys_put_le16(crc_val, crc);
+	log_hexdump_dbg(slot->data, slot->len, "<<< TX packet %u", seq);
+
+	k_mutex_lock(&uart_tr->ack_tx_lock, K_FOREVER);
+	ret = frame_tx(uart_tr, header, sizeof(header), slot->data, slot->len, crc);
+	k_mutex_unlock(&uart_tr->ack_tx_lock);
+
+	return ret;
+}
+
+/* Called from the UART ISR when a cumulative ack is received. */
+static void window_ack(struct nrf_rpc_uart *uart_tr, uint8_t seq)
+{
+	struct tx_window *win = &uart_tr->tx_win;
+	k_spinlock_key_t key;
+	uint8_t in_flight;
+	uint8_t acked;
+	bool empty;
+
+	key = k_spin_lock(&win->lock);
+
+	in_flight = win->next - win->base;
+	acked = seq + 1 - win->base;
+
+	if (acked == 0 || acked > in_flight) {
+		k_spin_unlock(&win->lock, key);
+		LOG_DBG("Stale ack %u", seq);
+		return;
+	}
+
+	win->base += acked;
+	win->attempts = 0;
+	win->syn = false;
+	empty = (win->base == win->next);
+
+	k_spin_unlock(&win->lock, key);
+
+	/* Restart the retransmission timer for the oldest frame that is still in flight. */
+	if (empty) {
+		k_work_cancel_delayable(&win->retx_work);
+	} else {
+		k_work_reschedule(&win->retx_work, K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME));
+	}
+
+	/*
+	 * Buffers of acknowledged frames are freed when their slots are reused, so that the heap
+	 * is not accessed from the ISR.
+	 */
+	while (acked-- > 0) {
+		k_sem_give(&win->free_sem);
+	}
+}
+
+static void retx_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct nrf_rpc_uart *uart_tr = CONTAINER_OF(dwork, struct nrf_rpc_uart, tx_win.retx_work);
+	struct tx_window *win = &uart_tr->tx_win;
+	k_spinlock_key_t key;
+	uint8_t base;
+	uint8_t next;
+	bool give_up;
+
+	/* Prevent reuse of the window slots while they are retransmitted. */
+	k_mutex_lock(&uart_tr->tx_lock, K_FOREVER);
+
+	key = k_spin_lock(&win->lock);
+	base = win->base;
+	next = win->next;
+	give_up = (base != next) && (++win->attempts >= CONFIG_NRF_RPC_UART_TX_ATTEMPTS);
+
+	if (give_up) {
+		/*
+		 * Skip a window of sequence numbers so that the receiver resynchronizes on the
+		 * next frame instead of waiting for the dropped ones.
+		 */
+		win->next += WINDOW_SIZE;
+		win->base = win->next;
+		win->attempts = 0;
+		win->dropped = true;
+	}
+
+	k_spin_unlock(&win->lock, key);
+
+	if (give_up) {
+		LOG_ERR("No ack for packets %u-%u, dropping and failing the next send", base,
+			(uint8_t)(next - 1));
+
+		for (uint8_t seq = base; seq != next; seq++) {
+			k_sem_give(&win->free_sem);
+		}
+	} else if (base != next) {
+		LOG_WRN("Ack timeout, retransmitting packets %u-%u", base, (uint8_t)(next - 1));
+
+		/* The following frames are not sent if one fails, they are retried on timeout. */
+		for (uint8_t seq = base; seq != next; seq++) {
+			if (window_frame_tx(uart_tr, seq) < 0) {
+				break;
+			}
+		}
+
+		k_work_reschedule(&win->retx_work, K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME));
+	}
+
+	k_mutex_unlock(&uart_tr->tx_lock);
+}
+#endif /* CONFIG_NRF_RPC_UART_RELIABLE_WINDOW */
+
 static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t receive_cb,
 		void *context)
 {
@@ -357,6 +957,22 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 		return -NRF_ENOENT;
 	}
 
+#if CONFIG_NRF_RPC_UART_ASYNC_API
+	/* configure callback to receive data and TX completion events */
+	int ret = uart_callback_set(uart_tr->uart, uart_async_cb, uart_tr);
+
+	if (ret < 0) {
+		if (ret == -ENOTSUP) {
+			LOG_ERR("Asynchronous UART API support not enabled\n");
+		} else {
+			LOG_ERR("Error setting UART callback: %d\n", ret);
+		}
+		return 0;
+	}
+
+	k_sem_init(&uart_tr->tx_done_sem, 0, 1);
+	uart_tr->tx_busy = false;
+#else
 	/* configure interrupt and callback to receive data */
 	int ret = uart_irq_callback_user_data_set(uart_tr->uart, serial_cb, uart_tr);
 
@@ -370,9 +986,15 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 		}
 		return 0;
 	}
+#endif
 
 	k_mutex_init(&uart_tr->tx_lock);
 
+#if CONFIG_NRF_RPC_UART_TX_BUF_POOL
+	k_mem_slab_init(&uart_tr->tx_buf_pool, uart_tr->tx_buf_pool_mem, TX_BUF_SIZE,
+			CONFIG_NRF_RPC_UART_TX_BUF_POOL_SIZE);
+#endif
+
 	if (IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE)) {
 		k_mutex_init(&uart_tr->ack_tx_lock);
 		k_sem_init(&uart_tr->ack_sem, 0, 1);
@@ -380,6 +1002,15 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 		uart_tr->flips.rx_flip_any = 1;
 	}
 
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+	k_sem_init(&uart_tr->tx_win.free_sem, WINDOW_SIZE, WINDOW_SIZE);
+	k_work_init_delayable(&uart_tr->tx_win.retx_work, retx_work_handler);
+	uart_tr->tx_win.syn = true;
+	uart_tr->tx_win.dropped = false;
+	uart_tr->rx_seq_sync = false;
+	uart_tr->rx_syn = false;
+#endif
+
 	k_work_queue_init(&uart_tr->rx_workq);
 	k_work_queue_start(&uart_tr->rx_workq, uart_tr->rx_workq_stack,
 			   K_THREAD_STACK_SIZEOF(uart_tr->rx_workq_stack), K_PRIO_PREEMPT(0),
@@ -392,27 +1023,81 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 	uart_tr->rx_pkt_ctx.capacity = sizeof(uart_tr->rx_pkt);
 	uart_tr->rx_ack_ctx.state = HDLC_STATE_UNSYNC;
 	uart_tr->rx_ack_ctx.capacity = sizeof(uart_tr->rx_ack);
+#if CONFIG_NRF_RPC_UART_ASYNC_API
+	rx_dma_enable(uart_tr);
+#else
 	uart_irq_rx_enable(uart_tr->uart);
+#endif
 	nrf_rpc_uart_initialized_hook(uart_tr->uart);
 
 	return 0;
 }
 
-static void send_byte(const struct device *dev, uint8_t byte)
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
 {
-	if (byte == HDLC_CHAR_DELIMITER || byte == HDLC_CHAR_ESCAPE) {
-		uart_poll_out(dev, HDLC_CHAR_ESCAPE);
-		byte ^= 0x20;
+	struct nrf_rpc_uart *uart_tr = transport->ctx;
+	struct tx_window *win = &uart_tr->tx_win;
+	struct tx_window_slot *slot;
+	k_spinlock_key_t key;
+	bool dropped;
+	uint8_t seq;
+	bool first;
+
+	/*
+	 * Wait for a free slot in the window. The wait is bounded as the window is emptied
+	 * when the peer does not acknowledge the frames after all attempts.
+	 */
+	k_sem_take(&win->free_sem, K_FOREVER);
+	k_mutex_lock(&uart_tr->tx_lock, K_FOREVER);
+
+	key = k_spin_lock(&win->lock);
+	dropped = win->dropped;
+	win->dropped = false;
+
+	if (dropped) {
+		k_spin_unlock(&win->lock, key);
+		k_sem_give(&win->free_sem);
+		k_mutex_unlock(&uart_tr->tx_lock);
+
+		/*
+		 * The packets are acknowledged after send() returns, so the loss of the previous
+		 * packets is reported to the caller of the following send().
+		 */
+		tx_buf_release(uart_tr, data);
+
+		return -EPROTO;
 	}
 
-	uart_poll_out(dev, byte);
+	seq = win->next++;
+	first = (win->base == seq);
+	k_spin_unlock(&win->lock, key);
+
+	slot = &win->slots[seq & (WINDOW_SIZE - 1)];
+	tx_buf_release(uart_tr, slot->data);
+	slot->data = data;
+	slot->len = length;
+
+	if (window_frame_tx(uart_tr, seq) < 0) {
+		/* The frame is kept in the window, so retransmit it instead of failing. */
+		k_work_reschedule(&win->retx_work, K_NO_WAIT);
+	} else if (first) {
+		k_work_reschedule(&win->retx_work, K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME));
+	}
+
+	k_mutex_unlock(&uart_tr->tx_lock);
+
+	return 0;
 }
 
+#else /* CONFIG_NRF_RPC_UART_RELIABLE_WINDOW */
+
 static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
 {
 	uint8_t crc[2];
 	uint16_t crc_val;
 	bool acked = true;
+	int ret;
 	struct nrf_rpc_uart *uart_tr = transport->ctx;
 
 	k_mutex_lock(&uart_tr->tx_lock, K_FOREVER);
@@ -421,7 +1106,7 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 	crc_val = tx_flip(uart_tr, crc_val);
 	log_hexdump_dbg(data, length, "<<< TX packet %04x", crc_val);
 
-#if CONFIG_NRF_RPC_UART_RELIABLE
+#if CONFIG_NRF_RPC_UART_RELIABLE_STOP_AND_WAIT
 	int attempts = 0;
 
 	uart_tr->ack_payload = crc_val;
@@ -431,22 +1116,17 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 		attempts++;
 		k_mutex_lock(&uart_tr->ack_tx_lock, K_FOREVER);
 		k_sem_reset(&uart_tr->ack_sem);
-#endif /* CONFIG_NRF_RPC_UART_RELIABLE */
-
-		uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
-
-		for (size_t i = 0; i < length; i++) {
-			send_byte(uart_tr->uart, data[i]);
-		}
+#endif /* CONFIG_NRF_RPC_UART_RELIABLE_STOP_AND_WAIT */
 
 		sys_put_le16(crc_val, crc);
-		send_byte(uart_tr->uart, crc[0]);
-		send_byte(uart_tr->uart, crc[1]);
-
-		uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
+		ret = frame_tx(uart_tr, NULL, 0, data, length, crc);
 
-#if CONFIG_NRF_RPC_UART_RELIABLE
+#if CONFIG_NRF_RPC_UART_RELIABLE_STOP_AND_WAIT
 		k_mutex_unlock(&uart_tr->ack_tx_lock);
+		if (ret < 0) {
+			break;
+		}
+
 		if (k_sem_take(&uart_tr->ack_sem, K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME)) ==
 		    0) {
 			acked = true;
@@ -455,20 +1135,34 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 			LOG_WRN("Ack timeout");
 		}
 	} while (!acked && attempts < CONFIG_NRF_RPC_UART_TX_ATTEMPTS);
-#endif /* CONFIG_NRF_RPC_UART_RELIABLE */
+#endif /* CONFIG_NRF_RPC_UART_RELIABLE_STOP_AND_WAIT */
 
-	k_free((void *)data);
+	tx_buf_release(uart_tr, data);
 
 	k_mutex_unlock(&uart_tr->tx_lock);
 
+	if (ret < 0) {
+		return ret;
+	}
+
 	return acked ? 0 : -EPROTO;
 }
+#endif /* CONFIG_NRF_RPC_UART_RELIABLE_WINDOW */
 
 static void *tx_buf_alloc(const struct nrf_rpc_tr *transport, size_t *size)
 {
 	void *data = NULL;
 
+#if CONFIG_NRF_RPC_UART_TX_BUF_POOL
+	struct nrf_rpc_uart *uart_tr = transport->ctx;
+
+	if (*size > CONFIG_NRF_RPC_UART_MAX_PACKET_SIZE ||
+	    k_mem_slab_alloc(&uart_tr->tx_buf_pool, &data, K_FOREVER) != 0) {
+		data = NULL;
+	}
+#else
 	data = k_malloc(*size);
+#endif
 	if (!data) {
 		LOG_ERR("Failed to allocate TX buffer");
 		goto error;
@@ -485,9 +1179,7 @@ error:
 
 static void tx_buf_free(const struct nrf_rpc_tr *transport, void *buf)
 {
-	ARG_UNUSED(transport);
-
-	k_free(buf);
+	tx_buf_release(transport->ctx, buf);
 }
 
 __weak void nrf_rpc_uart_initialized_hook(const struct device *uart_dev)
@@ -515,3 +1207,7 @@ const struct nrf_rpc_tr_api nrf_rpc_uart_service_api = {
 	};
 
 DT_FOREACH_STATUS_OKAY(nordic_nrf_uarte, NRF_RPC_UART_TRANSPORT_DEFINE);
+
+#ifdef CONFIG_UART_EMUL
+DT_FOREACH_STATUS_OKAY(zephyr_uart_emul, NRF_RPC_UART_TRANSPORT_DEFINE);
+#endif
@@ -31,6 +31,34 @@ extern "C" {
 #define ZMS_NAMECNT_ID     0x80000000
 #define ZMS_NAME_ID_OFFSET 0x40000000
 
+#if CONFIG_SETTINGS_ZMS_NAME_HASH
+/* With hashed names, the ID of the setting's name is derived from the hash of
+ * the name, so that the name is found with a single read:
+ *
+ *	name ID = ZMS_HASH_BASE + ((hash & ZMS_HASH_MASK) << collision bits | collision)
+ *
+ * The name is preceded by the IDs of the previous and the next setting, forming
+ * a doubly linked list of all settings, which is walked to load them. The list
+ * starts and ends at the ZMS_LL_HEAD entry. The entry with ID ==
+ * ZMS_HASH_COLLISION_ID is used to store the largest collision index in use.
+ *
+ * Hashed name IDs are placed in the upper half of the name ID range, so they do
+ * not overlap the IDs of settings stored by the legacy layout. These settings
+ * are moved to hashed IDs when the backend is initialized.
+ */
+#define ZMS_HASH_BASE           (ZMS_NAMECNT_ID + (ZMS_NAME_ID_OFFSET >> 1))
+#define ZMS_HASH_SLOT_BITS      29
+#define ZMS_HASH_COLLISION_BITS CONFIG_SETTINGS_ZMS_NAME_HASH_COLLISION_BITS
+#define ZMS_HASH_COLLISION_NUM  BIT(ZMS_HASH_COLLISION_BITS)
+#define ZMS_HASH_MASK           BIT_MASK(ZMS_HASH_SLOT_BITS - ZMS_HASH_COLLISION_BITS)
+#define ZMS_HASH_NAME_ID(hash, collision)                                                          \
+	(ZMS_HASH_BASE + ((((hash) & ZMS_HASH_MASK) << ZMS_HASH_COLLISION_BITS) | (collision)))
+#define ZMS_HASH_COLLISION(name_id)                                                                \
+	(((name_id) - ZMS_HASH_BASE) & (ZMS_HASH_COLLISION_NUM - 1))
+#define ZMS_LL_HEAD             (ZMS_HASH_BASE - 1)
+#define ZMS_HASH_COLLISION_ID   (ZMS_HASH_BASE - 2)
+#endif
+
 struct settings_zms {
 	struct settings_store cf_store;
 	struct zms_fs cf_zms;
@@ -46,6 +74,9 @@ struct settings_zms {
 	uint32_t cache_total;
 	bool loaded;
 #endif
+#if CONFIG_SETTINGS_ZMS_NAME_HASH
+	uint32_t hash_collision_max;
+#endif
 };
 
 /* register zms to be a source of settings */
@@ -8,10 +8,12 @@
 #define _POSIX_C_SOURCE 200809L /* for strnlen() */
 
 #include <errno.h>
+#include <stddef.h>
 #include <string.h>
 
 #include "settings/settings_zms_legacy.h"
 
+#include <zephyr/kernel.h>
 #include <zephyr/settings/settings.h>
 #include <zephyr/sys/hash_function.h>
 #include <zephyr/storage/flash_map.h>
@@ -109,11 +111,422 @@ static uint32_t settings_zms_cache_match(struct settings_zms *cf, const char *na
 }
 #endif /* CONFIG_SETTINGS_ZMS_NAME_CACHE */
 
+#if CONFIG_SETTINGS_ZMS_NAME_HASH
+/* Entry stored at the name ID: links of the settings list followed by the name.
+ * The head of the list is stored in the same format, with an empty name.
+ */
+struct settings_zms_hash_entry {
+	uint32_t prev;
+	uint32_t next;
+	char name[SETTINGS_FULL_NAME_LEN];
+};
+
+#define ZMS_HASH_LINKS_SIZE offsetof(struct settings_zms_hash_entry, name)
+
+static int settings_zms_hash_read(struct settings_zms *cf, uint32_t name_id,
+				  struct settings_zms_hash_entry *entry)
+{
+	ssize_t rc = zms_read(&cf->cf_zms, name_id, entry, sizeof(*entry) - 1);
+
+	if ((rc == -ENOENT) && (name_id == ZMS_LL_HEAD)) {
+		/* The list is empty. */
+		entry->prev = ZMS_LL_HEAD;
+		entry->next = ZMS_LL_HEAD;
+		rc = ZMS_HASH_LINKS_SIZE;
+	}
+
+	if (rc < 0) {
+		return rc;
+	}
+
+	if ((size_t)rc < ZMS_HASH_LINKS_SIZE) {
+		return -EIO;
+	}
+
+	entry->name[rc - ZMS_HASH_LINKS_SIZE] = '\0';
+
+	return 0;
+}
+
+static int settings_zms_hash_write(struct settings_zms *cf, uint32_t name_id,
+				   const struct settings_zms_hash_entry *entry)
+{
+	ssize_t rc = zms_write(&cf->cf_zms, name_id, entry,
+			       ZMS_HASH_LINKS_SIZE + strlen(entry->name));
+
+	return (rc < 0) ? rc : 0;
+}
+
+/* Replace the previous or the next link of the entry, if it still points to old_id,
+ * or unconditionally if old_id is ZMS_NAMECNT_ID. Entries that are gone or already
+ * relinked are left as they are.
+ */
+static int settings_zms_hash_relink(struct settings_zms *cf, uint32_t name_id, bool next,
+				    uint32_t old_id, uint32_t new_id)
+{
+	struct settings_zms_hash_entry entry;
+	uint32_t *link = next ? &entry.next : &entry.prev;
+	int rc;
+
+	rc = settings_zms_hash_read(cf, name_id, &entry);
+	if (rc) {
+		return (rc == -ENOENT) ? 0 : rc;
+	}
+
+	if ((*link == new_id) || ((old_id != ZMS_NAMECNT_ID) && (*link != old_id))) {
+		return 0;
+	}
+
+	*link = new_id;
+
+	return settings_zms_hash_write(cf, name_id, &entry);
+}
+
+/* Find the name ID of the setting and read its entry. If the setting is not found,
+ * free_id is set to the ID where it can be stored, or to ZMS_NAMECNT_ID if all of
+ * the IDs are in use.
+ */
+static uint32_t settings_zms_hash_find(struct settings_zms *cf, const char *name,
+				       struct settings_zms_hash_entry *entry, uint32_t *free_id)
+{
+	uint32_t name_hash = sys_hash32(name, strnlen(name, SETTINGS_FULL_NAME_LEN));
+	uint32_t name_id;
+	int rc;
+
+	*free_id = ZMS_NAMECNT_ID;
+
+	for (uint32_t collision = 0; collision <= cf->hash_collision_max; collision++) {
+		name_id = ZMS_HASH_NAME_ID(name_hash, collision);
+
+		rc = settings_zms_hash_read(cf, name_id, entry);
+		if (rc) {
+			if ((rc == -ENOENT) && (*free_id == ZMS_NAMECNT_ID)) {
+				*free_id = name_id;
+			}
+			continue;
+		}
+
+		if (!strcmp(name, entry->name)) {
+			return name_id;
+		}
+	}
+
+	if ((*free_id == ZMS_NAMECNT_ID) &&
+	    (cf->hash_collision_max < ZMS_HASH_COLLISION_NUM - 1)) {
+		*free_id = ZMS_HASH_NAME_ID(name_hash, cf->hash_collision_max + 1);
+	}
+
+	return ZMS_NAMECNT_ID;
+}
+
+static int settings_zms_hash_load_entry(struct settings_zms *cf, uint32_t name_id,
+					const struct settings_zms_hash_entry *entry,
+					const struct settings_load_arg *arg)
+{
+	struct settings_zms_read_fn_arg read_fn_arg;
+	ssize_t rc;
+
+	/* Settings outside of the subtree are skipped without reading their values. */
+	if ((arg != NULL) && (arg->subtree != NULL) &&
+	    !settings_name_steq(entry->name, arg->subtree, NULL)) {
+		return 0;
+	}
+
+	rc = zms_get_data_length(&cf->cf_zms, name_id + ZMS_NAME_ID_OFFSET);
+	if (rc <= 0) {
+		/* Saving the setting was interrupted. */
+		return 0;
+	}
+
+	read_fn_arg.fs = &cf->cf_zms;
+	read_fn_arg.id = name_id + ZMS_NAME_ID_OFFSET;
+
+	return settings_call_set_handler(entry->name, rc, settings_zms_read_fn, &read_fn_arg,
+					 (void *)arg);
+}
+
+/* Walk the list forward from the head. If the list is broken by an interrupted
+ * update, walk it backward from the head to load the remaining settings. Links
+ * that were not updated because of the interruption are repaired on the way.
+ */
+static int settings_zms_hash_load(struct settings_zms *cf, const struct settings_load_arg *arg)
+{
+	struct settings_zms_hash_entry entry;
+	uint32_t prev_id = ZMS_LL_HEAD;
+	uint32_t next_id = ZMS_LL_HEAD;
+	uint32_t tail_id;
+	uint32_t name_id;
+	int rc;
+
+	rc = settings_zms_hash_read(cf, ZMS_LL_HEAD, &entry);
+	if (rc) {
+		return rc;
+	}
+
+	tail_id = entry.prev;
+
+	for (name_id = entry.next; name_id != ZMS_LL_HEAD; name_id = entry.next) {
+		rc = settings_zms_hash_read(cf, name_id, &entry);
+		if (rc == -ENOENT) {
+			break;
+		} else if (rc) {
+			return rc;
+		}
+
+		if (entry.prev != prev_id) {
+			entry.prev = prev_id;
+			(void)settings_zms_hash_write(cf, name_id, &entry);
+		}
+
+		rc = settings_zms_hash_load_entry(cf, name_id, &entry, arg);
+		if (rc) {
+			return rc;
+		}
+
+		prev_id = name_id;
+	}
+
+	if (name_id != ZMS_LL_HEAD) {
+		LOG_WRN("Repairing settings list at ID %x", name_id);
+
+		for (name_id = tail_id; (name_id != ZMS_LL_HEAD) && (name_id != prev_id);
+		     name_id = entry.prev) {
+			rc = settings_zms_hash_read(cf, name_id, &entry);
+			if (rc == -ENOENT) {
+				break;
+			} else if (rc) {
+				return rc;
+			}
+
+			if (entry.next != next_id) {
+				entry.next = next_id;
+				(void)settings_zms_hash_write(cf, name_id, &entry);
+			}
+
+			rc = settings_zms_hash_load_entry(cf, name_id, &entry, arg);
+			if (rc) {
+				return rc;
+			}
+
+			next_id = name_id;
+		}
+	} else if (tail_id == prev_id) {
+		return 0;
+	}
+
+	/* Join the part of the list walked forward with the part walked backward. */
+	rc = settings_zms_hash_relink(cf, prev_id, true, ZMS_NAMECNT_ID, next_id);
+	if (rc) {
+		return rc;
+	}
+
+	return settings_zms_hash_relink(cf, next_id, false, ZMS_NAMECNT_ID, prev_id);
+}
+
+static int settings_zms_hash_save(struct settings_zms *cf, const char *name, const char *value,
+				  size_t val_len)
+{
+	struct settings_zms_hash_entry entry;
+	uint32_t name_id, free_id, next_id, collision;
+	size_t name_len;
+	int rc;
+
+	name_id = settings_zms_hash_find(cf, name, &entry, &free_id);
+
+	if ((value == NULL) || (val_len == 0)) {
+		if (name_id == ZMS_NAMECNT_ID) {
+			return 0;
+		}
+
+		/* The entry is deleted first, so that the setting is no longer found.
+		 * If updating the neighbours is interrupted, the list is repaired
+		 * when loading.
+		 */
+		rc = zms_delete(&cf->cf_zms, name_id);
+		if (rc < 0) {
+			return rc;
+		}
+
+		rc = settings_zms_hash_relink(cf, entry.prev, true, name_id, entry.next);
+		if (rc) {
+			return rc;
+		}
+
+		rc = settings_zms_hash_relink(cf, entry.next, false, name_id, entry.prev);
+		if (rc) {
+			return rc;
+		}
+
+		rc = zms_delete(&cf->cf_zms, name_id + ZMS_NAME_ID_OFFSET);
+
+		return (rc < 0) ? rc : 0;
+	}
+
+	if (name_id != ZMS_NAMECNT_ID) {
+		rc = zms_write(&cf->cf_zms, name_id + ZMS_NAME_ID_OFFSET, value, val_len);
+
+		return (rc < 0) ? rc : 0;
+	}
+
+	/* No free IDs left for the name hash. */
+	if (free_id == ZMS_NAMECNT_ID) {
+		return -ENOMEM;
+	}
+
+	name_len = strnlen(name, SETTINGS_FULL_NAME_LEN);
+	if (name_len >= sizeof(entry.name)) {
+		return -EINVAL;
+	}
+
+	collision = ZMS_HASH_COLLISION(free_id);
+	if (collision > cf->hash_collision_max) {
+		rc = zms_write(&cf->cf_zms, ZMS_HASH_COLLISION_ID, &collision, sizeof(collision));
+		if (rc < 0) {
+			return rc;
+		}
+
+		cf->hash_collision_max = collision;
+	}
+
+	rc = zms_write(&cf->cf_zms, free_id + ZMS_NAME_ID_OFFSET, value, val_len);
+	if (rc < 0) {
+		return rc;
+	}
+
+	/* The setting is inserted at the head of the list. The head is updated
+	 * before the entry is written, so that a setting that is found is always
+	 * reachable from the head.
+	 */
+	rc = settings_zms_hash_read(cf, ZMS_LL_HEAD, &entry);
+	if (rc) {
+		return rc;
+	}
+
+	next_id = entry.next;
+	if (next_id == ZMS_LL_HEAD) {
+		entry.prev = free_id;
+	}
+	entry.next = free_id;
+
+	rc = settings_zms_hash_write(cf, ZMS_LL_HEAD, &entry);
+	if (rc) {
+		return rc;
+	}
+
+	entry.prev = ZMS_LL_HEAD;
+	entry.next = next_id;
+	memcpy(entry.name, name, name_len);
+	entry.name[name_len] = '\0';
+
+	rc = settings_zms_hash_write(cf, free_id, &entry);
+	if (rc || (next_id == ZMS_LL_HEAD)) {
+		return rc;
+	}
+
+	return settings_zms_hash_relink(cf, next_id, false, ZMS_LL_HEAD, free_id);
+}
+
+/* Move the setting stored at the legacy name ID to a hashed ID. ZMS entries
+ * can only be read and written as a whole, so values that do not fit in the
+ * static buffer are moved through a buffer allocated from the heap.
+ */
+static int settings_zms_hash_migrate_entry(struct settings_zms *cf, uint32_t name_id,
+					   const char *name, size_t val_len)
+{
+	static char value_buf[CONFIG_SETTINGS_ZMS_NAME_HASH_MIGRATION_VALUE_SIZE_MAX];
+	char *value = value_buf;
+	ssize_t rc;
+
+	if (val_len > sizeof(value_buf)) {
+		value = k_malloc(val_len);
+		if (value == NULL) {
+			LOG_ERR("No memory to move setting's value (%zu bytes)", val_len);
+			return -ENOMEM;
+		}
+	}
+
+	rc = zms_read(&cf->cf_zms, name_id + ZMS_NAME_ID_OFFSET, value, val_len);
+	if (rc >= 0) {
+		rc = settings_zms_hash_save(cf, name, value, rc);
+	}
+
+	if (value != value_buf) {
+		k_free(value);
+	}
+
+	return rc;
+}
+
+/* Move settings stored in the legacy layout to hashed IDs. Each setting is deleted
+ * from the legacy layout once it is stored, so that an interrupted migration is
+ * resumed on the next initialization.
+ */
+static int settings_zms_hash_migrate(struct settings_zms *cf)
+{
+	char name[SETTINGS_FULL_NAME_LEN];
+	uint32_t last_name_id;
+	ssize_t rc1, rc2;
+	int rc;
+
+	rc = zms_read(&cf->cf_zms, ZMS_NAMECNT_ID, &last_name_id, sizeof(last_name_id));
+	if (rc < 0) {
+		/* Nothing is stored in the legacy layout. */
+		return 0;
+	}
+
+	LOG_INF("Moving settings to hashed IDs");
+
+	for (uint32_t name_id = last_name_id; name_id > ZMS_NAMECNT_ID; name_id--) {
+		rc1 = zms_read(&cf->cf_zms, name_id, &name, sizeof(name) - 1);
+		rc2 = zms_get_data_length(&cf->cf_zms, name_id + ZMS_NAME_ID_OFFSET);
+
+		if ((rc1 > 0) && (rc2 > 0)) {
+			name[rc1] = '\0';
+
+			rc = settings_zms_hash_migrate_entry(cf, name_id, name, rc2);
+			if (rc) {
+				return rc;
+			}
+		}
+
+		rc = zms_delete(&cf->cf_zms, name_id + ZMS_NAME_ID_OFFSET);
+		if (rc >= 0) {
+			rc = zms_delete(&cf->cf_zms, name_id);
+		}
+
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	rc = zms_delete(&cf->cf_zms, ZMS_NAMECNT_ID);
+
+	return (rc < 0) ? rc : 0;
+}
+
+static int settings_zms_hash_init(struct settings_zms *cf)
+{
+	ssize_t rc;
+
+	rc = zms_read(&cf->cf_zms, ZMS_HASH_COLLISION_ID, &cf->hash_collision_max,
+		      sizeof(cf->hash_collision_max));
+	if (rc < 0) {
+		cf->hash_collision_max = 0;
+	}
+
+	return settings_zms_hash_migrate(cf);
+}
+#endif /* CONFIG_SETTINGS_ZMS_NAME_HASH */
+
 static int settings_zms_load(struct settings_store *cs, const struct settings_load_arg *arg)
 {
-	int ret = 0;
 	struct settings_zms *cf = CONTAINER_OF(cs, struct settings_zms, cf_store);
+
+#if CONFIG_SETTINGS_ZMS_NAME_HASH
+	return settings_zms_hash_load(cf, arg);
+#else
 	struct settings_zms_read_fn_arg read_fn_arg;
+	int ret = 0;
 	char name[SETTINGS_FULL_NAME_LEN];
 	ssize_t rc1, rc2;
 	uint32_t name_id = ZMS_NAMECNT_ID;
@@ -195,21 +608,26 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 		}
 	}
 	return ret;
+#endif /* CONFIG_SETTINGS_ZMS_NAME_HASH */
 }
 
 static int settings_zms_save(struct settings_store *cs, const char *name, const char *value,
 			     size_t val_len)
 {
 	struct settings_zms *cf = CONTAINER_OF(cs, struct settings_zms, cf_store);
-	char rdname[SETTINGS_FULL_NAME_LEN];
-	uint32_t name_id, write_name_id;
-	bool delete, write_name;
-	int rc = 0;
 
 	if (!name) {
 		return -EINVAL;
 	}
 
+#if CONFIG_SETTINGS_ZMS_NAME_HASH
+	return settings_zms_hash_save(cf, name, value, val_len);
+#else
+	char rdname[SETTINGS_FULL_NAME_LEN];
+	uint32_t name_id, write_name_id;
+	bool delete, write_name;
+	int rc = 0;
+
 	/* Find out if we are doing a delete */
 	delete = ((value == NULL) || (val_len == 0));
 
@@ -342,6 +760,7 @@ found:
 #endif
 
 	return 0;
+#endif /* CONFIG_SETTINGS_ZMS_NAME_HASH */
 }
 
 /* Initialize the zms backend. */
@@ -360,6 +779,13 @@ int settings_zms_backend_init(struct settings_zms *cf)
 		return rc;
 	}
 
+#if CONFIG_SETTINGS_ZMS_NAME_HASH
+	rc = settings_zms_hash_init(cf);
+	if (rc) {
+		return rc;
+	}
+#endif
+
 	rc = zms_read(&cf->cf_zms, ZMS_NAMECNT_ID, &last_name_id, sizeof(last_name_id));
 	if (rc < 0) {
 		cf->last_name_id = ZMS_NAMECNT_ID;
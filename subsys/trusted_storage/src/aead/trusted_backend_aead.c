@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <zephyr/kernel.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/logging/log.h>
 #include <mbedtls/platform_util.h>
@@ -47,6 +48,171 @@ typedef struct stored_object {
 	uint8_t data[AEAD_MAX_BUF_SIZE];
 } stored_object;
 
+static psa_status_t copy_object_data(const uint8_t *data, size_t size, size_t data_offset,
+				     size_t data_length, void *p_data, size_t *p_data_length)
+{
+	if (data_offset > size) {
+		*p_data_length = 0;
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	if ((data_offset + data_length) > size) {
+		size -= data_offset;
+	} else {
+		size = data_length;
+	}
+
+	memcpy(p_data, data + data_offset, size);
+	*p_data_length = size;
+
+	return PSA_SUCCESS;
+}
+
+#if CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE
+/** Decrypted object kept in RAM. Free entries have INVALID_UID as UID. */
+typedef struct cached_object {
+	psa_storage_uid_t uid;
+	const char *prefix;
+	uint32_t last_used;
+	stored_object_header header;
+	uint8_t data[STORAGE_MAX_ASSET_SIZE];
+} cached_object;
+
+static cached_object object_cache[CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE_SIZE];
+static uint32_t object_cache_use_cnt;
+static K_MUTEX_DEFINE(object_cache_lock);
+
+/*
+ * Finds the cached object. If the object is not cached, returns a free entry or the least
+ * recently used one instead. Must be called with the cache locked.
+ */
+static cached_object *object_cache_entry(const psa_storage_uid_t uid, const char *prefix,
+					 bool *hit)
+{
+	cached_object *victim = &object_cache[0];
+
+	for (size_t i = 0; i < ARRAY_SIZE(object_cache); i++) {
+		cached_object *entry = &object_cache[i];
+
+		if (entry->uid == uid && strcmp(entry->prefix, prefix) == 0) {
+			*hit = true;
+			return entry;
+		}
+
+		if (victim->uid == INVALID_UID) {
+			continue;
+		}
+
+		if (entry->uid == INVALID_UID ||
+		    (int32_t)(entry->last_used - victim->last_used) < 0) {
+			victim = entry;
+		}
+	}
+
+	*hit = false;
+
+	return victim;
+}
+
+static bool object_cache_get(const psa_storage_uid_t uid, const char *prefix, size_t data_offset,
+			     size_t data_length, void *p_data, size_t *p_data_length,
+			     psa_status_t *status)
+{
+	cached_object *entry;
+	bool hit;
+
+	k_mutex_lock(&object_cache_lock, K_FOREVER);
+
+	entry = object_cache_entry(uid, prefix, &hit);
+	if (hit) {
+		entry->last_used = ++object_cache_use_cnt;
+		*status = copy_object_data(entry->data, entry->header.data_size, data_offset,
+					   data_length, p_data, p_data_length);
+	}
+
+	k_mutex_unlock(&object_cache_lock);
+
+	return hit;
+}
+
+static bool object_cache_get_header(const psa_storage_uid_t uid, const char *prefix,
+				    stored_object_header *header)
+{
+	cached_object *entry;
+	bool hit;
+
+	k_mutex_lock(&object_cache_lock, K_FOREVER);
+
+	entry = object_cache_entry(uid, prefix, &hit);
+	if (hit) {
+		*header = entry->header;
+	}
+
+	k_mutex_unlock(&object_cache_lock);
+
+	return hit;
+}
+
+static void object_cache_put(const psa_storage_uid_t uid, const char *prefix,
+			     const stored_object_header *header, const void *data)
+{
+	cached_object *entry;
+	bool hit;
+
+	k_mutex_lock(&object_cache_lock, K_FOREVER);
+
+	entry = object_cache_entry(uid, prefix, &hit);
+	mbedtls_platform_zeroize(entry, sizeof(*entry));
+
+	entry->uid = uid;
+	entry->prefix = prefix;
+	entry->last_used = ++object_cache_use_cnt;
+	entry->header = *header;
+	if (header->data_size > 0) {
+		memcpy(entry->data, data, header->data_size);
+	}
+
+	k_mutex_unlock(&object_cache_lock);
+}
+
+static void object_cache_remove(const psa_storage_uid_t uid, const char *prefix)
+{
+	cached_object *entry;
+	bool hit;
+
+	k_mutex_lock(&object_cache_lock, K_FOREVER);
+
+	entry = object_cache_entry(uid, prefix, &hit);
+	if (hit) {
+		mbedtls_platform_zeroize(entry, sizeof(*entry));
+	}
+
+	k_mutex_unlock(&object_cache_lock);
+}
+#else
+static bool object_cache_get(const psa_storage_uid_t uid, const char *prefix, size_t data_offset,
+			     size_t data_length, void *p_data, size_t *p_data_length,
+			     psa_status_t *status)
+{
+	return false;
+}
+
+static bool object_cache_get_header(const psa_storage_uid_t uid, const char *prefix,
+				    stored_object_header *header)
+{
+	return false;
+}
+
+static void object_cache_put(const psa_storage_uid_t uid, const char *prefix,
+			     const stored_object_header *header, const void *data)
+{
+}
+
+static void object_cache_remove(const psa_storage_uid_t uid, const char *prefix)
+{
+}
+#endif /* CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE */
+
 psa_status_t trusted_get_info(const psa_storage_uid_t uid, const char *prefix,
 			      struct psa_storage_info_t *p_info)
 {
@@ -59,9 +225,12 @@ psa_status_t trusted_get_info(const psa_storage_uid_t uid, const char *prefix,
 	}
 
 	/* Get size & flags */
-	status = storage_get_object(uid, prefix, (void *)&header, sizeof(header), &out_length);
-	if (status != PSA_SUCCESS) {
-		return status;
+	if (!object_cache_get_header(uid, prefix, &header)) {
+		status = storage_get_object(uid, prefix, (void *)&header, sizeof(header),
+					    &out_length);
+		if (status != PSA_SUCCESS) {
+			return status;
+		}
 	}
 
 	p_info->capacity = header.data_size;
@@ -92,6 +261,11 @@ psa_status_t trusted_get(const psa_storage_uid_t uid, const char *prefix, size_t
 		return PSA_ERROR_INVALID_ARGUMENT;
 	}
 
+	if (object_cache_get(uid, prefix, data_offset, data_length, p_data, p_data_length,
+			     &status)) {
+		return status;
+	}
+
 	/* Get AEAD key */
 	status = trusted_storage_get_key(uid, key_buf, AEAD_KEY_SIZE);
 	if (status != PSA_SUCCESS) {
@@ -115,20 +289,10 @@ psa_status_t trusted_get(const psa_storage_uid_t uid, const char *prefix, size_t
 		goto clean_up;
 	}
 
-	if (data_offset > out_length) {
-		*p_data_length = 0;
-		status = PSA_ERROR_INVALID_ARGUMENT;
-		goto clean_up;
-	}
-
-	if ((data_offset + data_length) > out_length) {
-		out_length -= data_offset;
-	} else {
-		out_length = data_length;
-	}
+	object_cache_put(uid, prefix, &object_data.header, object_data.data);
 
-	memcpy(p_data, object_data.data + data_offset, out_length);
-	*p_data_length = out_length;
+	status = copy_object_data(object_data.data, out_length, data_offset, data_length, p_data,
+				  p_data_length);
 
 clean_up:
 	/* Clean up */
@@ -205,11 +369,14 @@ psa_status_t trusted_set(const psa_storage_uid_t uid, const char *prefix, size_t
 		goto cleanup_objects;
 	}
 
+	object_cache_put(uid, prefix, &object_data.header, p_data);
+
 	goto cleanup;
 
 cleanup_objects:
 	/* Remove object if an error occurs */
 	LOG_DBG("trusted_set cleanup. status %d", status);
+	object_cache_remove(uid, prefix);
 	storage_remove_object(uid, prefix);
 
 cleanup:
@@ -238,6 +405,8 @@ psa_status_t trusted_remove(const psa_storage_uid_t uid, const char *prefix)
 		return PSA_ERROR_NOT_PERMITTED;
 	}
 
+	object_cache_remove(uid, prefix);
+
 	return storage_remove_object(uid, prefix);
 }
 
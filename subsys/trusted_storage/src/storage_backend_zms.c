@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/fs/zms.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/hash_function.h>
+
+#include "storage_backend.h"
+
+LOG_MODULE_REGISTER(trusted_storage_zms, CONFIG_TRUSTED_STORAGE_LOG_LEVEL);
+
+#define TRUSTED_STORAGE_PARTITION FIXED_PARTITION_ID(trusted_storage_partition)
+
+/*
+ * The ZMS ID of an object is derived from the hash of its prefix and UID. The lower
+ * bits of the ID are used to store objects whose hashes collide:
+ *
+ *	object ID = (hash & ZMS_OBJECT_MASK) << collision bits | collision
+ *
+ * The tag of the object, which holds its prefix and UID, is stored under the object ID
+ * with ZMS_TAG_FLAG set. The tag is compared before the object is read.
+ *
+ * The entry with ID == ZMS_COLLISION_MAX_ID is used to store the largest collision
+ * index in use, so that objects that are not stored are not searched for further.
+ */
+#define ZMS_COLLISION_BITS   CONFIG_TRUSTED_STORAGE_STORAGE_BACKEND_ZMS_COLLISION_BITS
+#define ZMS_COLLISION_NUM    BIT(ZMS_COLLISION_BITS)
+#define ZMS_OBJECT_MASK      BIT_MASK(30 - ZMS_COLLISION_BITS)
+#define ZMS_OBJECT_ID(hash, collision)                                                             \
+	((((hash) & ZMS_OBJECT_MASK) << ZMS_COLLISION_BITS) | (collision))
+#define ZMS_COLLISION(id)    ((id) & (ZMS_COLLISION_NUM - 1))
+#define ZMS_TAG_FLAG         BIT(30)
+#define ZMS_COLLISION_MAX_ID BIT(31)
+#define ZMS_INVALID_ID       UINT32_MAX
+
+/* Prefix length aligned with the filenames of the Settings storage backend */
+#define TRUSTED_STORAGE_ZMS_BACKEND_PREFIX_MAX_LENGTH 15
+
+/* Log pattern: prefix, uid high, uid low */
+#define TRUSTED_STORAGE_ZMS_BACKEND_LOG_PATTERN "%s/%08x%08x"
+#define UID_LOG_ARGS(uid) (unsigned int)((uid) >> 32), (unsigned int)((uid) & 0xffffffff)
+
+struct object_tag {
+	psa_storage_uid_t uid;
+	char prefix[TRUSTED_STORAGE_ZMS_BACKEND_PREFIX_MAX_LENGTH];
+};
+
+static K_MUTEX_DEFINE(storage_zms_lock);
+static struct zms_fs storage_zms;
+static uint32_t storage_zms_collision_max;
+static bool storage_zms_ready;
+
+static psa_status_t error_to_psa_error(int errorno)
+{
+
+	switch (errorno) {
+	case 0:
+		return PSA_SUCCESS;
+	case -ENOSPC:
+		return PSA_ERROR_INSUFFICIENT_STORAGE;
+	case -ENOENT:
+		return PSA_ERROR_DOES_NOT_EXIST;
+	case -ENODATA:
+		return PSA_ERROR_DATA_CORRUPT;
+	default:
+		return PSA_ERROR_STORAGE_FAILURE;
+	}
+}
+
+/* Helper to fill the tag and its length */
+static psa_status_t create_tag(struct object_tag *tag, size_t *tag_length, const char *prefix,
+			       const psa_storage_uid_t uid)
+{
+	size_t prefix_length = strlen(prefix);
+
+	if (prefix_length > sizeof(tag->prefix)) {
+		return PSA_ERROR_STORAGE_FAILURE;
+	}
+
+	tag->uid = uid;
+	memcpy(tag->prefix, prefix, prefix_length);
+	*tag_length = offsetof(struct object_tag, prefix) + prefix_length;
+
+	return PSA_SUCCESS;
+}
+
+/* Mount ZMS on the first use, as the PSA storage can be used before the application starts */
+static int storage_zms_init(void)
+{
+	const struct flash_area *fa;
+	struct flash_sector sector;
+	uint32_t sector_cnt = 1;
+	ssize_t len;
+	int rc;
+
+	if (storage_zms_ready) {
+		return 0;
+	}
+
+	rc = flash_area_open(TRUSTED_STORAGE_PARTITION, &fa);
+	if (rc) {
+		return rc;
+	}
+
+	rc = flash_area_get_sectors(TRUSTED_STORAGE_PARTITION, &sector_cnt, &sector);
+	if (rc != 0 && rc != -ENOMEM) {
+		flash_area_close(fa);
+		return rc;
+	}
+
+	storage_zms.flash_device = fa->fa_dev;
+	storage_zms.offset = fa->fa_off;
+	storage_zms.sector_size = sector.fs_size;
+	storage_zms.sector_count = fa->fa_size / sector.fs_size;
+
+	flash_area_close(fa);
+
+	rc = zms_mount(&storage_zms);
+	if (rc) {
+		LOG_ERR("Failed to mount ZMS, err %d", rc);
+		return rc;
+	}
+
+	len = zms_read(&storage_zms, ZMS_COLLISION_MAX_ID, &storage_zms_collision_max,
+		       sizeof(storage_zms_collision_max));
+	if (len < 0) {
+		storage_zms_collision_max = 0;
+	}
+
+	storage_zms_ready = true;
+
+	return 0;
+}
+
+/*
+ * Finds the object ID of the tag. If the object is not stored, free_id is set to the ID
+ * where it can be stored, or to ZMS_INVALID_ID if all of the IDs are in use.
+ */
+static uint32_t storage_zms_find(const struct object_tag *tag, size_t tag_length,
+				 uint32_t *free_id)
+{
+	struct object_tag stored;
+	uint32_t hash = sys_hash32(tag, tag_length);
+	uint32_t id;
+	ssize_t len;
+
+	*free_id = ZMS_INVALID_ID;
+
+	for (uint32_t collision = 0; collision <= storage_zms_collision_max; collision++) {
+		id = ZMS_OBJECT_ID(hash, collision);
+
+		len = zms_read(&storage_zms, id | ZMS_TAG_FLAG, &stored, sizeof(stored));
+		if (len == -ENOENT) {
+			if (*free_id == ZMS_INVALID_ID) {
+				*free_id = id;
+			}
+			continue;
+		}
+
+		if (len > 0 && (size_t)len == tag_length &&
+		    memcmp(&stored, tag, tag_length) == 0) {
+			return id;
+		}
+	}
+
+	if (*free_id == ZMS_INVALID_ID && storage_zms_collision_max < ZMS_COLLISION_NUM - 1) {
+		*free_id = ZMS_OBJECT_ID(hash, storage_zms_collision_max + 1);
+	}
+
+	return ZMS_INVALID_ID;
+}
+
+psa_status_t storage_get_object(const psa_storage_uid_t uid, const char *prefix, void *object_data,
+				const size_t object_size, size_t *object_length)
+{
+	struct object_tag tag;
+	size_t tag_length;
+	uint32_t id, free_id;
+	ssize_t ret;
+	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+
+	if (object_size == 0 || object_data == NULL || prefix == NULL) {
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	status = create_tag(&tag, &tag_length, prefix, uid);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	k_mutex_lock(&storage_zms_lock, K_FOREVER);
+
+	ret = storage_zms_init();
+	if (ret == 0) {
+		id = storage_zms_find(&tag, tag_length, &free_id);
+		if (id == ZMS_INVALID_ID) {
+			ret = -ENOENT;
+		} else {
+			ret = zms_read(&storage_zms, id, object_data, object_size);
+		}
+	}
+
+	k_mutex_unlock(&storage_zms_lock);
+
+	LOG_DBG("Get object " TRUSTED_STORAGE_ZMS_BACKEND_LOG_PATTERN " (max_size: %zd), ret: %d",
+		prefix, UID_LOG_ARGS(uid), object_size, (int)ret);
+
+	if (ret < 0) {
+		return error_to_psa_error(ret);
+	}
+
+	*object_length = ret;
+
+	return PSA_SUCCESS;
+}
+
+psa_status_t storage_set_object(const psa_storage_uid_t uid, const char *prefix,
+				const void *object_data, const size_t object_size)
+{
+	struct object_tag tag;
+	size_t tag_length;
+	uint32_t id, free_id, collision;
+	ssize_t ret;
+	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+
+	if (object_size == 0 || object_data == NULL || prefix == NULL) {
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	status = create_tag(&tag, &tag_length, prefix, uid);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	LOG_DBG("Set object " TRUSTED_STORAGE_ZMS_BACKEND_LOG_PATTERN ". Size: %zd", prefix,
+		UID_LOG_ARGS(uid), object_size);
+
+	k_mutex_lock(&storage_zms_lock, K_FOREVER);
+
+	ret = storage_zms_init();
+	if (ret) {
+		goto unlock;
+	}
+
+	id = storage_zms_find(&tag, tag_length, &free_id);
+	if (id == ZMS_INVALID_ID) {
+		if (free_id == ZMS_INVALID_ID) {
+			ret = -ENOSPC;
+			goto unlock;
+		}
+
+		collision = ZMS_COLLISION(free_id);
+		if (collision > storage_zms_collision_max) {
+			ret = zms_write(&storage_zms, ZMS_COLLISION_MAX_ID, &collision,
+					sizeof(collision));
+			if (ret < 0) {
+				goto unlock;
+			}
+
+			storage_zms_collision_max = collision;
+		}
+
+		/* The tag is written first, as an object is only read once its tag is found */
+		ret = zms_write(&storage_zms, free_id | ZMS_TAG_FLAG, &tag, tag_length);
+		if (ret < 0) {
+			goto unlock;
+		}
+
+		id = free_id;
+	}
+
+	ret = zms_write(&storage_zms, id, object_data, object_size);
+
+unlock:
+	k_mutex_unlock(&storage_zms_lock);
+
+	return error_to_psa_error(ret < 0 ? ret : 0);
+}
+
+psa_status_t storage_remove_object(const psa_storage_uid_t uid, const char *prefix)
+{
+	struct object_tag tag;
+	size_t tag_length;
+	uint32_t id, free_id;
+	int ret;
+	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+
+	if (prefix == NULL) {
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	status = create_tag(&tag, &tag_length, prefix, uid);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	k_mutex_lock(&storage_zms_lock, K_FOREVER);
+
+	ret = storage_zms_init();
+	if (ret == 0) {
+		id = storage_zms_find(&tag, tag_length, &free_id);
+		if (id != ZMS_INVALID_ID) {
+			/* The object is deleted before its tag. A tag left behind by an
+			 * interrupted removal is reused when the object is stored again.
+			 */
+			ret = zms_delete(&storage_zms, id);
+			if (ret == 0) {
+				ret = zms_delete(&storage_zms, id | ZMS_TAG_FLAG);
+			}
+		}
+	}
+
+	k_mutex_unlock(&storage_zms_lock);
+
+	status = error_to_psa_error(ret);
+
+	LOG_DBG("Remove object " TRUSTED_STORAGE_ZMS_BACKEND_LOG_PATTERN ", status %d", prefix,
+		UID_LOG_ARGS(uid), status);
+
+	return status;
+}
@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Minimal replacement of the Matter reporting engine interface, implemented by the test. */
+
+#pragma once
+
+#include <lib/core/DataModelTypes.h>
+
+void MatterReportingAttributeChangeCallback(chip::EndpointId endpoint, chip::ClusterId clusterId,
+					    chip::AttributeId attributeId);
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Minimal replacement of the Matter error type, used to test the module without the Matter stack. */
+
+#pragma once
+
+#include <cstdint>
+
+namespace chip
+{
+
+class ChipError {
+public:
+	constexpr explicit ChipError(uint32_t value) : mValue(value) {}
+
+	constexpr bool operator==(const ChipError &other) const { return mValue == other.mValue; }
+	constexpr bool operator!=(const ChipError &other) const { return mValue != other.mValue; }
+
+	uint32_t Format() const { return mValue; }
+
+private:
+	uint32_t mValue;
+};
+
+} /* namespace chip */
+
+using CHIP_ERROR = chip::ChipError;
+
+#define CHIP_ERROR_FORMAT "u"
+
+#define CHIP_NO_ERROR chip::ChipError(0)
+#define CHIP_ERROR_NO_MEMORY chip::ChipError(0x0B)
+#define CHIP_ERROR_INTERNAL chip::ChipError(0xAC)
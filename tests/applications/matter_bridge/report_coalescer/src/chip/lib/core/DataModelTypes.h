@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Minimal replacement of the Matter data model types. */
+
+#pragma once
+
+#include <cstdint>
+
+namespace chip
+{
+
+using EndpointId = uint16_t;
+using ClusterId = uint32_t;
+using AttributeId = uint32_t;
+
+} /* namespace chip */
@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Minimal replacement of the Matter error handling macros. */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+#define VerifyOrReturn(expr)                                                                                         \
+	do {                                                                                                         \
+		if (!(expr)) {                                                                                       \
+			return;                                                                                      \
+		}                                                                                                    \
+	} while (false)
+
+#define VerifyOrReturnError(expr, code)                                                                              \
+	do {                                                                                                         \
+		if (!(expr)) {                                                                                       \
+			return (code);                                                                               \
+		}                                                                                                    \
+	} while (false)
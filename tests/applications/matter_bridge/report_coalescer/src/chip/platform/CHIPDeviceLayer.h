@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Minimal replacement of the Matter device layer. */
+
+#pragma once
+
+#include <lib/support/CodeUtils.h>
+#include <system/SystemLayer.h>
+
+namespace chip::DeviceLayer
+{
+
+System::Layer &SystemLayer();
+
+} /* namespace chip::DeviceLayer */
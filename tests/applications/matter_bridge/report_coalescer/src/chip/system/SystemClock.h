@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Minimal replacement of the Matter system clock, controlled by the test. */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace chip::System
+{
+
+namespace Clock
+{
+
+using Milliseconds32 = std::chrono::duration<uint32_t, std::milli>;
+using Milliseconds64 = std::chrono::duration<uint64_t, std::milli>;
+using Timestamp = Milliseconds64;
+
+constexpr Timestamp kZero{ 0 };
+
+class ClockBase {
+public:
+	Timestamp GetMonotonicTimestamp() const { return mNow; }
+	void Advance(Milliseconds32 delay) { mNow += delay; }
+
+private:
+	Timestamp mNow{ 1000 };
+};
+
+} /* namespace Clock */
+
+Clock::ClockBase &SystemClock();
+
+} /* namespace chip::System */
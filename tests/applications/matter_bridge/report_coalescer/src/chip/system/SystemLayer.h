@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Minimal replacement of the Matter system layer, which runs a single timer controlled by the test. */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <system/SystemClock.h>
+
+namespace chip::System
+{
+
+class Layer;
+
+using TimerCompleteCallback = void (*)(Layer *layer, void *appState);
+
+class Layer {
+public:
+	CHIP_ERROR StartTimer(Clock::Milliseconds32 delay, TimerCompleteCallback callback, void *appState)
+	{
+		mDeadline = SystemClock().GetMonotonicTimestamp() + delay;
+		mCallback = callback;
+		mAppState = appState;
+		return CHIP_NO_ERROR;
+	}
+
+	void CancelTimer(TimerCompleteCallback callback, void *appState)
+	{
+		if (mCallback == callback && mAppState == appState) {
+			mCallback = nullptr;
+		}
+	}
+
+	bool IsTimerActive() const { return mCallback != nullptr; }
+	Clock::Timestamp GetTimerDeadline() const { return mDeadline; }
+
+	/* Fire the timer if its deadline has passed. */
+	void HandleTimer()
+	{
+		TimerCompleteCallback callback = mCallback;
+
+		if (callback && SystemClock().GetMonotonicTimestamp() >= mDeadline) {
+			mCallback = nullptr;
+			callback(this, mAppState);
+		}
+	}
+
+private:
+	TimerCompleteCallback mCallback = nullptr;
+	void *mAppState = nullptr;
+	Clock::Timestamp mDeadline{};
+};
+
+} /* namespace chip::System */
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "report_coalescer.h"
+
+#include <app/reporting/reporting.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+LOG_MODULE_REGISTER(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace chip;
+
+namespace
+{
+
+constexpr EndpointId kEndpoint1 = 3;
+constexpr EndpointId kEndpoint2 = 4;
+constexpr ClusterId kTemperatureCluster = 0x0402;
+constexpr ClusterId kHumidityCluster = 0x0405;
+constexpr ClusterId kOnOffCluster = 0x0006;
+constexpr AttributeId kMeasuredValue = 0x0000;
+constexpr AttributeId kTolerance = 0x0003;
+
+struct Report {
+	EndpointId mEndpointId;
+	ClusterId mClusterId;
+	AttributeId mAttributeId;
+};
+
+System::Clock::ClockBase sClock;
+System::Layer sSystemLayer;
+Report sReports[16];
+size_t sReportsCount;
+
+void Advance(uint32_t delayMs)
+{
+	sClock.Advance(System::Clock::Milliseconds32(delayMs));
+	sSystemLayer.HandleTimer();
+}
+
+bool IsReported(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId)
+{
+	for (size_t i = 0; i < sReportsCount; i++) {
+		if (sReports[i].mEndpointId == endpointId && sReports[i].mClusterId == clusterId &&
+		    sReports[i].mAttributeId == attributeId) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void Before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	sSystemLayer = System::Layer();
+	sReportsCount = 0;
+}
+
+} /* namespace */
+
+System::Clock::ClockBase &System::SystemClock()
+{
+	return sClock;
+}
+
+System::Layer &DeviceLayer::SystemLayer()
+{
+	return sSystemLayer;
+}
+
+void MatterReportingAttributeChangeCallback(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId)
+{
+	zassert_true(sReportsCount < ARRAY_SIZE(sReports), "Too many reports");
+	sReports[sReportsCount++] = { endpoint, clusterId, attributeId };
+}
+
+ZTEST(report_coalescer, test_coalesce)
+{
+	Nrf::ReportCoalescer coalescer;
+
+	coalescer.Report(kEndpoint1, kTemperatureCluster, kMeasuredValue);
+	coalescer.Report(kEndpoint1, kTemperatureCluster, kMeasuredValue);
+	coalescer.Report(kEndpoint1, kTemperatureCluster, kTolerance);
+	coalescer.Report(kEndpoint2, kTemperatureCluster, kMeasuredValue);
+	coalescer.Report(kEndpoint1, kTemperatureCluster, kMeasuredValue);
+
+	/* Nothing is reported until the window expires. */
+	Advance(Nrf::ReportCoalescer::kWindowMs - 1);
+	zassert_equal(sReportsCount, 0, "Reported before the window expired");
+	zassert_equal(coalescer.PendingCount(), 3, "Invalid number of pending reports");
+
+	/* Each changed attribute is reported once. */
+	Advance(1);
+	zassert_equal(sReportsCount, 3, "Invalid number of reports");
+	zassert_true(IsReported(kEndpoint1, kTemperatureCluster, kMeasuredValue));
+	zassert_true(IsReported(kEndpoint1, kTemperatureCluster, kTolerance));
+	zassert_true(IsReported(kEndpoint2, kTemperatureCluster, kMeasuredValue));
+	zassert_equal(coalescer.PendingCount(), 0, "Reports left pending");
+	zassert_false(sSystemLayer.IsTimerActive(), "Flush scheduled without pending reports");
+
+	const Nrf::ReportCoalescer::Stats &stats = coalescer.GetStats();
+
+	zassert_equal(stats.mUpdates, 5);
+	zassert_equal(stats.mSent, 3);
+	zassert_equal(stats.mSuppressed, 2);
+	zassert_equal(stats.mOverflows, 0);
+
+	coalescer.ResetStats();
+	zassert_equal(coalescer.GetStats().mUpdates, 0, "Stats not reset");
+}
+
+ZTEST(report_coalescer, test_window_not_extended)
+{
+	Nrf::ReportCoalescer coalescer;
+
+	coalescer.Report(kEndpoint1, kTemperatureCluster, kMeasuredValue);
+	Advance(Nrf::ReportCoalescer::kWindowMs / 2);
+
+	/* The window starts with the first change, it is not moved by the following ones. */
+	coalescer.Report(kEndpoint1, kHumidityCluster, kMeasuredValue);
+	Advance(Nrf::ReportCoalescer::kWindowMs / 2);
+
+	zassert_equal(sReportsCount, 2, "Invalid number of reports");
+}
+
+ZTEST(report_coalescer, test_overflow)
+{
+	Nrf::ReportCoalescer coalescer;
+
+	for (AttributeId i = 0; i < Nrf::ReportCoalescer::kMaxPendingReports; i++) {
+		coalescer.Report(kEndpoint1, kTemperatureCluster, i);
+	}
+
+	/* The change that does not fit is reported right away, the pending ones wait for the window. */
+	coalescer.Report(kEndpoint2, kTemperatureCluster, kMeasuredValue);
+	zassert_equal(sReportsCount, 1, "Overflowing report not sent");
+	zassert_true(IsReported(kEndpoint2, kTemperatureCluster, kMeasuredValue));
+	zassert_equal(coalescer.GetStats().mOverflows, 1);
+
+	Advance(Nrf::ReportCoalescer::kWindowMs);
+	zassert_equal(sReportsCount, Nrf::ReportCoalescer::kMaxPendingReports + 1, "Pending reports not sent");
+	zassert_equal(coalescer.GetStats().mSent, Nrf::ReportCoalescer::kMaxPendingReports + 1);
+}
+
+ZTEST(report_coalescer, test_cancel)
+{
+	Nrf::ReportCoalescer coalescer;
+
+	coalescer.Report(kEndpoint1, kTemperatureCluster, kMeasuredValue);
+	coalescer.Report(kEndpoint2, kTemperatureCluster, kMeasuredValue);
+	coalescer.Report(kEndpoint1, kHumidityCluster, kMeasuredValue);
+
+	/* Reports of the removed endpoint are dropped. */
+	coalescer.Cancel(kEndpoint1);
+	zassert_equal(coalescer.PendingCount(), 1, "Reports not dropped");
+
+	Advance(Nrf::ReportCoalescer::kWindowMs);
+	zassert_equal(sReportsCount, 1, "Invalid number of reports");
+	zassert_true(IsReported(kEndpoint2, kTemperatureCluster, kMeasuredValue));
+}
+
+ZTEST(report_coalescer, test_rate_limit)
+{
+	constexpr uint32_t kMinIntervalMs = 5 * Nrf::ReportCoalescer::kWindowMs;
+	Nrf::ReportCoalescer coalescer;
+
+	zassert_equal(coalescer.SetRateLimit(kTemperatureCluster, kMinIntervalMs), CHIP_NO_ERROR);
+
+	/* The first report of the rate limited cluster is sent when the window expires. */
+	coalescer.Report(kEndpoint1, kTemperatureCluster, kMeasuredValue);
+	Advance(Nrf::ReportCoalescer::kWindowMs);
+	zassert_equal(sReportsCount, 1, "First report not sent");
+
+	/* The next report of the cluster is held back until the minimum interval passes. */
+	coalescer.Report(kEndpoint1, kTemperatureCluster, kMeasuredValue);
+	coalescer.Report(kEndpoint2, kTemperatureCluster, kMeasuredValue);
+	coalescer.Report(kEndpoint1, kOnOffCluster, kMeasuredValue);
+	Advance(Nrf::ReportCoalescer::kWindowMs);
+
+	/* The clusters which are not rate limited are not held back. */
+	zassert_equal(sReportsCount, 2, "Rate limit not applied");
+	zassert_true(IsReported(kEndpoint1, kOnOffCluster, kMeasuredValue));
+	zassert_equal(coalescer.PendingCount(), 2, "Invalid number of pending reports");
+	zassert_true(sSystemLayer.IsTimerActive(), "Flush of the held back reports not scheduled");
+
+	Advance(kMinIntervalMs - Nrf::ReportCoalescer::kWindowMs - 1);
+	zassert_equal(sReportsCount, 2, "Report sent before the minimum interval");
+
+	/* All pending reports of the cluster are sent in the same pass. */
+	Advance(1);
+	zassert_equal(sReportsCount, 4, "Held back reports not sent");
+	zassert_equal(coalescer.PendingCount(), 0, "Reports left pending");
+}
+
+ZTEST(report_coalescer, test_rate_limit_remove)
+{
+	Nrf::ReportCoalescer coalescer;
+
+	zassert_equal(coalescer.SetRateLimit(kTemperatureCluster, 10000), CHIP_NO_ERROR);
+
+	coalescer.Report(kEndpoint1, kTemperatureCluster, kMeasuredValue);
+	Advance(Nrf::ReportCoalescer::kWindowMs);
+	coalescer.Report(kEndpoint1, kTemperatureCluster, kMeasuredValue);
+	Advance(Nrf::ReportCoalescer::kWindowMs);
+	zassert_equal(sReportsCount, 1, "Rate limit not applied");
+
+	/* The reports held back by the removed limit are sent when the window expires. */
+	zassert_equal(coalescer.SetRateLimit(kTemperatureCluster, 0), CHIP_NO_ERROR);
+	Advance(Nrf::ReportCoalescer::kWindowMs);
+	zassert_equal(sReportsCount, 2, "Held back report not sent");
+}
+
+ZTEST(report_coalescer, test_rate_limit_no_memory)
+{
+	Nrf::ReportCoalescer coalescer;
+
+	for (ClusterId i = 0; i < Nrf::ReportCoalescer::kMaxRateLimits; i++) {
+		zassert_equal(coalescer.SetRateLimit(i, 100), CHIP_NO_ERROR);
+	}
+
+	zassert_equal(coalescer.SetRateLimit(Nrf::ReportCoalescer::kMaxRateLimits, 100), CHIP_ERROR_NO_MEMORY,
+		      "Too many rate limits set");
+
+	/* The limit of an already limited cluster can be changed, and a removed limit frees its slot. */
+	zassert_equal(coalescer.SetRateLimit(0, 200), CHIP_NO_ERROR);
+	zassert_equal(coalescer.SetRateLimit(0, 0), CHIP_NO_ERROR);
+	zassert_equal(coalescer.SetRateLimit(Nrf::ReportCoalescer::kMaxRateLimits, 100), CHIP_NO_ERROR);
+}
+
+ZTEST_SUITE(report_coalescer, NULL, NULL, Before, NULL, NULL);
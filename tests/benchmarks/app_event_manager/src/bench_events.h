@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _BENCH_EVENTS_H_
+#define _BENCH_EVENTS_H_
+
+#include <app_event_manager.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct bench_normal_event {
+	struct app_event_header header;
+
+	uint32_t submit_cycles;
+};
+
+APP_EVENT_TYPE_DECLARE(bench_normal_event);
+
+struct bench_high_event {
+	struct app_event_header header;
+
+	uint32_t submit_cycles;
+};
+
+APP_EVENT_TYPE_DECLARE(bench_high_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BENCH_EVENTS_H_ */
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdlib.h>
+#include <zephyr/ztest.h>
+#include <app_event_manager.h>
+
+#include "bench_events.h"
+
+/* Number of normal priority events submitted in one burst. */
+#define BURST_LEN		32
+/* Number of bursts. A single high priority event is submitted in the middle of each burst. */
+#define ROUND_CNT		64
+/* Simulated processing time of a normal priority event. */
+#define NORMAL_HANDLER_US	50
+
+static uint32_t normal_latency[BURST_LEN * ROUND_CNT];
+static uint32_t high_latency[ROUND_CNT];
+static size_t normal_cnt;
+static size_t high_cnt;
+
+static K_SEM_DEFINE(round_done_sem, 0, 1);
+static atomic_t round_left;
+
+static void round_event_handled(void)
+{
+	/* Events can be handled by both system workqueue and the high priority lane thread. */
+	if (atomic_dec(&round_left) == 1) {
+		k_sem_give(&round_done_sem);
+	}
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	uint32_t now = k_cycle_get_32();
+
+	if (is_bench_normal_event(aeh)) {
+		const struct bench_normal_event *event = cast_bench_normal_event(aeh);
+
+		normal_latency[normal_cnt++] = now - event->submit_cycles;
+		k_busy_wait(NORMAL_HANDLER_US);
+		round_event_handled();
+		return false;
+	}
+
+	if (is_bench_high_event(aeh)) {
+		const struct bench_high_event *event = cast_bench_high_event(aeh);
+
+		high_latency[high_cnt++] = now - event->submit_cycles;
+		round_event_handled();
+		return false;
+	}
+
+	__ASSERT_NO_MSG(false);
+	return false;
+}
+
+APP_EVENT_LISTENER(bench, app_event_handler);
+APP_EVENT_SUBSCRIBE(bench, bench_normal_event);
+APP_EVENT_SUBSCRIBE(bench, bench_high_event);
+
+static int cmp_u32(const void *a, const void *b)
+{
+	uint32_t va = *(const uint32_t *)a;
+	uint32_t vb = *(const uint32_t *)b;
+
+	return (va > vb) - (va < vb);
+}
+
+static uint32_t percentile_us(const uint32_t *sorted, size_t cnt, unsigned int pct)
+{
+	size_t idx = (cnt * pct) / 100;
+
+	if (idx >= cnt) {
+		idx = cnt - 1;
+	}
+
+	return (uint32_t)k_cyc_to_us_floor64(sorted[idx]);
+}
+
+static uint32_t report_lane(const char *name, uint32_t *latency, size_t cnt)
+{
+	qsort(latency, cnt, sizeof(latency[0]), cmp_u32);
+
+	TC_PRINT("%s lane (%zu events): p50 %u us, p90 %u us, p99 %u us, max %u us\n",
+		 name, cnt,
+		 percentile_us(latency, cnt, 50),
+		 percentile_us(latency, cnt, 90),
+		 percentile_us(latency, cnt, 99),
+		 percentile_us(latency, cnt, 100));
+
+	return percentile_us(latency, cnt, 50);
+}
+
+static void submit_normal(void)
+{
+	struct bench_normal_event *event = new_bench_normal_event();
+
+	event->submit_cycles = k_cycle_get_32();
+	APP_EVENT_SUBMIT(event);
+}
+
+static void submit_high(void)
+{
+	struct bench_high_event *event = new_bench_high_event();
+
+	event->submit_cycles = k_cycle_get_32();
+	APP_EVENT_SUBMIT(event);
+}
+
+static void *bench_setup(void)
+{
+	zassert_ok(app_event_manager_init(), "Error when initializing");
+	return NULL;
+}
+
+ZTEST(app_event_manager_bench, test_submit_to_handler_latency)
+{
+	normal_cnt = 0;
+	high_cnt = 0;
+
+	for (size_t r = 0; r < ROUND_CNT; r++) {
+		atomic_set(&round_left, BURST_LEN + 1);
+
+		/* Submit the whole burst before any event is processed. */
+		k_sched_lock();
+		for (size_t i = 0; i < BURST_LEN; i++) {
+			if (i == (BURST_LEN / 2)) {
+				submit_high();
+			}
+			submit_normal();
+		}
+		k_sched_unlock();
+
+		zassert_ok(k_sem_take(&round_done_sem, K_SECONDS(5)), "Burst not processed");
+	}
+
+	zassert_equal(normal_cnt, ARRAY_SIZE(normal_latency));
+	zassert_equal(high_cnt, ARRAY_SIZE(high_latency));
+
+	uint32_t normal_p50 = report_lane("normal", normal_latency, normal_cnt);
+	uint32_t high_p50 = report_lane("high", high_latency, high_cnt);
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIORITY_LANES)) {
+		zassert_true(high_p50 < normal_p50,
+			     "High priority lane is not faster than the normal lane");
+	}
+}
+
+ZTEST_SUITE(app_event_manager_bench, NULL, bench_setup, NULL, NULL, NULL);
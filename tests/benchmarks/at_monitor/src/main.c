@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <nrf_modem_at.h>
+#include <modem/at_monitor.h>
+
+/* Number of times the trace is replayed. */
+#define REPEAT_CNT 20
+
+/* at_monitor_dispatch() is implemented in the AT monitor library
+ * and is called by the Modem library in an ISR.
+ */
+extern void at_monitor_dispatch(const char *notif);
+
+/* The Modem library is not linked, the notifications are dispatched by the benchmark. */
+int nrf_modem_at_notif_handler_set(nrf_modem_at_notif_handler_t callback)
+{
+	return 0;
+}
+
+/* Monitors defined by the libraries of a typical cellular application:
+ * LTE link control, PDN, modem info, date-time, modem battery, SMS and an application.
+ */
+#define MONITORS(X)                                                                                \
+	X(mdmev, "%MDMEV")                                                                         \
+	X(ncellmeas, "%NCELLMEAS")                                                                 \
+	X(rai, "%RAI")                                                                             \
+	X(cedrxp, "+CEDRXP")                                                                       \
+	X(xt3412, "%XT3412")                                                                       \
+	X(xmodemsleep, "%XMODEMSLEEP")                                                             \
+	X(cereg, "+CEREG")                                                                         \
+	X(cscon, "+CSCON")                                                                         \
+	X(cesq, "%CESQ")                                                                           \
+	X(xtime, "%XTIME")                                                                         \
+	X(xvbatlowlvl, "%XVBATLOWLVL")                                                             \
+	X(pofwarn, "%MDMEV: ME BATTERY LOW")                                                       \
+	X(cgev, "+CGEV")                                                                           \
+	X(cnec_esm, "+CNEC_ESM")                                                                   \
+	X(app_cereg, "CEREG")                                                                      \
+	X(app_ncellmeas, "NCELLMEAS")
+
+#define MONITORS_ISR(X)                                                                            \
+	X(cmt, "+CMT")                                                                             \
+	X(cms, "+CMS")                                                                             \
+	X(cds, "+CDS")
+
+#define MONITOR_INDEX(name, filter) MON_##name,
+#define MONITOR_FILTER(name, filter) filter,
+
+enum {
+	MONITORS(MONITOR_INDEX)
+	MONITORS_ISR(MONITOR_INDEX)
+	MON_COUNT
+};
+
+static const char *const filters[] = {
+	MONITORS(MONITOR_FILTER)
+	MONITORS_ISR(MONITOR_FILTER)
+};
+
+static uint32_t received[MON_COUNT];
+static uint32_t expected[MON_COUNT];
+
+#define MONITOR_DEFINE(name, filter)                                                               \
+	AT_MONITOR(mon_##name, filter, on_##name);                                                 \
+	static void on_##name(const char *notif)                                                   \
+	{                                                                                          \
+		received[MON_##name]++;                                                            \
+	}
+
+#define MONITOR_ISR_DEFINE(name, filter)                                                           \
+	AT_MONITOR_ISR(mon_##name, filter, on_##name);                                             \
+	static void on_##name(const char *notif)                                                   \
+	{                                                                                          \
+		received[MON_##name]++;                                                            \
+	}
+
+MONITORS(MONITOR_DEFINE)
+MONITORS_ISR(MONITOR_ISR_DEFINE)
+
+/* Notifications recorded from a modem attaching to the network, moving between cells,
+ * sending data and going to sleep.
+ */
+static const char *const trace[] = {
+	"%MDMEV: SEARCH STATUS 1\r\n",
+	"+CEREG: 2,\"76C1\",\"0102DA04\",7\r\n",
+	"+CSCON: 1\r\n",
+	"%MDMEV: PRACH CE-LEVEL 0\r\n",
+	"+CGEV: EXCE STATUS 0\r\n",
+	"+CNEC_ESM: 50,0\r\n",
+	"+CEREG: 5,\"76C1\",\"0102DA04\",7,,,\"11100000\",\"11100000\"\r\n",
+	"+CGEV: ME PDN ACT 0\r\n",
+	"%XTIME: \"0A\",\"52400161227140\",\"00\"\r\n",
+	"+CEDRXP: 4,\"1000\",\"0101\",\"1011\"\r\n",
+	"%MDMEV: SEARCH STATUS 2\r\n",
+	"%CESQ: 54,2,16,2\r\n",
+	"+CSCON: 0\r\n",
+	"%XT3412: 3240000\r\n",
+	"%XMODEMSLEEP: 1,86399999\r\n",
+	"+CSCON: 1\r\n",
+	"%RAI: \"0102DA04\",\"001\",\"01\",1\r\n",
+	"+CSCON: 0\r\n",
+	"%NCELLMEAS: 0,\"0102DA04\",\"26295\",\"76C1\",64,6400,8,54,16,5600,6400,263,49,10,0\r\n",
+	"+CEREG: 1,\"76C2\",\"0102DA05\",7\r\n",
+	"%CESQ: 48,2,12,1\r\n",
+	"+CMT: \"+4712345678\",22\r\n",
+	"%XVBATLOWLVL: 3300\r\n",
+	"%MDMEV: ME BATTERY LOW\r\n",
+	"+CEREG: 0\r\n",
+};
+
+static void run(void)
+{
+	uint64_t isr_cycles = 0;
+	uint64_t wq_cycles = 0;
+	uint32_t start;
+	uint32_t dispatched;
+
+	memset(received, 0, sizeof(received));
+	memset(expected, 0, sizeof(expected));
+
+	for (size_t i = 0; i < ARRAY_SIZE(trace); i++) {
+		for (size_t j = 0; j < MON_COUNT; j++) {
+			if (strstr(trace[i], filters[j])) {
+				expected[j] += REPEAT_CNT;
+			}
+		}
+	}
+
+	for (int r = 0; r < REPEAT_CNT; r++) {
+		for (size_t i = 0; i < ARRAY_SIZE(trace); i++) {
+			/* Hold the workqueue while dispatching, as the ISR would. */
+			k_sched_lock();
+			start = k_cycle_get_32();
+			at_monitor_dispatch(trace[i]);
+			dispatched = k_cycle_get_32();
+			k_sched_unlock();
+			/* The system workqueue preempts this thread and dispatches the notification. */
+			k_yield();
+			isr_cycles += dispatched - start;
+			wq_cycles += k_cycle_get_32() - dispatched;
+		}
+	}
+
+	for (size_t j = 0; j < MON_COUNT; j++) {
+		zassert_equal(received[j], expected[j], "Monitor %s received %u, expected %u",
+			      filters[j], received[j], expected[j]);
+	}
+
+	TC_PRINT("%u monitors, %u notifications, matcher %s\n", MON_COUNT,
+		 REPEAT_CNT * ARRAY_SIZE(trace),
+		 IS_ENABLED(CONFIG_AT_MONITOR_MATCHER) ? "enabled" : "disabled");
+	TC_PRINT("ISR: %llu cycles per notification\n",
+		 isr_cycles / (REPEAT_CNT * ARRAY_SIZE(trace)));
+	TC_PRINT("Workqueue: %llu cycles per notification\n",
+		 wq_cycles / (REPEAT_CNT * ARRAY_SIZE(trace)));
+}
+
+ZTEST(at_monitor_bench, test_trace)
+{
+	run();
+}
+
+ZTEST_SUITE(at_monitor_bench, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/bluetooth/mesh.h>
+
+#include <mesh/net.h>
+#include <mesh/rpl.h>
+
+#define ROUNDS 16
+
+/* Every entry of the replay protection list is used. */
+#define SRC_CNT CONFIG_BT_MESH_CRPL
+
+/* Stride of the order in which the sources send messages, coprime with SRC_CNT. */
+#define SRC_STRIDE 97
+
+BUILD_ASSERT(SRC_CNT >= 256, "The benchmark needs at least 256 sources");
+
+static uint16_t src_addr(size_t i)
+{
+	/* Primary element addresses of nodes with three elements each. */
+	return 0x0100 + ((i * SRC_STRIDE) % SRC_CNT) * 3;
+}
+
+static bool rpl_check(uint16_t src, uint32_t seq, bool old_iv)
+{
+	struct bt_mesh_net_rx rx = {
+		.ctx.addr = src,
+		.seq = seq,
+		.old_iv = old_iv,
+		.local_match = 1,
+		.net_if = BT_MESH_NET_IF_ADV,
+	};
+
+	return bt_mesh_rpl_check(&rx, NULL, false);
+}
+
+static const char *rpl_engine_name(void)
+{
+	return IS_ENABLED(CONFIG_BT_MESH_RPL_HASH) ? "hash index" : "linear";
+}
+
+/* Check a message of every source, and return the average number of cycles for a check. */
+static uint64_t rpl_check_all(uint32_t seq, bool replay)
+{
+	uint64_t cycles = 0;
+	uint32_t start;
+	bool rejected;
+
+	for (size_t i = 0; i < SRC_CNT; i++) {
+		start = k_cycle_get_32();
+		rejected = rpl_check(src_addr(i), seq, false);
+		cycles += k_cycle_get_32() - start;
+
+		zassert_equal(rejected, replay, "Unexpected result for 0x%04x", src_addr(i));
+	}
+
+	return cycles / SRC_CNT;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	bt_mesh_rpl_clear();
+}
+
+ZTEST(bt_mesh_rpl_bench, test_check)
+{
+	uint64_t new_cycles;
+	uint64_t accept_cycles = 0;
+	uint64_t replay_cycles = 0;
+
+	new_cycles = rpl_check_all(0, false);
+
+	for (uint32_t r = 1; r <= ROUNDS; r++) {
+		accept_cycles += rpl_check_all(r, false);
+		replay_cycles += rpl_check_all(r, true);
+	}
+
+	TC_PRINT("%s RPL: %u sources\n", rpl_engine_name(), SRC_CNT);
+	TC_PRINT("new source: %llu cycles\n", new_cycles);
+	TC_PRINT("accepted: %llu cycles\n", accept_cycles / ROUNDS);
+	TC_PRINT("replayed: %llu cycles\n", replay_cycles / ROUNDS);
+}
+
+ZTEST(bt_mesh_rpl_bench, test_full)
+{
+	(void)rpl_check_all(0, false);
+
+	zassert_true(rpl_check(0x0001, 0, false), "New source accepted in a full RPL");
+	zassert_false(rpl_check(src_addr(0), 1, false), "Known source rejected in a full RPL");
+}
+
+ZTEST(bt_mesh_rpl_bench, test_iv_update)
+{
+	(void)rpl_check_all(1, false);
+
+	/* All entries are moved to the old IV Index. */
+	bt_mesh_rpl_reset();
+
+	zassert_true(rpl_check(src_addr(0), 1, true), "Replayed message accepted");
+	zassert_false(rpl_check(src_addr(0), 2, true), "Message on the old IV Index rejected");
+
+	/* Every second source sends a message on the new IV Index. */
+	for (size_t i = 0; i < SRC_CNT; i += 2) {
+		zassert_false(rpl_check(src_addr(i), 0, false), "Message on the new IV Index rejected");
+	}
+
+	/* The entries of the other sources are removed, and the list is compacted. */
+	bt_mesh_rpl_reset();
+
+	for (size_t i = 0; i < SRC_CNT; i++) {
+		zassert_equal(rpl_check(src_addr(i), 0, true), !(i % 2),
+			      "Unexpected result for 0x%04x", src_addr(i));
+	}
+}
+
+ZTEST_SUITE(bt_mesh_rpl_bench, NULL, NULL, before, NULL, NULL);
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/bluetooth/uuid.h>
+#include <bluetooth/scan.h>
+
+#include "trace.h"
+
+#define ROUNDS 16
+
+/* Devices matched in a single pass of the trace. */
+#define ANY_MODE_MATCH_CNT 16
+#define ALL_MODE_MATCH_CNT 3
+
+static const char * const names[] = {
+	"Nordic_HRM", "Nordic_HIDS", "Nordic_Blinky", "Nordic_Glucose",
+	"Nordic_CGM", "Nordic_ESL", "Nordic_Beacon", "Nordic_Mesh",
+};
+
+static const struct bt_uuid_128 uuid_nus =
+	BT_UUID_INIT_128(BT_UUID_128_ENCODE(0x6e400001, 0xb5a3, 0xf393, 0xe0a9, 0xe50e24dcca9e));
+static const struct bt_uuid_128 uuid_lbs =
+	BT_UUID_INIT_128(BT_UUID_128_ENCODE(0x00001523, 0x1212, 0xefde, 0x1523, 0x785feabcd123));
+static const struct bt_uuid_128 uuid_thingy =
+	BT_UUID_INIT_128(BT_UUID_128_ENCODE(0xef680100, 0x9b35, 0x4933, 0x9b10, 0x52ffa9740042));
+
+static struct bt_le_scan_cb *scan_cb;
+static uint32_t match_cnt;
+
+int __wrap_bt_le_scan_cb_register(struct bt_le_scan_cb *cb)
+{
+	scan_cb = cb;
+
+	return 0;
+}
+
+static void filter_match(struct bt_scan_device_info *device_info,
+			 struct bt_scan_filter_match *filter_match, bool connectable)
+{
+	match_cnt++;
+}
+
+BT_SCAN_CB_INIT(scan_cb_data, filter_match, NULL, NULL, NULL);
+
+static const char *filter_engine_name(void)
+{
+	return IS_ENABLED(CONFIG_BT_SCAN_FILTER_HASH) ? "lookup tables" : "linear";
+}
+
+static void trace_replay(const char *mode, uint32_t expected_match_cnt)
+{
+	uint64_t cycles = 0;
+	uint32_t start;
+
+	zassert_not_null(scan_cb, "Scanning callback not registered");
+
+	match_cnt = 0;
+
+	for (int r = 0; r < ROUNDS; r++) {
+		for (size_t i = 0; i < trace_len; i++) {
+			struct net_buf_simple buf;
+			struct bt_le_scan_recv_info info = {
+				.addr = &trace[i].addr,
+				.adv_props = trace[i].adv_props,
+			};
+
+			net_buf_simple_init_with_data(&buf, (void *)trace[i].data, trace[i].len);
+
+			start = k_cycle_get_32();
+			scan_cb->recv(&info, &buf);
+			cycles += k_cycle_get_32() - start;
+		}
+	}
+
+	zassert_equal(match_cnt, ROUNDS * expected_match_cnt, "Unexpected number of matches");
+
+	TC_PRINT("%s filters, %s mode: %zu reports\n", filter_engine_name(), mode, trace_len);
+	TC_PRINT("scan_recv: %llu cycles\n", cycles / (ROUNDS * trace_len));
+}
+
+static void *setup(void)
+{
+	bt_scan_cb_register(&scan_cb_data);
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	bt_scan_init(NULL);
+	bt_scan_blocklist_clear();
+
+	for (size_t i = 0; i < trace_blocklist_len; i++) {
+		zassert_ok(bt_scan_blocklist_device_add(&trace_blocklist[i]));
+	}
+
+	for (size_t i = 0; i < trace_filter_addr_len; i++) {
+		zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &trace_filter_addr[i]));
+	}
+}
+
+ZTEST(bt_scan_bench, test_any_mode)
+{
+	const struct bt_uuid *uuids[] = {
+		BT_UUID_HRS, BT_UUID_HIDS, BT_UUID_GLS, BT_UUID_CGMS,
+		&uuid_nus.uuid, &uuid_lbs.uuid, &uuid_thingy.uuid, BT_UUID_ESS,
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(names); i++) {
+		zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, names[i]));
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(uuids); i++) {
+		zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, uuids[i]));
+	}
+
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_ADDR_FILTER | BT_SCAN_NAME_FILTER |
+					 BT_SCAN_UUID_FILTER, false));
+
+	trace_replay("any", ANY_MODE_MATCH_CNT);
+}
+
+ZTEST(bt_scan_bench, test_all_mode)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(names); i++) {
+		zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, names[i]));
+	}
+
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_ADDR_FILTER | BT_SCAN_NAME_FILTER, true));
+
+	trace_replay("all", ALL_MODE_MATCH_CNT);
+}
+
+ZTEST_SUITE(bt_scan_bench, NULL, setup, before, NULL, NULL);
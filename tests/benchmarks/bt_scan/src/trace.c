@@ -0,0 +1,518 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "trace.h"
+
+/* Advertising reports of a dense environment, made of beacons, phones, wearables and a few
+ * devices the benchmark looks for. The reports are passed to the library in this order.
+ */
+const struct adv_report trace[] = {
+	{ /* Eddystone-URL */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xb6, 0xbd, 0xf3, 0xa6, 0x85, 0xe2}}},
+		.len = 25,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x03, 0xaa, 0xfe, 0x11, 0x16, 0xaa, 0xfe, 0x10,
+			 0xf4, 0x03, 0x6e, 0x6f, 0x72, 0x64, 0x69, 0x63, 0x73, 0x65, 0x6d, 0x69,
+			 0x07},
+	},
+	{ /* Microsoft CDP */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x4c, 0x9d, 0xe8, 0xda, 0xd5, 0xe9}}},
+		.len = 31,
+		.data = {0x1e, 0xff, 0x06, 0x00, 0x01, 0x09, 0x20, 0x02, 0xa9, 0x3c, 0x7f, 0x4f,
+			 0x83, 0x3a, 0xab, 0x76, 0x4b, 0xfd, 0x5d, 0x25, 0x34, 0x5d, 0x86, 0xb3,
+			 0x1e, 0x03, 0x3e, 0xac, 0x98, 0x73, 0x86},
+	},
+	{ /* Named device */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x89, 0x62, 0x1b, 0xcc, 0xdd, 0xd1}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 19,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x03, 0x0a, 0x18, 0x0b, 0x09, 0x57, 0x48, 0x2d,
+			 0x31, 0x30, 0x30, 0x30, 0x58, 0x4d, 0x34},
+	},
+	{ /* Device in the address filter */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x88, 0xa2, 0x65, 0x8d, 0xea, 0xdb}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 15,
+		.data = {0x02, 0x01, 0x06, 0x0b, 0xff, 0x59, 0x00, 0xb7, 0x0b, 0xee, 0x4c, 0x32,
+			 0xc8, 0xcc, 0xb3},
+	},
+	{ /* Eddystone-URL */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xd5, 0x19, 0x2d, 0x93, 0x2d, 0xf3}}},
+		.len = 25,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x03, 0xaa, 0xfe, 0x11, 0x16, 0xaa, 0xfe, 0x10,
+			 0xf4, 0x03, 0x6e, 0x6f, 0x72, 0x64, 0x69, 0x63, 0x73, 0x65, 0x6d, 0x69,
+			 0x07},
+	},
+	{ /* Nordic UART Service */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xda, 0xfb, 0xbd, 0x2e, 0x81, 0xfa}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 31,
+		.data = {0x02, 0x01, 0x06, 0x11, 0x07, 0x9e, 0xca, 0xdc, 0x24, 0x0e, 0xe5, 0xa9,
+			 0xe0, 0x93, 0xf3, 0xa3, 0xb5, 0x01, 0x00, 0x40, 0x6e, 0x09, 0x08, 0x4e,
+			 0x6f, 0x72, 0x64, 0x69, 0x63, 0x5f, 0x55},
+	},
+	{ /* Microsoft CDP */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xac, 0xbb, 0x0e, 0x42, 0xeb, 0xdd}}},
+		.len = 31,
+		.data = {0x1e, 0xff, 0x06, 0x00, 0x01, 0x09, 0x20, 0x02, 0x39, 0xb0, 0x83, 0x84,
+			 0x3f, 0xfa, 0x00, 0xa2, 0x98, 0x82, 0x17, 0x05, 0x03, 0x9b, 0x9b, 0xde,
+			 0x13, 0x57, 0xbe, 0xa9, 0xb5, 0x44, 0x45},
+	},
+	{ /* Named device */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x4e, 0x78, 0x87, 0x0e, 0xff, 0xf3}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 20,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x03, 0x0a, 0x18, 0x0c, 0x09, 0x47, 0x61, 0x72,
+			 0x6d, 0x69, 0x6e, 0x20, 0x56, 0x65, 0x6e, 0x75},
+	},
+	{ /* Microsoft CDP */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x5e, 0x67, 0x79, 0x37, 0xd4, 0xcf}}},
+		.len = 31,
+		.data = {0x1e, 0xff, 0x06, 0x00, 0x01, 0x09, 0x20, 0x02, 0x4b, 0x3c, 0x8e, 0x8a,
+			 0x7a, 0x1d, 0xd6, 0x44, 0xc0, 0x6f, 0x6a, 0x17, 0x3e, 0xa4, 0xfa, 0x95,
+			 0xc8, 0x03, 0x1a, 0x99, 0x45, 0x0b, 0x68},
+	},
+	{ /* Nordic_HRM */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xb4, 0x4b, 0x89, 0x93, 0x07, 0xc0}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 21,
+		.data = {0x02, 0x01, 0x06, 0x05, 0x03, 0x0d, 0x18, 0x0f, 0x18, 0x0b, 0x09, 0x4e,
+			 0x6f, 0x72, 0x64, 0x69, 0x63, 0x5f, 0x48, 0x52, 0x4d},
+	},
+	{ /* Vendor service */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x25, 0x47, 0x04, 0x47, 0x6d, 0xce}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 26,
+		.data = {0x02, 0x01, 0x06, 0x11, 0x07, 0x0e, 0xa9, 0x7d, 0xb0, 0x74, 0x9f, 0x52,
+			 0x8f, 0xa9, 0x96, 0xb8, 0x26, 0x4b, 0x8d, 0x8c, 0x4b, 0x04, 0x08, 0x44,
+			 0x65, 0x76},
+	},
+	{ /* Vendor service */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x4c, 0x31, 0x1a, 0x68, 0x4e, 0xf9}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 26,
+		.data = {0x02, 0x01, 0x06, 0x11, 0x07, 0x2a, 0xf4, 0x58, 0x00, 0xbe, 0xc0, 0x76,
+			 0x21, 0xc3, 0xcd, 0x32, 0x16, 0x3c, 0x6c, 0xc0, 0x32, 0x04, 0x08, 0x44,
+			 0x65, 0x76},
+	},
+	{ /* Vendor service */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xa4, 0x68, 0xbb, 0x40, 0xa0, 0xd4}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 26,
+		.data = {0x02, 0x01, 0x06, 0x11, 0x07, 0x0e, 0xa9, 0x7d, 0xb0, 0x74, 0x9f, 0x52,
+			 0x8f, 0xa9, 0x96, 0xb8, 0x26, 0x4b, 0x8d, 0x8c, 0x4b, 0x04, 0x08, 0x44,
+			 0x65, 0x76},
+	},
+	{ /* Vendor service */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x7e, 0x55, 0xa7, 0x63, 0x70, 0xdb}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 26,
+		.data = {0x02, 0x01, 0x06, 0x11, 0x07, 0xd2, 0x19, 0x0e, 0x22, 0x63, 0x60, 0x0d,
+			 0x74, 0xcb, 0xeb, 0xb5, 0x0f, 0x38, 0x65, 0x6a, 0x3e, 0x04, 0x08, 0x44,
+			 0x65, 0x76},
+	},
+	{ /* Named device */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x9c, 0xa0, 0x50, 0xef, 0xbc, 0xde}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 21,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x03, 0x0a, 0x18, 0x0d, 0x09, 0x4c, 0x45, 0x2d,
+			 0x42, 0x6f, 0x73, 0x65, 0x20, 0x51, 0x43, 0x33, 0x35},
+	},
+	{ /* Microsoft CDP */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x5a, 0x44, 0x3c, 0x62, 0x18, 0xec}}},
+		.len = 31,
+		.data = {0x1e, 0xff, 0x06, 0x00, 0x01, 0x09, 0x20, 0x02, 0x9a, 0x46, 0x68, 0xf3,
+			 0xd3, 0xee, 0x3b, 0xca, 0xa4, 0xe6, 0x41, 0x3d, 0xb3, 0x58, 0x3a, 0xad,
+			 0x35, 0x09, 0x04, 0x85, 0x28, 0x9f, 0x94},
+	},
+	{ /* Eddystone-URL */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xa2, 0x45, 0x02, 0xe8, 0x24, 0xec}}},
+		.len = 25,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x03, 0xaa, 0xfe, 0x11, 0x16, 0xaa, 0xfe, 0x10,
+			 0xf4, 0x03, 0x6e, 0x6f, 0x72, 0x64, 0x69, 0x63, 0x73, 0x65, 0x6d, 0x69,
+			 0x07},
+	},
+	{ /* Microsoft CDP */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x15, 0xad, 0x44, 0xb5, 0xaa, 0xc1}}},
+		.len = 31,
+		.data = {0x1e, 0xff, 0x06, 0x00, 0x01, 0x09, 0x20, 0x02, 0x63, 0x3d, 0x3e, 0xec,
+			 0x5f, 0x1a, 0x9e, 0x33, 0x49, 0x6d, 0xa3, 0x5d, 0xdd, 0x5c, 0xcb, 0xf8,
+			 0x3d, 0x90, 0x60, 0x55, 0x62, 0x1e, 0xdf},
+	},
+	{ /* iBeacon */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x13, 0x42, 0x9f, 0x49, 0x3b, 0xf3}}},
+		.len = 30,
+		.data = {0x02, 0x01, 0x06, 0x1a, 0xff, 0x4c, 0x00, 0x02, 0x15, 0xd6, 0xfd, 0xdc,
+			 0xf3, 0x40, 0x9e, 0x96, 0x51, 0xbe, 0x89, 0x1d, 0x2e, 0xb6, 0x9d, 0x7c,
+			 0xe0, 0x00, 0x01, 0x00, 0x02, 0xc5},
+	},
+	{ /* Device in the address filter */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xe1, 0x92, 0x76, 0x51, 0xe3, 0xfe}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 15,
+		.data = {0x02, 0x01, 0x06, 0x0b, 0xff, 0x59, 0x00, 0x66, 0x52, 0x8f, 0x14, 0x8a,
+			 0x83, 0x14, 0x6c},
+	},
+	{ /* Vendor service */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x99, 0xd4, 0x47, 0x10, 0x9c, 0xf2}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 26,
+		.data = {0x02, 0x01, 0x06, 0x11, 0x07, 0x7c, 0x10, 0x3b, 0x45, 0xbc, 0x2c, 0xeb,
+			 0x8e, 0xe2, 0x5a, 0xa5, 0xe4, 0xe9, 0xcc, 0x25, 0xdc, 0x04, 0x08, 0x44,
+			 0x65, 0x76},
+	},
+	{ /* iBeacon */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x9a, 0xa5, 0xb5, 0xe4, 0x38, 0xfd}}},
+		.len = 30,
+		.data = {0x02, 0x01, 0x06, 0x1a, 0xff, 0x4c, 0x00, 0x02, 0x15, 0x50, 0xf7, 0xbb,
+			 0xd9, 0x2d, 0x40, 0xd9, 0xaa, 0x3a, 0x95, 0xd2, 0xb8, 0x5e, 0xb8, 0xe8,
+			 0x72, 0x00, 0x01, 0x00, 0x02, 0xc5},
+	},
+	{ /* iBeacon */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xb2, 0x04, 0xca, 0x31, 0xd4, 0xc9}}},
+		.len = 30,
+		.data = {0x02, 0x01, 0x06, 0x1a, 0xff, 0x4c, 0x00, 0x02, 0x15, 0x18, 0xc8, 0xa6,
+			 0xc0, 0xdf, 0xe1, 0xfc, 0x6b, 0x16, 0x80, 0x79, 0x04, 0x1a, 0xeb, 0x14,
+			 0x38, 0x00, 0x01, 0x00, 0x02, 0xc5},
+	},
+	{ /* iBeacon */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x75, 0x23, 0x84, 0xa9, 0xf0, 0xf2}}},
+		.len = 30,
+		.data = {0x02, 0x01, 0x06, 0x1a, 0xff, 0x4c, 0x00, 0x02, 0x15, 0x16, 0xb3, 0xef,
+			 0x45, 0xce, 0x7f, 0x44, 0xce, 0x84, 0x62, 0xd2, 0xe8, 0x2e, 0xcb, 0x62,
+			 0xbf, 0x00, 0x01, 0x00, 0x02, 0xc5},
+	},
+	{ /* Nordic_HRM */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xfc, 0xd6, 0x87, 0x79, 0x7b, 0xc3}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 21,
+		.data = {0x02, 0x01, 0x06, 0x05, 0x03, 0x0d, 0x18, 0x0f, 0x18, 0x0b, 0x09, 0x4e,
+			 0x6f, 0x72, 0x64, 0x69, 0x63, 0x5f, 0x48, 0x52, 0x4d},
+	},
+	{ /* iBeacon */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x87, 0xcc, 0x65, 0xd8, 0xf1, 0xd4}}},
+		.len = 30,
+		.data = {0x02, 0x01, 0x06, 0x1a, 0xff, 0x4c, 0x00, 0x02, 0x15, 0xce, 0x5f, 0x14,
+			 0xe7, 0x54, 0xc3, 0xd6, 0x00, 0x5d, 0x11, 0x3b, 0x1f, 0xa4, 0xa0, 0x17,
+			 0x5a, 0x00, 0x01, 0x00, 0x02, 0xc5},
+	},
+	{ /* iBeacon */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x9c, 0x66, 0x9b, 0xab, 0xf1, 0xd2}}},
+		.len = 30,
+		.data = {0x02, 0x01, 0x06, 0x1a, 0xff, 0x4c, 0x00, 0x02, 0x15, 0x8d, 0x35, 0x94,
+			 0xc0, 0xaf, 0x99, 0x42, 0xdd, 0x5c, 0xde, 0x9d, 0x7b, 0xfe, 0xad, 0xed,
+			 0x26, 0x00, 0x01, 0x00, 0x02, 0xc5},
+	},
+	{ /* iBeacon */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xb5, 0x24, 0xf3, 0xb2, 0x55, 0xc3}}},
+		.len = 30,
+		.data = {0x02, 0x01, 0x06, 0x1a, 0xff, 0x4c, 0x00, 0x02, 0x15, 0xb7, 0x20, 0x75,
+			 0xd7, 0x6a, 0x24, 0x48, 0x3d, 0x19, 0x3a, 0xa2, 0x04, 0x3d, 0x01, 0x56,
+			 0x37, 0x00, 0x01, 0x00, 0x02, 0xc5},
+	},
+	{ /* Vendor service */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x6b, 0xc2, 0xe2, 0x5d, 0xdc, 0xed}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 26,
+		.data = {0x02, 0x01, 0x06, 0x11, 0x07, 0x2a, 0xf4, 0x58, 0x00, 0xbe, 0xc0, 0x76,
+			 0x21, 0xc3, 0xcd, 0x32, 0x16, 0x3c, 0x6c, 0xc0, 0x32, 0x04, 0x08, 0x44,
+			 0x65, 0x76},
+	},
+	{ /* Eddystone-URL */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xf6, 0x7d, 0xf9, 0xb3, 0xad, 0xcc}}},
+		.len = 25,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x03, 0xaa, 0xfe, 0x11, 0x16, 0xaa, 0xfe, 0x10,
+			 0xf4, 0x03, 0x6e, 0x6f, 0x72, 0x64, 0x69, 0x63, 0x73, 0x65, 0x6d, 0x69,
+			 0x07},
+	},
+	{ /* iBeacon */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x6c, 0xb9, 0xbc, 0x02, 0x6d, 0xc6}}},
+		.len = 30,
+		.data = {0x02, 0x01, 0x06, 0x1a, 0xff, 0x4c, 0x00, 0x02, 0x15, 0xde, 0x35, 0xac,
+			 0x42, 0xa1, 0xbb, 0xe0, 0x8d, 0xbe, 0x3e, 0x83, 0x4c, 0xcb, 0x8a, 0xd7,
+			 0x72, 0x00, 0x01, 0x00, 0x02, 0xc5},
+	},
+	{ /* Device in the address filter */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x1c, 0x33, 0x58, 0xe4, 0xcd, 0xee}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 15,
+		.data = {0x02, 0x01, 0x06, 0x0b, 0xff, 0x59, 0x00, 0x43, 0xdb, 0x55, 0xcc, 0x08,
+			 0xfd, 0x12, 0xf0},
+	},
+	{ /* Eddystone-URL */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x20, 0x49, 0x3f, 0x98, 0x5c, 0xd9}}},
+		.len = 25,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x03, 0xaa, 0xfe, 0x11, 0x16, 0xaa, 0xfe, 0x10,
+			 0xf4, 0x03, 0x6e, 0x6f, 0x72, 0x64, 0x69, 0x63, 0x73, 0x65, 0x6d, 0x69,
+			 0x07},
+	},
+	{ /* Nordic UART Service */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x84, 0xc0, 0x9f, 0x24, 0x40, 0xfc}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 31,
+		.data = {0x02, 0x01, 0x06, 0x11, 0x07, 0x9e, 0xca, 0xdc, 0x24, 0x0e, 0xe5, 0xa9,
+			 0xe0, 0x93, 0xf3, 0xa3, 0xb5, 0x01, 0x00, 0x40, 0x6e, 0x09, 0x08, 0x4e,
+			 0x6f, 0x72, 0x64, 0x69, 0x63, 0x5f, 0x55},
+	},
+	{ /* Microsoft CDP */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x45, 0xb3, 0xf5, 0x2a, 0xf8, 0xde}}},
+		.len = 31,
+		.data = {0x1e, 0xff, 0x06, 0x00, 0x01, 0x09, 0x20, 0x02, 0xf9, 0x27, 0x01, 0x77,
+			 0x2c, 0xee, 0x3b, 0x76, 0x12, 0xba, 0xd7, 0x98, 0x00, 0x18, 0xf7, 0x02,
+			 0xf4, 0x14, 0xea, 0x2b, 0x45, 0x05, 0x65},
+	},
+	{ /* Nordic_HIDS */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xf8, 0xce, 0xf9, 0x49, 0xf4, 0xfa}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 26,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x19, 0xc1, 0x03, 0x05, 0x03, 0x12, 0x18, 0x0f,
+			 0x18, 0x0c, 0x09, 0x4e, 0x6f, 0x72, 0x64, 0x69, 0x63, 0x5f, 0x48, 0x49,
+			 0x44, 0x53},
+	},
+	{ /* Vendor service */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x2b, 0x7e, 0x17, 0x81, 0x6a, 0xdd}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 26,
+		.data = {0x02, 0x01, 0x06, 0x11, 0x07, 0xd2, 0x19, 0x0e, 0x22, 0x63, 0x60, 0x0d,
+			 0x74, 0xcb, 0xeb, 0xb5, 0x0f, 0x38, 0x65, 0x6a, 0x3e, 0x04, 0x08, 0x44,
+			 0x65, 0x76},
+	},
+	{ /* Named device */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xd5, 0x01, 0xc6, 0x21, 0xcd, 0xdc}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 13,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x03, 0x0a, 0x18, 0x05, 0x09, 0x54, 0x69, 0x6c,
+			 0x65},
+	},
+	{ /* Device in the address filter */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x5e, 0x5a, 0x2e, 0xc7, 0x35, 0xc1}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 15,
+		.data = {0x02, 0x01, 0x06, 0x0b, 0xff, 0x59, 0x00, 0x37, 0x6e, 0x74, 0xdb, 0x6d,
+			 0xcf, 0xbe, 0x55},
+	},
+	{ /* Eddystone-URL */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x94, 0x9a, 0x05, 0x10, 0x77, 0xc0}}},
+		.len = 25,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x03, 0xaa, 0xfe, 0x11, 0x16, 0xaa, 0xfe, 0x10,
+			 0xf4, 0x03, 0x6e, 0x6f, 0x72, 0x64, 0x69, 0x63, 0x73, 0x65, 0x6d, 0x69,
+			 0x07},
+	},
+	{ /* iBeacon */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x45, 0x52, 0xf3, 0xec, 0xe2, 0xe5}}},
+		.len = 30,
+		.data = {0x02, 0x01, 0x06, 0x1a, 0xff, 0x4c, 0x00, 0x02, 0x15, 0x4a, 0x81, 0x5a,
+			 0xfc, 0x95, 0xeb, 0x3f, 0x95, 0x29, 0x90, 0x34, 0x54, 0x73, 0x2d, 0x73,
+			 0xac, 0x00, 0x01, 0x00, 0x02, 0xc5},
+	},
+	{ /* Microsoft CDP */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x13, 0x51, 0xd1, 0xca, 0x49, 0xfb}}},
+		.len = 31,
+		.data = {0x1e, 0xff, 0x06, 0x00, 0x01, 0x09, 0x20, 0x02, 0xa3, 0x4c, 0x69, 0xfd,
+			 0x92, 0x7c, 0x24, 0x52, 0x08, 0x00, 0x6c, 0xa7, 0x58, 0xca, 0x58, 0x16,
+			 0x04, 0x37, 0xec, 0x14, 0x77, 0x84, 0x3e},
+	},
+	{ /* Nordic UART Service */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x60, 0x02, 0x62, 0x57, 0xee, 0xf4}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 31,
+		.data = {0x02, 0x01, 0x06, 0x11, 0x07, 0x9e, 0xca, 0xdc, 0x24, 0x0e, 0xe5, 0xa9,
+			 0xe0, 0x93, 0xf3, 0xa3, 0xb5, 0x01, 0x00, 0x40, 0x6e, 0x09, 0x08, 0x4e,
+			 0x6f, 0x72, 0x64, 0x69, 0x63, 0x5f, 0x55},
+	},
+	{ /* Nordic_HRM */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x40, 0x40, 0x6b, 0xd9, 0x52, 0xf9}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 21,
+		.data = {0x02, 0x01, 0x06, 0x05, 0x03, 0x0d, 0x18, 0x0f, 0x18, 0x0b, 0x09, 0x4e,
+			 0x6f, 0x72, 0x64, 0x69, 0x63, 0x5f, 0x48, 0x52, 0x4d},
+	},
+	{ /* iBeacon */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xf4, 0xbb, 0x53, 0x63, 0x3b, 0xc5}}},
+		.len = 30,
+		.data = {0x02, 0x01, 0x06, 0x1a, 0xff, 0x4c, 0x00, 0x02, 0x15, 0xf9, 0x6d, 0x0d,
+			 0x9d, 0x8c, 0x20, 0xa9, 0xd4, 0x0e, 0x96, 0xac, 0x2d, 0x64, 0xc2, 0xa3,
+			 0x42, 0x00, 0x01, 0x00, 0x02, 0xc5},
+	},
+	{ /* Nordic_Blinky */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x4e, 0xe3, 0x2d, 0xba, 0x51, 0xe6}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 18,
+		.data = {0x02, 0x01, 0x06, 0x0e, 0x09, 0x4e, 0x6f, 0x72, 0x64, 0x69, 0x63, 0x5f,
+			 0x42, 0x6c, 0x69, 0x6e, 0x6b, 0x79},
+	},
+	{ /* Eddystone-URL */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x41, 0xa8, 0xa9, 0x98, 0x02, 0xfe}}},
+		.len = 25,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x03, 0xaa, 0xfe, 0x11, 0x16, 0xaa, 0xfe, 0x10,
+			 0xf4, 0x03, 0x6e, 0x6f, 0x72, 0x64, 0x69, 0x63, 0x73, 0x65, 0x6d, 0x69,
+			 0x07},
+	},
+	{ /* Eddystone-URL */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x8e, 0x58, 0x5f, 0x36, 0x6c, 0xc8}}},
+		.len = 25,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x03, 0xaa, 0xfe, 0x11, 0x16, 0xaa, 0xfe, 0x10,
+			 0xf4, 0x03, 0x6e, 0x6f, 0x72, 0x64, 0x69, 0x63, 0x73, 0x65, 0x6d, 0x69,
+			 0x07},
+	},
+	{ /* Nordic_Blinky */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x80, 0x38, 0xba, 0x10, 0xc7, 0xdf}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 18,
+		.data = {0x02, 0x01, 0x06, 0x0e, 0x09, 0x4e, 0x6f, 0x72, 0x64, 0x69, 0x63, 0x5f,
+			 0x42, 0x6c, 0x69, 0x6e, 0x6b, 0x79},
+	},
+	{ /* Microsoft CDP */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x7a, 0xfc, 0x89, 0x44, 0xa0, 0xc6}}},
+		.len = 31,
+		.data = {0x1e, 0xff, 0x06, 0x00, 0x01, 0x09, 0x20, 0x02, 0x06, 0xa8, 0x3b, 0x26,
+			 0x07, 0x64, 0x69, 0x8e, 0x35, 0xc3, 0x53, 0x0e, 0xfb, 0x0f, 0x42, 0x68,
+			 0xa5, 0x14, 0x96, 0x10, 0x14, 0x90, 0xcb},
+	},
+	{ /* Microsoft CDP */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xe9, 0xaa, 0x74, 0x0a, 0x8c, 0xd6}}},
+		.len = 31,
+		.data = {0x1e, 0xff, 0x06, 0x00, 0x01, 0x09, 0x20, 0x02, 0x53, 0x06, 0x18, 0x15,
+			 0xbc, 0x58, 0x20, 0x63, 0x02, 0xfa, 0x80, 0xa3, 0xfb, 0xe8, 0xdc, 0xa6,
+			 0xe4, 0x95, 0xea, 0x30, 0x3c, 0x65, 0x51},
+	},
+	{ /* Named device */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x8e, 0x55, 0x8c, 0xb6, 0x29, 0xdc}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 21,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x03, 0x0a, 0x18, 0x0d, 0x09, 0x4c, 0x45, 0x2d,
+			 0x42, 0x6f, 0x73, 0x65, 0x20, 0x51, 0x43, 0x33, 0x35},
+	},
+	{ /* iBeacon */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x2b, 0x91, 0x09, 0x87, 0x62, 0xc3}}},
+		.len = 30,
+		.data = {0x02, 0x01, 0x06, 0x1a, 0xff, 0x4c, 0x00, 0x02, 0x15, 0xff, 0x8c, 0xb9,
+			 0x1d, 0x15, 0xe4, 0x60, 0xd0, 0x3b, 0xaf, 0x64, 0xdf, 0x96, 0x2c, 0xb5,
+			 0x75, 0x00, 0x01, 0x00, 0x02, 0xc5},
+	},
+	{ /* Named device */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xb4, 0x9f, 0x25, 0x1e, 0xe1, 0xf0}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 19,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x03, 0x0a, 0x18, 0x0b, 0x09, 0x4a, 0x42, 0x4c,
+			 0x20, 0x46, 0x6c, 0x69, 0x70, 0x20, 0x35},
+	},
+	{ /* Device in the address filter */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x50, 0xad, 0xcf, 0x4c, 0xe5, 0xd9}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 15,
+		.data = {0x02, 0x01, 0x06, 0x0b, 0xff, 0x59, 0x00, 0x02, 0x02, 0xfb, 0x43, 0x93,
+			 0x8e, 0x98, 0xcd},
+	},
+	{ /* Named device */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xf0, 0xb0, 0x9d, 0x7a, 0x72, 0xd3}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 21,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x03, 0x0a, 0x18, 0x0d, 0x09, 0x4c, 0x45, 0x2d,
+			 0x42, 0x6f, 0x73, 0x65, 0x20, 0x51, 0x43, 0x33, 0x35},
+	},
+	{ /* Named device */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xe6, 0x68, 0xf7, 0xbd, 0xa5, 0xc0}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 21,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x03, 0x0a, 0x18, 0x0d, 0x09, 0x4c, 0x45, 0x2d,
+			 0x42, 0x6f, 0x73, 0x65, 0x20, 0x51, 0x43, 0x33, 0x35},
+	},
+	{ /* Nordic_HIDS */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xf8, 0x03, 0x39, 0x8c, 0xb8, 0xcf}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 26,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x19, 0xc1, 0x03, 0x05, 0x03, 0x12, 0x18, 0x0f,
+			 0x18, 0x0c, 0x09, 0x4e, 0x6f, 0x72, 0x64, 0x69, 0x63, 0x5f, 0x48, 0x49,
+			 0x44, 0x53},
+	},
+	{ /* Named device */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x4e, 0x80, 0x37, 0x6a, 0x71, 0xe7}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 21,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x03, 0x0a, 0x18, 0x0d, 0x09, 0x4c, 0x45, 0x2d,
+			 0x42, 0x6f, 0x73, 0x65, 0x20, 0x51, 0x43, 0x33, 0x35},
+	},
+	{ /* Named device */
+		.addr = {BT_ADDR_LE_RANDOM, {{0xca, 0x99, 0xa3, 0xa4, 0x65, 0xe6}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 19,
+		.data = {0x02, 0x01, 0x06, 0x03, 0x03, 0x0a, 0x18, 0x0b, 0x09, 0x57, 0x48, 0x2d,
+			 0x31, 0x30, 0x30, 0x30, 0x58, 0x4d, 0x34},
+	},
+	{ /* Vendor service */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x87, 0xe3, 0x18, 0x87, 0x7a, 0xdb}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 26,
+		.data = {0x02, 0x01, 0x06, 0x11, 0x07, 0x7c, 0x10, 0x3b, 0x45, 0xbc, 0x2c, 0xeb,
+			 0x8e, 0xe2, 0x5a, 0xa5, 0xe4, 0xe9, 0xcc, 0x25, 0xdc, 0x04, 0x08, 0x44,
+			 0x65, 0x76},
+	},
+	{ /* Device in the address filter */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x50, 0x10, 0x25, 0x87, 0xc3, 0xe1}}},
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+		.len = 15,
+		.data = {0x02, 0x01, 0x06, 0x0b, 0xff, 0x59, 0x00, 0xae, 0x13, 0xf8, 0x9a, 0x26,
+			 0x05, 0xf4, 0xa8},
+	},
+	{ /* Microsoft CDP */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x0e, 0x32, 0xb3, 0xbe, 0xfc, 0xc9}}},
+		.len = 31,
+		.data = {0x1e, 0xff, 0x06, 0x00, 0x01, 0x09, 0x20, 0x02, 0xe1, 0x76, 0x0d, 0x0a,
+			 0xc7, 0x8f, 0x2b, 0xd0, 0x1d, 0x26, 0xeb, 0xc3, 0x7f, 0x10, 0x2c, 0x2a,
+			 0x0b, 0x1f, 0x2b, 0x3e, 0x3c, 0x74, 0x57},
+	},
+	{ /* iBeacon */
+		.addr = {BT_ADDR_LE_RANDOM, {{0x70, 0x8f, 0x8f, 0x6c, 0xa2, 0xe6}}},
+		.len = 30,
+		.data = {0x02, 0x01, 0x06, 0x1a, 0xff, 0x4c, 0x00, 0x02, 0x15, 0x0d, 0xb8, 0xa0,
+			 0xc0, 0x3a, 0x5e, 0xd9, 0x31, 0xab, 0xc3, 0x7e, 0x98, 0x68, 0xbe, 0xfc,
+			 0xdb, 0x00, 0x01, 0x00, 0x02, 0xc5},
+	},
+};
+
+const size_t trace_len = ARRAY_SIZE(trace);
+
+const bt_addr_le_t trace_filter_addr[] = {
+	{BT_ADDR_LE_RANDOM, {{0x88, 0xa2, 0x65, 0x8d, 0xea, 0xdb}}},
+	{BT_ADDR_LE_RANDOM, {{0xb4, 0x4b, 0x89, 0x93, 0x07, 0xc0}}},
+	{BT_ADDR_LE_RANDOM, {{0xe1, 0x92, 0x76, 0x51, 0xe3, 0xfe}}},
+	{BT_ADDR_LE_RANDOM, {{0xfc, 0xd6, 0x87, 0x79, 0x7b, 0xc3}}},
+	{BT_ADDR_LE_RANDOM, {{0x1c, 0x33, 0x58, 0xe4, 0xcd, 0xee}}},
+	{BT_ADDR_LE_RANDOM, {{0x5e, 0x5a, 0x2e, 0xc7, 0x35, 0xc1}}},
+	{BT_ADDR_LE_RANDOM, {{0x40, 0x40, 0x6b, 0xd9, 0x52, 0xf9}}},
+	{BT_ADDR_LE_RANDOM, {{0x50, 0xad, 0xcf, 0x4c, 0xe5, 0xd9}}},
+	{BT_ADDR_LE_RANDOM, {{0x50, 0x10, 0x25, 0x87, 0xc3, 0xe1}}},
+	{BT_ADDR_LE_RANDOM, {{0x3d, 0x8b, 0x8c, 0x91, 0xeb, 0xf4}}},
+	{BT_ADDR_LE_RANDOM, {{0xdd, 0xe3, 0x24, 0x8b, 0x92, 0xeb}}},
+	{BT_ADDR_LE_RANDOM, {{0x6a, 0x51, 0x2e, 0xbf, 0xad, 0xea}}},
+	{BT_ADDR_LE_RANDOM, {{0x70, 0x8e, 0x05, 0xfb, 0x2a, 0xfa}}},
+	{BT_ADDR_LE_RANDOM, {{0xad, 0x47, 0x10, 0xa1, 0x10, 0xe2}}},
+	{BT_ADDR_LE_RANDOM, {{0xf8, 0xb8, 0xec, 0xd6, 0xaa, 0xe5}}},
+	{BT_ADDR_LE_RANDOM, {{0xce, 0xd0, 0xd1, 0x07, 0x3a, 0xd2}}},
+	{BT_ADDR_LE_RANDOM, {{0xbf, 0x81, 0x5b, 0xef, 0xcb, 0xcf}}},
+	{BT_ADDR_LE_RANDOM, {{0x6b, 0x00, 0xbf, 0x9a, 0xc0, 0xfa}}},
+	{BT_ADDR_LE_RANDOM, {{0x7e, 0x70, 0x6b, 0xdd, 0x05, 0xe0}}},
+	{BT_ADDR_LE_RANDOM, {{0xca, 0xe2, 0xd0, 0x80, 0x82, 0xdd}}},
+	{BT_ADDR_LE_RANDOM, {{0x6e, 0x16, 0x74, 0xdd, 0xc9, 0xdb}}},
+	{BT_ADDR_LE_RANDOM, {{0xd2, 0xc7, 0x2c, 0x8d, 0x1d, 0xf0}}},
+	{BT_ADDR_LE_RANDOM, {{0x34, 0xd8, 0xfa, 0x84, 0xe4, 0xc6}}},
+	{BT_ADDR_LE_RANDOM, {{0x94, 0x53, 0x9c, 0xd5, 0xe7, 0xf1}}},
+};
+
+const size_t trace_filter_addr_len = ARRAY_SIZE(trace_filter_addr);
+
+const bt_addr_le_t trace_blocklist[] = {
+	{BT_ADDR_LE_RANDOM, {{0x4c, 0x9d, 0xe8, 0xda, 0xd5, 0xe9}}},
+	{BT_ADDR_LE_RANDOM, {{0xac, 0xbb, 0x0e, 0x42, 0xeb, 0xdd}}},
+	{BT_ADDR_LE_RANDOM, {{0x5e, 0x67, 0x79, 0x37, 0xd4, 0xcf}}},
+	{BT_ADDR_LE_RANDOM, {{0x5a, 0x44, 0x3c, 0x62, 0x18, 0xec}}},
+	{BT_ADDR_LE_RANDOM, {{0x8d, 0x2a, 0xb7, 0x57, 0xe1, 0xcc}}},
+	{BT_ADDR_LE_RANDOM, {{0xad, 0x51, 0x63, 0xe6, 0x9c, 0xdf}}},
+	{BT_ADDR_LE_RANDOM, {{0x38, 0x01, 0xde, 0xcb, 0xd7, 0xf3}}},
+	{BT_ADDR_LE_RANDOM, {{0xd2, 0x67, 0x5f, 0x00, 0xa9, 0xf5}}},
+};
+
+const size_t trace_blocklist_len = ARRAY_SIZE(trace_blocklist);
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include <zephyr/bluetooth/bluetooth.h>
+
+/* Advertising report of the trace. */
+struct adv_report {
+	bt_addr_le_t addr;
+	uint8_t adv_props;
+	uint8_t len;
+	uint8_t data[BT_GAP_ADV_MAX_ADV_DATA_LEN];
+};
+
+extern const struct adv_report trace[];
+extern const size_t trace_len;
+
+/* Addresses of the address filter, some of them are not in the trace. */
+extern const bt_addr_le_t trace_filter_addr[];
+extern const size_t trace_filter_addr_len;
+
+/* Addresses of the blocklist. */
+extern const bt_addr_le_t trace_blocklist[];
+extern const size_t trace_blocklist_len;
+
+#endif /* TRACE_H_ */
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <data_fifo.h>
+
+/* Number of blocks in the FIFO, as used by the audio datapath. */
+#define FIFO_BLOCK_CNT	 8
+/* Size of a block, 10 ms of 48 kHz 16-bit mono PCM. */
+#define FIFO_BLOCK_SIZE	 960
+/* Number of blocks passed from the producer to the consumer in a test. */
+#define BLOCK_CNT	 4096
+/* The producer yields after that many blocks to let the consumer catch up. */
+#define PRODUCER_BURST	 4
+
+DATA_FIFO_DEFINE(fifo_msgq_slab, FIFO_BLOCK_CNT, FIFO_BLOCK_SIZE);
+DATA_FIFO_SPSC_DEFINE(fifo_spsc, FIFO_BLOCK_CNT, FIFO_BLOCK_SIZE);
+
+K_THREAD_STACK_DEFINE(producer_stack, 1024);
+static struct k_thread producer_thread;
+static int producer_ret;
+
+static void producer(void *p1, void *p2, void *p3)
+{
+	struct data_fifo *fifo = p1;
+	uint32_t *block;
+
+	for (uint32_t i = 0; i < BLOCK_CNT; i++) {
+		producer_ret = data_fifo_pointer_first_vacant_get(fifo, (void **)&block, K_FOREVER);
+		if (producer_ret) {
+			return;
+		}
+
+		block[0] = i;
+		block[1] = k_cycle_get_32();
+
+		producer_ret = data_fifo_block_lock(fifo, (void **)&block, FIFO_BLOCK_SIZE);
+		if (producer_ret) {
+			return;
+		}
+
+		if ((i % PRODUCER_BURST) == (PRODUCER_BURST - 1)) {
+			k_yield();
+		}
+	}
+}
+
+static void run(struct data_fifo *fifo, const char *name)
+{
+	uint64_t latency_sum = 0;
+	uint32_t latency_min = UINT32_MAX;
+	uint32_t latency_max = 0;
+	uint32_t start;
+	uint32_t cycles;
+	uint32_t *block;
+	size_t size;
+	int ret;
+
+	zassert_ok(data_fifo_init(fifo));
+
+	start = k_cycle_get_32();
+
+	/* The producer runs with the same priority as the consumer, so they alternate. */
+	k_thread_create(&producer_thread, producer_stack, K_THREAD_STACK_SIZEOF(producer_stack),
+			producer, fifo, NULL, NULL, k_thread_priority_get(k_current_get()), 0,
+			K_NO_WAIT);
+
+	for (uint32_t i = 0; i < BLOCK_CNT; i++) {
+		ret = data_fifo_pointer_last_filled_get(fifo, (void **)&block, &size, K_FOREVER);
+		zassert_ok(ret);
+		zassert_equal(block[0], i, "Block lost or reordered");
+		zassert_equal(size, FIFO_BLOCK_SIZE);
+
+		uint32_t latency = k_cycle_get_32() - block[1];
+
+		latency_sum += latency;
+		latency_min = MIN(latency_min, latency);
+		latency_max = MAX(latency_max, latency);
+
+		data_fifo_block_free(fifo, block);
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	zassert_ok(k_thread_join(&producer_thread, K_SECONDS(1)));
+	zassert_ok(producer_ret);
+	zassert_ok(data_fifo_uninit(fifo));
+
+	TC_PRINT("%s: %u blocks in %u us, %u cycles per block\n", name, BLOCK_CNT,
+		 k_cyc_to_us_floor32(cycles), cycles / BLOCK_CNT);
+	TC_PRINT("%s: latency avg %llu min %u max %u cycles, jitter %u cycles\n", name,
+		 latency_sum / BLOCK_CNT, latency_min, latency_max, latency_max - latency_min);
+}
+
+ZTEST(data_fifo_bench, test_msgq_slab)
+{
+	run(&fifo_msgq_slab, "msgq_slab");
+}
+
+ZTEST(data_fifo_bench, test_spsc)
+{
+	run(&fifo_spsc, "spsc");
+}
+
+ZTEST_SUITE(data_fifo_bench, NULL, NULL, NULL, NULL, NULL);
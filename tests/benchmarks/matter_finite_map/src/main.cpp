@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "util/bridged_devices_map.h"
+#include "util/finite_map.h"
+
+namespace
+{
+/* Bridged devices are grouped per provider like sensors exposing multiple endpoints. */
+constexpr uint8_t kDevicesPerProvider = 2;
+constexpr int kRounds = 8;
+
+struct BridgedDevice {
+	operator bool() const { return mProvider != nullptr; }
+	bool operator==(const BridgedDevice &other) const { return mProvider == other.mProvider; }
+
+	const void *mProvider{ nullptr };
+	uint16_t mEndpointId{ 0 };
+};
+
+template <uint16_t N> using LinearMap = Nrf::FiniteMap<uint16_t, BridgedDevice, N>;
+/* The same container as BridgeManager uses, with the reverse index from the provider to its devices. */
+template <uint16_t N>
+using HashedMap = Nrf::BridgedDevicesMap<BridgedDevice, N, N / kDevicesPerProvider, kDevicesPerProvider>;
+
+/* Providers are only used as unique addresses. */
+uint8_t sProviders[256];
+
+const void *ProviderGet(uint16_t index)
+{
+	return &sProviders[index / kDevicesPerProvider];
+}
+
+template <typename Map> uint32_t LookupByIndex(Map &map, uint16_t devices)
+{
+	uint32_t checksum = 0;
+
+	for (uint16_t i = 0; i < devices; i++) {
+		if (map.Contains(i)) {
+			checksum += map[i].mEndpointId;
+		}
+	}
+
+	return checksum;
+}
+
+/* Find devices of each provider the way BridgeManager::HandleUpdate did before the reverse index. */
+template <typename Map> uint32_t LookupByProviderScan(Map &map, uint16_t devices)
+{
+	uint32_t checksum = 0;
+
+	for (uint16_t p = 0; p < devices / kDevicesPerProvider; p++) {
+		for (auto &item : map.mMap) {
+			if (item.value.mProvider == &sProviders[p]) {
+				checksum += item.value.mEndpointId;
+			}
+		}
+	}
+
+	return checksum;
+}
+
+/* Find devices of each provider the way BridgeManager::HandleUpdate does now. */
+template <typename Map> uint32_t LookupByProviderIndex(Map &map, uint16_t devices)
+{
+	uint32_t checksum = 0;
+
+	for (uint16_t p = 0; p < devices / kDevicesPerProvider; p++) {
+		const auto *providerDevices = map.GetProviderDevices(&sProviders[p]);
+
+		if (!providerDevices) {
+			continue;
+		}
+
+		for (uint8_t i = 0; i < providerDevices->mCount; i++) {
+			checksum += map[providerDevices->mIndexes[i]].mEndpointId;
+		}
+	}
+
+	return checksum;
+}
+
+template <uint16_t N> bool InsertDevice(LinearMap<N> &map, uint16_t index)
+{
+	return map.Insert(index, BridgedDevice{ ProviderGet(index), static_cast<uint16_t>(index + 1) });
+}
+
+template <uint16_t N> bool InsertDevice(HashedMap<N> &map, uint16_t index)
+{
+	return map.InsertPair(index, BridgedDevice{ ProviderGet(index), static_cast<uint16_t>(index + 1) });
+}
+
+template <uint16_t N> bool EraseDevice(LinearMap<N> &map, uint16_t index)
+{
+	return map.Erase(index);
+}
+
+template <uint16_t N> bool EraseDevice(HashedMap<N> &map, uint16_t index)
+{
+	return map.ErasePair(index, ProviderGet(index));
+}
+
+/* Remove and add back every device, as done when bridged devices disconnect and reconnect. */
+template <typename Map> void Churn(Map &map, uint16_t devices)
+{
+	for (uint16_t i = 0; i < devices; i++) {
+		uint16_t index = (i * 7) % devices;
+
+		zassert_true(EraseDevice(map, index));
+		zassert_true(InsertDevice(map, index));
+	}
+}
+
+template <typename Map> void Fill(Map &map, uint16_t devices)
+{
+	for (uint16_t i = 0; i < devices; i++) {
+		zassert_true(InsertDevice(map, i));
+	}
+}
+
+#define BENCH(_cycles, _expr)                                                                                          \
+	do {                                                                                                           \
+		uint32_t start = k_cycle_get_32();                                                                     \
+		for (int round = 0; round < kRounds; round++) {                                                        \
+			_expr;                                                                                         \
+		}                                                                                                      \
+		_cycles = (k_cycle_get_32() - start) / kRounds;                                                        \
+	} while (0)
+
+template <uint16_t N> void Bench()
+{
+	static LinearMap<N> linearMap;
+	static HashedMap<N> hashedMap;
+	uint32_t linearCycles;
+	uint32_t hashedCycles;
+	volatile uint32_t linearChecksum;
+	volatile uint32_t hashedChecksum;
+
+	Fill(linearMap, N);
+	Fill(hashedMap, N);
+
+	BENCH(linearCycles, linearChecksum = LookupByIndex(linearMap, N));
+	BENCH(hashedCycles, hashedChecksum = LookupByIndex(hashedMap, N));
+	zassert_equal(linearChecksum, hashedChecksum);
+	TC_PRINT("%3u devices, lookup by index   : linear %7u, hashed %7u cycles per %u lookups\n", N,
+		 linearCycles, hashedCycles, N);
+
+	BENCH(linearCycles, linearChecksum = LookupByProviderScan(linearMap, N));
+	BENCH(hashedCycles, hashedChecksum = LookupByProviderIndex(hashedMap, N));
+	zassert_equal(linearChecksum, hashedChecksum);
+	TC_PRINT("%3u devices, lookup by provider: linear %7u, hashed %7u cycles per %u updates\n", N,
+		 linearCycles, hashedCycles, N / kDevicesPerProvider);
+
+	BENCH(linearCycles, Churn(linearMap, N));
+	BENCH(hashedCycles, Churn(hashedMap, N));
+	zassert_equal(LookupByIndex(linearMap, N), LookupByIndex(hashedMap, N));
+	zassert_equal(LookupByProviderScan(linearMap, N), LookupByProviderIndex(hashedMap, N));
+	TC_PRINT("%3u devices, erase and insert  : linear %7u, hashed %7u cycles per %u devices\n", N,
+		 linearCycles, hashedCycles, N);
+}
+} /* namespace */
+
+ZTEST(matter_finite_map_bench, test_64_devices)
+{
+	Bench<64>();
+}
+
+ZTEST(matter_finite_map_bench, test_128_devices)
+{
+	Bench<128>();
+}
+
+ZTEST(matter_finite_map_bench, test_256_devices)
+{
+	Bench<256>();
+}
+
+ZTEST_SUITE(matter_finite_map_bench, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/serial/uart_emul.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/ring_buffer.h>
+
+#include <nrf_rpc/nrf_rpc_uart.h>
+
+#if CONFIG_NRF_CPU_LOAD
+#include <debug/cpu_load.h>
+#endif
+
+#define UART_A DT_NODELABEL(euart0)
+#define UART_B DT_NODELABEL(euart1)
+
+/* Emulated line rate, 10 bits are transferred per byte. */
+#define LINK_BAUDRATE	 DT_PROP(UART_A, current_speed)
+/* Emulated one-way latency of the link, for example added by USB-UART bridges. */
+#define LINK_LATENCY_US	 1000
+/* Transmitter is blocked when that many microseconds of data wait for the line. */
+#define LINK_BACKLOG_US	 2000
+/* Bytes scheduled for delivery within that time window are delivered at once. */
+#define LINK_MERGE_US	 200
+#define LINK_BUF_SIZE	 2048
+#define LINK_MARK_CNT	 64
+
+#define PACKET_SIZE 256
+#define PACKET_CNT  200
+
+struct link_mark {
+	int64_t deliver_us;
+	uint32_t len;
+};
+
+/* One direction of the emulated connection between two UARTs. */
+struct link {
+	const struct device *dst;
+	struct ring_buf buf;
+	uint8_t buf_data[LINK_BUF_SIZE];
+	struct link_mark marks[LINK_MARK_CNT];
+	uint32_t mark_head;
+	uint32_t mark_cnt;
+	int64_t line_free_us;
+	struct k_spinlock lock;
+	struct k_work_delayable work;
+};
+
+static struct link link_ab;
+static struct link link_ba;
+
+static K_SEM_DEFINE(rx_done_sem, 0, 1);
+static uint32_t rx_cnt;
+static uint32_t rx_errors;
+/* Number of times the UART driver reported new TX data, a proxy for the per-byte CPU overhead. */
+static atomic_t tx_events;
+
+static int64_t now_us(void)
+{
+	return k_ticks_to_us_floor64(k_uptime_ticks());
+}
+
+static void link_tx_data_ready(const struct device *dev, size_t size, void *user_data)
+{
+	struct link *link = user_data;
+	uint8_t chunk[64];
+	k_spinlock_key_t key;
+	int64_t deliver_us;
+	int64_t backlog_us;
+	uint32_t len;
+
+	ARG_UNUSED(size);
+
+	atomic_inc(&tx_events);
+
+	while ((len = uart_emul_get_tx_data(dev, chunk, sizeof(chunk))) > 0) {
+		key = k_spin_lock(&link->lock);
+
+		link->line_free_us = MAX(link->line_free_us, now_us()) +
+				     (len * 10 * USEC_PER_SEC) / LINK_BAUDRATE;
+		deliver_us = link->line_free_us + LINK_LATENCY_US;
+		backlog_us = link->line_free_us - now_us();
+
+		__ASSERT(ring_buf_space_get(&link->buf) >= len, "Link buffer overflow");
+		ring_buf_put(&link->buf, chunk, len);
+
+		struct link_mark *last = &link->marks[(link->mark_head + link->mark_cnt - 1) %
+						      LINK_MARK_CNT];
+
+		if ((link->mark_cnt > 0) && (deliver_us - last->deliver_us < LINK_MERGE_US)) {
+			last->deliver_us = deliver_us;
+			last->len += len;
+		} else {
+			__ASSERT(link->mark_cnt < LINK_MARK_CNT, "Link mark overflow");
+			link->marks[(link->mark_head + link->mark_cnt) % LINK_MARK_CNT] =
+				(struct link_mark){.deliver_us = deliver_us, .len = len};
+			link->mark_cnt++;
+		}
+
+		k_spin_unlock(&link->lock, key);
+
+		/* Emulate the limited TX FIFO by blocking the transmitter. */
+		if (backlog_us > LINK_BACKLOG_US) {
+			k_busy_wait(backlog_us - LINK_BACKLOG_US);
+		}
+	}
+
+	k_work_schedule(&link->work, K_NO_WAIT);
+}
+
+static void link_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct link *link = CONTAINER_OF(dwork, struct link, work);
+	static uint8_t chunk[256];
+	struct link_mark *mark;
+	k_spinlock_key_t key;
+	int64_t deliver_us;
+	uint32_t len;
+
+	while (true) {
+		key = k_spin_lock(&link->lock);
+
+		if (link->mark_cnt == 0) {
+			k_spin_unlock(&link->lock, key);
+			return;
+		}
+
+		mark = &link->marks[link->mark_head];
+
+		if (mark->deliver_us > now_us()) {
+			deliver_us = mark->deliver_us;
+			k_spin_unlock(&link->lock, key);
+			k_work_schedule(&link->work, K_TIMEOUT_ABS_US(deliver_us));
+			return;
+		}
+
+		len = ring_buf_get(&link->buf, chunk, MIN(mark->len, sizeof(chunk)));
+		mark->len -= len;
+
+		if (mark->len == 0) {
+			link->mark_head = (link->mark_head + 1) % LINK_MARK_CNT;
+			link->mark_cnt--;
+		}
+
+		k_spin_unlock(&link->lock, key);
+
+		len -= uart_emul_put_rx_data(link->dst, chunk, len);
+		__ASSERT(len == 0, "UART RX FIFO overflow");
+	}
+}
+
+static void link_init(struct link *link, const struct device *src, const struct device *dst)
+{
+	link->dst = dst;
+	ring_buf_init(&link->buf, sizeof(link->buf_data), link->buf_data);
+	k_work_init_delayable(&link->work, link_work_handler);
+	uart_emul_callback_tx_data_ready_set(src, link_tx_data_ready, link);
+}
+
+static void receive_handler_a(const struct nrf_rpc_tr *transport, const uint8_t *packet,
+			      size_t len, void *context)
+{
+	/* Only acks are sent from B to A. */
+	rx_errors++;
+}
+
+static void receive_handler_b(const struct nrf_rpc_tr *transport, const uint8_t *packet,
+			      size_t len, void *context)
+{
+	/* Packets must be received exactly once and in order. */
+	if (len != PACKET_SIZE || sys_get_le32(packet) != rx_cnt) {
+		rx_errors++;
+	}
+
+	if (++rx_cnt == PACKET_CNT) {
+		k_sem_give(&rx_done_sem);
+	}
+}
+
+static void *bench_setup(void)
+{
+	const struct nrf_rpc_tr *tr_a = &NRF_RPC_UART_TRANSPORT(UART_A);
+	const struct nrf_rpc_tr *tr_b = &NRF_RPC_UART_TRANSPORT(UART_B);
+
+	link_init(&link_ab, DEVICE_DT_GET(UART_A), DEVICE_DT_GET(UART_B));
+	link_init(&link_ba, DEVICE_DT_GET(UART_B), DEVICE_DT_GET(UART_A));
+
+	zassert_ok(tr_a->api->init(tr_a, receive_handler_a, NULL));
+	zassert_ok(tr_b->api->init(tr_b, receive_handler_b, NULL));
+
+	return NULL;
+}
+
+ZTEST(nrf_rpc_uart_bench, test_throughput)
+{
+	const struct nrf_rpc_tr *tr = &NRF_RPC_UART_TRANSPORT(UART_A);
+	uint64_t total = (uint64_t)PACKET_CNT * PACKET_SIZE;
+	int64_t start_us;
+	int64_t elapsed_us;
+
+	atomic_set(&tx_events, 0);
+#if CONFIG_NRF_CPU_LOAD
+	cpu_load_reset();
+#endif
+	start_us = now_us();
+
+	for (uint32_t i = 0; i < PACKET_CNT; i++) {
+		size_t size = PACKET_SIZE;
+		uint8_t *packet = tr->api->tx_buf_alloc(tr, &size);
+
+		zassert_equal(size, PACKET_SIZE);
+
+		/* Fill the packet with all byte values, including the ones that are escaped. */
+		for (size_t j = 0; j < size; j++) {
+			packet[j] = (uint8_t)(i + j);
+		}
+
+		sys_put_le32(i, packet);
+		zassert_ok(tr->api->send(tr, packet, size), "Failed to send packet %u", i);
+	}
+
+	zassert_ok(k_sem_take(&rx_done_sem, K_SECONDS(30)), "Packets not received");
+	elapsed_us = now_us() - start_us;
+
+	TC_PRINT("%u packets of %u bytes in %lld us: %llu B/s\n", PACKET_CNT, PACKET_SIZE,
+		 elapsed_us, total * USEC_PER_SEC / elapsed_us);
+	TC_PRINT("UART TX events per MB: %llu\n",
+		 (uint64_t)atomic_get(&tx_events) * MB(1) / total);
+#if CONFIG_NRF_CPU_LOAD
+	/* CPU load is given in 0.001% units. */
+	int load = cpu_load_get();
+
+	TC_PRINT("CPU load: %d.%03d%%, CPU time per MB: %llu us\n", load / 1000, load % 1000,
+		 (uint64_t)elapsed_us * load * MB(1) / (100000 * total));
+#endif
+
+	zassert_equal(rx_errors, 0, "Packets lost, duplicated or reordered");
+}
+
+ZTEST_SUITE(nrf_rpc_uart_bench, NULL, bench_setup, NULL, NULL, NULL);
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/settings/settings.h>
+#include <psa/crypto.h>
+#include <psa/internal_trusted_storage.h>
+
+/* Number of stored assets, similar to the persistent keys and credentials of a Matter device. */
+#define ASSET_CNT   24
+#define ASSET_SIZE  64
+#define ROUNDS      4
+#define UID_BASE    0x30000
+
+static uint8_t asset[ASSET_SIZE];
+static uint8_t asset_read[ASSET_SIZE];
+
+static const char *backend_name(void)
+{
+	if (IS_ENABLED(CONFIG_TRUSTED_STORAGE_STORAGE_BACKEND_ZMS)) {
+		return IS_ENABLED(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE) ? "ZMS with cache" :
+									       "ZMS";
+	}
+
+	return "settings";
+}
+
+static void *setup(void)
+{
+	if (IS_ENABLED(CONFIG_SETTINGS)) {
+		zassert_ok(settings_subsys_init());
+	}
+
+	zassert_equal(psa_crypto_init(), PSA_SUCCESS);
+
+	return NULL;
+}
+
+ZTEST(trusted_storage_bench, test_its_set_get)
+{
+	uint64_t set_cycles = 0;
+	uint64_t get_cycles = 0;
+	uint32_t start;
+	size_t len;
+
+	for (int r = 0; r < ROUNDS; r++) {
+		for (int i = 0; i < ASSET_CNT; i++) {
+			memset(asset, i + r, sizeof(asset));
+
+			start = k_cycle_get_32();
+			zassert_equal(psa_its_set(UID_BASE + i, sizeof(asset), asset,
+						  PSA_STORAGE_FLAG_NONE),
+				      PSA_SUCCESS);
+			set_cycles += k_cycle_get_32() - start;
+		}
+
+		/* Read the assets in the reverse order, as the applications do not read them
+		 * in the order they were written.
+		 */
+		for (int i = ASSET_CNT - 1; i >= 0; i--) {
+			memset(asset, i + r, sizeof(asset));
+
+			start = k_cycle_get_32();
+			zassert_equal(psa_its_get(UID_BASE + i, 0, sizeof(asset_read), asset_read,
+						  &len),
+				      PSA_SUCCESS);
+			get_cycles += k_cycle_get_32() - start;
+
+			zassert_equal(len, sizeof(asset_read));
+			zassert_mem_equal(asset_read, asset, sizeof(asset));
+		}
+	}
+
+	for (int i = 0; i < ASSET_CNT; i++) {
+		zassert_equal(psa_its_remove(UID_BASE + i), PSA_SUCCESS);
+		zassert_equal(psa_its_get(UID_BASE + i, 0, sizeof(asset_read), asset_read, &len),
+			      PSA_ERROR_DOES_NOT_EXIST);
+	}
+
+	TC_PRINT("%s backend: %u assets of %u bytes\n", backend_name(), ASSET_CNT, ASSET_SIZE);
+	TC_PRINT("psa_its_set: %llu cycles\n", set_cycles / (ROUNDS * ASSET_CNT));
+	TC_PRINT("psa_its_get: %llu cycles\n", get_cycles / (ROUNDS * ASSET_CNT));
+}
+
+ZTEST_SUITE(trusted_storage_bench, NULL, setup, NULL, NULL, NULL);
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <modem/at_parser.h>
+
+#define BENCH_ROUNDS 100
+
+/* Responses with many values or lines, as parsed by the modem libraries. */
+static const char * const ncellmeas =
+	"%NCELLMEAS: 0,\"0102DA04\",\"26295\",\"76C1\",64,6400,8,54,16,5600,"
+	"6400,263,49,10,0,6400,264,45,9,0,6400,265,40,7,0,6400,266,38,5,0,"
+	"1300,100,36,4,0,1300,101,32,2,0,1300,102,30,1,0,5200\r\n"
+	"OK\r\n";
+
+static const char * const cops =
+	"+COPS: (2,\"Operator One Long Name\",\"Operator One\",\"26295\",9),"
+	"(1,\"Operator Two Long Name\",\"Operator Two\",\"26201\",7),"
+	"(1,\"Operator Three Long Name\",\"Operator Three\",\"26202\",7),,"
+	"(0,1,2,3,4),(0,1,2)\r\n"
+	"OK\r\n";
+
+static const char * const xmonitor =
+	"%XMONITOR: 1,\"Operator One Long Name\",\"Operator One\",\"26295\",\"76C1\",7,20,"
+	"\"0102DA04\",334,6400,53,24,\"\",\"11100000\",\"11100000\",\"01001001\"\r\n"
+	"OK\r\n";
+
+static const char * const cgeqosrdp =
+	"+CGEQOSRDP: 0,0,,\r\n"
+	"+CGEQOSRDP: 1,2,,\r\n"
+	"+CGEQOSRDP: 2,4,,,1,65280000\r\n"
+	"+CGEQOSRDP: 3,4,,,1,65280000\r\n"
+	"+CGEQOSRDP: 4,4,,,1,65280000\r\n"
+	"OK\r\n";
+
+/* Retrieve all values of all lines, from the last index to the first one, which is the worst
+ * case for the parser without the token table.
+ */
+static uint32_t bench_parse(const char *at, bool indexed)
+{
+	struct at_parser parser;
+	struct at_parser_token tokens[64];
+	const char *str;
+	size_t count;
+	size_t len;
+	uint32_t start;
+	int ret;
+
+	start = k_cycle_get_32();
+
+	zassert_ok(at_parser_init(&parser, at));
+	if (indexed) {
+		zassert_ok(at_parser_index(&parser, tokens, ARRAY_SIZE(tokens)));
+	}
+
+	do {
+		zassert_ok(at_parser_cmd_count_get(&parser, &count));
+
+		for (size_t i = count; i > 0; i--) {
+			ret = at_parser_string_ptr_get(&parser, i - 1, &str, &len);
+			zassert_true(ret == 0 || ret == -EOPNOTSUPP || ret == -ENODATA);
+		}
+	} while (at_parser_cmd_next(&parser) == 0);
+
+	return k_cycle_get_32() - start;
+}
+
+static void bench_run(const char *name, const char *at)
+{
+	uint32_t cycles = 0;
+	uint32_t cycles_indexed = 0;
+
+	for (int i = 0; i < BENCH_ROUNDS; i++) {
+		cycles += bench_parse(at, false);
+		cycles_indexed += bench_parse(at, true);
+	}
+
+	TC_PRINT("%s: %zu bytes, %u cycles, %u cycles indexed\n", name, strlen(at),
+		 cycles / BENCH_ROUNDS, cycles_indexed / BENCH_ROUNDS);
+}
+
+ZTEST(at_parser_bench, test_ncellmeas)
+{
+	bench_run("%NCELLMEAS", ncellmeas);
+}
+
+ZTEST(at_parser_bench, test_cops)
+{
+	bench_run("+COPS=?", cops);
+}
+
+ZTEST(at_parser_bench, test_xmonitor)
+{
+	bench_run("%XMONITOR", xmonitor);
+}
+
+ZTEST(at_parser_bench, test_cgeqosrdp)
+{
+	bench_run("+CGEQOSRDP", cgeqosrdp);
+}
+
+ZTEST_SUITE(at_parser_bench, NULL, NULL, NULL, NULL, NULL);
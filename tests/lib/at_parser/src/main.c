@@ -2088,4 +2088,201 @@ ZTEST(at_parser, test_at_parser_cmd_next)
 	zassert_equal(num, 6);
 }
 
+/* Check that every value of every line is the same with and without the token table. */
+static void check_index_equal(const char *at)
+{
+	int ret;
+	int ret_indexed;
+	struct at_parser parser;
+	struct at_parser indexed;
+	struct at_parser_token tokens[32];
+	size_t count;
+	size_t count_indexed;
+	const char *str;
+	const char *str_indexed;
+	size_t len;
+	size_t len_indexed;
+	int32_t num;
+	int32_t num_indexed;
+
+	zassert_ok(at_parser_init(&parser, at));
+	zassert_ok(at_parser_init(&indexed, at));
+	zassert_ok(at_parser_index(&indexed, tokens, ARRAY_SIZE(tokens)));
+
+	do {
+		ret = at_parser_cmd_count_get(&parser, &count);
+		ret_indexed = at_parser_cmd_count_get(&indexed, &count_indexed);
+		zassert_equal(ret, ret_indexed);
+		zassert_equal(count, count_indexed);
+
+		/* Values are retrieved backwards, which requires a rewind without the table. */
+		for (int i = 7; i >= 0; i--) {
+			ret = at_parser_string_ptr_get(&parser, i, &str, &len);
+			ret_indexed = at_parser_string_ptr_get(&indexed, i, &str_indexed,
+							       &len_indexed);
+			zassert_equal(ret, ret_indexed, "%s index %d", at, i);
+			if (!ret) {
+				zassert_equal(str, str_indexed);
+				zassert_equal(len, len_indexed);
+			}
+
+			ret = at_parser_num_get(&parser, i, &num);
+			ret_indexed = at_parser_num_get(&indexed, i, &num_indexed);
+			zassert_equal(ret, ret_indexed, "%s index %d", at, i);
+			if (!ret) {
+				zassert_equal(num, num_indexed);
+			}
+		}
+
+		ret = at_parser_cmd_next(&parser);
+		ret_indexed = at_parser_cmd_next(&indexed);
+		zassert_equal(ret, ret_indexed);
+	} while (!ret);
+}
+
+ZTEST(at_parser, test_at_parser_index)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(singleline); i++) {
+		check_index_equal(singleline[i]);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(multiline); i++) {
+		check_index_equal(multiline[i]);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(pduline); i++) {
+		check_index_equal(pduline[i]);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(singleparamline); i++) {
+		check_index_equal(singleparamline[i]);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(emptyparamline); i++) {
+		check_index_equal(emptyparamline[i]);
+	}
+
+	check_index_equal(certificate);
+	check_index_equal("+CEREG: 2,\"76C1\"x,3\r\n");
+	check_index_equal("+CEREG: 2,\"76C1,3\r\n");
+	check_index_equal("+CEREG: 1,,\r\n+CEREG: ,\r\n");
+}
+
+ZTEST(at_parser, test_at_parser_index_cmd_next)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_token tokens[16];
+	int32_t num = 0;
+	size_t count = 0;
+	const char *str;
+	size_t len;
+
+	const char *at = "+NOTIF: 1,2,3,,\r\n"
+			 "+NOTIF2: 4,5\r\n"
+			 "+NOTIF3: 6,7,8\r\n"
+			 "OK\r\n";
+
+	ret = at_parser_init(&parser, at);
+	zassert_ok(ret);
+
+	ret = at_parser_index(&parser, tokens, ARRAY_SIZE(tokens));
+	zassert_ok(ret);
+
+	ret = at_parser_num_get(&parser, 3, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 3);
+
+	ret = at_parser_num_get(&parser, 1, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 1);
+
+	ret = at_parser_num_get(&parser, 5, &num);
+	zassert_equal(ret, -ENODATA);
+
+	ret = at_parser_num_get(&parser, 6, &num);
+	zassert_equal(ret, -EAGAIN);
+
+	ret = at_parser_cmd_next(&parser);
+	zassert_ok(ret);
+
+	ret = at_parser_cmd_count_get(&parser, &count);
+	zassert_ok(ret);
+	zassert_equal(count, 3);
+
+	ret = at_parser_num_get(&parser, 2, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 5);
+
+	ret = at_parser_cmd_next(&parser);
+	zassert_ok(ret);
+
+	ret = at_parser_string_ptr_get(&parser, 0, &str, &len);
+	zassert_ok(ret);
+	zassert_mem_equal(str, "+NOTIF3", len);
+
+	ret = at_parser_num_get(&parser, 3, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 8);
+
+	ret = at_parser_num_get(&parser, 4, &num);
+	zassert_equal(ret, -EIO);
+
+	ret = at_parser_cmd_next(&parser);
+	zassert_equal(ret, -EOPNOTSUPP);
+}
+
+ZTEST(at_parser, test_at_parser_index_einval)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_token tokens[4];
+
+	ret = at_parser_index(NULL, tokens, ARRAY_SIZE(tokens));
+	zassert_equal(ret, -EINVAL);
+
+	ret = at_parser_init(&parser, "+NOTIF: 1,2\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_index(&parser, NULL, 0);
+	zassert_equal(ret, -EINVAL);
+}
+
+ZTEST(at_parser, test_at_parser_index_eperm)
+{
+	int ret;
+	struct at_parser parser = { 0 };
+	struct at_parser_token tokens[4];
+
+	ret = at_parser_index(&parser, tokens, ARRAY_SIZE(tokens));
+	zassert_equal(ret, -EPERM);
+}
+
+ZTEST(at_parser, test_at_parser_index_enomem)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_token tokens[4];
+	int32_t num = 0;
+
+	ret = at_parser_init(&parser, "+NOTIF: 1,2\r\n+NOTIF: 3,4\r\n");
+	zassert_ok(ret);
+
+	/* The table needs one entry per line and one entry per value, eight in total. */
+	ret = at_parser_index(&parser, tokens, ARRAY_SIZE(tokens));
+	zassert_equal(ret, -ENOMEM);
+
+	/* The parser is still usable without the table. */
+	ret = at_parser_num_get(&parser, 2, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 2);
+
+	ret = at_parser_cmd_next(&parser);
+	zassert_ok(ret);
+
+	ret = at_parser_num_get(&parser, 1, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 3);
+}
+
 ZTEST_SUITE(at_parser, NULL, NULL, NULL, NULL, NULL);
@@ -8,6 +8,13 @@
 #include <errno.h>
 #include <data_fifo.h>
 
+/* Run the same tests for both data_fifo modes */
+#if CONFIG_DATA_FIFO_SPSC
+#define TEST_DATA_FIFO_DEFINE DATA_FIFO_SPSC_DEFINE
+#else
+#define TEST_DATA_FIFO_DEFINE DATA_FIFO_DEFINE
+#endif
+
 /* Catch asserts to fail test */
 void assert_post_action(const char *file, unsigned int line)
 {
@@ -34,7 +41,7 @@ static void internal_test_remaining_elements(struct data_fifo *data_fifo, uint32
 ZTEST(suite_data_fifo, test_data_fifo_uninit_ok)
 {
 #define BLOCKS_NUM 10
-	DATA_FIFO_DEFINE(data_fifo, 10, 128);
+	TEST_DATA_FIFO_DEFINE(data_fifo, 10, 128);
 
 	int ret;
 
@@ -75,7 +82,7 @@ ZTEST(suite_data_fifo, test_data_fifo_uninit_ok)
 
 ZTEST(suite_data_fifo, test_data_fifo_init_ok)
 {
-	DATA_FIFO_DEFINE(data_fifo, 8, 128);
+	TEST_DATA_FIFO_DEFINE(data_fifo, 8, 128);
 
 	int ret;
 
@@ -86,7 +93,7 @@ ZTEST(suite_data_fifo, test_data_fifo_init_ok)
 ZTEST(suite_data_fifo, test_data_fifo_data_put_get_ok)
 {
 #define DATA_SIZE 5
-	DATA_FIFO_DEFINE(data_fifo, 8, 128);
+	TEST_DATA_FIFO_DEFINE(data_fifo, 8, 128);
 
 	int ret;
 
@@ -161,7 +168,7 @@ ZTEST(suite_data_fifo, test_data_fifo_data_put_get_ok)
 ZTEST(suite_data_fifo, test_data_fifo_data_put_too_many)
 {
 #define BLOCKS_NUM 10
-	DATA_FIFO_DEFINE(data_fifo, 10, 128);
+	TEST_DATA_FIFO_DEFINE(data_fifo, 10, 128);
 
 	int ret;
 
@@ -195,7 +202,7 @@ ZTEST(suite_data_fifo, test_data_fifo_data_put_too_many)
 
 ZTEST(suite_data_fifo, test_data_fifo_data_put_too_much_data)
 {
-	DATA_FIFO_DEFINE(data_fifo, 10, 128);
+	TEST_DATA_FIFO_DEFINE(data_fifo, 10, 128);
 
 	int ret;
 
@@ -214,7 +221,7 @@ ZTEST(suite_data_fifo, test_data_fifo_data_put_too_much_data)
 
 ZTEST(suite_data_fifo, test_data_fifo_data_put_size_zero)
 {
-	DATA_FIFO_DEFINE(data_fifo, 10, 128);
+	TEST_DATA_FIFO_DEFINE(data_fifo, 10, 128);
 
 	int ret;
 
@@ -231,4 +238,155 @@ ZTEST(suite_data_fifo, test_data_fifo_data_put_size_zero)
 	zassert_equal(ret, -EINVAL, "block_lock did not return -EINVAL");
 }
 
+#if CONFIG_DATA_FIFO_SPSC
+ZTEST(suite_data_fifo, test_data_fifo_spsc_wrap_around)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 3, 128);
+
+	int ret;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	uint32_t *data_ptr;
+	void *data_ptr_read;
+	size_t data_size;
+
+	/* Cycle through the ring several times with a varying number of blocks in use */
+	for (uint32_t i = 0; i < 20; i++) {
+		uint32_t blocks_num = 1 + (i % 3);
+
+		for (uint32_t j = 0; j < blocks_num; j++) {
+			ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr,
+								 K_NO_WAIT);
+			zassert_equal(ret, 0, "first_vacant_get did not return 0");
+			*data_ptr = i * 10 + j;
+
+			ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr,
+						   sizeof(uint32_t) + j);
+			zassert_equal(ret, 0, "block_lock did not return 0");
+		}
+
+		internal_test_remaining_elements(&data_fifo, blocks_num, blocks_num, __LINE__);
+
+		for (uint32_t j = 0; j < blocks_num; j++) {
+			ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read,
+								&data_size, K_NO_WAIT);
+			zassert_equal(ret, 0, "_last_filled_get did not return 0");
+			zassert_equal(*(uint32_t *)data_ptr_read, i * 10 + j, "data incorrect");
+			zassert_equal(data_size, sizeof(uint32_t) + j, "data size incorrect");
+
+			data_fifo_block_free(&data_fifo, data_ptr_read);
+		}
+
+		ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size,
+							K_NO_WAIT);
+		zassert_equal(ret, -ENOMSG, "_last_filled_get did not return -ENOMSG");
+	}
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_lock_out_of_order)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	void *data_ptr_1;
+	void *data_ptr_2;
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, &data_ptr_1, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, &data_ptr_2, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	ret = data_fifo_block_lock(&data_fifo, &data_ptr_2, 1);
+	zassert_equal(ret, -EINVAL, "block_lock did not return -EINVAL");
+
+	ret = data_fifo_block_lock(&data_fifo, &data_ptr_1, 1);
+	zassert_equal(ret, 0, "block_lock did not return 0");
+
+	internal_test_remaining_elements(&data_fifo, 2, 1, __LINE__);
+
+	ret = data_fifo_empty(&data_fifo);
+	zassert_equal(ret, 0, "empty did not return 0");
+
+	internal_test_remaining_elements(&data_fifo, 0, 0, __LINE__);
+}
+
+#define SPSC_BLOCKS_NUM 64
+
+DATA_FIFO_SPSC_DEFINE(spsc_data_fifo, 4, 128);
+K_THREAD_STACK_DEFINE(spsc_producer_stack, 1024);
+static struct k_thread spsc_producer_thread;
+static int spsc_producer_ret;
+
+static void spsc_producer(void *p1, void *p2, void *p3)
+{
+	struct data_fifo *data_fifo = p1;
+	uint32_t *data_ptr;
+
+	for (uint32_t i = 0; i < SPSC_BLOCKS_NUM; i++) {
+		spsc_producer_ret =
+			data_fifo_pointer_first_vacant_get(data_fifo, (void **)&data_ptr, K_FOREVER);
+		if (spsc_producer_ret) {
+			return;
+		}
+
+		*data_ptr = i;
+
+		spsc_producer_ret =
+			data_fifo_block_lock(data_fifo, (void **)&data_ptr, sizeof(uint32_t));
+		if (spsc_producer_ret) {
+			return;
+		}
+
+		if (i % 8 == 0) {
+			k_sleep(K_MSEC(1));
+		}
+	}
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_blocking_wait)
+{
+	struct data_fifo *data_fifo = &spsc_data_fifo;
+
+	int ret;
+
+	ret = data_fifo_init(data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	void *data_ptr_read;
+	size_t data_size;
+
+	ret = data_fifo_pointer_last_filled_get(data_fifo, &data_ptr_read, &data_size, K_MSEC(1));
+	zassert_equal(ret, -EAGAIN, "_last_filled_get did not return -EAGAIN");
+
+	k_thread_create(&spsc_producer_thread, spsc_producer_stack,
+			K_THREAD_STACK_SIZEOF(spsc_producer_stack), spsc_producer, data_fifo, NULL,
+			NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+
+	for (uint32_t i = 0; i < SPSC_BLOCKS_NUM; i++) {
+		ret = data_fifo_pointer_last_filled_get(data_fifo, &data_ptr_read, &data_size,
+							K_MSEC(100));
+		zassert_equal(ret, 0, "_last_filled_get did not return 0");
+		zassert_equal(*(uint32_t *)data_ptr_read, i, "data incorrect");
+
+		/* Let the producer fill the ring */
+		if (i % 16 == 0) {
+			k_sleep(K_MSEC(5));
+		}
+
+		data_fifo_block_free(data_fifo, data_ptr_read);
+	}
+
+	ret = k_thread_join(&spsc_producer_thread, K_MSEC(100));
+	zassert_equal(ret, 0, "producer did not finish");
+	zassert_equal(spsc_producer_ret, 0, "producer failed with %d", spsc_producer_ret);
+	internal_test_remaining_elements(data_fifo, 0, 0, __LINE__);
+}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 ZTEST_SUITE(suite_data_fifo, NULL, NULL, NULL, NULL, NULL);
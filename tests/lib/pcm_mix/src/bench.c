@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <pcm_mix.h>
+
+/* 10 ms of 48 kHz mono audio */
+#define BENCH_SAMPLES 480
+#define BENCH_ROUNDS  16
+#define BENCH_STREAMS 4
+
+static int32_t bench_buf_a[BENCH_SAMPLES * 2];
+static int32_t bench_buf_b[BENCH_STREAMS][BENCH_SAMPLES * 2];
+
+static const char *const mode_names[] = {
+	[B_STEREO_INTO_A_STEREO] = "stereo into stereo",
+	[B_MONO_INTO_A_MONO] = "mono into mono",
+	[B_MONO_INTO_A_STEREO_LR] = "mono into stereo LR",
+	[B_MONO_INTO_A_STEREO_L] = "mono into stereo L",
+	[B_MONO_INTO_A_STEREO_R] = "mono into stereo R",
+};
+
+static int32_t bench_sample_next(uint32_t *val, uint8_t pcm_bit_depth)
+{
+	*val = *val * 1664525 + 1013904223;
+
+	/* 24-bit samples must be sign extended */
+	return (pcm_bit_depth == 24) ? ((int32_t)(*val << 8) >> 8) : (int32_t)*val;
+}
+
+static void bench_fill(uint8_t pcm_bit_depth)
+{
+	/* Random-like pattern to get a mix of clipped and not clipped samples */
+	uint32_t val = 0x12345678;
+
+	for (size_t i = 0; i < ARRAY_SIZE(bench_buf_a); i++) {
+		bench_buf_a[i] = bench_sample_next(&val, pcm_bit_depth);
+	}
+
+	for (size_t s = 0; s < BENCH_STREAMS; s++) {
+		for (size_t i = 0; i < ARRAY_SIZE(bench_buf_b[s]); i++) {
+			bench_buf_b[s][i] = bench_sample_next(&val, pcm_bit_depth);
+		}
+	}
+}
+
+static void bench_mix(enum pcm_mix_mode mix_mode, uint8_t pcm_bit_depth)
+{
+	size_t sample_size = (pcm_bit_depth == 16) ? sizeof(int16_t) : sizeof(int32_t);
+	size_t size_b = BENCH_SAMPLES * sample_size;
+	size_t size_a = (mix_mode == B_MONO_INTO_A_MONO) ? size_b : 2 * size_b;
+	uint32_t cycles = 0;
+	uint32_t start;
+	int ret;
+
+	if (mix_mode == B_STEREO_INTO_A_STEREO) {
+		size_b = size_a;
+	}
+
+	for (int i = 0; i < BENCH_ROUNDS; i++) {
+		bench_fill(pcm_bit_depth);
+
+		start = k_cycle_get_32();
+		ret = pcm_mix_bit_depth(bench_buf_a, size_a, bench_buf_b[0], size_b, mix_mode,
+					pcm_bit_depth);
+		cycles += k_cycle_get_32() - start;
+
+		zassert_equal(ret, 0);
+	}
+
+	TC_PRINT("%2u-bit %-20s: %u cycles per %u output samples\n", pcm_bit_depth,
+		 mode_names[mix_mode], cycles / BENCH_ROUNDS,
+		 (uint32_t)(size_a / sample_size));
+}
+
+static void bench_mix_gain(uint8_t pcm_bit_depth)
+{
+	size_t sample_size = (pcm_bit_depth == 16) ? sizeof(int16_t) : sizeof(int32_t);
+	struct pcm_mix_stream streams[BENCH_STREAMS];
+	uint32_t cycles = 0;
+	uint32_t start;
+	int ret;
+
+	for (size_t s = 0; s < BENCH_STREAMS; s++) {
+		streams[s].pcm = bench_buf_b[s];
+		streams[s].gain = PCM_MIX_GAIN_UNITY / 2;
+	}
+
+	for (int i = 0; i < BENCH_ROUNDS; i++) {
+		bench_fill(pcm_bit_depth);
+
+		start = k_cycle_get_32();
+		ret = pcm_mix_gain(bench_buf_a, BENCH_SAMPLES * sample_size, streams,
+				   ARRAY_SIZE(streams), pcm_bit_depth);
+		cycles += k_cycle_get_32() - start;
+
+		zassert_equal(ret, 0);
+	}
+
+	TC_PRINT("%2u-bit %u streams with gain : %u cycles per %u output samples\n",
+		 pcm_bit_depth, BENCH_STREAMS, cycles / BENCH_ROUNDS, BENCH_SAMPLES);
+}
+
+ZTEST(suite_pcm_mix_bench, test_bench_mix_modes)
+{
+	static const uint8_t bit_depths[] = { 16, 24, 32 };
+
+	for (size_t i = 0; i < ARRAY_SIZE(bit_depths); i++) {
+		for (size_t mode = 0; mode < ARRAY_SIZE(mode_names); mode++) {
+			bench_mix(mode, bit_depths[i]);
+		}
+
+		bench_mix_gain(bit_depths[i]);
+	}
+}
+
+ZTEST_SUITE(suite_pcm_mix_bench, NULL, NULL, NULL, NULL, NULL);
@@ -127,4 +127,125 @@ ZTEST(suite_pcm_mix, test_mono_into_stereo_r)
 	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
 }
 
+ZTEST(suite_pcm_mix, test_mono_into_stereo_l_too_large)
+{
+	int ret;
+	int16_t sample_a[] = { 10, 10, 10, 10 };
+	int16_t sample_b[] = { -5, 5, 5 };
+	int16_t sample_r[] = { 10, 10, 10, 10 };
+
+	ret = pcm_mix(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+		      B_MONO_INTO_A_STEREO_L);
+	ZEQ(ret, -EPERM);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_unaligned_odd_length)
+{
+	int ret;
+	int16_t buf_a[] = { 0, 10, 20, INT16_MAX, INT16_MIN, 50 };
+	int16_t buf_b[] = { 0, 1, 2, 3, -4, 5 };
+	int16_t sample_r[] = { 11, 22, INT16_MAX, INT16_MIN, 55 };
+
+	/* Buffers starting at odd sample are not word aligned */
+	ret = pcm_mix(&buf_a[1], 5 * sizeof(int16_t), &buf_b[1], 5 * sizeof(int16_t),
+		      B_MONO_INTO_A_MONO);
+	ZEQ(ret, 0);
+
+	verify_array_eq(&buf_a[1], sample_r, ARRAY_SIZE(sample_r));
+	ZEQ(buf_a[0], 0);
+}
+
+ZTEST(suite_pcm_mix, test_24_bit)
+{
+	int ret;
+	int32_t sample_a[] = { (1 << 23) - 10, 10, -(1 << 23) + 10, 10 };
+	int32_t sample_b[] = { 20, -20 };
+	int32_t sample_r[] = { (1 << 23) - 1, 30, -(1 << 23), -10 };
+
+	ret = pcm_mix_bit_depth(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+				B_MONO_INTO_A_STEREO_LR, 24);
+	ZEQ(ret, 0);
+
+	zassert_mem_equal(sample_a, sample_r, sizeof(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_32_bit)
+{
+	int ret;
+	int32_t sample_a[] = { INT32_MAX - 1, 10, INT32_MIN + 1, 10 };
+	int32_t sample_b[] = { 5, -5 };
+	int32_t sample_r[] = { INT32_MAX - 1, 15, INT32_MIN + 1, 5 };
+
+	ret = pcm_mix_bit_depth(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+				B_MONO_INTO_A_STEREO_R, 32);
+	ZEQ(ret, 0);
+
+	zassert_mem_equal(sample_a, sample_r, sizeof(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_32_bit_high_values)
+{
+	int ret;
+	int32_t sample_a[] = { INT32_MAX - 1, INT32_MIN + 1 };
+	int32_t sample_b[] = { 5, -5 };
+	int32_t sample_r[] = { INT32_MAX, INT32_MIN };
+
+	ret = pcm_mix_bit_depth(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+				B_STEREO_INTO_A_STEREO, 32);
+	ZEQ(ret, 0);
+
+	zassert_mem_equal(sample_a, sample_r, sizeof(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_illegal_bit_depth)
+{
+	int ret;
+	int16_t sample_a[] = { 0, 1, 2 };
+
+	ret = pcm_mix_bit_depth(sample_a, sizeof(sample_a), sample_a, sizeof(sample_a),
+				B_MONO_INTO_A_MONO, 8);
+	ZEQ(ret, -EINVAL);
+}
+
+ZTEST(suite_pcm_mix, test_gain)
+{
+	int ret;
+	int16_t sample_a[] = { 100, -100, INT16_MAX, 0 };
+	int16_t sample_b[] = { 100, 100, 100, 0 };
+	int16_t sample_c[] = { 1000, 1000, 1000, 1000 };
+	int16_t sample_r[] = { 500, 300, INT16_MAX, 250 };
+	struct pcm_mix_stream streams[] = {
+		{ .pcm = sample_a, .gain = PCM_MIX_GAIN_UNITY },
+		{ .pcm = sample_b, .gain = PCM_MIX_GAIN_UNITY + PCM_MIX_GAIN_UNITY / 2 },
+		{ .pcm = sample_c, .gain = PCM_MIX_GAIN_UNITY / 4 },
+		{ .pcm = NULL, .gain = PCM_MIX_GAIN_UNITY },
+	};
+
+	/* The output can be one of the inputs */
+	ret = pcm_mix_gain(sample_a, sizeof(sample_a), streams, ARRAY_SIZE(streams), 16);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_gain_24_bit)
+{
+	int ret;
+	int32_t sample_a[] = { 1 << 22, -(1 << 22), 1000 };
+	int32_t sample_b[] = { (1 << 23) - 1, -(1 << 23), -3000 };
+	int32_t sample_out[3];
+	int32_t sample_r[] = { (1 << 23) - 1, -(1 << 23), -500 };
+	struct pcm_mix_stream streams[] = {
+		{ .pcm = sample_a, .gain = PCM_MIX_GAIN_UNITY },
+		{ .pcm = sample_b, .gain = PCM_MIX_GAIN_UNITY / 2 },
+	};
+
+	ret = pcm_mix_gain(sample_out, sizeof(sample_out), streams, ARRAY_SIZE(streams), 24);
+	ZEQ(ret, 0);
+
+	zassert_mem_equal(sample_out, sample_r, sizeof(sample_r));
+}
+
 ZTEST_SUITE(suite_pcm_mix, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/tc_util.h>
+#include <sample_rate_converter.h>
+#include <math.h>
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+typedef int16_t sample_t;
+#define SAMPLE_FULL_SCALE INT16_MAX
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+typedef int32_t sample_t;
+#define SAMPLE_FULL_SCALE INT32_MAX
+#endif
+
+/* Number of blocks of 10 ms converted in each SNR test */
+#define SNR_BLOCKS	   20
+/* Output samples skipped while the filter fills up with input samples */
+#define SNR_SKIP_SAMPLES   64
+/* Minimum SNR against a sine wave computed at the output sample rate */
+#define SNR_MIN_DB	   60.0
+#define TONE_HZ		   1000.0
+#define TONE_AMPLITUDE	   (0.5 * SAMPLE_FULL_SCALE)
+#define OUTPUT_BUF_SAMPLES (CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX + 2)
+
+static struct sample_rate_converter_ctx polyphase_ctx;
+static sample_t input_buf[CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX];
+static sample_t output_buf[OUTPUT_BUF_SAMPLES];
+
+static double tone_get(double time, uint32_t sample_rate)
+{
+	return TONE_AMPLITUDE * sin(2.0 * M_PI * TONE_HZ * time / sample_rate);
+}
+
+/**
+ * Convert a sine wave in blocks of 10 ms and compare the output to the same sine wave computed
+ * at the output sample rate. Output sample k is expected at input sample k * step.
+ */
+static double snr_get(uint32_t sample_rate_input, uint32_t sample_rate_output, int32_t adjust_ppb,
+		      size_t *samples_out)
+{
+	size_t block = sample_rate_input / 100;
+	double step = ((double)sample_rate_input / sample_rate_output) * (1.0 + adjust_ppb * 1e-9);
+	double signal = 0.0;
+	double noise = 0.0;
+	size_t n = 0;
+	size_t k = 0;
+	size_t output_written;
+	int ret;
+
+	zassert_true(block <= ARRAY_SIZE(input_buf));
+
+	ret = sample_rate_converter_ratio_adjust(&polyphase_ctx, adjust_ppb);
+	zassert_equal(ret, 0, "Failed to adjust the conversion ratio (%d)", ret);
+
+	for (int b = 0; b < SNR_BLOCKS; b++) {
+		for (size_t i = 0; i < block; i++, n++) {
+			input_buf[i] = (sample_t)lround(tone_get(n, sample_rate_input));
+		}
+
+		ret = sample_rate_converter_process(&polyphase_ctx, SAMPLE_RATE_FILTER_POLYPHASE,
+						    input_buf, block * sizeof(sample_t),
+						    sample_rate_input, output_buf, sizeof(output_buf),
+						    &output_written, sample_rate_output);
+		zassert_equal(ret, 0, "Sample rate conversion process failed (%d)", ret);
+
+		for (size_t i = 0; i < output_written / sizeof(sample_t); i++, k++) {
+			double expected = tone_get(k * step, sample_rate_input);
+			double error = output_buf[i] - expected;
+
+			if (k < SNR_SKIP_SAMPLES) {
+				continue;
+			}
+
+			signal += expected * expected;
+			noise += error * error;
+		}
+	}
+
+	if (samples_out != NULL) {
+		*samples_out = k;
+	}
+
+	return 10.0 * log10(signal / noise);
+}
+
+static void snr_verify(uint32_t sample_rate_input, uint32_t sample_rate_output)
+{
+	size_t samples_out;
+	size_t samples_expected =
+		(uint64_t)SNR_BLOCKS * (sample_rate_input / 100) * sample_rate_output /
+		sample_rate_input;
+	double snr = snr_get(sample_rate_input, sample_rate_output, 0, &samples_out);
+
+	TC_PRINT("%d Hz to %d Hz: SNR %d dB\n", sample_rate_input, sample_rate_output, (int)snr);
+
+	zassert_true(snr >= SNR_MIN_DB, "SNR too low (%d dB)", (int)snr);
+
+	/* Output is delayed by the right wing of the filter, at most half the taps */
+	zassert_true(samples_out <= samples_expected, "Too many output samples (%d)",
+		     samples_out);
+	zassert_true(samples_out + CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_MAX_TAPS / 2 >=
+			     samples_expected,
+		     "Too few output samples (%d)", samples_out);
+}
+
+static void polyphase_setup(void *f)
+{
+	sample_rate_converter_open(&polyphase_ctx);
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_snr_44_1khz_to_48khz)
+{
+	snr_verify(44100, 48000);
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_snr_48khz_to_44_1khz)
+{
+	snr_verify(48000, 44100);
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_snr_48khz_to_32khz)
+{
+	snr_verify(48000, 32000);
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_snr_48khz_to_8khz)
+{
+	snr_verify(48000, 8000);
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_snr_16khz_to_48khz)
+{
+	snr_verify(16000, 48000);
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_ratio_adjust_drift)
+{
+	size_t samples_nominal;
+	size_t samples_fast;
+	size_t samples_slow;
+	double snr;
+
+	snr = snr_get(48000, 48000, 0, &samples_nominal);
+	zassert_true(snr >= SNR_MIN_DB, "SNR too low (%d dB)", (int)snr);
+
+	/* 1000 ppm faster input clock, one sample less every 1000 samples */
+	sample_rate_converter_open(&polyphase_ctx);
+	snr = snr_get(48000, 48000, 1000000, &samples_fast);
+	zassert_true(snr >= SNR_MIN_DB, "SNR too low with positive drift (%d dB)", (int)snr);
+
+	sample_rate_converter_open(&polyphase_ctx);
+	snr = snr_get(48000, 48000, -1000000, &samples_slow);
+	zassert_true(snr >= SNR_MIN_DB, "SNR too low with negative drift (%d dB)", (int)snr);
+
+	zassert_within(samples_nominal - samples_fast, SNR_BLOCKS * 480 / 1000, 1,
+		       "Unexpected number of output samples (%d)", samples_fast);
+	zassert_within(samples_slow - samples_nominal, SNR_BLOCKS * 480 / 1000, 1,
+		       "Unexpected number of output samples (%d)", samples_slow);
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_ratio_adjust_invalid)
+{
+	int ret;
+
+	ret = sample_rate_converter_ratio_adjust(NULL, 0);
+	zassert_equal(ret, -EINVAL, "NULL context did not fail");
+
+	ret = sample_rate_converter_ratio_adjust(
+		&polyphase_ctx, CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_MAX_ADJUST_PPM * 1000 + 1);
+	zassert_equal(ret, -EINVAL, "Too large adjustment did not fail");
+
+	ret = sample_rate_converter_ratio_adjust(
+		&polyphase_ctx, -CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_MAX_ADJUST_PPM * 1000 - 1);
+	zassert_equal(ret, -EINVAL, "Too large negative adjustment did not fail");
+
+	ret = sample_rate_converter_ratio_adjust(
+		&polyphase_ctx, CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_MAX_ADJUST_PPM * 1000);
+	zassert_equal(ret, 0, "Maximum adjustment failed");
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_invalid_too_many_taps)
+{
+	int ret;
+	size_t output_written;
+
+	/* Downsampling by 12 needs twice the default number of taps */
+	ret = sample_rate_converter_process(&polyphase_ctx, SAMPLE_RATE_FILTER_POLYPHASE, input_buf,
+					    sizeof(input_buf), 48000, output_buf,
+					    sizeof(output_buf), &output_written, 4000);
+	zassert_equal(ret, -EINVAL, "Process did not fail");
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_invalid_output_buf_too_small)
+{
+	int ret;
+	size_t output_written;
+	size_t input_size = 441 * sizeof(sample_t);
+
+	/* Fill the filter, then request more output samples than there is space for */
+	ret = sample_rate_converter_process(&polyphase_ctx, SAMPLE_RATE_FILTER_POLYPHASE, input_buf,
+					    input_size, 44100, output_buf, sizeof(output_buf),
+					    &output_written, 48000);
+	zassert_equal(ret, 0, "Sample rate conversion process failed (%d)", ret);
+
+	ret = sample_rate_converter_process(&polyphase_ctx, SAMPLE_RATE_FILTER_POLYPHASE, input_buf,
+					    input_size, 44100, output_buf, input_size,
+					    &output_written, 48000);
+	zassert_equal(ret, -EINVAL, "Process did not fail");
+}
+
+ZTEST_SUITE(suite_sample_rate_converter_polyphase, NULL, NULL, polyphase_setup, NULL, NULL);
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Minimal replacement of the Matter error type, used to test the module without the Matter stack. */
+
+#pragma once
+
+#include <cstdint>
+
+typedef uint32_t CHIP_ERROR;
+
+#define CHIP_NO_ERROR 0u
+#define CHIP_ERROR_INCORRECT_STATE 0x03u
+#define CHIP_ERROR_NO_MEMORY 0x0Bu
+#define CHIP_ERROR_BUFFER_TOO_SMALL 0x19u
+#define CHIP_ERROR_INVALID_ARGUMENT 0x2Fu
+#define CHIP_ERROR_INTERNAL 0xACu
+#define CHIP_ERROR_POSIX(code) (0x200u + static_cast<uint32_t>(code))
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Minimal replacement of the Matter error handling macros. */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+#define VerifyOrReturnError(expr, code)                                                                              \
+	do {                                                                                                         \
+		if (!(expr)) {                                                                                       \
+			return (code);                                                                               \
+		}                                                                                                    \
+	} while (false)
+
+#define ReturnErrorOnFailure(expr)                                                                                   \
+	do {                                                                                                         \
+		CHIP_ERROR __err = (expr);                                                                           \
+		if (__err != CHIP_NO_ERROR) {                                                                        \
+			return __err;                                                                                \
+		}                                                                                                    \
+	} while (false)
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Minimal replacement of the Matter byte span. */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip
+{
+
+class MutableByteSpan {
+public:
+	MutableByteSpan() = default;
+	MutableByteSpan(uint8_t *data, size_t size) : mData(data), mSize(size) {}
+
+	uint8_t *data() const { return mData; }
+	size_t size() const { return mSize; }
+	void reduce_size(size_t size) { mSize = size < mSize ? size : mSize; }
+
+private:
+	uint8_t *mData = nullptr;
+	size_t mSize = 0;
+};
+
+} /* namespace chip */
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Minimal replacement of the Matter system error mapping. */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+namespace chip::System
+{
+
+inline CHIP_ERROR MapErrorZephyr(int code)
+{
+	return code == 0 ? CHIP_NO_ERROR : CHIP_ERROR_POSIX(-code);
+}
+
+} /* namespace chip::System */
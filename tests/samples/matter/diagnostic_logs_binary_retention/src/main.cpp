@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "diagnostic_logs_binary_retention.h"
+
+#include <zephyr/retention/retention.h>
+#include <zephyr/ztest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+
+const struct device *const kPartition = DEVICE_DT_GET(DT_NODELABEL(logs_retention));
+
+/* The partition header holds the image tag, and the positions of the oldest and the newest record. */
+constexpr size_t kPartitionHeaderSize = 3 * sizeof(uint32_t);
+constexpr size_t kRecordHeaderSize = 4;
+constexpr size_t kTextSize = 13;
+
+uint8_t sText[256];
+uint8_t sLogs[1024];
+
+/* Records are numbered, so that the evicted ones can be told apart. */
+const uint8_t *Text(unsigned int number)
+{
+	snprintf(reinterpret_cast<char *>(sText), sizeof(sText), "record %05u\n", number);
+
+	return sText;
+}
+
+size_t Capacity()
+{
+	return retention_size(kPartition) - kPartitionHeaderSize;
+}
+
+size_t ReadAll(DiagnosticLogsBinaryRetention &retention, size_t chunkSize)
+{
+	DiagnosticLogsBinaryRetentionReader reader(retention);
+	bool isEndOfLog = false;
+	size_t size = 0;
+
+	while (!isEndOfLog) {
+		chip::MutableByteSpan chunk(sLogs + size, std::min(chunkSize, sizeof(sLogs) - size));
+
+		zassert_equal(reader.GetLogs(chunk, isEndOfLog), CHIP_NO_ERROR, "Reading logs failed");
+		zassert_true(chunk.size() > 0 || isEndOfLog, "No progress when reading logs");
+		size += chunk.size();
+	}
+
+	zassert_equal(reader.FinishLogs(), CHIP_NO_ERROR, "Finishing logs failed");
+
+	return size;
+}
+
+void Before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_ok(retention_clear(kPartition), "Clearing partition failed");
+}
+
+} /* namespace */
+
+ZTEST(diagnostic_logs_binary_retention, test_wrap_evict)
+{
+	DiagnosticLogsBinaryRetention retention(kPartition);
+	const size_t recordSize = kRecordHeaderSize + kTextSize;
+	const size_t stored = Capacity() / recordSize;
+	const unsigned int written = 3 * stored + 1;
+
+	zassert_equal(retention.Init(), CHIP_NO_ERROR, "Init failed");
+	/* The records must not fit the ring evenly, so that some of them wrap around its end. */
+	zassert_not_equal(Capacity() % recordSize, 0, "Records do not wrap around");
+
+	for (unsigned int i = 0; i < written; i++) {
+		zassert_equal(retention.PushLog(Text(i), kTextSize), CHIP_NO_ERROR, "Pushing log failed");
+	}
+
+	/* Only the newest records are kept, the oldest ones are evicted. */
+	zassert_equal(DiagnosticLogsBinaryRetentionReader(retention).GetLogsSize(), stored * kTextSize,
+		      "Invalid logs size");
+
+	/* The records are read in small chunks, so that the wrapped ones are not read at once. */
+	zassert_equal(ReadAll(retention, 2 * kTextSize + 1), stored * kTextSize, "Invalid logs read");
+
+	for (size_t i = 0; i < stored; i++) {
+		zassert_mem_equal(sLogs + i * kTextSize, Text(written - stored + i), kTextSize,
+				  "Invalid record %zu", i);
+	}
+}
+
+ZTEST(diagnostic_logs_binary_retention, test_split)
+{
+	DiagnosticLogsBinaryRetention retention(kPartition);
+	const size_t size = 2 * CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_MAX_RECORD_SIZE + 7;
+
+	zassert_equal(retention.Init(), CHIP_NO_ERROR, "Init failed");
+
+	for (size_t i = 0; i < size; i++) {
+		sText[i] = 'a' + i % 26;
+	}
+
+	/* Text longer than the maximum record size is stored in several records. */
+	zassert_equal(retention.PushLog(sText, size), CHIP_NO_ERROR, "Pushing log failed");
+	zassert_equal(retention.GetLogsEnd() - retention.GetLogsBegin(), size + 3 * kRecordHeaderSize,
+		      "Invalid number of records");
+
+	zassert_equal(ReadAll(retention, sizeof(sLogs)), size, "Invalid logs read");
+	zassert_mem_equal(sLogs, sText, size, "Invalid logs");
+}
+
+ZTEST(diagnostic_logs_binary_retention, test_clear)
+{
+	DiagnosticLogsBinaryRetention retention(kPartition);
+
+	zassert_equal(retention.Init(), CHIP_NO_ERROR, "Init failed");
+	zassert_equal(retention.PushLog(Text(0), kTextSize), CHIP_NO_ERROR, "Pushing log failed");
+	zassert_equal(retention.Clear(), CHIP_NO_ERROR, "Clearing logs failed");
+
+	zassert_equal(retention.GetLogsBegin(), retention.GetLogsEnd(), "Logs not cleared");
+	zassert_equal(ReadAll(retention, sizeof(sLogs)), 0, "Cleared logs read");
+
+	/* The positions are not rewound, so new records follow the cleared ones. */
+	zassert_equal(retention.PushLog(Text(1), kTextSize), CHIP_NO_ERROR, "Pushing log failed");
+	zassert_equal(ReadAll(retention, sizeof(sLogs)), kTextSize, "Invalid logs read");
+	zassert_mem_equal(sLogs, Text(1), kTextSize, "Invalid logs");
+}
+
+ZTEST(diagnostic_logs_binary_retention, test_image_tag)
+{
+	uint32_t imageTag;
+
+	{
+		DiagnosticLogsBinaryRetention retention(kPartition);
+
+		zassert_equal(retention.Init(), CHIP_NO_ERROR, "Init failed");
+		zassert_equal(retention.PushLog(Text(0), kTextSize), CHIP_NO_ERROR, "Pushing log failed");
+	}
+
+	{
+		/* The records are kept after a reboot of the same image. */
+		DiagnosticLogsBinaryRetention retention(kPartition);
+
+		zassert_equal(retention.Init(), CHIP_NO_ERROR, "Init failed");
+		zassert_equal(ReadAll(retention, sizeof(sLogs)), kTextSize, "Logs not kept");
+		zassert_mem_equal(sLogs, Text(0), kTextSize, "Invalid logs");
+	}
+
+	/* The image tag is the first field of the partition header. */
+	zassert_ok(retention_read(kPartition, 0, reinterpret_cast<uint8_t *>(&imageTag), sizeof(imageTag)));
+	imageTag = ~imageTag;
+	zassert_ok(retention_write(kPartition, 0, reinterpret_cast<uint8_t *>(&imageTag), sizeof(imageTag)));
+
+	{
+		/* The records written by a different image are dropped. */
+		DiagnosticLogsBinaryRetention retention(kPartition);
+
+		zassert_equal(retention.Init(), CHIP_NO_ERROR, "Init failed");
+		zassert_equal(retention.GetLogsBegin(), retention.GetLogsEnd(), "Logs not dropped");
+		zassert_equal(ReadAll(retention, sizeof(sLogs)), 0, "Dropped logs read");
+	}
+}
+
+ZTEST_SUITE(diagnostic_logs_binary_retention, NULL, NULL, Before, NULL, NULL);
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+
+#include "util/hashed_finite_map.h"
+
+namespace
+{
+
+struct Value {
+	operator bool() const { return mValue != 0; }
+	bool operator==(const Value &other) const { return mValue == other.mValue; }
+
+	uint16_t mValue{ 0 };
+};
+
+/* The map of 8 items uses 16 buckets. */
+constexpr uint16_t kMapSize = 8;
+constexpr uint8_t kBucketBits = 4;
+constexpr size_t kBucketsCount = 1 << kBucketBits;
+
+using Map = Nrf::HashedFiniteMap<uint16_t, Value, kMapSize>;
+
+/* The home bucket of the key, computed the same way as by the map, to build the probe sequences on purpose. */
+size_t Home(uint16_t key)
+{
+	uint64_t product = static_cast<uint64_t>(key) * UINT64_C(0x9E3779B97F4A7C15);
+
+	return static_cast<size_t>(product >> (64 - kBucketBits));
+}
+
+/* Find the keys which have the given home bucket, skipping the keys below the start key. */
+void FindKeys(size_t home, uint16_t *keys, size_t count, uint16_t start = 0)
+{
+	for (uint16_t key = start; count > 0; key++) {
+		if (Home(key) == home) {
+			*(keys++) = key;
+			count--;
+		}
+	}
+}
+
+uint16_t ValueOf(uint16_t key)
+{
+	return key + 1;
+}
+
+void Insert(Map &map, uint16_t key)
+{
+	zassert_true(map.Insert(key, Value{ ValueOf(key) }), "Inserting key %u failed", key);
+}
+
+void ExpectFound(Map &map, uint16_t key)
+{
+	zassert_true(map.Contains(key), "Key %u not found", key);
+	zassert_equal(map[key].mValue, ValueOf(key), "Invalid value of key %u", key);
+}
+
+} /* namespace */
+
+ZTEST(hashed_finite_map, test_erase_chain_middle)
+{
+	constexpr size_t kHome = 3;
+	uint16_t chain[3];
+	uint16_t next;
+	Map map;
+
+	FindKeys(kHome, chain, ARRAY_SIZE(chain));
+	FindKeys(kHome + 2, &next, 1);
+
+	/* The chain occupies buckets 3-6: chain[0], chain[1], next (in its home bucket) and chain[2]. */
+	Insert(map, chain[0]);
+	Insert(map, chain[1]);
+	Insert(map, next);
+	Insert(map, chain[2]);
+
+	/* Erasing from the middle of the chain moves chain[2] back into the gap, but not the key in its home bucket,
+	 * as lookups of it start after the gap. */
+	zassert_true(map.Erase(chain[1]), "Erasing key failed");
+	zassert_false(map.Contains(chain[1]), "Erased key found");
+	ExpectFound(map, chain[0]);
+	ExpectFound(map, chain[2]);
+	ExpectFound(map, next);
+	zassert_equal(map.Size(), 3, "Invalid size");
+
+	/* Erasing the head of the chain moves the rest of it once again. */
+	zassert_true(map.Erase(chain[0]), "Erasing key failed");
+	zassert_false(map.Contains(chain[0]), "Erased key found");
+	ExpectFound(map, chain[2]);
+	ExpectFound(map, next);
+
+	/* The erased keys can be inserted again, and are not duplicated. */
+	Insert(map, chain[1]);
+	Insert(map, chain[0]);
+	zassert_false(map.Insert(chain[2], Value{ ValueOf(chain[2]) }), "Duplicated key inserted");
+
+	for (uint16_t key : chain) {
+		ExpectFound(map, key);
+	}
+	ExpectFound(map, next);
+	zassert_equal(map.Size(), 4, "Invalid size");
+}
+
+ZTEST(hashed_finite_map, test_erase_chain_wrap)
+{
+	constexpr size_t kHome = kBucketsCount - 1;
+	uint16_t chain[3];
+	uint16_t next;
+	Map map;
+
+	FindKeys(kHome, chain, ARRAY_SIZE(chain));
+	FindKeys(0, &next, 1);
+
+	/* The chain wraps around the end of the buckets: chain[0] in bucket 15, chain[1] in 0, chain[2] in 1 and next
+	 * in 2, past its home bucket 0. */
+	for (uint16_t key : chain) {
+		Insert(map, key);
+	}
+	Insert(map, next);
+
+	/* All keys following the gap are moved back across the end of the buckets. */
+	zassert_true(map.Erase(chain[0]), "Erasing key failed");
+	zassert_false(map.Contains(chain[0]), "Erased key found");
+	ExpectFound(map, chain[1]);
+	ExpectFound(map, chain[2]);
+	ExpectFound(map, next);
+
+	zassert_true(map.Erase(chain[2]), "Erasing key failed");
+	zassert_false(map.Contains(chain[2]), "Erased key found");
+	ExpectFound(map, chain[1]);
+	ExpectFound(map, next);
+	zassert_equal(map.Size(), 2, "Invalid size");
+}
+
+ZTEST(hashed_finite_map, test_random_operations)
+{
+	/* Keys from a small range, so that the probe sequences are long and often overlap. */
+	constexpr uint16_t kKeysCount = 4 * kMapSize;
+	bool present[kKeysCount] = {};
+	uint16_t presentCount = 0;
+	uint32_t state = 0x12345678;
+	Map map;
+
+	for (int i = 0; i < 10000; i++) {
+		/* xorshift32, so that the sequence is the same on every run. */
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+
+		uint16_t key = state % kKeysCount;
+
+		if (present[key]) {
+			zassert_true(map.Erase(key), "Erasing key %u failed", key);
+			present[key] = false;
+			presentCount--;
+		} else if (presentCount < kMapSize) {
+			Insert(map, key);
+			present[key] = true;
+			presentCount++;
+		} else {
+			zassert_false(map.Insert(key, Value{ ValueOf(key) }), "Key inserted into full map");
+		}
+
+		for (uint16_t k = 0; k < kKeysCount; k++) {
+			if (present[k]) {
+				ExpectFound(map, k);
+			} else {
+				zassert_false(map.Contains(k), "Key %u found after %d operations", k, i + 1);
+			}
+		}
+
+		zassert_equal(map.Size(), presentCount, "Invalid size");
+		zassert_equal(map.FreeSlots(), kMapSize - presentCount, "Invalid number of free slots");
+	}
+}
+
+ZTEST_SUITE(hashed_finite_map, NULL, NULL, NULL, NULL, NULL);
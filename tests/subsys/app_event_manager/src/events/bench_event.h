@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _BENCH_EVENT_H_
+#define _BENCH_EVENT_H_
+
+/**
+ * @brief Bench Event
+ * @defgroup bench_event Bench Event
+ * @{
+ */
+
+#include <app_event_manager.h>
+#include <app_event_manager_profiler_tracer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct bench_event {
+	struct app_event_header header;
+
+	uint32_t seq;
+};
+
+APP_EVENT_TYPE_DECLARE(bench_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _BENCH_EVENT_H_ */
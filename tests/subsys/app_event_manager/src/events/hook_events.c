@@ -0,0 +1,17 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "hook_events.h"
+
+APP_EVENT_TYPE_DEFINE(hook_a_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE());
+
+APP_EVENT_TYPE_DEFINE(hook_b_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE());
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _HOOK_EVENTS_H_
+#define _HOOK_EVENTS_H_
+
+/**
+ * @brief Hook Events
+ * @defgroup hook_events Hook Events
+ * @{
+ */
+
+#include <app_event_manager.h>
+#include <app_event_manager_profiler_tracer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct hook_a_event {
+	struct app_event_header header;
+};
+
+APP_EVENT_TYPE_DECLARE(hook_a_event);
+
+struct hook_b_event {
+	struct app_event_header header;
+};
+
+APP_EVENT_TYPE_DECLARE(hook_b_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _HOOK_EVENTS_H_ */
@@ -0,0 +1,13 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "pool_events.h"
+
+APP_EVENT_TYPE_DEFINE_WITH_POOL(pool_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE(),
+		  POOL_EVENT_POOL_SIZE);
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _POOL_EVENTS_H_
+#define _POOL_EVENTS_H_
+
+/**
+ * @brief Pool Events
+ * @defgroup pool_events Pool Events
+ * @{
+ */
+
+#include <app_event_manager.h>
+#include <app_event_manager_profiler_tracer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of events in the memory pool of the pool event. */
+#define POOL_EVENT_POOL_SIZE 2
+
+struct pool_event {
+	struct app_event_header header;
+
+	/* Set for the last event, which checks the pool after the other events are freed. */
+	bool check;
+};
+
+APP_EVENT_TYPE_DECLARE(pool_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _POOL_EVENTS_H_ */
@@ -25,10 +25,14 @@ enum test_id {
 	TEST_BASIC,
 	TEST_DATA,
 	TEST_EVENT_ORDER,
+	TEST_EVENT_ORDER_BATCH,
 	TEST_SUBSCRIBER_ORDER,
 	TEST_OOM,
 	TEST_MULTICONTEXT,
 	TEST_NAME_STYLE_SORTING,
+	TEST_DISPATCH_BENCH,
+	TEST_HOOKS,
+	TEST_POOLS,
 
 	TEST_CNT
 };
@@ -5,8 +5,10 @@
  */
 
 #include <zephyr/ztest.h>
+#include <zephyr/shell/shell_dummy.h>
 #include <app_event_manager.h>
 
+#include "pool_events.h"
 #include "sized_events.h"
 #include "test_events.h"
 
@@ -63,6 +65,11 @@ ZTEST(suite0, test_event_order)
 	test_start(TEST_EVENT_ORDER);
 }
 
+ZTEST(suite0, test_event_order_batch)
+{
+	test_start(TEST_EVENT_ORDER_BATCH);
+}
+
 ZTEST(suite0, test_subs_order)
 {
 	test_start(TEST_SUBSCRIBER_ORDER);
@@ -184,6 +191,49 @@ ZTEST(suite0, test_name_style_events_sorting)
 	test_start(TEST_NAME_STYLE_SORTING);
 }
 
+ZTEST(suite0, test_dispatch_bench)
+{
+	test_start(TEST_DISPATCH_BENCH);
+}
+
+ZTEST(suite0, test_hooks_for_event)
+{
+	test_start(TEST_HOOKS);
+}
+
+ZTEST(suite0, test_event_pools)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)) {
+		ztest_test_skip();
+		return;
+	}
+
+	test_start(TEST_POOLS);
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+	const struct event_type *et = _EVENT_ID(pool_event);
+	const struct shell *sh = shell_backend_dummy_get_ptr();
+	const char *output;
+	char expected[128];
+	size_t size;
+
+	/* The pool usage is displayed after all of the pool events are freed. */
+	snprintf(expected, sizeof(expected),
+		 "[E:pool_event] block size: %zu, used: 0/%u, max used: %u, heap fallbacks: %ld",
+		 et->pool->info.block_size, POOL_EVENT_POOL_SIZE, POOL_EVENT_POOL_SIZE,
+		 (long)atomic_get(&_app_event_manager_pool_fallback_cnt[et - _event_type_list_start]));
+
+	shell_backend_dummy_clear_output(sh);
+	zassert_ok(shell_execute_cmd(sh, "app_event_manager show_pools"),
+		   "Command show_pools failed");
+
+	output = shell_backend_dummy_get_output(sh, &size);
+	zassert_not_null(strstr(output, expected), "Invalid pool usage: %s", output);
+	zassert_not_null(strstr(output, "[E:test_start_event] no pool"),
+			 "Event without pool not displayed: %s", output);
+#endif
+}
+
 ZTEST_SUITE(suite0, NULL, test_init, NULL, NULL, NULL);
 
 static bool app_event_handler(const struct app_event_header *aeh)
@@ -59,6 +59,32 @@ static bool app_event_handler(const struct app_event_header *aeh)
 			break;
 		}
 
+		case TEST_EVENT_ORDER_BATCH:
+		{
+			sys_slist_t events;
+			struct order_event *event;
+
+			sys_slist_init(&events);
+
+			/* Submit all but last two events as a list. */
+			for (size_t i = 0; i < TEST_EVENT_ORDER_CNT - 2; i++) {
+				event = new_order_event();
+				event->val = i;
+				APP_EVENT_LIST_APPEND(&events, event);
+			}
+
+			app_event_manager_submit_list(&events);
+			zassert_true(sys_slist_is_empty(&events), "List not consumed");
+
+			struct order_event *last1 = new_order_event();
+			struct order_event *last2 = new_order_event();
+
+			last1->val = TEST_EVENT_ORDER_CNT - 2;
+			last2->val = TEST_EVENT_ORDER_CNT - 1;
+			APP_EVENT_SUBMIT_BATCH(last1, last2);
+			break;
+		}
+
 		case TEST_SUBSCRIBER_ORDER:
 		{
 			struct order_event *event = new_order_event();
@@ -25,7 +25,8 @@ static bool app_event_handler(const struct app_event_header *aeh)
 		struct test_start_event *event = cast_test_start_event(aeh);
 
 		cur_test_id = event->test_id;
-		if (cur_test_id == TEST_EVENT_ORDER) {
+		if ((cur_test_id == TEST_EVENT_ORDER) ||
+		    (cur_test_id == TEST_EVENT_ORDER_BATCH)) {
 			i = 0;
 		}
 
@@ -56,7 +57,8 @@ static bool app_event_handler(const struct app_event_header *aeh)
 	}
 
 	if (is_order_event(aeh)) {
-		if (cur_test_id == TEST_EVENT_ORDER) {
+		if ((cur_test_id == TEST_EVENT_ORDER) ||
+		    (cur_test_id == TEST_EVENT_ORDER_BATCH)) {
 			struct order_event *event = cast_order_event(aeh);
 
 			zassert_equal(event->val, i, "Incorrent event order");
@@ -65,7 +67,7 @@ static bool app_event_handler(const struct app_event_header *aeh)
 			if (i == TEST_EVENT_ORDER_CNT) {
 				struct test_end_event *te = new_test_end_event();
 
-				te->test_id = TEST_EVENT_ORDER;
+				te->test_id = cur_test_id;
 				APP_EVENT_SUBMIT(te);
 			}
 		}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "bench_event.h"
+
+#include "test_config.h"
+
+#define MODULE test_dispatch_bench
+
+/* Number of listeners that never consume the bench event. */
+#define BENCH_LISTENER_CNT 4
+
+static uint32_t start_cycles;
+static size_t notification_cnt;
+static size_t event_cnt;
+
+static bool bench_start_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		if (st->test_id != TEST_DISPATCH_BENCH) {
+			/* Ignore other test cases, check if proper test_id. */
+			zassert_true(st->test_id < TEST_CNT,
+				     "test_id out of range");
+			return false;
+		}
+
+		notification_cnt = 0;
+		event_cnt = 0;
+		start_cycles = k_cycle_get_32();
+
+		for (size_t i = 0; i < TEST_DISPATCH_BENCH_EVENT_CNT; i++) {
+			struct bench_event *event = new_bench_event();
+
+			event->seq = i;
+			APP_EVENT_SUBMIT(event);
+		}
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, bench_start_handler);
+APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
+
+static bool bench_listener_handler(const struct app_event_header *aeh)
+{
+	zassert_true(is_bench_event(aeh), "Event unhandled");
+	notification_cnt++;
+
+	return false;
+}
+
+#define BENCH_LISTENER_DEFINE(i, _)						\
+	APP_EVENT_LISTENER_NO_CONSUME(_CONCAT(bench_listener_, i),		\
+				      bench_listener_handler);			\
+	APP_EVENT_SUBSCRIBE(_CONCAT(bench_listener_, i), bench_event);
+
+LISTIFY(BENCH_LISTENER_CNT, BENCH_LISTENER_DEFINE, ())
+
+static bool bench_end_handler(const struct app_event_header *aeh)
+{
+	zassert_true(is_bench_event(aeh), "Event unhandled");
+
+	const struct bench_event *event = cast_bench_event(aeh);
+
+	zassert_equal(event->seq, event_cnt, "Wrong event order");
+	event_cnt++;
+
+	if (event_cnt == TEST_DISPATCH_BENCH_EVENT_CNT) {
+		uint32_t cycles = k_cycle_get_32() - start_cycles;
+
+		zassert_equal(notification_cnt, BENCH_LISTENER_CNT * event_cnt,
+			      "Not all listeners notified");
+
+		TC_PRINT("Dispatch table %s: %u cycles per event (%u listeners)\n",
+			 IS_ENABLED(CONFIG_APP_EVENT_MANAGER_DISPATCH_TABLE) ?
+				"enabled" : "disabled",
+			 cycles / TEST_DISPATCH_BENCH_EVENT_CNT,
+			 BENCH_LISTENER_CNT + 1);
+
+		struct test_end_event *te = new_test_end_event();
+
+		te->test_id = TEST_DISPATCH_BENCH;
+		APP_EVENT_SUBMIT(te);
+	}
+
+	return false;
+}
+
+APP_EVENT_LISTENER_NO_CONSUME(bench_end, bench_end_handler);
+APP_EVENT_SUBSCRIBE_FINAL(bench_end, bench_event);
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "hook_events.h"
+
+#define MODULE test_hooks
+
+static size_t preprocess_cnt;
+static size_t postprocess_cnt;
+static size_t hook_b_cnt;
+
+static void preprocess_hook(const struct app_event_header *aeh)
+{
+	zassert_true(is_hook_a_event(aeh), "Preprocess hook called for other event type");
+	preprocess_cnt++;
+}
+
+APP_EVENT_HOOK_PREPROCESS_REGISTER_FOR_EVENT(preprocess_hook, hook_a_event);
+
+static void postprocess_hook(const struct app_event_header *aeh)
+{
+	zassert_true(is_hook_a_event(aeh), "Postprocess hook called for other event type");
+	postprocess_cnt++;
+}
+
+APP_EVENT_HOOK_POSTPROCESS_REGISTER_FOR_EVENT(postprocess_hook, hook_a_event);
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		if (st->test_id != TEST_HOOKS) {
+			/* Ignore other test cases, check if proper test_id. */
+			zassert_true(st->test_id < TEST_CNT,
+				     "test_id out of range");
+			return false;
+		}
+
+		preprocess_cnt = 0;
+		postprocess_cnt = 0;
+		hook_b_cnt = 0;
+
+		APP_EVENT_SUBMIT(new_hook_b_event());
+		APP_EVENT_SUBMIT(new_hook_a_event());
+		APP_EVENT_SUBMIT(new_hook_b_event());
+
+		return false;
+	}
+
+	if (is_hook_a_event(aeh)) {
+		/* The postprocess hook is called after the listeners. */
+		zassert_equal(preprocess_cnt, 1, "Preprocess hook not called");
+		zassert_equal(postprocess_cnt, 0, "Postprocess hook called too early");
+
+		return false;
+	}
+
+	if (is_hook_b_event(aeh)) {
+		hook_b_cnt++;
+
+		if (hook_b_cnt == 1) {
+			zassert_equal(preprocess_cnt, 0, "Preprocess hook called for hook_b_event");
+			zassert_equal(postprocess_cnt, 0, "Postprocess hook called for hook_b_event");
+		} else {
+			/* The events are processed in the order they are submitted. */
+			zassert_equal(preprocess_cnt, 1, "Preprocess hook called for hook_b_event");
+			zassert_equal(postprocess_cnt, 1, "Postprocess hook called for hook_b_event");
+
+			struct test_end_event *te = new_test_end_event();
+
+			te->test_id = TEST_HOOKS;
+			APP_EVENT_SUBMIT(te);
+		}
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
+APP_EVENT_SUBSCRIBE(MODULE, hook_a_event);
+APP_EVENT_SUBSCRIBE(MODULE, hook_b_event);
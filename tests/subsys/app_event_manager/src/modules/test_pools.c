@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "pool_events.h"
+
+#define MODULE test_pools
+
+static struct k_mem_slab *pool;
+static atomic_t *fallback_cnt;
+static atomic_val_t fallback_cnt_start;
+static size_t pool_event_cnt;
+
+static bool is_in_pool(const void *event)
+{
+	const char *start = pool->buffer;
+	const char *end = start + (pool->info.num_blocks * pool->info.block_size);
+
+	return ((const char *)event >= start) && ((const char *)event < end);
+}
+
+static void pool_test_start(void)
+{
+	struct pool_event *events[POOL_EVENT_POOL_SIZE + 1];
+
+	pool = _EVENT_ID(pool_event)->pool;
+	fallback_cnt = &_app_event_manager_pool_fallback_cnt[_EVENT_ID(pool_event) -
+							     _event_type_list_start];
+
+	zassert_not_null(pool, "Pool not created");
+	zassert_equal(k_mem_slab_num_used_get(pool), 0, "Pool events not freed");
+
+	pool_event_cnt = 0;
+	fallback_cnt_start = atomic_get(fallback_cnt);
+
+	/* Events are allocated from the pool until it is exhausted. */
+	for (size_t i = 0; i < POOL_EVENT_POOL_SIZE; i++) {
+		events[i] = new_pool_event();
+		zassert_true(is_in_pool(events[i]), "Event not allocated from pool");
+		zassert_equal(k_mem_slab_num_used_get(pool), i + 1, "Invalid pool usage");
+	}
+
+	/* The event which does not fit the pool is allocated from heap. */
+	events[POOL_EVENT_POOL_SIZE] = new_pool_event();
+	zassert_false(is_in_pool(events[POOL_EVENT_POOL_SIZE]), "Event allocated from exhausted pool");
+	zassert_equal(atomic_get(fallback_cnt), fallback_cnt_start + 1, "Heap fallback not counted");
+
+	for (size_t i = 0; i < ARRAY_SIZE(events); i++) {
+		events[i]->check = false;
+		APP_EVENT_SUBMIT(events[i]);
+	}
+}
+
+static void pool_test_check(const struct pool_event *event)
+{
+	pool_event_cnt++;
+
+	if (pool_event_cnt == POOL_EVENT_POOL_SIZE + 1) {
+		/* The processed events are returned to the pool, so the next event is allocated from it. */
+		zassert_equal(k_mem_slab_num_used_get(pool), 0, "Pool events not freed");
+
+		struct pool_event *ev = new_pool_event();
+
+		zassert_true(is_in_pool(ev), "Event not allocated from pool");
+		ev->check = true;
+		APP_EVENT_SUBMIT(ev);
+	} else if (event->check) {
+		zassert_equal(k_mem_slab_num_used_get(pool), 1, "Invalid pool usage");
+		zassert_equal(k_mem_slab_max_used_get(pool), POOL_EVENT_POOL_SIZE,
+			      "Invalid pool high-water mark");
+		zassert_equal(atomic_get(fallback_cnt), fallback_cnt_start + 1,
+			      "Unexpected heap fallback");
+
+		struct test_end_event *te = new_test_end_event();
+
+		te->test_id = TEST_POOLS;
+		APP_EVENT_SUBMIT(te);
+	}
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		if (st->test_id != TEST_POOLS) {
+			/* Ignore other test cases, check if proper test_id. */
+			zassert_true(st->test_id < TEST_CNT,
+				     "test_id out of range");
+			return false;
+		}
+
+		pool_test_start();
+
+		return false;
+	}
+
+	if (is_pool_event(aeh)) {
+		pool_test_check(cast_pool_event(aeh));
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
+APP_EVENT_SUBSCRIBE(MODULE, pool_event);
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <string.h>
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/conn.h>
+
+#include "conn_mock.h"
+
+static const bt_addr_le_t peer_addr = {
+	.type = BT_ADDR_LE_PUBLIC,
+	.a.val = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06},
+};
+
+static bool peer_bonded;
+
+void bt_conn_mock_bonded_set(bool bonded)
+{
+	peer_bonded = bonded;
+}
+
+const bt_addr_le_t *bt_conn_mock_peer_get(void)
+{
+	return &peer_addr;
+}
+
+int __wrap_bt_conn_get_info(const struct bt_conn *conn, struct bt_conn_info *info)
+{
+	ARG_UNUSED(conn);
+
+	memset(info, 0, sizeof(*info));
+	info->type = BT_CONN_TYPE_LE;
+	info->id = BT_ID_DEFAULT;
+	info->le.dst = &peer_addr;
+
+	return 0;
+}
+
+void __wrap_bt_foreach_bond(uint8_t id, void (*func)(const struct bt_bond_info *info,
+						      void *user_data),
+			    void *user_data)
+{
+	struct bt_bond_info info;
+
+	if (id != BT_ID_DEFAULT || !peer_bonded) {
+		return;
+	}
+
+	bt_addr_le_copy(&info.addr, &peer_addr);
+	func(&info, user_data);
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BT_CONN_MOCK_H_
+#define BT_CONN_MOCK_H_
+
+#include <stdbool.h>
+#include <zephyr/bluetooth/addr.h>
+
+/**
+ * @file
+ * @defgroup bt_conn_mock API
+ * @{
+ * @brief The API used to setup the mock of the peer
+ *
+ * The bt_conn_get_info and bt_foreach_bond functions are wrapped, so that any
+ * connection object refers to the same peer.
+ */
+
+/**
+ * @brief Set the bond state of the peer
+ *
+ * @param bonded True if the peer is bonded.
+ */
+void bt_conn_mock_bonded_set(bool bonded);
+
+/**
+ * @brief Get the identity address of the peer
+ *
+ * @return The identity address of the peer.
+ */
+const bt_addr_le_t *bt_conn_mock_peer_get(void);
+
+/** @} */
+#endif /* BT_CONN_MOCK_H_ */
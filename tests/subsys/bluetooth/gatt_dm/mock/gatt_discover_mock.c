@@ -11,6 +11,7 @@
 #include <zephyr/ztest.h>
 #include <zephyr/sys/util.h>
 
+#define DB_HASH_MOCK_SIZE 16
 
 /* Settings of the discover mock */
 static struct bt_discover_mock {
@@ -19,15 +20,37 @@ static struct bt_discover_mock {
 	struct bt_conn *conn;
 	struct bt_gatt_discover_params *params;
 	struct k_work_delayable work;
+	size_t cnt;
 } discover_mock_data;
 
+/* Settings of the read mock */
+static struct bt_read_mock {
+	const uint8_t *db_hash;
+	struct bt_conn *conn;
+	struct bt_gatt_read_params *params;
+	struct k_work_delayable work;
+} read_mock_data;
+
 static void bt_gatt_discover_work(struct k_work *work);
+static void bt_gatt_read_work(struct k_work *work);
 
 void bt_gatt_discover_mock_setup(const struct bt_gatt_attr *attr, size_t len)
 {
 	k_work_init_delayable(&discover_mock_data.work, bt_gatt_discover_work);
 	discover_mock_data.attr = attr;
 	discover_mock_data.len  = len;
+	discover_mock_data.cnt  = 0;
+}
+
+size_t bt_gatt_discover_mock_cnt_get(void)
+{
+	return discover_mock_data.cnt;
+}
+
+void bt_gatt_read_mock_setup(const uint8_t *db_hash)
+{
+	k_work_init_delayable(&read_mock_data.work, bt_gatt_read_work);
+	read_mock_data.db_hash = db_hash;
 }
 
 static bool bt_gatt_primary_check(const struct bt_gatt_attr *attr_cur,
@@ -128,7 +151,38 @@ int bt_gatt_discover(struct bt_conn *conn,
 	printk("Running %s mock\n", __func__);
 	discover_mock_data.conn = conn;
 	discover_mock_data.params = params;
+	discover_mock_data.cnt++;
 
 	k_work_schedule(&discover_mock_data.work, K_MSEC(5));
 	return 0;
 }
+
+static void bt_gatt_read_work(struct k_work *work)
+{
+	struct bt_gatt_read_params *params = read_mock_data.params;
+
+	zassert_equal(0, params->handle_count, "Only reading by UUID is supported");
+	zassert_true(!bt_uuid_cmp(BT_UUID_GATT_DB_HASH, params->by_uuid.uuid),
+		     "Only reading the Database Hash is supported");
+
+	if (!read_mock_data.db_hash) {
+		(void)params->func(read_mock_data.conn, BT_ATT_ERR_ATTRIBUTE_NOT_FOUND, params,
+				   NULL, 0);
+		return;
+	}
+
+	(void)params->func(read_mock_data.conn, 0, params, read_mock_data.db_hash,
+			   DB_HASH_MOCK_SIZE);
+}
+
+/* Mocked version of the bt_gatt_read */
+/* Call the bt_gatt_read_mock_setup function first */
+int bt_gatt_read(struct bt_conn *conn, struct bt_gatt_read_params *params)
+{
+	printk("Running %s mock\n", __func__);
+	read_mock_data.conn = conn;
+	read_mock_data.params = params;
+
+	k_work_schedule(&read_mock_data.work, K_MSEC(5));
+	return 0;
+}
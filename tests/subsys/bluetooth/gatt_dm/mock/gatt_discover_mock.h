@@ -90,5 +90,25 @@
  */
 void bt_gatt_discover_mock_setup(const struct bt_gatt_attr *attr, size_t len);
 
+/**
+ * @brief Get the number of the GATT discover calls
+ *
+ * The number is reset by @ref bt_gatt_discover_mock_setup.
+ *
+ * @return The number of @ref bt_gatt_discover calls.
+ */
+size_t bt_gatt_discover_mock_cnt_get(void);
+
+/**
+ * @brief GATT read mock setup
+ *
+ * This function setups the mock for @ref bt_gatt_read function.
+ * Only reading the Database Hash characteristic by its UUID is supported.
+ *
+ * @param db_hash The value of the Database Hash characteristic or NULL
+ *                if the characteristic is not present.
+ */
+void bt_gatt_read_mock_setup(const uint8_t *db_hash);
+
 /** @} */
 #endif /* #define BT_GATT_DISCOVERY_MOCK_H_ */
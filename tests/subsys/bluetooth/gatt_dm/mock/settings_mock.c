@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <string.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/ztest.h>
+
+#include "settings_mock.h"
+
+#define SETTINGS_MOCK_NAME_MAX_LEN 64
+
+struct settings_data {
+	sys_snode_t node;
+	char *name;
+	char *val;
+	size_t val_len;
+};
+
+static sys_slist_t settings_list;
+
+static void settings_data_free(struct settings_data *data)
+{
+	k_free(data->val);
+	k_free(data->name);
+	k_free(data);
+}
+
+void settings_mock_clear(void)
+{
+	while (!sys_slist_is_empty(&settings_list)) {
+		sys_snode_t *cur_node = sys_slist_get(&settings_list);
+
+		settings_data_free(CONTAINER_OF(cur_node, struct settings_data, node));
+	}
+}
+
+size_t settings_mock_cnt_get(void)
+{
+	return sys_slist_len(&settings_list);
+}
+
+static ssize_t settings_mock_read_fn(void *back_end, void *data, size_t len)
+{
+	struct settings_data *settings_data = back_end;
+
+	len = MIN(len, settings_data->val_len);
+	memcpy(data, settings_data->val, len);
+
+	return len;
+}
+
+static int settings_mock_load(struct settings_store *cs, const struct settings_load_arg *arg)
+{
+	struct settings_data *data;
+	int err = 0;
+
+	/* The subtree filtering is done by settings_call_set_handler. */
+	SYS_SLIST_FOR_EACH_CONTAINER(&settings_list, data, node) {
+		err = settings_call_set_handler(data->name, data->val_len, settings_mock_read_fn,
+						data, arg);
+		if (err) {
+			break;
+		}
+	}
+
+	return err;
+}
+
+static int settings_mock_save(struct settings_store *cs, const char *name, const char *value,
+			      size_t val_len)
+{
+	struct settings_data *record;
+	size_t name_len = strnlen(name, SETTINGS_MOCK_NAME_MAX_LEN);
+
+	zassert_not_equal(name_len, SETTINGS_MOCK_NAME_MAX_LEN, "Too long settings key");
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&settings_list, record, node) {
+		if (strcmp(record->name, name)) {
+			continue;
+		}
+
+		/* Delete the record */
+		if (val_len == 0) {
+			zassert_true(sys_slist_find_and_remove(&settings_list, &record->node),
+				     "Unable to delete settings item");
+			settings_data_free(record);
+			return 0;
+		}
+
+		k_free(record->val);
+		record->val = k_malloc(val_len);
+		zassert_not_null(record->val, "Heap too small. Increase heap size.");
+		memcpy(record->val, value, val_len);
+		record->val_len = val_len;
+
+		return 0;
+	}
+
+	if (val_len == 0) {
+		return 0;
+	}
+
+	record = k_malloc(sizeof(*record));
+	zassert_not_null(record, "Heap too small. Increase heap size.");
+
+	record->name = k_malloc(name_len + 1);
+	zassert_not_null(record->name, "Heap too small. Increase heap size.");
+	strcpy(record->name, name);
+
+	record->val = k_malloc(val_len);
+	zassert_not_null(record->val, "Heap too small. Increase heap size.");
+	memcpy(record->val, value, val_len);
+	record->val_len = val_len;
+
+	sys_slist_append(&settings_list, &record->node);
+
+	return 0;
+}
+
+static struct settings_store_itf settings_mock_itf = {
+	.csi_load = settings_mock_load,
+	.csi_save = settings_mock_save,
+};
+
+static struct settings_store settings_mock_store = {
+	.cs_itf = &settings_mock_itf
+};
+
+static int settings_mock_init(void)
+{
+	sys_slist_init(&settings_list);
+
+	settings_dst_register(&settings_mock_store);
+	settings_src_register(&settings_mock_store);
+
+	return 0;
+}
+
+SYS_INIT(settings_mock_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEVICE);
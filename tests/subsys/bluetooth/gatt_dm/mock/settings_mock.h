@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SETTINGS_MOCK_H_
+#define SETTINGS_MOCK_H_
+
+#include <stddef.h>
+
+/**
+ * @file
+ * @defgroup settings_mock API
+ * @{
+ * @brief The API of the settings backend that stores the values in RAM
+ */
+
+/** @brief Remove all stored values. */
+void settings_mock_clear(void);
+
+/**
+ * @brief Get the number of stored values
+ *
+ * @return The number of stored values.
+ */
+size_t settings_mock_cnt_get(void);
+
+/** @} */
+#endif /* SETTINGS_MOCK_H_ */
@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/bluetooth/uuid.h>
+#include <bluetooth/gatt_dm.h>
+#include "../mock/gatt_discover_mock.h"
+#include "../mock/conn_mock.h"
+#include "../mock/settings_mock.h"
+
+/* Timeout for the discovery in ms */
+#define SERVICE_DISCOVERY_TIMEOUT 2000
+
+#define BT_UUID_VENDOR_SERV \
+	BT_UUID_DECLARE_128(BT_UUID_128_ENCODE(0x6e400001, 0xb5a3, 0xf393, 0xe0a9, 0xe50e24dcca9e))
+#define BT_UUID_VENDOR_CHR \
+	BT_UUID_DECLARE_128(BT_UUID_128_ENCODE(0x6e400002, 0xb5a3, 0xf393, 0xe0a9, 0xe50e24dcca9e))
+
+static char dummy_conn;
+static K_SEM_DEFINE(cache_discovery_finished, 0, 1);
+
+/* Recorded discovery responses of the peer */
+static const struct bt_gatt_attr recorded_db[] = {
+	BT_GATT_DISCOVER_MOCK_SERV(1, BT_UUID_GATT, 5),
+	BT_GATT_DISCOVER_MOCK_CHRC(2, BT_UUID_GATT_SC, BT_GATT_CHRC_INDICATE),
+	BT_GATT_DISCOVER_MOCK_DESC(3, BT_UUID_GATT_SC),
+	BT_GATT_DISCOVER_MOCK_DESC(4, BT_UUID_GATT_CCC),
+	BT_GATT_DISCOVER_MOCK_CHRC(5, BT_UUID_GATT_DB_HASH, BT_GATT_CHRC_READ),
+
+	BT_GATT_DISCOVER_MOCK_SERV(6, BT_UUID_BAS, 9),
+	BT_GATT_DISCOVER_MOCK_CHRC(7, BT_UUID_BAS_BATTERY_LEVEL,
+				   BT_GATT_CHRC_READ | BT_GATT_CHRC_NOTIFY),
+	BT_GATT_DISCOVER_MOCK_DESC(8, BT_UUID_BAS_BATTERY_LEVEL),
+	BT_GATT_DISCOVER_MOCK_DESC(9, BT_UUID_GATT_CCC),
+
+	BT_GATT_DISCOVER_MOCK_SERV(10, BT_UUID_VENDOR_SERV, 10),
+
+	BT_GATT_DISCOVER_MOCK_SERV(11, BT_UUID_VENDOR_SERV, 0xffff),
+	BT_GATT_DISCOVER_MOCK_CHRC(12, BT_UUID_VENDOR_CHR, BT_GATT_CHRC_WRITE),
+	BT_GATT_DISCOVER_MOCK_DESC(13, BT_UUID_VENDOR_CHR),
+};
+
+/* Recorded discovery responses of the peer after a firmware update */
+static const struct bt_gatt_attr recorded_db_updated[] = {
+	BT_GATT_DISCOVER_MOCK_SERV(1, BT_UUID_GATT, 5),
+	BT_GATT_DISCOVER_MOCK_CHRC(2, BT_UUID_GATT_SC, BT_GATT_CHRC_INDICATE),
+	BT_GATT_DISCOVER_MOCK_DESC(3, BT_UUID_GATT_SC),
+	BT_GATT_DISCOVER_MOCK_DESC(4, BT_UUID_GATT_CCC),
+	BT_GATT_DISCOVER_MOCK_CHRC(5, BT_UUID_GATT_DB_HASH, BT_GATT_CHRC_READ),
+
+	BT_GATT_DISCOVER_MOCK_SERV(6, BT_UUID_DIS, 8),
+	BT_GATT_DISCOVER_MOCK_CHRC(7, BT_UUID_DIS_MODEL_NUMBER, BT_GATT_CHRC_READ),
+	BT_GATT_DISCOVER_MOCK_DESC(8, BT_UUID_DIS_MODEL_NUMBER),
+
+	BT_GATT_DISCOVER_MOCK_SERV(9, BT_UUID_BAS, 0xffff),
+	BT_GATT_DISCOVER_MOCK_CHRC(10, BT_UUID_BAS_BATTERY_LEVEL, BT_GATT_CHRC_READ),
+	BT_GATT_DISCOVER_MOCK_DESC(11, BT_UUID_BAS_BATTERY_LEVEL),
+};
+
+static const uint8_t db_hash[16] = {
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+	0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10,
+};
+
+static const uint8_t db_hash_updated[16] = {
+	0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+	0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20,
+};
+
+static void cache_cb_completed(struct bt_gatt_dm *dm, void *context)
+{
+	*(struct bt_gatt_dm **)context = dm;
+	k_sem_give(&cache_discovery_finished);
+}
+
+static void cache_cb_service_not_found(struct bt_conn *conn, void *context)
+{
+	*(struct bt_gatt_dm **)context = NULL;
+	k_sem_give(&cache_discovery_finished);
+}
+
+static void cache_cb_error_found(struct bt_conn *conn, int err, void *context)
+{
+	zassert_unreachable("Discovery error: %d", err);
+}
+
+static const struct bt_gatt_dm_cb cache_cb = {
+	.completed         = cache_cb_completed,
+	.service_not_found = cache_cb_service_not_found,
+	.error_found       = cache_cb_error_found
+};
+
+static struct bt_gatt_dm *cache_run_dm(const struct bt_uuid *svc_uuid)
+{
+	struct bt_gatt_dm *dm;
+	int err;
+
+	err = bt_gatt_dm_start((struct bt_conn *)&dummy_conn, svc_uuid, &cache_cb, &dm);
+	zassert_ok(err, "bt_gatt_dm_start finished with error: %d", err);
+
+	err = k_sem_take(&cache_discovery_finished, K_MSEC(SERVICE_DISCOVERY_TIMEOUT));
+	zassert_ok(err, "It seems that no callback function was called: %d", err);
+
+	return dm;
+}
+
+static struct bt_gatt_dm *cache_run_dm_next(struct bt_gatt_dm *dm)
+{
+	struct bt_gatt_dm *dm_next;
+	int err;
+
+	bt_gatt_dm_data_release(dm);
+
+	err = bt_gatt_dm_continue(dm, &dm_next);
+	zassert_ok(err, "bt_gatt_dm_continue finished with error: %d", err);
+
+	err = k_sem_take(&cache_discovery_finished, K_MSEC(SERVICE_DISCOVERY_TIMEOUT));
+	zassert_ok(err, "It seems that no callback function was called: %d", err);
+
+	return dm_next;
+}
+
+/* Checks the discovered attributes against the recorded database */
+static void check_attrs(const struct bt_gatt_dm *dm, const struct bt_gatt_attr *db, size_t db_len)
+{
+	const struct bt_gatt_dm_attr *attr = bt_gatt_dm_service_get(dm);
+	size_t cnt = 0;
+
+	for (; attr; attr = bt_gatt_dm_attr_next(dm, attr), cnt++) {
+		const struct bt_gatt_attr *db_attr = NULL;
+		const struct bt_gatt_service_val *service_val;
+		const struct bt_gatt_chrc *chrc;
+
+		for (size_t i = 0; i < db_len; i++) {
+			if (db[i].handle == attr->handle) {
+				db_attr = &db[i];
+				break;
+			}
+		}
+
+		zassert_not_null(db_attr, "Unexpected handle: %u", attr->handle);
+		zassert_true(!bt_uuid_cmp(db_attr->uuid, attr->uuid), "Unexpected UUID, handle: %u",
+			     attr->handle);
+
+		service_val = bt_gatt_dm_attr_service_val(attr);
+		if (service_val) {
+			const struct bt_gatt_service_val *db_val = db_attr->user_data;
+
+			zassert_true(!bt_uuid_cmp(db_val->uuid, service_val->uuid),
+				     "Unexpected service UUID, handle: %u", attr->handle);
+			zassert_equal(db_val->end_handle, service_val->end_handle,
+				      "Unexpected end handle, handle: %u", attr->handle);
+		}
+
+		chrc = bt_gatt_dm_attr_chrc_val(attr);
+		if (chrc) {
+			const struct bt_gatt_chrc *db_chrc = db_attr->user_data;
+
+			zassert_true(!bt_uuid_cmp(db_chrc->uuid, chrc->uuid),
+				     "Unexpected characteristic UUID, handle: %u", attr->handle);
+			zassert_equal(db_chrc->properties, chrc->properties,
+				      "Unexpected properties, handle: %u", attr->handle);
+		}
+	}
+
+	zassert_equal(cnt, bt_gatt_dm_attr_cnt(dm), "Unexpected number of attributes: %zu", cnt);
+}
+
+/* Discovers the service, releases the data and returns the number of GATT discover calls */
+static size_t cache_discover(const struct bt_uuid *svc_uuid, const struct bt_gatt_attr *db,
+			     size_t db_len, size_t attr_cnt)
+{
+	struct bt_gatt_dm *dm;
+	size_t cnt;
+
+	bt_gatt_discover_mock_setup(db, db_len);
+
+	dm = cache_run_dm(svc_uuid);
+	if (!attr_cnt) {
+		zassert_is_null(dm, "Detected service that should be inviable");
+		return bt_gatt_discover_mock_cnt_get();
+	}
+
+	zassert_not_null(dm, "Device Manager pointer not set");
+	zassert_equal(attr_cnt, bt_gatt_dm_attr_cnt(dm), "Unexpected number of attributes: %zu",
+		      bt_gatt_dm_attr_cnt(dm));
+	check_attrs(dm, db, db_len);
+
+	cnt = bt_gatt_discover_mock_cnt_get();
+
+	zassert_ok(bt_gatt_dm_data_release(dm), "Release failed");
+
+	return cnt;
+}
+
+static void cache_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_sem_reset(&cache_discovery_finished);
+	settings_mock_clear();
+	bt_conn_mock_bonded_set(true);
+	bt_gatt_read_mock_setup(db_hash);
+}
+
+static void cache_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Other test suites discover a different database of the same peer */
+	settings_mock_clear();
+	bt_conn_mock_bonded_set(false);
+}
+
+ZTEST_SUITE(gatt_dm_cache, NULL, NULL, cache_before, cache_after, NULL);
+
+ZTEST(gatt_dm_cache, test_cache_hit)
+{
+	zassert_not_equal(0, cache_discover(BT_UUID_BAS, recorded_db, ARRAY_SIZE(recorded_db), 4),
+			  "First discovery served from the cache");
+	zassert_equal(0, cache_discover(BT_UUID_BAS, recorded_db, ARRAY_SIZE(recorded_db), 4),
+		      "Discovery not served from the cache");
+
+	/* Other services are discovered and cached separately */
+	zassert_not_equal(0, cache_discover(BT_UUID_GATT, recorded_db, ARRAY_SIZE(recorded_db), 5),
+			  "First discovery served from the cache");
+	zassert_equal(0, cache_discover(BT_UUID_GATT, recorded_db, ARRAY_SIZE(recorded_db), 5),
+		      "Discovery not served from the cache");
+	zassert_equal(0, cache_discover(BT_UUID_BAS, recorded_db, ARRAY_SIZE(recorded_db), 4),
+		      "Discovery not served from the cache");
+}
+
+ZTEST(gatt_dm_cache, test_cache_service_not_found)
+{
+	zassert_not_equal(0, cache_discover(BT_UUID_HIDS, recorded_db, ARRAY_SIZE(recorded_db), 0),
+			  "First discovery served from the cache");
+	zassert_equal(0, cache_discover(BT_UUID_HIDS, recorded_db, ARRAY_SIZE(recorded_db), 0),
+		      "Discovery not served from the cache");
+}
+
+ZTEST(gatt_dm_cache, test_cache_continue)
+{
+	static const size_t attr_cnt[] = {5, 4, 1, 3};
+
+	for (int round = 0; round < 2; round++) {
+		struct bt_gatt_dm *dm;
+
+		bt_gatt_discover_mock_setup(recorded_db, ARRAY_SIZE(recorded_db));
+
+		dm = cache_run_dm(NULL);
+		for (size_t i = 0; i < ARRAY_SIZE(attr_cnt); i++) {
+			zassert_not_null(dm, "Device Manager pointer not set, service %zu", i);
+			zassert_equal(attr_cnt[i], bt_gatt_dm_attr_cnt(dm),
+				      "Unexpected number of attributes: %zu, service %zu",
+				      bt_gatt_dm_attr_cnt(dm), i);
+			check_attrs(dm, recorded_db, ARRAY_SIZE(recorded_db));
+
+			dm = cache_run_dm_next(dm);
+		}
+
+		zassert_is_null(dm, "Unexpected service detected");
+
+		if (round == 0) {
+			zassert_not_equal(0, bt_gatt_discover_mock_cnt_get(),
+					  "First discovery served from the cache");
+		} else {
+			zassert_equal(0, bt_gatt_discover_mock_cnt_get(),
+				      "Discovery not served from the cache");
+		}
+	}
+}
+
+ZTEST(gatt_dm_cache, test_cache_empty_service)
+{
+	/* The first instance of the vendor service is empty */
+	zassert_not_equal(0, cache_discover(BT_UUID_VENDOR_SERV, recorded_db,
+					    ARRAY_SIZE(recorded_db), 1),
+			  "First discovery served from the cache");
+	zassert_equal(0, cache_discover(BT_UUID_VENDOR_SERV, recorded_db,
+					ARRAY_SIZE(recorded_db), 1),
+		      "Discovery not served from the cache");
+}
+
+ZTEST(gatt_dm_cache, test_cache_db_hash_changed)
+{
+	zassert_not_equal(0, cache_discover(BT_UUID_BAS, recorded_db, ARRAY_SIZE(recorded_db), 4),
+			  "First discovery served from the cache");
+
+	bt_gatt_read_mock_setup(db_hash_updated);
+
+	zassert_not_equal(0, cache_discover(BT_UUID_BAS, recorded_db_updated,
+					    ARRAY_SIZE(recorded_db_updated), 3),
+			  "Outdated cache used");
+	zassert_equal(0, cache_discover(BT_UUID_BAS, recorded_db_updated,
+					ARRAY_SIZE(recorded_db_updated), 3),
+		      "Discovery not served from the cache");
+}
+
+ZTEST(gatt_dm_cache, test_cache_invalidate)
+{
+	zassert_not_equal(0, cache_discover(BT_UUID_BAS, recorded_db, ARRAY_SIZE(recorded_db), 4),
+			  "First discovery served from the cache");
+	zassert_not_equal(0, settings_mock_cnt_get(), "Nothing stored");
+
+	zassert_ok(bt_gatt_dm_cache_invalidate(bt_conn_mock_peer_get()), "Invalidate failed");
+
+	/* The cache is removed in the discovery workqueue. */
+	zassert_true(WAIT_FOR(settings_mock_cnt_get() == 0, USEC_PER_SEC, k_msleep(1)),
+		     "Cache not removed");
+
+	zassert_not_equal(0, cache_discover(BT_UUID_BAS, recorded_db, ARRAY_SIZE(recorded_db), 4),
+			  "Removed cache used");
+}
+
+ZTEST(gatt_dm_cache, test_cache_not_bonded)
+{
+	bt_conn_mock_bonded_set(false);
+
+	zassert_not_equal(0, cache_discover(BT_UUID_BAS, recorded_db, ARRAY_SIZE(recorded_db), 4),
+			  "First discovery served from the cache");
+	zassert_not_equal(0, cache_discover(BT_UUID_BAS, recorded_db, ARRAY_SIZE(recorded_db), 4),
+			  "Cache used for a peer that is not bonded");
+	zassert_equal(0, settings_mock_cnt_get(), "Cache stored for a peer that is not bonded");
+}
+
+ZTEST(gatt_dm_cache, test_cache_no_db_hash)
+{
+	bt_gatt_read_mock_setup(NULL);
+
+	zassert_not_equal(0, cache_discover(BT_UUID_BAS, recorded_db, ARRAY_SIZE(recorded_db), 4),
+			  "First discovery served from the cache");
+	zassert_not_equal(0, cache_discover(BT_UUID_BAS, recorded_db, ARRAY_SIZE(recorded_db), 4),
+			  "Cache used for a peer without the Database Hash");
+	zassert_equal(0, settings_mock_cnt_get(),
+		      "Cache stored for a peer without the Database Hash");
+}
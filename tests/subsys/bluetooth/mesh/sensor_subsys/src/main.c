@@ -11,6 +11,7 @@
 
 #include <zephyr/ztest.h>
 #include <bluetooth/mesh/sensor_types.h>
+#include <bluetooth/mesh/properties.h>
 #include <sensor.h> /* private header from the source folder */
 
 #ifndef CONFIG_LITTLE_ENDIAN
@@ -975,4 +976,62 @@ TEST_SENSOR_TYPE(rel_dev_runtime_in_a_generic_level_range, 0x0061,
 
 TEST_SENSOR_TYPE(total_dev_runtime, 0x006e, CHANNEL(time_hour_24, 3))
 
+/****************** type lookup section **********************************/
+
+ZTEST(sensor_types_test, test_type_get)
+{
+	const struct bt_mesh_sensor_type *prev = NULL;
+
+	/* The lookup depends on the sensor types being sorted by their IDs. */
+	STRUCT_SECTION_FOREACH(bt_mesh_sensor_type, type) {
+		if (prev) {
+			zassert_true(prev->id < type->id, "0x%04x out of order", type->id);
+		}
+
+		zassert_equal_ptr(bt_mesh_sensor_type_get(type->id), type);
+		prev = type;
+	}
+
+	zassert_is_null(bt_mesh_sensor_type_get(BT_MESH_PROP_ID_PROHIBITED));
+	zassert_is_null(bt_mesh_sensor_type_get(BT_MESH_PROP_ID_CENTER_BEAM_INTENSITY_AT_FULL_POWER));
+	zassert_is_null(bt_mesh_sensor_type_get(0xffff));
+}
+
+ZTEST(sensor_types_test, test_status_decode)
+{
+	struct sensor_status_entry entries[3];
+
+	NET_BUF_SIMPLE_DEFINE(buf, 32);
+
+	zassert_ok(sensor_status_id_encode(&buf, 1, BT_MESH_PROP_ID_MOTION_SENSED));
+	net_buf_simple_add_u8(&buf, 100);
+	/* Unknown sensor type in the long format */
+	zassert_ok(sensor_status_id_encode(&buf, 2, 0x0800));
+	net_buf_simple_add_le16(&buf, 0x1234);
+	/* Sensor without data */
+	zassert_ok(sensor_status_id_encode(&buf, 0, BT_MESH_PROP_ID_PEOPLE_COUNT));
+	zassert_ok(sensor_status_id_encode(&buf, 1, BT_MESH_PROP_ID_PRESENT_AMB_TEMP));
+	net_buf_simple_add_u8(&buf, 42);
+	/* Truncated data */
+	zassert_ok(sensor_status_id_encode(&buf, 2, BT_MESH_PROP_ID_TIME_SINCE_MOTION_SENSED));
+	net_buf_simple_add_u8(&buf, 0);
+
+	zassert_equal(sensor_status_decode(&buf, entries, ARRAY_SIZE(entries)), 3);
+	zassert_equal_ptr(entries[0].type, &bt_mesh_sensor_motion_sensed);
+	zassert_equal(entries[0].len, 1);
+	zassert_equal(entries[0].data[0], 100);
+	zassert_is_null(entries[1].type);
+	zassert_equal(entries[1].id, 0x0800);
+	zassert_equal(entries[1].len, 2);
+	zassert_equal_ptr(entries[2].type, &bt_mesh_sensor_people_count);
+	zassert_equal(entries[2].len, 0);
+
+	/* The valid entries are decoded before the truncated one fails. */
+	zassert_equal(sensor_status_decode(&buf, entries, ARRAY_SIZE(entries)), 1);
+	zassert_equal_ptr(entries[0].type, &bt_mesh_sensor_present_amb_temp);
+	zassert_equal(entries[0].data[0], 42);
+
+	zassert_equal(sensor_status_decode(&buf, entries, ARRAY_SIZE(entries)), -EMSGSIZE);
+}
+
 ZTEST_SUITE(sensor_types_test, NULL, NULL, NULL, NULL, NULL);
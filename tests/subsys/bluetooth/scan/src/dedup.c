@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "scan_test_common.h"
+
+#define DELIVERY_WAIT K_MSEC(2 * CONFIG_BT_SCAN_CHANGED_DEVICES_INTERVAL_MS)
+
+static struct {
+	int cnt;
+	size_t count;
+	struct bt_scan_changed_device device[CONFIG_BT_SCAN_CHANGED_DEVICES_MAX];
+} changed;
+
+static void devices_changed(const struct bt_scan_changed_device *devices, size_t count)
+{
+	zassert_true(count <= ARRAY_SIZE(changed.device), "Too many changed devices");
+
+	changed.cnt++;
+	changed.count = count;
+	memcpy(changed.device, devices, count * sizeof(devices[0]));
+}
+
+static struct bt_scan_changed_devices_cb changed_cb = {
+	.changed = devices_changed,
+};
+
+/* Check if the report is delivered to the scanning callbacks. */
+static bool delivered(uint8_t addr_id, const char *name)
+{
+	name_recv(addr_id, BT_DATA_NAME_COMPLETE, name);
+
+	return (result.match_cnt + result.no_match_cnt) > 0;
+}
+
+static void *setup(void)
+{
+	scan_test_cb_register();
+	bt_scan_changed_devices_cb_register(&changed_cb);
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	bt_scan_init(NULL);
+
+	/* Deliver the changes of the previous test. */
+	k_sleep(DELIVERY_WAIT);
+	memset(&changed, 0, sizeof(changed));
+}
+
+ZTEST(bt_scan_dedup, test_duplicate)
+{
+	zassert_true(delivered(1, "Nordic_HRM"));
+	zassert_false(delivered(1, "Nordic_HRM"), "Duplicate report delivered");
+	zassert_true(delivered(2, "Nordic_HRM"), "Report of other device not delivered");
+	zassert_true(delivered(1, "Nordic_HIDS"), "Changed report not delivered");
+
+	/* The advertising data and the scan response data are tracked separately. */
+	zassert_false(delivered(1, "Nordic_HRM"));
+	zassert_false(delivered(1, "Nordic_HIDS"));
+}
+
+ZTEST(bt_scan_dedup, test_window)
+{
+	zassert_true(delivered(1, "Nordic_HRM"));
+
+	k_sleep(K_MSEC(CONFIG_BT_SCAN_DEDUP_WINDOW_MS / 2));
+	zassert_false(delivered(1, "Nordic_HRM"), "Duplicate report delivered");
+
+	k_sleep(K_MSEC(CONFIG_BT_SCAN_DEDUP_WINDOW_MS / 2));
+	zassert_true(delivered(1, "Nordic_HRM"), "Report not delivered after the window");
+	zassert_false(delivered(1, "Nordic_HRM"), "Duplicate report delivered");
+}
+
+ZTEST(bt_scan_dedup, test_lru)
+{
+	for (uint8_t i = 0; i < CONFIG_BT_SCAN_DEDUP_LEN; i++) {
+		zassert_true(delivered(i, "Nordic_HRM"));
+	}
+
+	/* Device 0 is reported again, so device 1 is the least recently reported. */
+	zassert_false(delivered(0, "Nordic_HRM"));
+	zassert_true(delivered(CONFIG_BT_SCAN_DEDUP_LEN, "Nordic_HRM"));
+
+	zassert_false(delivered(0, "Nordic_HRM"), "Recently reported device replaced");
+	zassert_true(delivered(1, "Nordic_HRM"), "Least recently reported device not replaced");
+}
+
+ZTEST(bt_scan_dedup, test_clear)
+{
+	const char *name = "Nordic_HRM";
+
+	zassert_true(delivered(1, name));
+	zassert_false(delivered(1, name));
+
+	bt_scan_dedup_clear();
+	zassert_true(delivered(1, name), "Report not delivered after clear");
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, name));
+	zassert_true(delivered(1, name), "Report not delivered after the filters changed");
+}
+
+ZTEST(bt_scan_dedup, test_changed_devices)
+{
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Nordic_HRM"));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_NAME_FILTER, false));
+
+	name_recv(1, BT_DATA_NAME_COMPLETE, "Nordic_HIDS");
+	name_recv(2, BT_DATA_NAME_COMPLETE, "Nordic_LBS");
+	name_recv(2, BT_DATA_NAME_COMPLETE, "Nordic_LBS");
+	name_recv(1, BT_DATA_NAME_COMPLETE, "Nordic_HRM");
+
+	zassert_equal(changed.cnt, 0, "Changed devices delivered before the interval");
+
+	k_sleep(DELIVERY_WAIT);
+
+	zassert_equal(changed.cnt, 1, "Changed devices not delivered");
+	zassert_equal(changed.count, 2, "Unexpected number of changed devices");
+	zassert_equal(changed.device[0].addr.a.val[0], 1);
+	zassert_equal(changed.device[0].rssi, -41);
+	zassert_true(changed.device[0].filter_match, "Last report of the device not reported");
+	zassert_equal(changed.device[1].addr.a.val[0], 2);
+	zassert_false(changed.device[1].filter_match);
+
+	/* Duplicates and repeated reports after the window are not changes. */
+	name_recv(1, BT_DATA_NAME_COMPLETE, "Nordic_HRM");
+	k_sleep(K_MSEC(CONFIG_BT_SCAN_DEDUP_WINDOW_MS));
+	zassert_true(delivered(1, "Nordic_HRM"));
+	k_sleep(DELIVERY_WAIT);
+
+	zassert_equal(changed.cnt, 1, "Unexpected changed devices delivery");
+}
+
+ZTEST(bt_scan_dedup, test_changed_devices_full)
+{
+	for (uint8_t i = 0; i <= CONFIG_BT_SCAN_CHANGED_DEVICES_MAX; i++) {
+		name_recv(i, BT_DATA_NAME_COMPLETE, "Nordic_HRM");
+	}
+
+	k_sleep(DELIVERY_WAIT);
+
+	zassert_equal(changed.cnt, 1, "Changed devices not delivered");
+	zassert_equal(changed.count, CONFIG_BT_SCAN_CHANGED_DEVICES_MAX);
+
+	/* The device that did not fit in the batch is not reported later. */
+	k_sleep(DELIVERY_WAIT);
+	zassert_equal(changed.cnt, 1, "Unexpected changed devices delivery");
+}
+
+ZTEST_SUITE(bt_scan_dedup, NULL, setup, before, NULL, NULL);
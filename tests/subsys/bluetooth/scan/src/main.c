@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/bluetooth/uuid.h>
+
+#include "scan_test_common.h"
+
+#define UUID_NUS_VAL BT_UUID_128_ENCODE(0x6e400001, 0xb5a3, 0xf393, 0xe0a9, 0xe50e24dcca9e)
+
+static void expect_match(void)
+{
+	zassert_equal(result.match_cnt, 1, "Filter match expected");
+	zassert_equal(result.no_match_cnt, 0, "Unexpected filter no match");
+}
+
+static void expect_no_match(void)
+{
+	zassert_equal(result.match_cnt, 0, "Unexpected filter match");
+	zassert_equal(result.no_match_cnt, 1, "Filter no match expected");
+}
+
+static uint32_t hits_get(enum bt_scan_filter_type type, uint8_t idx)
+{
+	uint32_t hits;
+
+	zassert_ok(bt_scan_filter_hits_get(type, idx, &hits), "Getting hits failed");
+
+	return hits;
+}
+
+static bool predicate(const void *global_state)
+{
+	ARG_UNUSED(global_state);
+
+	/* The filter tests pass the same reports repeatedly, which are dropped by the deduplication. */
+	return !IS_ENABLED(CONFIG_BT_SCAN_DEDUP);
+}
+
+static void *setup(void)
+{
+	scan_test_cb_register();
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	bt_scan_init(NULL);
+	bt_scan_blocklist_clear();
+}
+
+ZTEST(bt_scan_filter, test_name)
+{
+	static const char * const names[] = {
+		"Nordic_HRM", "Nordic_UART", "Nordic_LBS", "Thingy",
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(names); i++) {
+		zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, names[i]));
+	}
+
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_NAME_FILTER, false));
+
+	for (size_t i = 0; i < ARRAY_SIZE(names); i++) {
+		name_recv(1, BT_DATA_NAME_COMPLETE, names[i]);
+		expect_match();
+		zassert_true(result.status.name.match, "Name filter not matched");
+		zassert_str_equal(result.status.name.name, names[i], "Wrong name matched");
+	}
+
+	name_recv(1, BT_DATA_NAME_COMPLETE, "Nordic_Blinky");
+	expect_no_match();
+
+	name_recv(1, BT_DATA_NAME_COMPLETE, "Nordic_UART_2");
+	expect_no_match();
+
+	/* The name filter does not apply to short names. */
+	name_recv(1, BT_DATA_NAME_SHORTENED, "Thingy");
+	expect_no_match();
+}
+
+ZTEST(bt_scan_filter, test_short_name)
+{
+	const struct bt_scan_short_name short_names[] = {
+		{ .name = "Nordic_HRM", .min_len = 8 },
+		{ .name = "Nordic_HIDS", .min_len = 6 },
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(short_names); i++) {
+		zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_SHORT_NAME, &short_names[i]));
+	}
+
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_SHORT_NAME_FILTER, false));
+
+	name_recv(1, BT_DATA_NAME_SHORTENED, "Nordic_H");
+	expect_match();
+	zassert_str_equal(result.status.short_name.name, "Nordic_HRM", "Wrong name matched");
+
+	/* Too short for the first filter, long enough for the second one. */
+	name_recv(1, BT_DATA_NAME_SHORTENED, "Nordic");
+	expect_match();
+	zassert_str_equal(result.status.short_name.name, "Nordic_HIDS", "Wrong name matched");
+
+	name_recv(1, BT_DATA_NAME_SHORTENED, "Nordic_HI");
+	expect_match();
+	zassert_str_equal(result.status.short_name.name, "Nordic_HIDS", "Wrong name matched");
+
+	name_recv(1, BT_DATA_NAME_SHORTENED, "Nord");
+	expect_no_match();
+
+	name_recv(1, BT_DATA_NAME_SHORTENED, "Nordic_X");
+	expect_no_match();
+}
+
+ZTEST(bt_scan_filter, test_addr)
+{
+	bt_addr_le_t addr;
+
+	for (uint8_t i = 0; i < CONFIG_BT_SCAN_ADDRESS_CNT; i++) {
+		addr = addr_get(2 * i);
+		zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr));
+	}
+
+	addr = addr_get(1);
+	zassert_equal(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr), -ENOMEM,
+		      "Address filter overflow");
+
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_ADDR_FILTER, false));
+
+	for (uint8_t i = 0; i < 2 * CONFIG_BT_SCAN_ADDRESS_CNT; i++) {
+		adv_recv(i, NULL, 0);
+
+		if (i % 2) {
+			expect_no_match();
+			continue;
+		}
+
+		expect_match();
+		addr = addr_get(i);
+		zassert_true(bt_addr_le_eq(result.status.addr.addr, &addr), "Wrong address");
+	}
+}
+
+ZTEST(bt_scan_filter, test_uuid)
+{
+	const struct bt_data ad_16[] = {
+		BT_DATA_BYTES(BT_DATA_UUID16_ALL, BT_UUID_16_ENCODE(BT_UUID_BAS_VAL),
+			      BT_UUID_16_ENCODE(BT_UUID_HRS_VAL)),
+	};
+	/* The 16-bit UUID advertised in its 128-bit form. */
+	const struct bt_data ad_128[] = {
+		BT_DATA_BYTES(BT_DATA_UUID128_SOME,
+			      BT_UUID_128_ENCODE(BT_UUID_HRS_VAL, 0x0000, 0x1000, 0x8000,
+						 0x00805f9b34fb)),
+	};
+	const struct bt_data ad_nus[] = {
+		BT_DATA_BYTES(BT_DATA_UUID128_ALL, UUID_NUS_VAL),
+	};
+	const struct bt_data ad_other[] = {
+		BT_DATA_BYTES(BT_DATA_UUID16_ALL, BT_UUID_16_ENCODE(BT_UUID_DIS_VAL)),
+	};
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, BT_UUID_HRS));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID,
+				      BT_UUID_DECLARE_128(UUID_NUS_VAL)));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_UUID_FILTER, false));
+
+	adv_recv(1, ad_16, ARRAY_SIZE(ad_16));
+	expect_match();
+	zassert_equal(result.status.uuid.count, 1, "Wrong UUID count");
+	zassert_ok(bt_uuid_cmp(result.status.uuid.uuid[0], BT_UUID_HRS), "Wrong UUID");
+
+	adv_recv(1, ad_128, ARRAY_SIZE(ad_128));
+	expect_match();
+	zassert_ok(bt_uuid_cmp(result.status.uuid.uuid[0], BT_UUID_HRS), "Wrong UUID");
+
+	adv_recv(1, ad_nus, ARRAY_SIZE(ad_nus));
+	expect_match();
+	zassert_ok(bt_uuid_cmp(result.status.uuid.uuid[0], BT_UUID_DECLARE_128(UUID_NUS_VAL)),
+		   "Wrong UUID");
+
+	adv_recv(1, ad_other, ARRAY_SIZE(ad_other));
+	expect_no_match();
+}
+
+ZTEST(bt_scan_filter, test_uuid_all_mode)
+{
+	const struct bt_data ad_all[] = {
+		BT_DATA_BYTES(BT_DATA_UUID16_ALL, BT_UUID_16_ENCODE(BT_UUID_HRS_VAL),
+			      BT_UUID_16_ENCODE(BT_UUID_DIS_VAL),
+			      BT_UUID_16_ENCODE(BT_UUID_BAS_VAL)),
+	};
+	const struct bt_data ad_some[] = {
+		BT_DATA_BYTES(BT_DATA_UUID16_ALL, BT_UUID_16_ENCODE(BT_UUID_HRS_VAL),
+			      BT_UUID_16_ENCODE(BT_UUID_DIS_VAL)),
+	};
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, BT_UUID_BAS));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, BT_UUID_HRS));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_UUID_FILTER, true));
+
+	adv_recv(1, ad_all, ARRAY_SIZE(ad_all));
+	expect_match();
+	zassert_equal(result.status.uuid.count, 2, "Wrong UUID count");
+	zassert_ok(bt_uuid_cmp(result.status.uuid.uuid[0], BT_UUID_BAS), "Wrong UUID");
+	zassert_ok(bt_uuid_cmp(result.status.uuid.uuid[1], BT_UUID_HRS), "Wrong UUID");
+
+	adv_recv(1, ad_some, ARRAY_SIZE(ad_some));
+	expect_no_match();
+}
+
+ZTEST(bt_scan_filter, test_all_mode_addr)
+{
+	bt_addr_le_t addr = addr_get(1);
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Nordic_HRM"));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_ADDR_FILTER | BT_SCAN_NAME_FILTER, true));
+
+	name_recv(1, BT_DATA_NAME_COMPLETE, "Nordic_HRM");
+	expect_match();
+	zassert_true(result.status.addr.match, "Address filter not matched");
+	zassert_true(result.status.name.match, "Name filter not matched");
+
+	name_recv(1, BT_DATA_NAME_COMPLETE, "Nordic_UART");
+	expect_no_match();
+
+	/* The name of a device that does not match the address is not checked. */
+	name_recv(2, BT_DATA_NAME_COMPLETE, "Nordic_HRM");
+	expect_no_match();
+
+	zassert_equal(hits_get(BT_SCAN_FILTER_TYPE_ADDR, 0), 2, "Wrong address hits");
+	zassert_equal(hits_get(BT_SCAN_FILTER_TYPE_NAME, 0), 1, "Wrong name hits");
+}
+
+ZTEST(bt_scan_filter, test_blocklist)
+{
+	bt_addr_le_t addr;
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Nordic_HRM"));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_NAME_FILTER, false));
+
+	for (uint8_t i = 0; i < CONFIG_BT_SCAN_BLOCKLIST_LEN; i++) {
+		addr = addr_get(i);
+		zassert_ok(bt_scan_blocklist_device_add(&addr));
+		zassert_ok(bt_scan_blocklist_device_add(&addr), "Adding duplicate failed");
+	}
+
+	addr = addr_get(CONFIG_BT_SCAN_BLOCKLIST_LEN);
+	zassert_equal(bt_scan_blocklist_device_add(&addr), -ENOMEM, "Blocklist overflow");
+
+	for (uint8_t i = 0; i <= CONFIG_BT_SCAN_BLOCKLIST_LEN; i++) {
+		name_recv(i, BT_DATA_NAME_COMPLETE, "Nordic_HRM");
+
+		if (i < CONFIG_BT_SCAN_BLOCKLIST_LEN) {
+			zassert_equal(result.match_cnt + result.no_match_cnt, 0,
+				      "Event for a blocked device");
+		} else {
+			expect_match();
+		}
+	}
+
+	bt_scan_blocklist_clear();
+
+	name_recv(0, BT_DATA_NAME_COMPLETE, "Nordic_HRM");
+	expect_match();
+}
+
+ZTEST(bt_scan_filter, test_hits)
+{
+	const uint16_t appearance = BT_APPEARANCE_GENERIC_HEART_RATE;
+	const struct bt_data ad[] = {
+		BT_DATA_BYTES(BT_DATA_GAP_APPEARANCE, BT_BYTES_LIST_LE16(appearance)),
+		BT_DATA_BYTES(BT_DATA_MANUFACTURER_DATA, 0x59, 0x00, 0x01),
+	};
+	const uint8_t manufacturer_data[] = {0x59, 0x00};
+	const struct bt_scan_manufacturer_data md = {
+		.data = (uint8_t *)manufacturer_data,
+		.data_len = sizeof(manufacturer_data),
+	};
+	uint32_t hits;
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Nordic_HRM"));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Nordic_UART"));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_APPEARANCE, &appearance));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_MANUFACTURER_DATA, &md));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_NAME_FILTER | BT_SCAN_APPEARANCE_FILTER |
+					 BT_SCAN_MANUFACTURER_DATA_FILTER, false));
+
+	for (int i = 0; i < 3; i++) {
+		name_recv(1, BT_DATA_NAME_COMPLETE, "Nordic_UART");
+	}
+
+	adv_recv(1, ad, ARRAY_SIZE(ad));
+	expect_match();
+
+	zassert_equal(hits_get(BT_SCAN_FILTER_TYPE_NAME, 0), 0, "Wrong name hits");
+	zassert_equal(hits_get(BT_SCAN_FILTER_TYPE_NAME, 1), 3, "Wrong name hits");
+	zassert_equal(hits_get(BT_SCAN_FILTER_TYPE_APPEARANCE, 0), 1, "Wrong appearance hits");
+	zassert_equal(hits_get(BT_SCAN_FILTER_TYPE_MANUFACTURER_DATA, 0), 1,
+		      "Wrong manufacturer data hits");
+
+	zassert_equal(bt_scan_filter_hits_get(BT_SCAN_FILTER_TYPE_NAME, 2, &hits), -EINVAL,
+		      "Hits of a missing filter");
+	zassert_equal(bt_scan_filter_hits_get(BT_SCAN_FILTER_TYPE_UUID, 0, &hits), -EINVAL,
+		      "Hits of a missing filter");
+
+	bt_scan_filter_hits_reset();
+	zassert_equal(hits_get(BT_SCAN_FILTER_TYPE_NAME, 1), 0, "Hits not reset");
+}
+
+ZTEST(bt_scan_filter, test_remove_all)
+{
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Nordic_HRM"));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, BT_UUID_HRS));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_NAME_FILTER | BT_SCAN_UUID_FILTER, false));
+
+	name_recv(1, BT_DATA_NAME_COMPLETE, "Nordic_HRM");
+	expect_match();
+
+	bt_scan_filter_remove_all();
+
+	name_recv(1, BT_DATA_NAME_COMPLETE, "Nordic_HRM");
+	expect_no_match();
+
+	/* A shorter name replaces the removed one. */
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Nordic"));
+
+	name_recv(1, BT_DATA_NAME_COMPLETE, "Nordic_HRM");
+	expect_no_match();
+
+	name_recv(1, BT_DATA_NAME_COMPLETE, "Nordic");
+	expect_match();
+}
+
+ZTEST_SUITE(bt_scan_filter, predicate, setup, before, NULL, NULL);
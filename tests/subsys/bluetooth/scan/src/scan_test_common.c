@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+
+#include "scan_test_common.h"
+
+struct scan_test_result result;
+
+static struct bt_le_scan_cb *scan_cb;
+
+int __wrap_bt_le_scan_cb_register(struct bt_le_scan_cb *cb)
+{
+	scan_cb = cb;
+
+	return 0;
+}
+
+static void filter_match(struct bt_scan_device_info *device_info,
+			 struct bt_scan_filter_match *filter_match, bool connectable)
+{
+	result.match_cnt++;
+	result.status = *filter_match;
+}
+
+static void filter_no_match(struct bt_scan_device_info *device_info, bool connectable)
+{
+	result.no_match_cnt++;
+}
+
+BT_SCAN_CB_INIT(scan_cb_data, filter_match, filter_no_match, NULL, NULL);
+
+void scan_test_cb_register(void)
+{
+	static bool registered;
+
+	if (!registered) {
+		bt_scan_cb_register(&scan_cb_data);
+		registered = true;
+	}
+}
+
+bt_addr_le_t addr_get(uint8_t id)
+{
+	bt_addr_le_t addr = {
+		.type = BT_ADDR_LE_RANDOM,
+		.a.val = {id, 0x11, 0x22, 0x33, 0x44, 0xc5},
+	};
+
+	return addr;
+}
+
+void adv_recv(uint8_t addr_id, const struct bt_data *ad, size_t ad_len)
+{
+	NET_BUF_SIMPLE_DEFINE(buf, 31);
+	bt_addr_le_t addr = addr_get(addr_id);
+	struct bt_le_scan_recv_info info = {
+		.addr = &addr,
+		.rssi = -40 - addr_id,
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+	};
+
+	for (size_t i = 0; i < ad_len; i++) {
+		net_buf_simple_add_u8(&buf, ad[i].data_len + 1);
+		net_buf_simple_add_u8(&buf, ad[i].type);
+		net_buf_simple_add_mem(&buf, ad[i].data, ad[i].data_len);
+	}
+
+	memset(&result, 0, sizeof(result));
+
+	zassert_not_null(scan_cb, "Scanning callback not registered");
+	scan_cb->recv(&info, &buf);
+}
+
+void name_recv(uint8_t addr_id, uint8_t type, const char *name)
+{
+	const struct bt_data ad = BT_DATA(type, name, strlen(name));
+
+	adv_recv(addr_id, &ad, 1);
+}
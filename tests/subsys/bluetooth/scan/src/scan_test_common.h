@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SCAN_TEST_COMMON_H_
+#define _SCAN_TEST_COMMON_H_
+
+#include <zephyr/bluetooth/bluetooth.h>
+#include <bluetooth/scan.h>
+
+/* Scanning callbacks called for the last advertising report. */
+struct scan_test_result {
+	int match_cnt;
+	int no_match_cnt;
+	struct bt_scan_filter_match status;
+};
+
+extern struct scan_test_result result;
+
+/* Register the scanning callbacks of the test, only the first call has an effect. */
+void scan_test_cb_register(void);
+
+bt_addr_le_t addr_get(uint8_t id);
+
+/* Pass an advertising report with the given data to the library. */
+void adv_recv(uint8_t addr_id, const struct bt_data *ad, size_t ad_len);
+
+void name_recv(uint8_t addr_id, uint8_t type, const char *name);
+
+#endif /* _SCAN_TEST_COMMON_H_ */
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/drivers/flash/flash_simulator.h>
+#include <zephyr/storage/flash_map.h>
+#include <emds/emds.h>
+#include <emds_flash.h>
+
+#define D_ENTRIES_NUM 3
+#define S_DATA_LEN    256
+#define D_DATA_LEN    32
+
+static uint8_t s_data[S_DATA_LEN];
+static uint8_t d_data[D_ENTRIES_NUM][D_DATA_LEN];
+static uint8_t expect_s_data[S_DATA_LEN];
+static uint8_t expect_d_data[D_ENTRIES_NUM][D_DATA_LEN];
+
+EMDS_STATIC_ENTRY_DEFINE(s_entry, 0x100, s_data, sizeof(s_data));
+
+static struct emds_dynamic_entry d_entries[D_ENTRIES_NUM] = {
+	{{0x1001, &d_data[0][0], D_DATA_LEN}},
+	{{0x1002, &d_data[1][0], D_DATA_LEN}},
+	{{0x1003, &d_data[2][0], D_DATA_LEN}},
+};
+
+static void s_data_set(uint8_t value)
+{
+	memset(s_data, value, sizeof(s_data));
+	emds_entry_dirty_set(&emds_s_entry);
+}
+
+static void d_data_set(int idx, uint8_t value)
+{
+	memset(d_data[idx], value, sizeof(d_data[idx]));
+	emds_entry_dirty_set(&d_entries[idx].entry);
+}
+
+static uint32_t store_time_get(void)
+{
+	uint32_t store_time_us;
+
+	zassert_ok(emds_store_time_get(&store_time_us), "Getting store time failed");
+
+	return store_time_us;
+}
+
+static void load_prepare(void)
+{
+	memset(s_data, 0, sizeof(s_data));
+	memset(d_data, 0, sizeof(d_data));
+
+	zassert_ok(emds_load(), "Load failed");
+	zassert_mem_equal(s_data, expect_s_data, sizeof(s_data), "Static data has changed");
+	zassert_mem_equal(d_data, expect_d_data, sizeof(d_data), "Dynamic data has changed");
+
+	zassert_ok(emds_prepare(), "Prepare failed");
+}
+
+static void store(void)
+{
+	memcpy(expect_s_data, s_data, sizeof(s_data));
+	memcpy(expect_d_data, d_data, sizeof(d_data));
+
+	zassert_ok(emds_store(), "Store failed");
+}
+
+static void *setup(void)
+{
+	zassert_ok(emds_init(NULL), "Initializing failed");
+
+	for (int i = 0; i < D_ENTRIES_NUM; i++) {
+		zassert_ok(emds_entry_add(&d_entries[i]), "Add entry failed");
+	}
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	(void)fixture;
+
+	zassert_ok(emds_clear(), "Clear failed");
+	zassert_equal(emds_load(), -ENOENT, "Flash is not empty");
+	zassert_ok(emds_prepare(), "Prepare failed");
+
+	/* The first snapshot stores all entries */
+	s_data_set(0xaa);
+	for (int i = 0; i < D_ENTRIES_NUM; i++) {
+		d_data_set(i, 0x10 + i);
+	}
+
+	store();
+}
+
+ZTEST(emds_incremental, test_store_time_dirty_entries)
+{
+	uint32_t full_time;
+	uint32_t time;
+
+	zassert_ok(emds_load(), "Load failed");
+
+	/* Before the snapshot is allocated, the estimate covers all entries */
+	full_time = store_time_get();
+
+	zassert_ok(emds_prepare(), "Prepare failed");
+
+	time = store_time_get();
+	zassert_true(time < full_time, "Clean entries must take less time: %u, %u", time,
+		     full_time);
+
+	d_data_set(0, 0x20);
+	zassert_true(store_time_get() > time, "Dirty entry must take more time");
+
+	s_data_set(0xbb);
+	for (int i = 1; i < D_ENTRIES_NUM; i++) {
+		d_data_set(i, 0x20 + i);
+	}
+
+	zassert_equal(store_time_get(), full_time, "All dirty entries must take full time");
+}
+
+ZTEST(emds_incremental, test_clean_entries_restored)
+{
+	load_prepare();
+	d_data_set(1, 0x21);
+	store();
+
+	load_prepare();
+	s_data_set(0xbb);
+	store();
+
+	/* Nothing modified */
+	load_prepare();
+	store();
+
+	load_prepare();
+}
+
+ZTEST(emds_incremental, test_unmarked_entries_not_stored)
+{
+	load_prepare();
+
+	memset(s_data, 0xcc, sizeof(s_data));
+	d_data_set(2, 0x22);
+
+	zassert_ok(emds_store(), "Store failed");
+
+	memcpy(expect_d_data[2], d_data[2], sizeof(d_data[2]));
+	load_prepare();
+}
+
+ZTEST(emds_incremental, test_partition_switch)
+{
+	/* Fill both partitions several times, so that the snapshots that follow a partition
+	 * switch are stored in full and the references never point to an erased partition.
+	 */
+	for (int i = 0; i < 64; i++) {
+		load_prepare();
+		d_data_set(i % D_ENTRIES_NUM, i);
+		if (i % 8 == 0) {
+			s_data_set(i);
+		}
+		store();
+	}
+
+	load_prepare();
+}
+
+ZTEST(emds_incremental, test_corrupted_reference)
+{
+	const struct device *dev = FIXED_PARTITION_DEVICE(emds_partition_0);
+	uint8_t *flash_mem;
+	size_t flash_size;
+
+	load_prepare();
+	d_data_set(0, 0x20);
+	store();
+
+	/* The static entry of the second snapshot references the data of the first snapshot,
+	 * which is stored right after the first entry header in the partition.
+	 */
+	flash_mem = flash_simulator_get_memory(dev, &flash_size);
+	zassert_not_null(flash_mem, "No flash simulator memory");
+	flash_mem[FIXED_PARTITION_OFFSET(emds_partition_0) + sizeof(struct emds_data_entry)] ^=
+		0xff;
+
+	/* The entry with the corrupted data is not overwritten, the other entries are loaded. */
+	memset(s_data, 0x55, sizeof(s_data));
+	memset(d_data, 0, sizeof(d_data));
+
+	zassert_ok(emds_load(), "Load failed");
+	zassert_mem_equal(d_data, expect_d_data, sizeof(d_data), "Dynamic data has changed");
+
+	for (int i = 0; i < S_DATA_LEN; i++) {
+		zassert_equal(s_data[i], 0x55, "Corrupted data loaded");
+	}
+
+	/* The entry is stored in full by the next snapshot, even though it is not modified. */
+	zassert_ok(emds_prepare(), "Prepare failed");
+	store();
+
+	load_prepare();
+}
+
+ZTEST_SUITE(emds_incremental, NULL, setup, before, NULL, NULL);
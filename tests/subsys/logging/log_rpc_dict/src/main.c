@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <log_rpc_dict.h>
+
+#include <nrf_rpc/nrf_rpc_serialize.h>
+#include <nrf_rpc_cbor.h>
+#include <zcbor_decode.h>
+#include <zcbor_encode.h>
+
+#include <zephyr/sys/cbprintf.h>
+#include <zephyr/ztest.h>
+
+#include <string.h>
+
+/* 1 hour, 2 minutes, 3 seconds, 4 milliseconds and 5 microseconds. */
+#define TIMESTAMP_US 3723004005ULL
+
+static uint8_t package[128] __aligned(CBPRINTF_PACKAGE_ALIGNMENT);
+static uint8_t package_copy[128] __aligned(CBPRINTF_PACKAGE_ALIGNMENT);
+static uint8_t batch[256];
+static char output[64];
+
+static size_t package_create(const char *str)
+{
+	int length = cbprintf_package(package, sizeof(package), CBPRINTF_PACKAGE_ADD_RO_STR_POS,
+				      "Value %d of %s", 5, str);
+
+	zassert_true(length > 0, "Creating package failed (%d)", length);
+
+	return length;
+}
+
+static void encode_start(struct nrf_rpc_cbor_ctx *ctx)
+{
+	zcbor_new_encode_state(ctx->zs, ARRAY_SIZE(ctx->zs), batch, sizeof(batch), 0);
+}
+
+/* The batch is ended with the null item, the same as an nRF RPC packet. */
+static size_t encode_end(struct nrf_rpc_cbor_ctx *ctx)
+{
+	nrf_rpc_encode_null(ctx);
+	zassert_false(zcbor_check_error(ctx->zs), "Encoding failed");
+
+	return ctx->zs[0].payload_mut - batch;
+}
+
+static void decode_start(struct nrf_rpc_cbor_ctx *ctx, size_t length)
+{
+	zcbor_new_decode_state(ctx->zs, ARRAY_SIZE(ctx->zs), batch, length, ZCBOR_MAX_ELEM_COUNT,
+			       NULL, 0);
+}
+
+static const char *record_format(const struct log_rpc_dict_record *record,
+				 const char *source_name)
+{
+	size_t length;
+
+	zassert_true(record->package_size <= sizeof(package_copy));
+	memcpy(package_copy, record->package, record->package_size);
+
+	length = log_rpc_dict_record_format(output, sizeof(output) - 1, record, source_name,
+					    package_copy);
+	output[length] = '\0';
+
+	return output;
+}
+
+ZTEST(log_rpc_dict, test_round_trip)
+{
+	static const uint8_t data[] = {0xde, 0xad, 0xbe, 0xef};
+	char str[] = "str";
+	struct nrf_rpc_cbor_ctx ctx;
+	struct log_rpc_dict_record records[] = {
+		{
+			.level = LOG_RPC_LEVEL_INF,
+			.source_id = 7,
+			.timestamp_us = TIMESTAMP_US,
+		},
+		{
+			.level = LOG_RPC_LEVEL_DBG,
+			.source_id = -1,
+			.timestamp_us = 0,
+			.data = data,
+			.data_size = sizeof(data),
+		},
+	};
+	struct log_rpc_dict_record record;
+	size_t size = 1;
+	size_t length;
+
+	encode_start(&ctx);
+
+	for (size_t i = 0; i < ARRAY_SIZE(records); i++) {
+		records[i].package = package;
+		records[i].package_size = package_create(str);
+		size += log_rpc_dict_record_size(&records[i]);
+
+		log_rpc_dict_record_encode(&ctx, &records[i]);
+	}
+
+	length = encode_end(&ctx);
+	zassert_true(length <= size, "Record size %zu exceeded (%zu)", size, length);
+
+	/* The strings are appended to the encoded packages. */
+	strcpy(str, "new");
+	memset(package, 0, sizeof(package));
+
+	decode_start(&ctx, length);
+
+	zassert_true(log_rpc_dict_record_decode(&ctx, &record));
+	zassert_equal(record.level, LOG_RPC_LEVEL_INF);
+	zassert_equal(record.source_id, 7);
+	zassert_equal(record.timestamp_us, TIMESTAMP_US);
+	zassert_is_null(record.data);
+	zassert_equal(record.data_size, 0);
+	zassert_str_equal(record_format(&record, "src"), "[01:02:03.004,005] src: Value 5 of str");
+
+	zassert_true(log_rpc_dict_record_decode(&ctx, &record));
+	zassert_equal(record.level, LOG_RPC_LEVEL_DBG);
+	zassert_equal(record.source_id, -1);
+	zassert_equal(record.timestamp_us, 0);
+	zassert_equal(record.data_size, sizeof(data));
+	zassert_mem_equal(record.data, data, sizeof(data));
+	zassert_str_equal(record_format(&record, NULL), "[00:00:00.000,000] Value 5 of str");
+
+	/* The batch ends with the null item. */
+	zassert_false(log_rpc_dict_record_decode(&ctx, &record));
+	zassert_true(nrf_rpc_decode_valid(&ctx));
+}
+
+ZTEST(log_rpc_dict, test_format_truncated)
+{
+	struct log_rpc_dict_record record = {
+		.level = LOG_RPC_LEVEL_ERR,
+		.source_id = 1,
+		.timestamp_us = TIMESTAMP_US,
+		.package = package,
+		.package_size = package_create("str"),
+	};
+	size_t length;
+
+	length = log_rpc_dict_record_format(output, 26, &record, "src", package);
+
+	zassert_equal(length, 26);
+	zassert_mem_equal(output, "[01:02:03.004,005] src: Va", 26);
+}
+
+ZTEST(log_rpc_dict, test_malformed)
+{
+	struct log_rpc_dict_record record = {
+		.level = LOG_RPC_LEVEL_WRN,
+		.source_id = 3,
+		.timestamp_us = TIMESTAMP_US,
+		.package = package,
+		.package_size = package_create("str"),
+	};
+	struct nrf_rpc_cbor_ctx ctx;
+	size_t length;
+
+	encode_start(&ctx);
+	log_rpc_dict_record_encode(&ctx, &record);
+	length = encode_end(&ctx);
+
+	/* The record is cut in the middle of the package. */
+	decode_start(&ctx, length / 2);
+
+	zassert_false(log_rpc_dict_record_decode(&ctx, &record));
+	zassert_false(nrf_rpc_decode_valid(&ctx));
+}
+
+ZTEST_SUITE(log_rpc_dict, NULL, NULL, NULL, NULL, NULL);
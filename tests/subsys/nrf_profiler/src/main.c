@@ -5,7 +5,13 @@
  */
 
 #include <zephyr/ztest.h>
+#include <zephyr/sys/byteorder.h>
 #include <nrf_profiler.h>
+#include <string.h>
+
+#ifdef CONFIG_NRF_PROFILER_NORDIC_TRANSPORT_FILE
+#include <profiler_nordic_file_bottom.h>
+#endif
 
 #define PROFILED_EVENTS_NB 100
 #define U_VALUE_START 0
@@ -86,8 +92,140 @@ static uint32_t test_performance_core(void (*profiler_func)(struct log_event_buf
 	return elapsed_time_us;
 }
 
+#ifdef CONFIG_NRF_PROFILER_NORDIC_TRANSPORT_FILE
+/* Commands of the Nordic nrf_profiler backend. */
+#define COMMAND_SET_MASK 4
+#define COMMAND_INVALID 0x7f
+
+/* Events that do not fit in the data buffer, as every event takes at least two bytes. */
+#define FLOOD_EVENTS_NB CONFIG_NRF_PROFILER_NORDIC_DATA_BUFFER_SIZE
+#define DROPPED_EVENTS_DESCR "_nrf_profiler_dropped_events_,"
+
+/* Time after which the commands are handled and the data buffer is written to the file. */
+#define POLL_WAIT K_MSEC(2 * CONFIG_NRF_PROFILER_NORDIC_COMMAND_POLL_PERIOD)
+
+static int cmd_fd = -1;
+static uint8_t stream[3 * CONFIG_NRF_PROFILER_NORDIC_DATA_BUFFER_SIZE];
+
+struct stream_reader {
+	const uint8_t *pos;
+	const uint8_t *end;
+};
+
+static void command_send(const uint8_t *cmd, size_t len)
+{
+	zassert_equal(nrf_profiler_file_bottom_write(cmd_fd, cmd, len), (long)len,
+		      "Writing command failed");
+	k_sleep(POLL_WAIT);
+}
+
+static void event_mask_send(uint16_t disabled_event_id)
+{
+	uint8_t cmd[2 + DIV_ROUND_UP(NRF_PROFILER_MAX_NUMBER_OF_APPLICATION_AND_INTERNAL_EVENTS, 8)];
+	uint8_t mask_len = DIV_ROUND_UP(nrf_profiler_num_events, 8);
+
+	cmd[0] = COMMAND_SET_MASK;
+	cmd[1] = mask_len;
+	memset(&cmd[2], 0xff, mask_len);
+	if (disabled_event_id < nrf_profiler_num_events) {
+		cmd[2 + disabled_event_id / 8] &= ~BIT(disabled_event_id % 8);
+	}
+
+	command_send(cmd, 2 + mask_len);
+}
+
+static uint16_t dropped_events_event_id_get(void)
+{
+	for (uint16_t i = 0; i < nrf_profiler_num_events; i++) {
+		if (!strncmp(nrf_profiler_get_event_descr(i), DROPPED_EVENTS_DESCR,
+			     strlen(DROPPED_EVENTS_DESCR))) {
+			return i;
+		}
+	}
+
+	zassert_unreachable("No dropped events event type");
+
+	return 0;
+}
+
+static const uint8_t *stream_pull(struct stream_reader *reader, size_t len)
+{
+	const uint8_t *data = reader->pos;
+
+	zassert_true((size_t)(reader->end - reader->pos) >= len, "Truncated event");
+	reader->pos += len;
+
+	return data;
+}
+
+static uint32_t stream_pull_timestamp(struct stream_reader *reader)
+{
+	uint32_t value = 0;
+	uint8_t byte;
+
+	if (!IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_TIMESTAMP_DELTA)) {
+		return sys_get_le32(stream_pull(reader, sizeof(uint32_t)));
+	}
+
+	/* Zigzag encoded difference from the previous timestamp, as a varint. */
+	for (size_t shift = 0; ; shift += 7) {
+		zassert_true(shift < 32, "Varint too long");
+		byte = *stream_pull(reader, sizeof(byte));
+		value |= (uint32_t)(byte & 0x7f) << shift;
+		if (!(byte & 0x80)) {
+			break;
+		}
+	}
+
+	return (value >> 1) ^ -(value & 1);
+}
+
+static size_t stream_read(void)
+{
+	int fd = nrf_profiler_file_bottom_open(CONFIG_NRF_PROFILER_NORDIC_FILE_PATH, 0);
+	size_t len = 0;
+	long ret;
+
+	zassert_true(fd >= 0, "Cannot open data file");
+
+	do {
+		zassert_true(len < sizeof(stream), "Data file too big");
+		ret = nrf_profiler_file_bottom_read(fd, &stream[len], sizeof(stream) - len);
+		zassert_true(ret >= 0, "Reading data file failed");
+		len += ret;
+	} while (ret > 0);
+
+	nrf_profiler_file_bottom_close(fd);
+
+	return len;
+}
+
+static void big_event_check(struct stream_reader *reader, uint32_t cnt)
+{
+	const uint8_t *string_len;
+
+	zassert_equal(sys_get_le32(stream_pull(reader, 4)), U_VALUE_START + cnt);
+	zassert_equal((int32_t)sys_get_le32(stream_pull(reader, 4)), S_VALUE_START + cnt);
+	zassert_equal(sys_get_le16(stream_pull(reader, 2)), (uint16_t)(U_VALUE_START + cnt));
+	zassert_equal((int16_t)sys_get_le16(stream_pull(reader, 2)),
+		      (int16_t)(S_VALUE_START + cnt));
+	zassert_equal(*stream_pull(reader, 1), (uint8_t)(U_VALUE_START + cnt));
+	zassert_equal((int8_t)*stream_pull(reader, 1), (int8_t)(S_VALUE_START + cnt));
+
+	string_len = stream_pull(reader, 1);
+	zassert_equal(*string_len, strlen(EXAMPLE_STRING));
+	zassert_mem_equal(stream_pull(reader, *string_len), EXAMPLE_STRING, *string_len);
+}
+#endif /* CONFIG_NRF_PROFILER_NORDIC_TRANSPORT_FILE */
+
 static void *test_init(void)
 {
+#ifdef CONFIG_NRF_PROFILER_NORDIC_TRANSPORT_FILE
+	/* The command file is emptied before it is opened by the nrf_profiler. */
+	cmd_fd = nrf_profiler_file_bottom_open(CONFIG_NRF_PROFILER_NORDIC_FILE_CMD_PATH, 1);
+	zassert_true(cmd_fd >= 0, "Cannot open command file");
+#endif
+
 	zassert_ok(nrf_profiler_init(), "Error when initializing");
 	register_profiler_events();
 
@@ -120,4 +258,89 @@ ZTEST(suite_nrf_profiler, test_performance_03)
 	       "Elapsed time [us]: %d\n", PROFILED_EVENTS_NB, elapsed_time_us);
 }
 
+#ifdef CONFIG_NRF_PROFILER_NORDIC_TRANSPORT_FILE
+ZTEST(suite_nrf_profiler, test_stream_01_event_mask)
+{
+	static const uint8_t invalid_mask[] = {COMMAND_SET_MASK, UINT8_MAX};
+	static const uint8_t invalid_cmd[] = {COMMAND_INVALID, 0};
+
+	event_mask_send(data_event_id);
+	zassert_false(is_profiling_enabled(data_event_id), "Event type not disabled");
+	zassert_true(is_profiling_enabled(big_event_id), "Event type disabled");
+
+	/* Invalid commands are ignored. */
+	command_send(invalid_mask, sizeof(invalid_mask));
+	command_send(invalid_cmd, sizeof(invalid_cmd));
+	zassert_false(is_profiling_enabled(data_event_id), "Event type enabled");
+
+	event_mask_send(UINT16_MAX);
+	zassert_true(is_profiling_enabled(data_event_id), "Event type not enabled");
+}
+
+ZTEST(suite_nrf_profiler, test_stream_02_decode)
+{
+	uint16_t dropped_events_event_id = dropped_events_event_id_get();
+	struct stream_reader reader = {.pos = stream};
+	uint32_t no_data_cnt = 0;
+	uint32_t data_cnt = 0;
+	uint32_t big_cnt = 0;
+	uint32_t dropped_cnt = 0;
+	uint32_t timestamp = 0;
+	uint32_t prev_timestamp = 0;
+	uint32_t now;
+
+	/* Events that do not fit in the data buffer before it is written are dropped. */
+	k_sleep(POLL_WAIT);
+	(void)test_performance_core(NULL, no_data_event_id);
+	for (size_t i = 0; i < FLOOD_EVENTS_NB; i++) {
+		struct log_event_buf buf;
+
+		nrf_profiler_log_start(&buf);
+		nrf_profiler_log_send(&buf, no_data_event_id);
+	}
+
+	/* The number of dropped events is sent before the next event. */
+	k_sleep(POLL_WAIT);
+	(void)test_performance_core(NULL, no_data_event_id);
+	k_sleep(POLL_WAIT);
+	now = k_cycle_get_32();
+
+	reader.end = stream + stream_read();
+
+	while (reader.pos < reader.end) {
+		uint8_t id = *stream_pull(&reader, 1);
+
+		if (IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_TIMESTAMP_DELTA)) {
+			timestamp += stream_pull_timestamp(&reader);
+		} else {
+			timestamp = stream_pull_timestamp(&reader);
+		}
+
+		zassert_true(timestamp >= prev_timestamp, "Timestamps not in order");
+		zassert_true(timestamp <= now, "Timestamp in the future");
+		prev_timestamp = timestamp;
+
+		if (id == no_data_event_id) {
+			no_data_cnt++;
+		} else if (id == data_event_id) {
+			zassert_equal(sys_get_le32(stream_pull(&reader, 4)), data_cnt);
+			data_cnt++;
+		} else if (id == big_event_id) {
+			big_event_check(&reader, big_cnt);
+			big_cnt++;
+		} else if (id == dropped_events_event_id) {
+			dropped_cnt += sys_get_le32(stream_pull(&reader, 4));
+		} else {
+			zassert_unreachable("Unexpected event type %u", id);
+		}
+	}
+
+	zassert_equal(data_cnt, PROFILED_EVENTS_NB, "Data events lost");
+	zassert_equal(big_cnt, PROFILED_EVENTS_NB, "Big events lost");
+	zassert_true(dropped_cnt > 0, "No dropped events reported");
+	zassert_equal(no_data_cnt + dropped_cnt, 3 * PROFILED_EVENTS_NB + FLOOD_EVENTS_NB,
+		      "Dropped events not reported");
+}
+#endif /* CONFIG_NRF_PROFILER_NORDIC_TRANSPORT_FILE */
+
 ZTEST_SUITE(suite_nrf_profiler, NULL, test_init, NULL, NULL, NULL);
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+
+#include <nrf_rpc_os.h>
+
+#define POOL_SIZE CONFIG_NRF_RPC_THREAD_POOL_SIZE
+#define PKT_CNT	  16
+
+/* Packet header fields used by the test, the group ID is at the same offset as in nRF RPC. */
+#define PKT_ID_IDX    0
+#define PKT_BLOCK_IDX 1
+#define PKT_GROUP_IDX 4
+#define PKT_LEN	      5
+
+static uint8_t packets[PKT_CNT][PKT_LEN];
+static k_tid_t executed_by[PKT_CNT];
+
+static K_SEM_DEFINE(started_sem, 0, PKT_CNT);
+static K_SEM_DEFINE(done_sem, 0, PKT_CNT);
+static K_SEM_DEFINE(gate_sem, 0, PKT_CNT);
+
+static bool backpressure;
+static uint32_t backpressure_cnt;
+
+void nrf_rpc_os_thread_pool_backpressure_hook(bool active)
+{
+	backpressure = active;
+	backpressure_cnt++;
+}
+
+static void packet_handler(const uint8_t *data, size_t len)
+{
+	zassert_equal(len, PKT_LEN);
+
+	executed_by[data[PKT_ID_IDX]] = k_current_get();
+	k_sem_give(&started_sem);
+
+	if (data[PKT_BLOCK_IDX]) {
+		k_sem_take(&gate_sem, K_FOREVER);
+	}
+
+	k_sem_give(&done_sem);
+}
+
+static void send(uint8_t id, uint8_t group, bool block)
+{
+	packets[id][PKT_ID_IDX] = id;
+	packets[id][PKT_BLOCK_IDX] = block;
+	packets[id][PKT_GROUP_IDX] = group;
+
+	nrf_rpc_os_thread_pool_send(packets[id], PKT_LEN);
+}
+
+static void *thread_pool_setup(void)
+{
+	zassert_ok(nrf_rpc_os_init(packet_handler));
+
+	/* Let all pool threads start and become idle. */
+	k_sleep(K_MSEC(10));
+
+	return NULL;
+}
+
+static void thread_pool_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Let pool threads finish processing of packets from the previous test. */
+	k_sleep(K_MSEC(10));
+
+	k_sem_reset(&started_sem);
+	k_sem_reset(&done_sem);
+	memset(executed_by, 0, sizeof(executed_by));
+	backpressure_cnt = 0;
+	nrf_rpc_os_thread_pool_stats_reset();
+}
+
+ZTEST(nrf_rpc_thread_pool, test_group_affinity)
+{
+	struct nrf_rpc_os_thread_pool_stats stats;
+
+	for (uint8_t i = 0; i < 2 * POOL_SIZE; i++) {
+		send(i, i, false);
+		zassert_ok(k_sem_take(&done_sem, K_SECONDS(1)));
+	}
+
+	for (uint8_t i = 0; i < POOL_SIZE; i++) {
+		zassert_equal(executed_by[i], executed_by[i + POOL_SIZE],
+			      "Group %u executed by different threads", i);
+		zassert_not_equal(executed_by[i], executed_by[(i + 1) % POOL_SIZE],
+				  "Groups %u and %u executed by the same thread", i,
+				  (i + 1) % POOL_SIZE);
+	}
+
+	nrf_rpc_os_thread_pool_stats_get(&stats);
+	zassert_equal(stats.dispatched, 2 * POOL_SIZE);
+	zassert_equal(stats.stolen, 0);
+	zassert_equal(stats.blocked, 0);
+}
+
+ZTEST(nrf_rpc_thread_pool, test_work_stealing)
+{
+	struct nrf_rpc_os_thread_pool_stats stats;
+
+	/* Occupy the home thread of group 0. */
+	send(0, 0, true);
+	zassert_ok(k_sem_take(&started_sem, K_SECONDS(1)));
+
+	/* Packet of the same group must be stolen by an idle thread. */
+	send(1, 0, false);
+	zassert_ok(k_sem_take(&done_sem, K_SECONDS(1)));
+	zassert_not_equal(executed_by[0], executed_by[1]);
+
+	k_sem_give(&gate_sem);
+	zassert_ok(k_sem_take(&done_sem, K_SECONDS(1)));
+
+	nrf_rpc_os_thread_pool_stats_get(&stats);
+	zassert_equal(stats.dispatched, 2);
+	zassert_equal(stats.stolen, 1);
+	zassert_equal(stats.max_busy, 2);
+}
+
+ZTEST(nrf_rpc_thread_pool, test_backpressure)
+{
+	struct nrf_rpc_os_thread_pool_stats stats;
+	const uint8_t queued = CONFIG_NRF_RPC_THREAD_POOL_HIGH_WATERMARK;
+
+	/* Occupy all threads. */
+	for (uint8_t i = 0; i < POOL_SIZE; i++) {
+		send(i, i, true);
+		zassert_ok(k_sem_take(&started_sem, K_SECONDS(1)));
+	}
+
+	for (uint8_t i = 0; i < queued; i++) {
+		send(POOL_SIZE + i, 0, false);
+	}
+
+	nrf_rpc_os_thread_pool_stats_get(&stats);
+	zassert_equal(stats.queued, queued);
+	zassert_equal(stats.busy, POOL_SIZE);
+	zassert_equal(stats.blocked, 0);
+	zassert_equal(stats.backpressure, 1);
+	zassert_true(backpressure);
+	zassert_equal(backpressure_cnt, 1);
+
+	for (uint8_t i = 0; i < POOL_SIZE; i++) {
+		k_sem_give(&gate_sem);
+	}
+
+	for (uint8_t i = 0; i < POOL_SIZE + queued; i++) {
+		zassert_ok(k_sem_take(&done_sem, K_SECONDS(1)));
+	}
+
+	zassert_false(backpressure);
+	zassert_equal(backpressure_cnt, 2);
+
+	nrf_rpc_os_thread_pool_stats_get(&stats);
+	zassert_equal(stats.dispatched, POOL_SIZE + queued);
+	zassert_equal(stats.max_queued, queued);
+	zassert_equal(stats.max_busy, POOL_SIZE);
+}
+
+ZTEST_SUITE(nrf_rpc_thread_pool, NULL, thread_pool_setup, thread_pool_before, NULL, NULL);
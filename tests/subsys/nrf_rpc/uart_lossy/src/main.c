@@ -0,0 +1,434 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/serial/uart_emul.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/ring_buffer.h>
+
+#include <nrf_rpc/nrf_rpc_uart.h>
+
+#define UART_A DT_NODELABEL(euart0)
+#define UART_B DT_NODELABEL(euart1)
+#define UART_C DT_NODELABEL(euart2)
+
+#define HDLC_CHAR_ESCAPE    0x7d
+#define HDLC_CHAR_DELIMITER 0x7e
+
+#define FRAME_BUF_SIZE 320
+#define LINK_BUF_SIZE  4096
+
+#define PACKET_SIZE 64
+#define PACKET_CNT  60
+
+/* Time after which the sender gives up if no frame is acknowledged. */
+#define GIVE_UP_TIME K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME * \
+			    (CONFIG_NRF_RPC_UART_TX_ATTEMPTS + 2))
+
+/* One direction of the connection between two UARTs, which drops or corrupts some frames. */
+struct link {
+	const struct device *dst;
+	struct k_spinlock lock;
+	uint8_t frame[FRAME_BUF_SIZE];
+	size_t frame_len;
+	uint32_t frame_cnt;
+	/* Every drop_every-th frame is dropped, and every corrupt_every-th frame is corrupted. */
+	uint32_t drop_every;
+	uint32_t corrupt_every;
+	bool drop_all;
+	uint32_t dropped;
+	uint32_t corrupted;
+	struct ring_buf buf;
+	uint8_t buf_data[LINK_BUF_SIZE];
+	struct k_work work;
+};
+
+static struct link link_ab;
+static struct link link_ba;
+
+static uint32_t tx_id;
+
+/* Packets delivered to B. */
+static K_SEM_DEFINE(rx_sem, 0, K_SEM_MAX_LIMIT);
+static int64_t rx_last_id = -1;
+static uint32_t rx_errors;
+
+static bool is_special(uint8_t byte)
+{
+	return byte == HDLC_CHAR_DELIMITER || byte == HDLC_CHAR_ESCAPE;
+}
+
+/* Flip a bit of the frame, so that its CRC check fails but the frame boundaries are kept. */
+static void frame_corrupt(uint8_t *frame, size_t len)
+{
+	for (size_t i = len / 2; i < len - 1; i++) {
+		if (!is_special(frame[i]) && !is_special(frame[i] ^ 0x01)) {
+			frame[i] ^= 0x01;
+			return;
+		}
+	}
+}
+
+static void link_frame_end(struct link *link)
+{
+	link->frame_cnt++;
+
+	if (link->drop_all || (link->drop_every && (link->frame_cnt % link->drop_every) == 0)) {
+		link->dropped++;
+		return;
+	}
+
+	if (link->corrupt_every && (link->frame_cnt % link->corrupt_every) == 0) {
+		frame_corrupt(link->frame, link->frame_len);
+		link->corrupted++;
+	}
+
+	__ASSERT(ring_buf_space_get(&link->buf) >= link->frame_len, "Link buffer overflow");
+	ring_buf_put(&link->buf, link->frame, link->frame_len);
+}
+
+static void link_tx_data_ready(const struct device *dev, size_t size, void *user_data)
+{
+	struct link *link = user_data;
+	uint8_t chunk[64];
+	k_spinlock_key_t key;
+	uint32_t len;
+
+	ARG_UNUSED(size);
+
+	while ((len = uart_emul_get_tx_data(dev, chunk, sizeof(chunk))) > 0) {
+		key = k_spin_lock(&link->lock);
+
+		/* Every frame starts and ends with the delimiter. */
+		for (uint32_t i = 0; i < len; i++) {
+			__ASSERT(link->frame_len < sizeof(link->frame), "Frame too long");
+			link->frame[link->frame_len++] = chunk[i];
+
+			if (chunk[i] == HDLC_CHAR_DELIMITER && link->frame_len > 1) {
+				link_frame_end(link);
+				link->frame_len = 0;
+			}
+		}
+
+		k_spin_unlock(&link->lock, key);
+	}
+
+	k_work_submit(&link->work);
+}
+
+static void link_work_handler(struct k_work *work)
+{
+	struct link *link = CONTAINER_OF(work, struct link, work);
+	uint8_t chunk[256];
+	k_spinlock_key_t key;
+	uint32_t len;
+
+	while (true) {
+		key = k_spin_lock(&link->lock);
+		len = ring_buf_get(&link->buf, chunk, sizeof(chunk));
+		k_spin_unlock(&link->lock, key);
+
+		if (len == 0) {
+			break;
+		}
+
+		/* Data that does not fit in the RX FIFO would be lost, fail the test instead. */
+		if (uart_emul_put_rx_data(link->dst, chunk, len) != len) {
+			rx_errors++;
+		}
+	}
+}
+
+static void link_init(struct link *link, const struct device *src, const struct device *dst)
+{
+	link->dst = dst;
+	ring_buf_init(&link->buf, sizeof(link->buf_data), link->buf_data);
+	k_work_init(&link->work, link_work_handler);
+	uart_emul_callback_tx_data_ready_set(src, link_tx_data_ready, link);
+}
+
+static void link_reset(struct link *link)
+{
+	k_spinlock_key_t key = k_spin_lock(&link->lock);
+
+	link->frame_cnt = 0;
+	link->drop_every = 0;
+	link->corrupt_every = 0;
+	link->drop_all = false;
+	link->dropped = 0;
+	link->corrupted = 0;
+
+	k_spin_unlock(&link->lock, key);
+}
+
+static void receive_handler_a(const struct nrf_rpc_tr *transport, const uint8_t *packet,
+			      size_t len, void *context)
+{
+	/* Only acks are sent from B to A. */
+	rx_errors++;
+}
+
+static void receive_handler_b(const struct nrf_rpc_tr *transport, const uint8_t *packet,
+			      size_t len, void *context)
+{
+	uint32_t id = sys_get_le32(packet);
+
+	/* Packets must be delivered in order and without duplicates. */
+	if (len != PACKET_SIZE || (int64_t)id <= rx_last_id) {
+		rx_errors++;
+	}
+
+	rx_last_id = id;
+	k_sem_give(&rx_sem);
+}
+
+static int packet_send(void)
+{
+	const struct nrf_rpc_tr *tr = &NRF_RPC_UART_TRANSPORT(UART_A);
+	size_t size = PACKET_SIZE;
+	uint8_t *packet = tr->api->tx_buf_alloc(tr, &size);
+
+	zassert_equal(size, PACKET_SIZE);
+
+	/* Fill the packet with all byte values, including the ones that are escaped. */
+	for (size_t i = 0; i < size; i++) {
+		packet[i] = (uint8_t)(tx_id + i);
+	}
+
+	sys_put_le32(tx_id++, packet);
+
+	return tr->api->send(tr, packet, size);
+}
+
+static void expect_no_late_packets(void)
+{
+	/* Retransmissions of the delivered packets must not be delivered again. */
+	k_sleep(GIVE_UP_TIME);
+	zassert_equal(k_sem_count_get(&rx_sem), 0, "Packet delivered more than once");
+	zassert_equal(rx_errors, 0, "Packets duplicated or reordered");
+}
+
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+
+#define FRAME_FLAG_SYN BIT(0)
+
+/* Acks sent by C to the peer emulated by the test. */
+static K_SEM_DEFINE(c_ack_sem, 0, K_SEM_MAX_LIMIT);
+static uint8_t c_ack_frame[8];
+static size_t c_ack_len;
+static bool c_ack_escape;
+static uint8_t c_ack_seq;
+
+/* Packets delivered to C. */
+static K_SEM_DEFINE(c_rx_sem, 0, K_SEM_MAX_LIMIT);
+static uint32_t c_rx_id;
+
+static void c_ack_end(void)
+{
+	if (c_ack_len == 3 && sys_get_le16(&c_ack_frame[1]) == crc16_ccitt(0xffff, c_ack_frame, 1)) {
+		c_ack_seq = c_ack_frame[0];
+		k_sem_give(&c_ack_sem);
+	}
+
+	c_ack_len = 0;
+}
+
+static void c_tx_data_ready(const struct device *dev, size_t size, void *user_data)
+{
+	uint8_t byte;
+
+	ARG_UNUSED(size);
+	ARG_UNUSED(user_data);
+
+	while (uart_emul_get_tx_data(dev, &byte, 1) > 0) {
+		if (byte == HDLC_CHAR_DELIMITER) {
+			c_ack_end();
+		} else if (byte == HDLC_CHAR_ESCAPE) {
+			c_ack_escape = true;
+		} else if (c_ack_len < sizeof(c_ack_frame)) {
+			c_ack_frame[c_ack_len++] = c_ack_escape ? (byte ^ 0x20) : byte;
+			c_ack_escape = false;
+		}
+	}
+}
+
+static void receive_handler_c(const struct nrf_rpc_tr *transport, const uint8_t *packet,
+			      size_t len, void *context)
+{
+	c_rx_id = sys_get_le32(packet);
+	k_sem_give(&c_rx_sem);
+}
+
+static size_t hdlc_put(uint8_t *out, const uint8_t *data, size_t len)
+{
+	size_t out_len = 0;
+
+	for (size_t i = 0; i < len; i++) {
+		if (is_special(data[i])) {
+			out[out_len++] = HDLC_CHAR_ESCAPE;
+			out[out_len++] = data[i] ^ 0x20;
+		} else {
+			out[out_len++] = data[i];
+		}
+	}
+
+	return out_len;
+}
+
+/* Pass a frame to C as if it was sent by the peer transport. */
+static void c_frame_inject(uint8_t flags, uint8_t seq, uint32_t id)
+{
+	uint8_t packet[2 + sizeof(id) + sizeof(uint16_t)];
+	uint8_t frame[2 * sizeof(packet) + 2];
+	size_t len = 0;
+
+	packet[0] = flags;
+	packet[1] = seq;
+	sys_put_le32(id, &packet[2]);
+	sys_put_le16(crc16_ccitt(0xffff, packet, sizeof(packet) - sizeof(uint16_t)),
+		     &packet[sizeof(packet) - sizeof(uint16_t)]);
+
+	frame[len++] = HDLC_CHAR_DELIMITER;
+	len += hdlc_put(&frame[len], packet, sizeof(packet));
+	frame[len++] = HDLC_CHAR_DELIMITER;
+
+	zassert_equal(uart_emul_put_rx_data(DEVICE_DT_GET(UART_C), frame, len), len);
+}
+
+static void c_expect_ack(uint8_t seq)
+{
+	zassert_ok(k_sem_take(&c_ack_sem, K_MSEC(500)), "Packet %u not acked", seq);
+	zassert_equal(c_ack_seq, seq, "Wrong packet acked");
+}
+
+static void c_expect_no_ack(void)
+{
+	zassert_equal(k_sem_take(&c_ack_sem, K_MSEC(50)), -EAGAIN, "Unexpected ack");
+}
+
+static void c_expect(uint8_t flags, uint8_t seq, uint32_t id, bool delivered)
+{
+	c_frame_inject(flags, seq, id);
+
+	if (delivered) {
+		zassert_ok(k_sem_take(&c_rx_sem, K_MSEC(500)), "Packet %u not delivered", seq);
+		zassert_equal(c_rx_id, id, "Wrong packet delivered");
+		c_expect_ack(seq);
+	} else {
+		zassert_equal(k_sem_take(&c_rx_sem, K_MSEC(50)), -EAGAIN,
+			      "Packet %u delivered", seq);
+	}
+}
+
+#endif /* CONFIG_NRF_RPC_UART_RELIABLE_WINDOW */
+
+static void *setup(void)
+{
+	const struct nrf_rpc_tr *tr_a = &NRF_RPC_UART_TRANSPORT(UART_A);
+	const struct nrf_rpc_tr *tr_b = &NRF_RPC_UART_TRANSPORT(UART_B);
+
+	link_init(&link_ab, DEVICE_DT_GET(UART_A), DEVICE_DT_GET(UART_B));
+	link_init(&link_ba, DEVICE_DT_GET(UART_B), DEVICE_DT_GET(UART_A));
+
+	zassert_ok(tr_a->api->init(tr_a, receive_handler_a, NULL));
+	zassert_ok(tr_b->api->init(tr_b, receive_handler_b, NULL));
+
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+	const struct nrf_rpc_tr *tr_c = &NRF_RPC_UART_TRANSPORT(UART_C);
+
+	uart_emul_callback_tx_data_ready_set(DEVICE_DT_GET(UART_C), c_tx_data_ready, NULL);
+	zassert_ok(tr_c->api->init(tr_c, receive_handler_c, NULL));
+#endif
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	link_reset(&link_ab);
+	link_reset(&link_ba);
+	k_sem_reset(&rx_sem);
+	rx_errors = 0;
+}
+
+ZTEST(nrf_rpc_uart_lossy, test_lossy_link)
+{
+	link_ab.drop_every = 5;
+	link_ab.corrupt_every = 7;
+	link_ba.drop_every = 3;
+	link_ba.corrupt_every = 4;
+
+	/* The lost packets and acks are retransmitted until all packets are delivered. */
+	for (uint32_t i = 0; i < PACKET_CNT; i++) {
+		zassert_ok(packet_send(), "Failed to send packet %u", i);
+	}
+
+	for (uint32_t i = 0; i < PACKET_CNT; i++) {
+		zassert_ok(k_sem_take(&rx_sem, K_SECONDS(5)), "Packet %u not delivered", i);
+	}
+
+	zassert_equal(rx_last_id, tx_id - 1, "Last packet not delivered");
+	expect_no_late_packets();
+
+	zassert_true(link_ab.dropped > 0 && link_ab.corrupted > 0, "No packets lost");
+	zassert_true(link_ba.dropped > 0 && link_ba.corrupted > 0, "No acks lost");
+}
+
+ZTEST(nrf_rpc_uart_lossy, test_give_up)
+{
+	link_ab.drop_all = true;
+
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+	/* The packet is kept in the window, and its loss is reported by the following send. */
+	zassert_ok(packet_send());
+	k_sleep(GIVE_UP_TIME);
+#endif
+	zassert_equal(packet_send(), -EPROTO, "Packet loss not reported");
+	zassert_equal(link_ab.dropped, CONFIG_NRF_RPC_UART_TX_ATTEMPTS, "Wrong number of attempts");
+
+	/* The receiver resynchronizes on the next packet. */
+	link_ab.drop_all = false;
+	zassert_ok(packet_send());
+	zassert_ok(k_sem_take(&rx_sem, K_SECONDS(1)), "Packet not delivered");
+	zassert_equal(rx_last_id, tx_id - 1, "Dropped packet delivered");
+	expect_no_late_packets();
+}
+
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+ZTEST(nrf_rpc_uart_lossy, test_window_receiver)
+{
+	/* The frames are sent with the SYN flag until the peer receives the first ack. */
+	c_expect(FRAME_FLAG_SYN, 0, 100, true);
+	c_expect(FRAME_FLAG_SYN, 1, 101, true);
+	c_expect(0, 2, 102, true);
+
+	/* A retransmitted packet is not delivered again, but acknowledged, as the ack was lost. */
+	c_expect(0, 2, 102, false);
+	c_expect_ack(2);
+
+	/* A packet following a lost one is dropped without an ack, until the lost one comes. */
+	c_expect(0, 4, 104, false);
+	c_expect_no_ack();
+	c_expect(0, 3, 103, true);
+	c_expect(0, 4, 104, true);
+
+	/*
+	 * The peer is reset and starts from the sequence number 0, which would be taken for
+	 * a duplicate without the SYN flag.
+	 */
+	c_expect(FRAME_FLAG_SYN, 0, 200, true);
+	c_expect(FRAME_FLAG_SYN, 1, 201, true);
+	c_expect(FRAME_FLAG_SYN, 1, 201, false);
+	c_expect_ack(1);
+	c_expect(0, 2, 202, true);
+	c_expect_no_ack();
+}
+#endif
+
+ZTEST_SUITE(nrf_rpc_uart_lossy, NULL, setup, before, NULL, NULL);
@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/hash_function.h>
+
+#include <settings/settings_zms_legacy.h>
+
+#if DT_HAS_CHOSEN(zephyr_settings_partition)
+#define TEST_PARTITION DT_FIXED_PARTITION_ID(DT_CHOSEN(zephyr_settings_partition))
+#else
+#define TEST_PARTITION FIXED_PARTITION_ID(storage_partition)
+#endif
+
+#define TEST_SECTOR_COUNT 4
+#define SETTING_CNT	  8
+
+/* Size of the list links stored before the name in a hashed name entry. */
+#define NAME_LINKS_SIZE (2 * sizeof(uint32_t))
+
+/* Value larger than the static buffer used to move settings from the legacy layout. */
+#define LARGE_VALUE_SIZE (CONFIG_SETTINGS_ZMS_NAME_HASH_MIGRATION_VALUE_SIZE_MAX + 64)
+
+static struct settings_zms cf;
+static uint8_t large_value[LARGE_VALUE_SIZE];
+
+static const char *setting_name(uint8_t idx)
+{
+	static char name[SETTING_CNT][16];
+
+	snprintk(name[idx], sizeof(name[idx]), "test/%u", idx);
+
+	return name[idx];
+}
+
+static void backend_init(void)
+{
+	zassert_ok(settings_zms_backend_init(&cf), "Backend initialization failed");
+}
+
+static void setting_save(const char *name, uint8_t idx)
+{
+	zassert_ok(cf.cf_store.cs_itf->csi_save(&cf.cf_store, name, (const char *)&idx,
+						sizeof(idx)),
+		   "Saving %s failed", name);
+}
+
+static void setting_delete(const char *name)
+{
+	zassert_ok(cf.cf_store.cs_itf->csi_save(&cf.cf_store, name, NULL, 0),
+		   "Deleting %s failed", name);
+}
+
+static int load_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+		   void *param)
+{
+	uint32_t *mask = param;
+	uint8_t idx;
+
+	ARG_UNUSED(key);
+
+	if (len == sizeof(large_value)) {
+		static uint8_t value[LARGE_VALUE_SIZE];
+
+		zassert_equal(read_cb(cb_arg, value, len), len);
+		zassert_mem_equal(value, large_value, len, "Large value changed");
+		idx = value[0];
+	} else {
+		zassert_equal(len, sizeof(idx), "Unexpected value length %zu", len);
+		zassert_equal(read_cb(cb_arg, &idx, sizeof(idx)), sizeof(idx));
+	}
+
+	zassert_true(idx < 32, "Unexpected value %u", idx);
+	zassert_false(*mask & BIT(idx), "Setting %u loaded twice", idx);
+
+	*mask |= BIT(idx);
+
+	return 0;
+}
+
+static uint32_t settings_load_mask(const char *subtree)
+{
+	uint32_t mask = 0;
+	struct settings_load_arg arg = {
+		.subtree = subtree,
+		.cb = load_cb,
+		.param = &mask,
+	};
+
+	zassert_ok(cf.cf_store.cs_itf->csi_load(&cf.cf_store, &arg), "Loading failed");
+
+	return mask;
+}
+
+/* Find the hashed name ID of a stored setting. */
+static uint32_t name_id_get(const char *name)
+{
+	uint32_t name_hash = sys_hash32(name, strlen(name));
+	uint8_t entry[NAME_LINKS_SIZE + SETTINGS_FULL_NAME_LEN];
+	uint32_t name_id;
+	ssize_t len;
+
+	for (uint32_t collision = 0; collision <= cf.hash_collision_max; collision++) {
+		name_id = ZMS_HASH_NAME_ID(name_hash, collision);
+
+		len = zms_read(&cf.cf_zms, name_id, entry, sizeof(entry));
+		if ((len == NAME_LINKS_SIZE + strlen(name)) &&
+		    !memcmp(&entry[NAME_LINKS_SIZE], name, strlen(name))) {
+			return name_id;
+		}
+	}
+
+	zassert_unreachable("Setting %s not found", name);
+
+	return ZMS_NAMECNT_ID;
+}
+
+/* Store settings in the layout used without hashed name IDs. The setting with
+ * the index skip_idx is left out, and the value of the first setting is large.
+ */
+static void legacy_layout_write(uint8_t skip_idx)
+{
+	uint32_t last_name_id = ZMS_NAMECNT_ID + SETTING_CNT;
+
+	zassert_ok(zms_mount(&cf.cf_zms));
+
+	for (uint8_t i = 0; i < SETTING_CNT; i++) {
+		uint32_t name_id = ZMS_NAMECNT_ID + 1 + i;
+		const char *name = setting_name(i);
+
+		if (i == skip_idx) {
+			continue;
+		}
+
+		if (i == 0) {
+			zassert_true(zms_write(&cf.cf_zms, name_id + ZMS_NAME_ID_OFFSET,
+					       large_value, sizeof(large_value)) >= 0);
+		} else {
+			zassert_true(zms_write(&cf.cf_zms, name_id + ZMS_NAME_ID_OFFSET, &i,
+					       sizeof(i)) >= 0);
+		}
+
+		zassert_true(zms_write(&cf.cf_zms, name_id, name, strlen(name)) >= 0);
+	}
+
+	zassert_true(zms_write(&cf.cf_zms, ZMS_NAMECNT_ID, &last_name_id,
+			       sizeof(last_name_id)) >= 0);
+}
+
+static void legacy_layout_check_removed(void)
+{
+	uint32_t last_name_id;
+
+	zassert_equal(zms_read(&cf.cf_zms, ZMS_NAMECNT_ID, &last_name_id, sizeof(last_name_id)),
+		      -ENOENT, "Legacy name counter not removed");
+
+	for (uint32_t i = 1; i <= SETTING_CNT; i++) {
+		zassert_equal(zms_get_data_length(&cf.cf_zms, ZMS_NAMECNT_ID + i), -ENOENT,
+			      "Legacy name %u not removed", i);
+		zassert_equal(zms_get_data_length(&cf.cf_zms,
+						  ZMS_NAMECNT_ID + i + ZMS_NAME_ID_OFFSET),
+			      -ENOENT, "Legacy value %u not removed", i);
+	}
+}
+
+static void *setup(void)
+{
+	const struct flash_area *fa;
+	struct flash_sector sector;
+	uint32_t sector_cnt = 1;
+	int rc;
+
+	zassert_ok(flash_area_open(TEST_PARTITION, &fa));
+
+	rc = flash_area_get_sectors(TEST_PARTITION, &sector_cnt, &sector);
+	zassert_true((rc == 0) || (rc == -ENOMEM), "Getting sectors failed (%d)", rc);
+	zassert_true(fa->fa_size >= TEST_SECTOR_COUNT * sector.fs_size, "Partition too small");
+
+	cf.flash_dev = fa->fa_dev;
+	cf.cf_zms.flash_device = fa->fa_dev;
+	cf.cf_zms.offset = fa->fa_off;
+	cf.cf_zms.sector_size = sector.fs_size;
+	cf.cf_zms.sector_count = TEST_SECTOR_COUNT;
+
+	flash_area_close(fa);
+
+	/* Sets the settings interface of the backend. */
+	zassert_ok(settings_zms_src(&cf));
+
+	for (size_t i = 0; i < sizeof(large_value); i++) {
+		large_value[i] = i;
+	}
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	const struct flash_area *fa;
+
+	ARG_UNUSED(fixture);
+
+	zassert_ok(flash_area_open(TEST_PARTITION, &fa));
+	zassert_ok(flash_area_erase(fa, 0, TEST_SECTOR_COUNT * cf.cf_zms.sector_size));
+	flash_area_close(fa);
+}
+
+ZTEST(settings_zms_legacy, test_save_load)
+{
+	backend_init();
+
+	for (uint8_t i = 0; i < SETTING_CNT; i++) {
+		setting_save(setting_name(i), i);
+	}
+
+	zassert_equal(settings_load_mask(NULL), BIT_MASK(SETTING_CNT));
+
+	/* Overwriting a setting does not add it to the list again. */
+	setting_save(setting_name(3), 3);
+	setting_delete(setting_name(0));
+	setting_delete(setting_name(5));
+	setting_delete(setting_name(SETTING_CNT - 1));
+
+	zassert_equal(settings_load_mask(NULL),
+		      BIT_MASK(SETTING_CNT) & ~(BIT(0) | BIT(5) | BIT(SETTING_CNT - 1)));
+
+	/* Settings are found after reinitialization. */
+	backend_init();
+	setting_save(setting_name(5), 5);
+
+	zassert_equal(settings_load_mask(NULL),
+		      BIT_MASK(SETTING_CNT) & ~(BIT(0) | BIT(SETTING_CNT - 1)));
+
+	for (uint8_t i = 0; i < SETTING_CNT; i++) {
+		setting_delete(setting_name(i));
+	}
+
+	zassert_equal(settings_load_mask(NULL), 0);
+}
+
+ZTEST(settings_zms_legacy, test_subtree_load)
+{
+	backend_init();
+
+	setting_save("test/sub", 0);
+	setting_save("test/sub/a", 1);
+	setting_save("test/sub/b/c", 2);
+	setting_save("test/subtree", 3);
+	setting_save("test/other", 4);
+	setting_save("other/sub", 5);
+
+	zassert_equal(settings_load_mask("test/sub"), BIT(0) | BIT(1) | BIT(2));
+	zassert_equal(settings_load_mask("test/sub/b"), BIT(2));
+	zassert_equal(settings_load_mask("test"), BIT_MASK(5));
+	zassert_equal(settings_load_mask("none"), 0);
+	zassert_equal(settings_load_mask(NULL), BIT_MASK(6));
+}
+
+ZTEST(settings_zms_legacy, test_migration)
+{
+	legacy_layout_write(4);
+	backend_init();
+
+	legacy_layout_check_removed();
+
+	zassert_equal(settings_load_mask(NULL), BIT_MASK(SETTING_CNT) & ~BIT(4));
+
+	/* Migrated settings are found when saved. */
+	setting_save(setting_name(1), 1);
+	setting_delete(setting_name(2));
+
+	zassert_equal(settings_load_mask(NULL), BIT_MASK(SETTING_CNT) & ~(BIT(2) | BIT(4)));
+}
+
+ZTEST(settings_zms_legacy, test_migration_resume)
+{
+	backend_init();
+
+	/* Settings moved to hashed IDs before the migration was interrupted. */
+	for (uint8_t i = SETTING_CNT / 2; i < SETTING_CNT; i++) {
+		setting_save(setting_name(i), i);
+	}
+
+	legacy_layout_write(UINT8_MAX);
+	backend_init();
+
+	legacy_layout_check_removed();
+
+	zassert_equal(settings_load_mask(NULL), BIT_MASK(SETTING_CNT));
+}
+
+ZTEST(settings_zms_legacy, test_insert_interrupted)
+{
+	uint32_t name_id;
+
+	backend_init();
+
+	for (uint8_t i = 0; i < SETTING_CNT - 1; i++) {
+		setting_save(setting_name(i), i);
+	}
+
+	/* The head of the list is updated, but the name of the inserted setting
+	 * is not written.
+	 */
+	setting_save(setting_name(SETTING_CNT - 1), SETTING_CNT - 1);
+	name_id = name_id_get(setting_name(SETTING_CNT - 1));
+	zassert_ok(zms_delete(&cf.cf_zms, name_id));
+
+	zassert_equal(settings_load_mask(NULL), BIT_MASK(SETTING_CNT - 1));
+
+	/* The list is repaired by the first load. */
+	zassert_equal(settings_load_mask(NULL), BIT_MASK(SETTING_CNT - 1));
+
+	setting_save(setting_name(SETTING_CNT - 1), SETTING_CNT - 1);
+	zassert_equal(settings_load_mask(NULL), BIT_MASK(SETTING_CNT));
+}
+
+ZTEST(settings_zms_legacy, test_delete_interrupted)
+{
+	uint32_t name_id;
+
+	backend_init();
+
+	for (uint8_t i = 0; i < SETTING_CNT; i++) {
+		setting_save(setting_name(i), i);
+	}
+
+	/* The name of the deleted setting is removed, but its neighbours are not
+	 * relinked.
+	 */
+	name_id = name_id_get(setting_name(3));
+	zassert_ok(zms_delete(&cf.cf_zms, name_id));
+
+	zassert_equal(settings_load_mask(NULL), BIT_MASK(SETTING_CNT) & ~BIT(3));
+
+	/* Deleting another setting after the list is repaired. */
+	setting_delete(setting_name(4));
+	zassert_equal(settings_load_mask(NULL), BIT_MASK(SETTING_CNT) & ~(BIT(3) | BIT(4)));
+
+	setting_save(setting_name(3), 3);
+	zassert_equal(settings_load_mask(NULL), BIT_MASK(SETTING_CNT) & ~BIT(4));
+}
+
+ZTEST_SUITE(settings_zms_legacy, NULL, setup, before, NULL, NULL);
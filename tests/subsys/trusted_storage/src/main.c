@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/hash_function.h>
+#include <psa/crypto.h>
+#include <psa/internal_trusted_storage.h>
+
+#include "storage_backend.h"
+
+#define ITS_PREFIX CONFIG_PSA_INTERNAL_TRUSTED_STORAGE_PREFIX
+
+/* UIDs whose ZMS IDs are derived from the same hash, so they are stored in the collision slots. */
+#define UID_COLLIDING_1 0x40063
+#define UID_COLLIDING_2 0x412f3
+#define UID_OTHER	0x50000
+
+#define ZMS_OBJECT_MASK BIT_MASK(30 - CONFIG_TRUSTED_STORAGE_STORAGE_BACKEND_ZMS_COLLISION_BITS)
+
+/* Layout of the objects stored by the AEAD backend: header, nonce and encrypted data with tag. */
+struct stored_object_header {
+	psa_storage_create_flags_t create_flags;
+	size_t data_size;
+};
+
+#define AEAD_NONCE_OFFSET sizeof(struct stored_object_header)
+#define AEAD_NONCE_SIZE	  12
+#define AEAD_DATA_OFFSET  (AEAD_NONCE_OFFSET + AEAD_NONCE_SIZE)
+
+#define ASSET_SIZE 32
+#define NONCE_CNT  16
+
+static uint8_t asset_1[ASSET_SIZE];
+static uint8_t asset_2[ASSET_SIZE];
+static uint8_t asset_read[ASSET_SIZE];
+static uint8_t object[512];
+static uint8_t object_tampered[512];
+
+/* Hash of the tag the ZMS backend derives the object ID from: the UID followed by the prefix. */
+static uint32_t tag_hash(psa_storage_uid_t uid)
+{
+	uint8_t tag[sizeof(uid) + sizeof(ITS_PREFIX) - 1];
+
+	memcpy(tag, &uid, sizeof(uid));
+	memcpy(&tag[sizeof(uid)], ITS_PREFIX, sizeof(ITS_PREFIX) - 1);
+
+	return sys_hash32(tag, sizeof(tag));
+}
+
+static void expect_asset(psa_storage_uid_t uid, const uint8_t *asset)
+{
+	size_t len;
+
+	zassert_equal(psa_its_get(uid, 0, sizeof(asset_read), asset_read, &len), PSA_SUCCESS,
+		      "Failed to get asset %llx", (unsigned long long)uid);
+	zassert_equal(len, ASSET_SIZE);
+	zassert_mem_equal(asset_read, asset, ASSET_SIZE, "Invalid asset %llx",
+			  (unsigned long long)uid);
+}
+
+static void expect_no_asset(psa_storage_uid_t uid)
+{
+	size_t len;
+
+	zassert_equal(psa_its_get(uid, 0, sizeof(asset_read), asset_read, &len),
+		      PSA_ERROR_DOES_NOT_EXIST, "Asset %llx not removed", (unsigned long long)uid);
+}
+
+static size_t object_get(psa_storage_uid_t uid, uint8_t *buf)
+{
+	size_t len;
+
+	zassert_equal(storage_get_object(uid, ITS_PREFIX, buf, sizeof(object), &len), PSA_SUCCESS);
+	zassert_true(len > AEAD_DATA_OFFSET, "Stored object too short");
+
+	return len;
+}
+
+static void *setup(void)
+{
+	zassert_equal(psa_crypto_init(), PSA_SUCCESS);
+
+	memset(asset_1, 0x11, sizeof(asset_1));
+	memset(asset_2, 0x22, sizeof(asset_2));
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	psa_its_remove(UID_COLLIDING_1);
+	psa_its_remove(UID_COLLIDING_2);
+	psa_its_remove(UID_OTHER);
+}
+
+ZTEST(trusted_storage, test_hash_collision)
+{
+	zassert_equal(tag_hash(UID_COLLIDING_1) & ZMS_OBJECT_MASK,
+		      tag_hash(UID_COLLIDING_2) & ZMS_OBJECT_MASK,
+		      "UIDs do not collide, find new ones for the hash function");
+
+	zassert_equal(psa_its_set(UID_COLLIDING_1, ASSET_SIZE, asset_1, PSA_STORAGE_FLAG_NONE),
+		      PSA_SUCCESS);
+	zassert_equal(psa_its_set(UID_COLLIDING_2, ASSET_SIZE, asset_2, PSA_STORAGE_FLAG_NONE),
+		      PSA_SUCCESS);
+	expect_asset(UID_COLLIDING_1, asset_1);
+	expect_asset(UID_COLLIDING_2, asset_2);
+
+	/* Removing the asset from the first slot keeps the one in the following slot. */
+	zassert_equal(psa_its_remove(UID_COLLIDING_1), PSA_SUCCESS);
+	expect_no_asset(UID_COLLIDING_1);
+	expect_asset(UID_COLLIDING_2, asset_2);
+
+	/* The free slot is reused, and the asset is not duplicated. */
+	zassert_equal(psa_its_set(UID_COLLIDING_1, ASSET_SIZE, asset_2, PSA_STORAGE_FLAG_NONE),
+		      PSA_SUCCESS);
+	zassert_equal(psa_its_set(UID_COLLIDING_2, ASSET_SIZE, asset_1, PSA_STORAGE_FLAG_NONE),
+		      PSA_SUCCESS);
+	expect_asset(UID_COLLIDING_1, asset_2);
+	expect_asset(UID_COLLIDING_2, asset_1);
+
+	zassert_equal(psa_its_remove(UID_COLLIDING_2), PSA_SUCCESS);
+	expect_no_asset(UID_COLLIDING_2);
+	expect_asset(UID_COLLIDING_1, asset_2);
+}
+
+ZTEST(trusted_storage, test_tampered_object)
+{
+	/* The cached asset is returned without reading the storage. */
+	Z_TEST_SKIP_IFDEF(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE);
+
+	size_t offsets[3];
+	size_t read_len;
+	size_t len;
+
+	zassert_equal(psa_its_set(UID_OTHER, ASSET_SIZE, asset_1, PSA_STORAGE_FLAG_NONE),
+		      PSA_SUCCESS);
+	len = object_get(UID_OTHER, object);
+
+	/* The data size in the header, authenticated as additional data, the ciphertext and the tag. */
+	offsets[0] = offsetof(struct stored_object_header, data_size);
+	offsets[1] = AEAD_DATA_OFFSET;
+	offsets[2] = len - 1;
+
+	for (size_t i = 0; i < ARRAY_SIZE(offsets); i++) {
+		memcpy(object_tampered, object, len);
+		object_tampered[offsets[i]] ^= 0x01;
+
+		zassert_equal(storage_set_object(UID_OTHER, ITS_PREFIX, object_tampered, len),
+			      PSA_SUCCESS);
+		zassert_equal(psa_its_get(UID_OTHER, 0, sizeof(asset_read), asset_read, &read_len),
+			      PSA_ERROR_INVALID_SIGNATURE, "Tampered byte %zu not detected",
+			      offsets[i]);
+
+		zassert_equal(storage_set_object(UID_OTHER, ITS_PREFIX, object, len), PSA_SUCCESS);
+		expect_asset(UID_OTHER, asset_1);
+	}
+}
+
+ZTEST(trusted_storage, test_overwrite_nonce)
+{
+	static uint8_t nonces[NONCE_CNT][AEAD_NONCE_SIZE];
+	psa_storage_uid_t uid;
+
+	/* The same asset is written again, also under another UID sharing the storage slots. */
+	for (size_t i = 0; i < NONCE_CNT; i++) {
+		uid = (i % 2) ? UID_COLLIDING_2 : UID_COLLIDING_1;
+
+		zassert_equal(psa_its_set(uid, ASSET_SIZE, asset_1, PSA_STORAGE_FLAG_NONE),
+			      PSA_SUCCESS);
+		object_get(uid, object);
+		memcpy(nonces[i], &object[AEAD_NONCE_OFFSET], AEAD_NONCE_SIZE);
+
+		for (size_t j = 0; j < i; j++) {
+			zassert_true(memcmp(nonces[i], nonces[j], AEAD_NONCE_SIZE) != 0,
+				     "Nonce of write %zu reused by write %zu", j, i);
+		}
+	}
+
+	expect_asset(UID_COLLIDING_1, asset_1);
+	expect_asset(UID_COLLIDING_2, asset_1);
+}
+
+ZTEST_SUITE(trusted_storage, NULL, setup, before, NULL, NULL);